@@ -15,3 +15,11 @@
 
 #define JEMU_VERSION_STRING \
     "@JEMU_VERSION_MAJOR@.@JEMU_VERSION_MINOR@.@JEMU_VERSION_REL@"
+
+/* Set to 1 when the host provides threads for the multi-instance runners. */
+#define JEMU_THREADS_ENABLED @JEMU_THREADS_ENABLED@
+
+/* Set to 1 to build the execution profiler into the core. */
+#ifndef JEMU_PROFILE_ENABLED
+#define JEMU_PROFILE_ENABLED @JEMU_PROFILE_ENABLED@
+#endif
@@ -0,0 +1,265 @@
+/**
+ * \file fuzz_jemu65c02.c
+ *
+ * \brief A libFuzzer target that fuzzes guest firmware in persistent mode.
+ *
+ * The firmware is booted once, when the fuzzer starts, and each input is run
+ * from a snapshot of the booted instance. Guest edge coverage is counted in a
+ * libFuzzer extra counters map, so the fuzzer is guided by the firmware as
+ * well as by the emulator. An invalid opcode, a watchpoint hit, or a sanitizer
+ * violation aborts, which libFuzzer reports as a crash.
+ *
+ * The target is configured through the environment:
+ *      - JEMU_FUZZ_FIRMWARE: the path of the firmware image (required).
+ *      - JEMU_FUZZ_LOAD: the hex load address of the image; by default, the
+ *        image ends at $FFFF.
+ *      - JEMU_FUZZ_BOOT: the cycles run after reset, before the snapshot.
+ *      - JEMU_FUZZ_DEVICE: the hex address of an input device; if it is not
+ *        set, inputs are written to memory instead.
+ *      - JEMU_FUZZ_INPUT: the hex address of the input buffer ($0200).
+ *      - JEMU_FUZZ_INPUT_SIZE: the size of the input buffer (256).
+ *      - JEMU_FUZZ_LENGTH: the hex address to which the input length is
+ *        written, if any.
+ *      - JEMU_FUZZ_CYCLES: the cycle cap of each input (100000).
+ *      - JEMU_FUZZ_WATCH: comma separated hex addresses that crash when they
+ *        are written.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <jemu65c02/coverage.h>
+#include <jemu65c02/debug.h>
+#include <jemu65c02/fuzz.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_coverage;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_fuzz;
+
+int LLVMFuzzerInitialize(int* argc, char*** argv);
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+/* libFuzzer reads this section as extra coverage counters. */
+__attribute__((section("__libfuzzer_extra_counters")))
+static uint8_t coverage[JEMU_COVERAGE_MAP_SIZE];
+
+static uint8_t memory[65536];
+static j65c02* inst;
+static j65c02_fuzz* fuzz;
+
+/**
+ * \brief Read a numeric setting from the environment.
+ */
+static unsigned long setting_get(
+    const char* name, int base, unsigned long default_value)
+{
+    const char* value = getenv(name);
+
+    return NULL == value ? default_value : strtoul(value, NULL, base);
+}
+
+/**
+ * \brief Fail the fuzzer with a message.
+ */
+static void fail(const char* message, status retval)
+{
+    fprintf(stderr, "fuzz_jemu65c02: %s (0x%08x)\n", message, retval);
+    exit(1);
+}
+
+/**
+ * \brief The bus read callback.
+ */
+static status mem_read(void* context, uint16_t addr, uint8_t* val)
+{
+    (void)context;
+
+    *val = memory[addr];
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief The bus write callback.
+ */
+static status mem_write(void* context, uint16_t addr, uint8_t val)
+{
+    (void)context;
+
+    memory[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Load the firmware image into memory.
+ */
+static void firmware_load(void)
+{
+    const char* path = getenv("JEMU_FUZZ_FIRMWARE");
+    FILE* file;
+    size_t size;
+    unsigned long load;
+
+    if (NULL == path)
+    {
+        fail("JEMU_FUZZ_FIRMWARE is not set", 0);
+    }
+
+    file = fopen(path, "rb");
+    if (NULL == file)
+    {
+        fail("the firmware image can't be opened", 0);
+    }
+
+    /* read the image to the end of memory, then move it into place. */
+    size = fread(memory, 1, sizeof(memory), file);
+    fclose(file);
+
+    load = setting_get("JEMU_FUZZ_LOAD", 16, 65536 - size);
+    if (load + size > sizeof(memory))
+    {
+        fail("the firmware image does not fit at its load address", 0);
+    }
+
+    memmove(memory + load, memory, size);
+    memset(memory, 0, load);
+}
+
+/**
+ * \brief Boot the firmware, and snapshot it for the fuzzer.
+ */
+int LLVMFuzzerInitialize(int* argc, char*** argv)
+{
+    status retval;
+    j65c02_fuzz_options options;
+    const char* watch;
+
+    (void)argc;
+    (void)argv;
+
+    firmware_load();
+
+    retval =
+        j65c02_create(
+            &inst, &mem_read, &mem_write, NULL, JEMU_65c02_PERSONALITY_WDC,
+            JEMU_65c02_EMULATION_MODE_STRICT);
+    if (STATUS_SUCCESS != retval)
+    {
+        fail("the instance can't be created", retval);
+    }
+
+    retval = j65c02_memory_region_add(inst, 0, memory, sizeof(memory));
+    if (STATUS_SUCCESS != retval)
+    {
+        fail("the memory region can't be added", retval);
+    }
+
+    retval = j65c02_reset(inst);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = j65c02_run(inst, (int)setting_get("JEMU_FUZZ_BOOT", 10, 0));
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        fail("the firmware does not boot", retval);
+    }
+
+    /* set the watchpoints before the harness interposes on the bus. */
+    watch = getenv("JEMU_FUZZ_WATCH");
+    if (NULL != watch)
+    {
+        retval = j65c02_debug_enable(inst, true);
+        while (STATUS_SUCCESS == retval && '\0' != *watch)
+        {
+            char* end;
+            unsigned long addr = strtoul(watch, &end, 16);
+
+            retval =
+                j65c02_breakpoint_set(
+                    inst, (uint16_t)addr, JEMU_BREAKPOINT_WRITE);
+            watch = ',' == *end ? end + 1 : end + strlen(end);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            fail("the watchpoints can't be set", retval);
+        }
+    }
+
+    memset(&options, 0, sizeof(options));
+    options.input_mode = JEMU_FUZZ_INPUT_MEMORY;
+    options.input_addr = setting_get("JEMU_FUZZ_INPUT", 16, 0x0200);
+    options.input_capacity = setting_get("JEMU_FUZZ_INPUT_SIZE", 10, 256);
+    options.cycle_cap = (int)setting_get("JEMU_FUZZ_CYCLES", 10, 100000);
+
+    if (NULL != getenv("JEMU_FUZZ_DEVICE"))
+    {
+        options.input_mode = JEMU_FUZZ_INPUT_DEVICE;
+        options.input_addr = setting_get("JEMU_FUZZ_DEVICE", 16, 0);
+    }
+
+    if (NULL != getenv("JEMU_FUZZ_LENGTH"))
+    {
+        options.length_enabled = true;
+        options.length_addr = setting_get("JEMU_FUZZ_LENGTH", 16, 0);
+    }
+
+    retval = j65c02_fuzz_create(&fuzz, inst, &options);
+    if (STATUS_SUCCESS != retval)
+    {
+        fail("the harness can't be created", retval);
+    }
+
+    retval = j65c02_coverage_attach(inst, coverage);
+    if (STATUS_SUCCESS != retval)
+    {
+        fail("the coverage map can't be attached", retval);
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Run one input from the booted snapshot.
+ */
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    status retval;
+    int result;
+
+    retval = j65c02_fuzz_run(fuzz, data, size, &result);
+    if (STATUS_SUCCESS != retval)
+    {
+        fail("the input can't be run", retval);
+    }
+
+    switch (result)
+    {
+        case JEMU_FUZZ_RESULT_INVALID_OPCODE:
+            fprintf(
+                stderr, "fuzz_jemu65c02: invalid opcode at $%04x\n",
+                j65c02_reg_pc_get(inst));
+            abort();
+
+        case JEMU_FUZZ_RESULT_BREAKPOINT:
+            fprintf(
+                stderr, "fuzz_jemu65c02: watchpoint hit at $%04x\n",
+                j65c02_reg_pc_get(inst));
+            abort();
+
+        case JEMU_FUZZ_RESULT_SANITIZER:
+            fprintf(
+                stderr, "fuzz_jemu65c02: sanitizer violation at $%04x\n",
+                j65c02_reg_pc_get(inst));
+            abort();
+
+        default:
+            return 0;
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * \file jemu65c02/batch.h
+ *
+ * \brief Lockstep batch engine for jemu65c02.
+ *
+ * A batch runs up to JEMU_BATCH_MAX_LANES instances that execute the same
+ * program image but differ in their inputs. The registers of every instance
+ * are held in structure-of-arrays form, one lane per instance. Lanes that
+ * agree on the program counter execute register-only instructions together in
+ * a single pass over the lanes. Lanes that diverge, or that execute an
+ * instruction that touches the bus, fall back to scalar execution on their
+ * own instance. An instance with hooks, custom opcodes, the sanitizer,
+ * debugging, instrumentation, native routines, a peripheral, or copy and fill
+ * loops is run by \ref j65c02_run instead of in the batch.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The maximum number of lanes in a batch.
+ */
+#define JEMU_BATCH_MAX_LANES                                        32
+
+/**
+ * \brief A lockstep batch of instances.
+ */
+typedef struct JEMU_SYM(j65c02_batch) JEMU_SYM(j65c02_batch);
+
+/**
+ * \brief Statistics for a single batch run.
+ */
+typedef struct JEMU_SYM(j65c02_batch_stats) JEMU_SYM(j65c02_batch_stats);
+
+struct JEMU_SYM(j65c02_batch_stats)
+{
+    /** \brief Lane instructions executed in lockstep. */
+    uint64_t lockstep_instructions;
+    /** \brief Lane instructions executed by scalar fallback. */
+    uint64_t scalar_instructions;
+};
+
+/**
+ * \brief Create a lockstep batch over a set of instances.
+ *
+ * \note On success, the caller is given ownership of the batch and must release
+ * it by calling \ref j65c02_batch_release when it is no longer needed. The
+ * instances remain owned by the caller and must outlive the batch.
+ *
+ * \note Opcodes and operands of lockstep instructions are fetched once, through
+ * the first lane at a given program counter, so every instance in the batch
+ * must present the same code at the addresses it executes.
+ *
+ * \param batch             Pointer to the batch pointer to set to the created
+ *                          batch on success.
+ * \param insts             The instances in this batch, one per lane.
+ * \param count             The number of instances, up to
+ *                          JEMU_BATCH_MAX_LANES.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_batch_create)(
+    JEMU_SYM(j65c02_batch)** batch, JEMU_SYM(j65c02)** insts, size_t count);
+
+/**
+ * \brief Run every lane of a batch for the given number of cycles.
+ *
+ * \note Each lane ends in the same state, with the same cycle delta and cycle
+ * count, as if its instance had been run by \ref j65c02_run for this many
+ * cycles.
+ *
+ * \param batch             The batch to run.
+ * \param cycles            The number of cycles to run each lane.
+ * \param results           Set to the status of each lane, as would be
+ *                          returned by \ref j65c02_run.
+ * \param stats             Optional pointer set to the statistics for this
+ *                          run; may be NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if the batch ran, even if individual lanes failed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_batch_run)(
+    JEMU_SYM(j65c02_batch)* batch, int cycles, JEMU_SYM(status)* results,
+    JEMU_SYM(j65c02_batch_stats)* stats);
+
+/**
+ * \brief Release a lockstep batch.
+ *
+ * \note After this call, the batch pointer is no longer valid. The instances in
+ * this batch are not released.
+ *
+ * \param batch             The batch to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_batch_release)(JEMU_SYM(j65c02_batch)* batch);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_batch_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_batch) sym ## j65c02_batch; \
+    typedef JEMU_SYM(j65c02_batch_stats) sym ## j65c02_batch_stats; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_batch_create( \
+        JEMU_SYM(j65c02_batch)** x, JEMU_SYM(j65c02)** y, size_t z) { \
+            return JEMU_SYM(j65c02_batch_create)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_batch_run( \
+        JEMU_SYM(j65c02_batch)* w, int x, JEMU_SYM(status)* y, \
+        JEMU_SYM(j65c02_batch_stats)* z) { \
+            return JEMU_SYM(j65c02_batch_run)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_batch_release(JEMU_SYM(j65c02_batch)* x) { \
+            return JEMU_SYM(j65c02_batch_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_batch_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_batch_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_batch \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_batch_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,90 @@
+/**
+ * \file jemu65c02/coverage.h
+ *
+ * \brief Edge coverage for jemu65c02.
+ *
+ * An instance with a coverage map counts each control transfer it makes, in the
+ * style of AFL. The edge from the address of a branch, jump, call, return,
+ * BRK, or interrupted instruction to the address it transfers to is hashed to
+ * a byte of the map, and that byte is incremented, wrapping at 256. The map is
+ * owned by the caller, so it can live in memory shared with a fuzzer.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The size of a coverage map, in bytes.
+ */
+#define JEMU_COVERAGE_MAP_SIZE                                      65536
+
+/**
+ * \brief Attach a coverage map to an instance, or detach it.
+ *
+ * \note The map must hold JEMU_COVERAGE_MAP_SIZE bytes, and must outlive its
+ * attachment. It is not cleared by this call. Edges are counted by
+ * \ref j65c02_run, \ref j65c02_step, history runs, and interrupts. A batch
+ * runs an instance with a map attached by \ref j65c02_run.
+ *
+ * \param inst              The instance for this operation.
+ * \param map               The coverage map, or NULL to detach the map.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_coverage_attach)(JEMU_SYM(j65c02)* inst, uint8_t* map);
+
+/**
+ * \brief Get the index in a coverage map of an edge.
+ *
+ * \note Each address is scrambled by an odd multiplier, and the source is
+ * shifted so that the edges A to B and B to A count separately.
+ *
+ * \param from              The address of the instruction transferring
+ *                          control.
+ * \param to                The address it transfers to.
+ *
+ * \returns the index of this edge.
+ */
+static inline uint16_t JEMU_SYM(j65c02_coverage_index)(
+    uint16_t from, uint16_t to)
+{
+    uint16_t from_hash = (uint16_t)(from * 0x9E37u);
+    uint16_t to_hash = (uint16_t)(to * 0x9E37u);
+
+    return (uint16_t)((from_hash >> 1) ^ to_hash);
+}
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_coverage_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_coverage_attach(JEMU_SYM(j65c02)* x, uint8_t* y) { \
+            return JEMU_SYM(j65c02_coverage_attach)(x,y); } \
+    static inline uint16_t \
+    sym ## j65c02_coverage_index(uint16_t x, uint16_t y) { \
+            return JEMU_SYM(j65c02_coverage_index)(x,y); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_coverage_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_coverage_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_coverage \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_coverage_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,191 @@
+/**
+ * \file jemu65c02/debug.h
+ *
+ * \brief Breakpoints and watchpoints for jemu65c02.
+ *
+ * An instance with debugging enabled holds a bitmap per kind of breakpoint,
+ * with one bit per guest address, and a count of the breakpoints set in each
+ * page. \ref j65c02_run checks the count of the current page before each
+ * instruction, and only looks at the bitmap when the page has an execution
+ * breakpoint, so it runs at full speed until it reaches one. Read and write
+ * watchpoints are checked by interposing on the bus of the instance once the
+ * first of them is set.
+ *
+ * A run stops with JEMU_ERROR_BREAKPOINT before an instruction at an
+ * execution breakpoint, or after an instruction that touched a watched
+ * address. The hit can then be read back, and the next run resumes from where
+ * this one stopped, with the cycles it did not spend.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The kinds of breakpoint, which can be combined.
+ */
+#define JEMU_BREAKPOINT_EXEC                                        0x01
+#define JEMU_BREAKPOINT_READ                                        0x02
+#define JEMU_BREAKPOINT_WRITE                                       0x04
+
+/**
+ * \brief A breakpoint hit.
+ */
+typedef struct JEMU_SYM(j65c02_breakpoint_hit)
+JEMU_SYM(j65c02_breakpoint_hit);
+
+struct JEMU_SYM(j65c02_breakpoint_hit)
+{
+    /** \brief The JEMU_BREAKPOINT_* kind of breakpoint that fired. */
+    int kind;
+    /** \brief The address of the breakpoint. */
+    uint16_t addr;
+    /** \brief The address of the instruction that hit it. */
+    uint16_t pc;
+    /** \brief The value read or written, for a watchpoint. */
+    uint8_t value;
+    /** \brief The cycle count when it fired. */
+    uint64_t cycle_count;
+};
+
+/**
+ * \brief Enable or disable debugging on an instance.
+ *
+ * \note The bitmaps are allocated by this call and freed when the instance is
+ * released. Disabling debugging clears every breakpoint and condition. Once a
+ * watchpoint is set, debugging interposes on the bus of this instance, so any
+ * other bus interposer created after that must be released before debugging
+ * is disabled.
+ *
+ * \param inst              The instance for this operation.
+ * \param enable            true to enable debugging, or false to disable it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_debug_enable)(JEMU_SYM(j65c02)* inst, bool enable);
+
+/**
+ * \brief Set breakpoints at an address.
+ *
+ * \note Read watchpoints fire on every bus read of the address, including
+ * instruction fetches and stack pulls.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address to break at.
+ * \param kinds             The JEMU_BREAKPOINT_* kinds to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DEBUG_DISABLED if debugging is not enabled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_breakpoint_set)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, int kinds);
+
+/**
+ * \brief Clear breakpoints at an address.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address to clear.
+ * \param kinds             The JEMU_BREAKPOINT_* kinds to clear.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DEBUG_DISABLED if debugging is not enabled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_breakpoint_clear)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, int kinds);
+
+/**
+ * \brief Set the condition on the breakpoints at an address.
+ *
+ * \note A condition is an expression in C syntax over the registers A, X, Y,
+ * SP, P, and PC, the flags N, V, D, I, Z, and C, CYCLES, and memory as
+ * mem[addr]. The operators are the unary ! - ~, and the binary * / % + - << >>
+ * < <= > >= == != & ^ | && ||, with the precedence they have in C. Values are
+ * signed 64-bit integers whose arithmetic wraps around, and a division or
+ * remainder by zero gives zero. Numbers are decimal, or hex with a '$' or "0x"
+ * prefix, or binary with a '%' prefix. The condition is compiled into bytecode
+ * by this call, and the breakpoints at this address only fire when it is
+ * non-zero. Parentheses, memory references, and unary operators nest at most
+ * 32 deep. PC is the address of the instruction that hit the breakpoint, and
+ * memory is read through the bus of the instance, beneath its watchpoints.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address of the breakpoints.
+ * \param condition         The condition, or NULL to remove it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DEBUG_DISABLED if debugging is not enabled.
+ *      - JEMU_ERROR_BREAKPOINT_BAD_CONDITION if the condition does not
+ *        compile; the previous condition is kept.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_breakpoint_condition_set)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, const char* condition);
+
+/**
+ * \brief Get the breakpoint hit that last stopped a run or step.
+ *
+ * \param inst              The instance to query.
+ * \param hit               Set to the last hit.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DEBUG_DISABLED if debugging is not enabled.
+ *      - JEMU_ERROR_BREAKPOINT_NO_HIT if no breakpoint has fired.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_breakpoint_hit_get)(
+    const JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_breakpoint_hit)* hit);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_debug_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_breakpoint_hit) sym ## j65c02_breakpoint_hit; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_debug_enable(JEMU_SYM(j65c02)* x, bool y) { \
+            return JEMU_SYM(j65c02_debug_enable)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_breakpoint_set( \
+        JEMU_SYM(j65c02)* x, uint16_t y, int z) { \
+            return JEMU_SYM(j65c02_breakpoint_set)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_breakpoint_clear( \
+        JEMU_SYM(j65c02)* x, uint16_t y, int z) { \
+            return JEMU_SYM(j65c02_breakpoint_clear)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_breakpoint_condition_set( \
+        JEMU_SYM(j65c02)* x, uint16_t y, const char* z) { \
+            return JEMU_SYM(j65c02_breakpoint_condition_set)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_breakpoint_hit_get( \
+        const JEMU_SYM(j65c02)* x, JEMU_SYM(j65c02_breakpoint_hit)* y) { \
+            return JEMU_SYM(j65c02_breakpoint_hit_get)(x,y); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_debug_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_debug_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_debug \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_debug_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
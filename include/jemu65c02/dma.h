@@ -0,0 +1,155 @@
+/**
+ * \file jemu65c02/dma.h
+ *
+ * \brief A reference DMA controller for jemu65c02.
+ *
+ * A DMA controller sits on the bus of an instance and answers a window of
+ * eight registers. Firmware writes a source address, a destination address,
+ * and a length, then writes the control register with the start bit set. Once
+ * that instruction finishes, the controller moves the block, steals its cycles
+ * from the processor by adding them to the cycle count, and can raise an IRQ.
+ * Bytes held by registered memory regions are moved with host memcpy and
+ * memset, unless the sanitizer or debugging is enabled. Any other bytes go
+ * through the bus one at a time. The IRQ line is level triggered, and is held
+ * until firmware writes the status register.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The registers of a DMA controller, as offsets from its base address.
+ *
+ * Addresses and the length are little endian. A zero length moves nothing.
+ */
+#define JEMU_DMA_REG_SOURCE_LOW                                     0
+#define JEMU_DMA_REG_SOURCE_HIGH                                    1
+#define JEMU_DMA_REG_DESTINATION_LOW                                2
+#define JEMU_DMA_REG_DESTINATION_HIGH                               3
+#define JEMU_DMA_REG_LENGTH_LOW                                     4
+#define JEMU_DMA_REG_LENGTH_HIGH                                    5
+#define JEMU_DMA_REG_CONTROL                                        6
+#define JEMU_DMA_REG_STATUS                                         7
+#define JEMU_DMA_REGISTER_COUNT                                     8
+
+/**
+ * \brief The bits of the control register.
+ *
+ * Writing START begins a transfer; it always reads back as zero. With IRQ, an
+ * interrupt is raised when the transfer is done. With FILL, the byte at the
+ * source address is written to the whole destination instead of copying.
+ */
+#define JEMU_DMA_CONTROL_START                                      0x01
+#define JEMU_DMA_CONTROL_IRQ                                        0x02
+#define JEMU_DMA_CONTROL_FILL                                       0x04
+
+/**
+ * \brief The bits of the status register.
+ *
+ * DONE is set when a transfer is done, and cleared by any write to the status
+ * register, which also releases the IRQ line.
+ */
+#define JEMU_DMA_STATUS_DONE                                        0x80
+
+/**
+ * \brief A DMA controller.
+ */
+typedef struct JEMU_SYM(j65c02_dma) JEMU_SYM(j65c02_dma);
+
+/**
+ * \brief Create a DMA controller on the bus of an instance.
+ *
+ * \note On success, the caller is given ownership of the controller and must
+ * release it by calling \ref j65c02_dma_release before the instance is
+ * released. The controller interposes on the bus of the instance, so any other
+ * bus interposer created after it must be released first. Bytes are copied in
+ * ascending address order, as though one at a time, so a copy to an
+ * overlapping higher address repeats the bytes before it. The IRQ line is held
+ * from the end of a transfer until the status register is written, and is taken
+ * after the first instruction that leaves interrupts enabled, or that waits.
+ * Its state is saved in snapshots. The cycles of a transfer are stolen even if
+ * they overrun the run in progress; the overrun is carried in the cycle delta,
+ * and taken from the next run. An instance with the sanitizer or debugging
+ * enabled has every byte moved through the bus, so that each is checked as an
+ * instruction's access would be.
+ *
+ * \param dma               Pointer to the controller pointer to set to the
+ *                          created controller on success.
+ * \param inst              The instance whose bus the controller sits on.
+ * \param base              The address of the first register.
+ * \param cycles_per_byte   The cycles stolen from the processor for each byte
+ *                          moved, from 0 to 32767.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DMA_BAD_OPTIONS if the registers do not fit in the address
+ *        space, or the cycles per byte are out of range.
+ *      - JEMU_ERROR_DMA_IN_USE if the instance already has a controller.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_dma_create)(
+    JEMU_SYM(j65c02_dma)** dma, JEMU_SYM(j65c02)* inst, uint16_t base,
+    int cycles_per_byte);
+
+/**
+ * \brief Get the number of transfers a DMA controller has done.
+ *
+ * \param dma               The controller to query.
+ *
+ * \returns the number of transfers done.
+ */
+uint64_t JEMU_SYM(j65c02_dma_transfer_count_get)(
+    const JEMU_SYM(j65c02_dma)* dma);
+
+/**
+ * \brief Release a DMA controller.
+ *
+ * \note The bus of the instance is restored, and a transfer that was started
+ * but not yet run is dropped. After this call, the controller pointer is no
+ * longer valid.
+ *
+ * \param dma               The controller to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_dma_release)(JEMU_SYM(j65c02_dma)* dma);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_dma_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_dma) sym ## j65c02_dma; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_dma_create( \
+        JEMU_SYM(j65c02_dma)** w, JEMU_SYM(j65c02)* x, uint16_t y, int z) { \
+            return JEMU_SYM(j65c02_dma_create)(w,x,y,z); } \
+    static inline uint64_t \
+    sym ## j65c02_dma_transfer_count_get(const JEMU_SYM(j65c02_dma)* x) { \
+            return JEMU_SYM(j65c02_dma_transfer_count_get)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_dma_release(JEMU_SYM(j65c02_dma)* x) { \
+            return JEMU_SYM(j65c02_dma_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_dma_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_dma_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_dma \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_dma_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
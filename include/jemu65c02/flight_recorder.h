@@ -0,0 +1,108 @@
+/**
+ * \file jemu65c02/flight_recorder.h
+ *
+ * \brief Flight recorder for jemu65c02.
+ *
+ * The flight recorder is an optional fixed-size ring, owned by an instance,
+ * that holds the last N instructions executed by \ref j65c02_run and
+ * \ref j65c02_step. Each entry records the program counter, the opcode and its
+ * operands, the registers, and the cycle count as the instruction began. It
+ * is cheap enough to leave on, so that when a run fails, the path that led
+ * there can be dumped without running again with full tracing.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A flight recorder entry.
+ */
+typedef struct JEMU_SYM(j65c02_flight_entry) JEMU_SYM(j65c02_flight_entry);
+
+struct JEMU_SYM(j65c02_flight_entry)
+{
+    /** \brief The cycle count as this instruction began. */
+    uint64_t cycle_count;
+    /** \brief The address of the opcode. */
+    uint16_t reg_pc;
+    /** \brief The opcode. */
+    uint8_t opcode;
+    /** \brief The operand bytes that follow the opcode. */
+    uint8_t operands[2];
+    /** \brief The number of valid operand bytes. This is zero when the
+     * instruction was fetched from outside the registered memory regions,
+     * since reading its operands again could disturb a device. */
+    uint8_t operand_count;
+    /** \brief The registers as this instruction began. */
+    uint8_t reg_a;
+    uint8_t reg_x;
+    uint8_t reg_y;
+    uint8_t reg_sp;
+    uint8_t reg_status;
+};
+
+/**
+ * \brief Enable, resize, or disable the flight recorder of an instance.
+ *
+ * \note The ring is allocated by this call and freed when the instance is
+ * released. Any entries already held are discarded.
+ *
+ * \param inst              The instance for this operation.
+ * \param entries           The number of entries to hold, rounded up to a
+ *                          power of two, or zero to disable the recorder.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_flight_recorder_enable)(
+    JEMU_SYM(j65c02)* inst, size_t entries);
+
+/**
+ * \brief Copy the most recent flight recorder entries, oldest first.
+ *
+ * \param inst              The instance to query.
+ * \param entries           The array to which entries are copied.
+ * \param max               The size of this array, in entries.
+ *
+ * \returns the number of entries copied.
+ */
+size_t JEMU_SYM(j65c02_flight_recorder_dump)(
+    const JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_flight_entry)* entries,
+    size_t max);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_flight_recorder_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_flight_entry) sym ## j65c02_flight_entry; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_flight_recorder_enable(JEMU_SYM(j65c02)* x, size_t y) { \
+            return JEMU_SYM(j65c02_flight_recorder_enable)(x,y); } \
+    static inline size_t \
+    sym ## j65c02_flight_recorder_dump( \
+        const JEMU_SYM(j65c02)* x, JEMU_SYM(j65c02_flight_entry)* y, \
+        size_t z) { \
+            return JEMU_SYM(j65c02_flight_recorder_dump)(x,y,z); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_flight_recorder_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_flight_recorder_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_flight_recorder \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_flight_recorder_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
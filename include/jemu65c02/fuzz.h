@@ -0,0 +1,166 @@
+/**
+ * \file jemu65c02/fuzz.h
+ *
+ * \brief A persistent mode fuzzing harness for jemu65c02.
+ *
+ * A harness takes an instance that has already booted its firmware, and
+ * snapshots it. Each input then restores the snapshot, which copies the
+ * registered memory regions and the processor state back without allocating,
+ * injects the input into guest memory or through an input device, and runs the
+ * instance with a cycle cap. Together with a coverage map, this lets a
+ * coverage-guided fuzzer drive the emulator in process.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The ways an input can reach the guest.
+ *
+ * An input written to memory is copied to the input address, truncated to the
+ * input capacity, and its length can also be written as a little endian 16-bit
+ * value. An input device is read one byte at a time from the input address,
+ * and the byte after it reads 1 while input remains and 0 once it is used up.
+ */
+#define JEMU_FUZZ_INPUT_MEMORY                                      0
+#define JEMU_FUZZ_INPUT_DEVICE                                      1
+
+/**
+ * \brief The outcome of running an input.
+ */
+#define JEMU_FUZZ_RESULT_OK                                         0
+#define JEMU_FUZZ_RESULT_TIMEOUT                                    1
+#define JEMU_FUZZ_RESULT_INVALID_OPCODE                             2
+#define JEMU_FUZZ_RESULT_BREAKPOINT                                 3
+#define JEMU_FUZZ_RESULT_SANITIZER                                  4
+
+/**
+ * \brief A fuzzing harness.
+ */
+typedef struct JEMU_SYM(j65c02_fuzz) JEMU_SYM(j65c02_fuzz);
+
+/**
+ * \brief The configuration of a fuzzing harness.
+ */
+typedef struct JEMU_SYM(j65c02_fuzz_options) JEMU_SYM(j65c02_fuzz_options);
+
+struct JEMU_SYM(j65c02_fuzz_options)
+{
+    /** \brief The JEMU_FUZZ_INPUT_* way inputs reach the guest. */
+    int input_mode;
+    /** \brief The input buffer or input device address. */
+    uint16_t input_addr;
+    /** \brief The most input bytes delivered to the guest. */
+    size_t input_capacity;
+    /** \brief Whether the length of an input written to memory is written. */
+    bool length_enabled;
+    /** \brief The address of that length. */
+    uint16_t length_addr;
+    /** \brief The most cycles run for each input. */
+    int cycle_cap;
+};
+
+/**
+ * \brief Create a fuzzing harness for an instance that has booted.
+ *
+ * \note On success, the caller is given ownership of the harness and must
+ * release it by calling \ref j65c02_fuzz_release when it is no longer needed.
+ * The current state of the instance is the snapshot restored for each input.
+ * An input device interposes on the bus of the instance, so watchpoints must
+ * be set before the harness is created. The shadow memory of the sanitizer is
+ * saved with the snapshot, so the sanitizer must be enabled and its
+ * permissions set before the harness is created.
+ *
+ * \param fuzz              Pointer to the harness pointer to set to the
+ *                          created harness on success.
+ * \param inst              The instance to fuzz.
+ * \param options           The configuration of this harness.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_FUZZ_BAD_OPTIONS if the options are not valid.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_fuzz_create)(
+    JEMU_SYM(j65c02_fuzz)** fuzz, JEMU_SYM(j65c02)* inst,
+    const JEMU_SYM(j65c02_fuzz_options)* options);
+
+/**
+ * \brief Run an input from the snapshot of a harness.
+ *
+ * \note The run ends when the instance stops or waits, when it reaches the
+ * cycle cap, or when it fails. An invalid opcode, a breakpoint hit, or a
+ * sanitizer violation is an outcome of the input rather than a failure; the
+ * violation can be read with \ref j65c02_sanitizer_report_get.
+ *
+ * \param fuzz              The harness for this operation.
+ * \param data              The input.
+ * \param size              The size of this input, in bytes.
+ * \param result            Set to the JEMU_FUZZ_RESULT_* outcome of this
+ *                          input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_fuzz_run)(
+    JEMU_SYM(j65c02_fuzz)* fuzz, const uint8_t* data, size_t size,
+    int* result);
+
+/**
+ * \brief Release a fuzzing harness.
+ *
+ * \note The bus of the instance is restored, and the instance is left in the
+ * state of its last input. After this call, the harness pointer is no longer
+ * valid.
+ *
+ * \param fuzz              The harness to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_fuzz_release)(JEMU_SYM(j65c02_fuzz)* fuzz);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_fuzz_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_fuzz) sym ## j65c02_fuzz; \
+    typedef JEMU_SYM(j65c02_fuzz_options) sym ## j65c02_fuzz_options; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_fuzz_create( \
+        JEMU_SYM(j65c02_fuzz)** x, JEMU_SYM(j65c02)* y, \
+        const JEMU_SYM(j65c02_fuzz_options)* z) { \
+            return JEMU_SYM(j65c02_fuzz_create)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_fuzz_run( \
+        JEMU_SYM(j65c02_fuzz)* w, const uint8_t* x, size_t y, int* z) { \
+            return JEMU_SYM(j65c02_fuzz_run)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_fuzz_release(JEMU_SYM(j65c02_fuzz)* x) { \
+            return JEMU_SYM(j65c02_fuzz_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_fuzz_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_fuzz_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_fuzz \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_fuzz_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,156 @@
+/**
+ * \file jemu65c02/group.h
+ *
+ * \brief Multi-instance batch runner for jemu65c02.
+ *
+ * A group runs many independent emulator instances, each with its own cycle
+ * budget, across a fixed set of worker threads. Each instance has a home
+ * worker that is the same from run to run, so instances stay on the same core
+ * and in the same cache. Workers that run out of work steal the remaining
+ * instances of busier workers.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Pin each worker thread to its own CPU, where the host supports it.
+ */
+#define JEMU_GROUP_FLAG_PIN_CPUS                                    0x0001
+
+/**
+ * \brief A multi-instance batch runner.
+ */
+typedef struct JEMU_SYM(j65c02_group) JEMU_SYM(j65c02_group);
+
+/**
+ * \brief Statistics for a single group run.
+ */
+typedef struct JEMU_SYM(j65c02_group_stats) JEMU_SYM(j65c02_group_stats);
+
+struct JEMU_SYM(j65c02_group_stats)
+{
+    /** \brief The total number of emulated cycles executed. */
+    uint64_t cycles;
+    /** \brief The host wall-clock time taken by the run, in nanoseconds. */
+    uint64_t elapsed_ns;
+    /** \brief The number of instances run by a worker other than their home
+     * worker. */
+    uint64_t steals;
+};
+
+/**
+ * \brief Create a group runner.
+ *
+ * \note On success, the caller is given ownership of the group and must release
+ * it by calling \ref j65c02_group_release when it is no longer needed. When the
+ * host does not support threads, the group runs every instance on the calling
+ * thread.
+ *
+ * \param group             Pointer to the group pointer to set to the created
+ *                          group on success.
+ * \param worker_count      The number of worker threads, usually the number of
+ *                          host cores.
+ * \param flags             Zero or more JEMU_GROUP_FLAG_* values.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_group_create)(
+    JEMU_SYM(j65c02_group)** group, size_t worker_count, int flags);
+
+/**
+ * \brief Run every instance in a batch for its own cycle budget.
+ *
+ * \note Each instance is run by \ref j65c02_run on exactly one worker, and an
+ * instance must not appear in the batch more than once. Instance i is homed on
+ * the same worker for every run with the same count.
+ *
+ * \param group             The group that runs this batch.
+ * \param insts             The instances to run.
+ * \param budgets           The cycle budget for each instance.
+ * \param results           Set to the status returned by \ref j65c02_run for
+ *                          each instance.
+ * \param count             The number of instances in this batch.
+ * \param stats             Optional pointer set to the statistics for this
+ *                          run; may be NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if the batch ran, even if individual instances failed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_group_run)(
+    JEMU_SYM(j65c02_group)* group, JEMU_SYM(j65c02)** insts,
+    const int* budgets, JEMU_SYM(status)* results, size_t count,
+    JEMU_SYM(j65c02_group_stats)* stats);
+
+/**
+ * \brief Get the number of workers in a group.
+ *
+ * \param group             The group to query.
+ *
+ * \returns the number of workers.
+ */
+size_t JEMU_SYM(j65c02_group_worker_count_get)(
+    const JEMU_SYM(j65c02_group)* group);
+
+/**
+ * \brief Release a group runner, stopping its worker threads.
+ *
+ * \note After this call, the group pointer is no longer valid. The instances
+ * run by this group are not released.
+ *
+ * \param group             The group to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_group_release)(JEMU_SYM(j65c02_group)* group);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_group_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_group) sym ## j65c02_group; \
+    typedef JEMU_SYM(j65c02_group_stats) sym ## j65c02_group_stats; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_group_create( \
+        JEMU_SYM(j65c02_group)** x, size_t y, int z) { \
+            return JEMU_SYM(j65c02_group_create)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_group_run( \
+        JEMU_SYM(j65c02_group)* u, JEMU_SYM(j65c02)** v, const int* w, \
+        JEMU_SYM(status)* x, size_t y, JEMU_SYM(j65c02_group_stats)* z) { \
+            return JEMU_SYM(j65c02_group_run)(u,v,w,x,y,z); } \
+    static inline size_t \
+    sym ## j65c02_group_worker_count_get(const JEMU_SYM(j65c02_group)* x) { \
+            return JEMU_SYM(j65c02_group_worker_count_get)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_group_release(JEMU_SYM(j65c02_group)* x) { \
+            return JEMU_SYM(j65c02_group_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_group_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_group_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_group \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_group_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,286 @@
+/**
+ * \file jemu65c02/history.h
+ *
+ * \brief Reverse execution for jemu65c02.
+ *
+ * A history records the bus input of an instance as it runs, and saves a
+ * checkpoint every few thousand cycles into a fixed ring. Any earlier
+ * instruction boundary still covered by the ring can be reconstructed by
+ * restoring the nearest checkpoint before it and replaying the recorded input
+ * forward, so stepping back costs at most one checkpoint interval of replay no
+ * matter how long the instance has run.
+ *
+ * A point in history is identified by its position: the number of
+ * instructions executed since the history was created. The state at a
+ * position includes every interrupt, NMI, and reset delivered before the next
+ * instruction.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+#include <stdbool.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A reverse execution history.
+ */
+typedef struct JEMU_SYM(j65c02_history) JEMU_SYM(j65c02_history);
+
+/**
+ * \brief A stop condition for \ref j65c02_history_run_back.
+ *
+ * \param context           The user context for this condition.
+ * \param inst              The instance, at a point in history.
+ *
+ * \returns true to stop at this point, or false otherwise.
+ */
+typedef bool (*JEMU_SYM(j65c02_history_stop_fn))(
+    void* context, const JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Start keeping a history for an instance.
+ *
+ * \note On success, the caller is given ownership of the history and must
+ * release it by calling \ref j65c02_history_release when it is no longer
+ * needed. While the history exists, the instance is run, interrupted, and
+ * reset through the history. Every RAM and ROM region must be registered with
+ * \ref j65c02_memory_region_add before this call, as for a recorder. Replay
+ * runs each instruction through the sanitizer, if it is enabled, so that the
+ * instructions it stopped are stopped again, but not through the hooks.
+ *
+ * \param history           Pointer to the history pointer to set to the
+ *                          created history on success.
+ * \param inst              The instance for this history.
+ * \param interval          The number of cycles between checkpoints.
+ * \param checkpoints       The number of checkpoints held; older ones are
+ *                          dropped.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_INVALID_CHECKPOINTS if interval or checkpoints is zero.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_create)(
+    JEMU_SYM(j65c02_history)** history, JEMU_SYM(j65c02)* inst,
+    uint64_t interval, size_t checkpoints);
+
+/**
+ * \brief Run the instance forward for the given number of cycles, as
+ * \ref j65c02_run would, while keeping its history.
+ *
+ * \param history           The history for this operation.
+ * \param cycles            The number of cycles to run the instance.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_REWOUND if the instance is not at the present.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_run)(JEMU_SYM(j65c02_history)* history, int cycles);
+
+/**
+ * \brief Deliver an interrupt to the instance, and record it.
+ *
+ * \param history           The history for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_REWOUND if the instance is not at the present.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_interrupt)(JEMU_SYM(j65c02_history)* history);
+
+/**
+ * \brief Deliver an NMI to the instance, and record it.
+ *
+ * \param history           The history for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_REWOUND if the instance is not at the present.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_nmi)(JEMU_SYM(j65c02_history)* history);
+
+/**
+ * \brief Reset the instance, and record it.
+ *
+ * \param history           The history for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_REWOUND if the instance is not at the present.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_reset)(JEMU_SYM(j65c02_history)* history);
+
+/**
+ * \brief Move the instance to a position in its history.
+ *
+ * \note Device callbacks are not called while moving through history. Seeking
+ * to the present position returns the instance to live execution.
+ *
+ * \param history           The history for this operation.
+ * \param position          The position to which the instance is moved, from
+ *                          the oldest held position up to the present.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_UNAVAILABLE if the position is not held.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_seek)(
+    JEMU_SYM(j65c02_history)* history, uint64_t position);
+
+/**
+ * \brief Move the instance back by one instruction.
+ *
+ * \param history           The history for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_UNAVAILABLE if the instance is at the oldest held
+ *        position.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_step_back)(JEMU_SYM(j65c02_history)* history);
+
+/**
+ * \brief Move the instance back to the most recent earlier position at which
+ * a stop condition holds.
+ *
+ * \param history           The history for this operation.
+ * \param stop              The stop condition.
+ * \param context           The user context passed to the stop condition.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_UNAVAILABLE if the condition holds at no earlier
+ *        held position; the instance is left at the oldest held position.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_run_back)(
+    JEMU_SYM(j65c02_history)* history, JEMU_SYM(j65c02_history_stop_fn) stop,
+    void* context);
+
+/**
+ * \brief Get the current position of the instance in its history.
+ *
+ * \param history           The history to query.
+ *
+ * \returns the current position.
+ */
+uint64_t JEMU_SYM(j65c02_history_position_get)(
+    const JEMU_SYM(j65c02_history)* history);
+
+/**
+ * \brief Get the present position, which is the number of instructions run
+ * since the history was created.
+ *
+ * \param history           The history to query.
+ *
+ * \returns the present position.
+ */
+uint64_t JEMU_SYM(j65c02_history_present_get)(
+    const JEMU_SYM(j65c02_history)* history);
+
+/**
+ * \brief Get the oldest position still held in history.
+ *
+ * \param history           The history to query.
+ *
+ * \returns the oldest held position.
+ */
+uint64_t JEMU_SYM(j65c02_history_oldest_get)(
+    const JEMU_SYM(j65c02_history)* history);
+
+/**
+ * \brief Stop keeping a history and release it.
+ *
+ * \note The original callbacks of the instance are restored, and the instance
+ * is left at its current position. After this call, the history pointer is no
+ * longer valid.
+ *
+ * \param history           The history to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_release)(JEMU_SYM(j65c02_history)* history);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_history_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_history) sym ## j65c02_history; \
+    typedef JEMU_SYM(j65c02_history_stop_fn) sym ## j65c02_history_stop_fn; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_create( \
+        JEMU_SYM(j65c02_history)** w, JEMU_SYM(j65c02)* x, uint64_t y, \
+        size_t z) { \
+            return JEMU_SYM(j65c02_history_create)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_run(JEMU_SYM(j65c02_history)* x, int y) { \
+            return JEMU_SYM(j65c02_history_run)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_interrupt(JEMU_SYM(j65c02_history)* x) { \
+            return JEMU_SYM(j65c02_history_interrupt)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_nmi(JEMU_SYM(j65c02_history)* x) { \
+            return JEMU_SYM(j65c02_history_nmi)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_reset(JEMU_SYM(j65c02_history)* x) { \
+            return JEMU_SYM(j65c02_history_reset)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_seek(JEMU_SYM(j65c02_history)* x, uint64_t y) { \
+            return JEMU_SYM(j65c02_history_seek)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_step_back(JEMU_SYM(j65c02_history)* x) { \
+            return JEMU_SYM(j65c02_history_step_back)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_run_back( \
+        JEMU_SYM(j65c02_history)* x, JEMU_SYM(j65c02_history_stop_fn) y, \
+        void* z) { \
+            return JEMU_SYM(j65c02_history_run_back)(x,y,z); } \
+    static inline uint64_t \
+    sym ## j65c02_history_position_get(const JEMU_SYM(j65c02_history)* x) { \
+            return JEMU_SYM(j65c02_history_position_get)(x); } \
+    static inline uint64_t \
+    sym ## j65c02_history_present_get(const JEMU_SYM(j65c02_history)* x) { \
+            return JEMU_SYM(j65c02_history_present_get)(x); } \
+    static inline uint64_t \
+    sym ## j65c02_history_oldest_get(const JEMU_SYM(j65c02_history)* x) { \
+            return JEMU_SYM(j65c02_history_oldest_get)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_history_release(JEMU_SYM(j65c02_history)* x) { \
+            return JEMU_SYM(j65c02_history_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_history_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_history_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_history \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_history_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,146 @@
+/**
+ * \file jemu65c02/hle.h
+ *
+ * \brief Native high-level emulation of guest routines for jemu65c02.
+ *
+ * A native routine registered at a guest address runs in place of the guest
+ * routine there. When \ref j65c02_run or \ref j65c02_step reaches that address,
+ * the native routine runs against the registers and memory of the instance.
+ * The instance then returns from the routine as if it had executed an RTS,
+ * to the instruction after the JSR that called it, and is charged the cycles
+ * given when the routine was registered. Each address is
+ * checked against a bitmap of the registered addresses, so an instance runs at
+ * near full speed between calls, and an instance without native routines runs
+ * the plain loop, which skips the check entirely.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A native routine.
+ *
+ * \param context           The context passed when the routine was set.
+ * \param inst              The instance calling this routine.
+ *
+ * \returns a status code indicating success or failure. A failure is returned
+ * by the run or step, with the instance left at the entry of the routine.
+ */
+typedef JEMU_SYM(status) (*JEMU_SYM(j65c02_hle_fn))(
+    void* context, JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Set the native routine at a guest address.
+ *
+ * \note The routine is called by \ref j65c02_run, \ref j65c02_step, history
+ * runs and their replays, and by batches, which run an instance with native
+ * routines by \ref j65c02_run. A history counts each call as one position.
+ * An execution breakpoint at the same address fires before the routine runs.
+ * Setting a routine again replaces it.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The entry address of the guest routine.
+ * \param fn                The native routine to run in its place.
+ * \param context           The context passed to this routine.
+ * \param cycles            The cycles charged for each call, including the
+ *                          return.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HLE_BAD_ROUTINE if the routine is NULL or the cycles are
+ *        negative.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_set)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, JEMU_SYM(j65c02_hle_fn) fn,
+    void* context, int cycles);
+
+/**
+ * \brief Clear the native routine at a guest address, if there is one.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The entry address of the guest routine.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_clear)(JEMU_SYM(j65c02)* inst, uint16_t addr);
+
+/**
+ * \brief Read guest memory from a native routine.
+ *
+ * \note The read goes through the bus of the instance, so it is seen by any
+ * watchpoints and devices on that bus.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address to read.
+ * \param val               Set to the value read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from the bus on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_read)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief Write guest memory from a native routine.
+ *
+ * \note The write goes through the bus of the instance, so it is seen by any
+ * watchpoints and devices on that bus.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address to write.
+ * \param val               The value to write.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from the bus on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_write)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, uint8_t val);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_hle_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_hle_fn) sym ## j65c02_hle_fn; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_hle_set( \
+        JEMU_SYM(j65c02)* v, uint16_t w, JEMU_SYM(j65c02_hle_fn) x, \
+        void* y, int z) { \
+            return JEMU_SYM(j65c02_hle_set)(v,w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_hle_clear(JEMU_SYM(j65c02)* x, uint16_t y) { \
+            return JEMU_SYM(j65c02_hle_clear)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_hle_read(JEMU_SYM(j65c02)* x, uint16_t y, uint8_t* z) { \
+            return JEMU_SYM(j65c02_hle_read)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_hle_write(JEMU_SYM(j65c02)* x, uint16_t y, uint8_t z) { \
+            return JEMU_SYM(j65c02_hle_write)(x,y,z); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_hle_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_hle_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_hle \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_hle_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,84 @@
+/**
+ * \file jemu65c02/hooks.h
+ *
+ * \brief Per-instruction hooks for jemu65c02.
+ *
+ * Each instance dispatches instructions through a table. Registering hooks
+ * swaps in an instrumented table for that instance, whose handlers call the
+ * hooks around the real handlers, and unregistering them swaps the plain table
+ * back. An instance without hooks pays nothing for them.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief An instruction hook.
+ *
+ * \param context           The context passed when the hooks were set.
+ * \param inst              The instance running this instruction.
+ * \param pc                The address of the opcode.
+ * \param opcode            The opcode.
+ * \param cycles            0 before the instruction runs, or the cycles it
+ *                          took after it has run.
+ *
+ * \returns a status code indicating success or failure. A failure stops the
+ * instruction, if it has not run yet, and is returned by the run or step.
+ */
+typedef JEMU_SYM(status) (*JEMU_SYM(j65c02_hook_fn))(
+    void* context, JEMU_SYM(j65c02)* inst, uint16_t pc, uint8_t opcode,
+    int cycles);
+
+/**
+ * \brief Set the instruction hooks of an instance.
+ *
+ * \note The hooks are called by \ref j65c02_run, \ref j65c02_step, history
+ * runs, and batches, which run an instance with hooks by \ref j65c02_run.
+ * Setting both hooks to NULL restores the plain dispatch table.
+ *
+ * \param inst              The instance for this operation.
+ * \param pre               The hook called before each instruction, or NULL.
+ * \param post              The hook called after each instruction that ran,
+ *                          or NULL.
+ * \param context           The context passed to these hooks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hooks_set)(
+    JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_hook_fn) pre,
+    JEMU_SYM(j65c02_hook_fn) post, void* context);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_hooks_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_hook_fn) sym ## j65c02_hook_fn; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_hooks_set( \
+        JEMU_SYM(j65c02)* w, JEMU_SYM(j65c02_hook_fn) x, \
+        JEMU_SYM(j65c02_hook_fn) y, void* z) { \
+            return JEMU_SYM(j65c02_hooks_set)(w,x,y,z); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_hooks_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_hooks_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_hooks \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_hooks_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,80 @@
+/**
+ * \file jemu65c02/idiom.h
+ *
+ * \brief Loop idiom recognition for jemu65c02.
+ *
+ * Boot code spends much of its time clearing and copying RAM with tight loops
+ * such as LDA (src),Y / STA (dst),Y / INY / BNE or STZ abs,X / DEX / BNE. With
+ * idioms enabled, \ref j65c02_run checks the body of each loop that a BNE
+ * branches back to. A body made of an optional indexed LDA, an indexed STA or
+ * STZ, and an INX, DEX, INY, or DEY on the same index register is recognized.
+ * When its code, its pointers, and the memory it touches all lie in
+ * registered memory regions, the rest of the loop runs as a native copy or
+ * fill. A, X, Y, P, PC, memory, and the cycle count end up exactly as the
+ * guest loop would leave them.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Enable or disable loop idiom recognition on an instance.
+ *
+ * \note A loop is only run natively while the instance has no breakpoints,
+ * trace, flight recorder, coverage map, profile, hooks, sanitizer, or native
+ * routine in the loop, since these would miss the iterations that are
+ * skipped. A loop is also cut short where the cycles left in the run would
+ * have stopped it, so a run ends on the same instruction either way. Since a
+ * loop run natively reads and writes registered regions directly, do not
+ * enable idioms if firmware may store to a region, such as ROM, that the write
+ * callback would leave unchanged.
+ *
+ * \param inst              The instance for this operation.
+ * \param enable            true to enable idioms, or false to disable them.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_idioms_enable)(JEMU_SYM(j65c02)* inst, bool enable);
+
+/**
+ * \brief Get the number of loops run natively by an instance.
+ *
+ * \param inst              The instance to query.
+ *
+ * \returns the number of times a loop was run natively.
+ */
+uint64_t JEMU_SYM(j65c02_idiom_count_get)(const JEMU_SYM(j65c02)* inst);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_idiom_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_idioms_enable(JEMU_SYM(j65c02)* x, bool y) { \
+            return JEMU_SYM(j65c02_idioms_enable)(x,y); } \
+    static inline uint64_t \
+    sym ## j65c02_idiom_count_get(const JEMU_SYM(j65c02)* x) { \
+            return JEMU_SYM(j65c02_idiom_count_get)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_idiom_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_idiom_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_idiom \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_idiom_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -12,6 +12,7 @@
 #include <jemu65c02/function_decl.h>
 #include <jemu65c02/status.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* C++ compatibility. */
@@ -35,6 +36,12 @@ extern "C" {
 #define JEMU_65c02_STATUS_ZERO                   0x02
 #define JEMU_65c02_STATUS_CARRY                  0x01
 
+/**
+ * \brief The maximum number of memory regions that can be registered with an
+ * emulator instance.
+ */
+#define JEMU_MAX_MEMORY_REGIONS                     8
+
 /**
  * \brief The emulator instance.
  */
@@ -76,6 +83,47 @@ JEMU_SYM(j65c02_create)(
     JEMU_SYM(j65c02_write_fn) write, void* context, int personality,
     int emulation_mode);
 
+/**
+ * \brief Get the size of an emulator instance, in bytes.
+ *
+ * \note This is the minimum size of the storage passed to \ref j65c02_init.
+ *
+ * \returns the size of an emulator instance.
+ */
+size_t JEMU_SYM(j65c02_sizeof)(void);
+
+/**
+ * \brief Initialize an emulator instance in caller-provided storage.
+ *
+ * \note No memory is allocated by this call. The storage must be at least
+ * \ref j65c02_sizeof bytes in size, must be aligned for a pointer, and must
+ * outlive the instance. Aligning the storage to a cache line keeps the hot
+ * fields of the instance in a single line. On success, the caller must still call
+ * \ref j65c02_release when the instance is no longer needed; this clears the
+ * storage but does not free it.
+ *
+ * \param inst              Pointer to the instance pointer to set to the
+ *                          initialized instance on success.
+ * \param storage           The storage in which the instance is placed.
+ * \param size              The size of this storage, in bytes.
+ * \param read              The read callback function.
+ * \param write             The write callback function.
+ * \param context           The user context to be passed to the callback
+ *                          functions.
+ * \param personality       The processor personality (MOS, ROCKWELL, or WDC).
+ * \param emulation_mode    The emulation mode (strict or map invalid opcodes as
+ *                          NOPs).
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_init)(
+    JEMU_SYM(j65c02)** inst, void* storage, size_t size,
+    JEMU_SYM(j65c02_read_fn) read, JEMU_SYM(j65c02_write_fn) write,
+    void* context, int personality, int emulation_mode);
+
 /**
  * \brief Run the emulator instance for the given number of cycles.
  *
@@ -144,7 +192,9 @@ JEMU_SYM(j65c02_reset)(JEMU_SYM(j65c02)* inst);
 /**
  * \brief Release an emulator instance.
  *
- * \note After this call, the instance pointer is no longer valid.
+ * \note After this call, the instance pointer is no longer valid. Heap
+ * instances are freed, pool instances are returned to their pool, and
+ * instances initialized in caller-provided storage are cleared.
  *
  * \param inst              The instance to release.
  *
@@ -155,6 +205,32 @@ JEMU_SYM(j65c02_reset)(JEMU_SYM(j65c02)* inst);
 JEMU_SYM(status) FN_DECL_MUST_CHECK
 JEMU_SYM(j65c02_release)(JEMU_SYM(j65c02)* inst);
 
+/**
+ * \brief Register a region of host memory that backs part of the guest address
+ * space.
+ *
+ * \note The read and write callbacks remain the only way the processor reaches
+ * memory; a region tells the library which host bytes hold the guest's state,
+ * so that features such as snapshots can save and restore it directly. Any
+ * device state that must be rolled back with the processor should live in a
+ * registered region. The memory must outlive the instance.
+ *
+ * \param inst              The instance for this operation.
+ * \param base              The guest address at which this region starts.
+ * \param mem               The host memory backing this region.
+ * \param size              The size of this region, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_INVALID_MEMORY_REGION if the region is empty or does not
+ *        fit in the guest address space.
+ *      - JEMU_ERROR_MEMORY_REGION_LIMIT if JEMU_MAX_MEMORY_REGIONS regions are
+ *        already registered.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_memory_region_add)(
+    JEMU_SYM(j65c02)* inst, uint16_t base, uint8_t* mem, size_t size);
+
 /**
  * \brief Get the A register value.
  *
@@ -287,6 +363,10 @@ bool JEMU_SYM(j65c02_wait_flag_get)(const JEMU_SYM(j65c02)* inst);
 /**
  * \brief Get the cycle delta for this emulator instance.
  *
+ * \note The cycle delta holds the cycles left over from the last run, which
+ * are added to the next. It is negative when cycles stolen by a DMA transfer
+ * overran the last run.
+ *
  * \param inst              The instance to query.
  *
  * \returns the cycle delta.
@@ -301,6 +381,18 @@ int JEMU_SYM(j65c02_cycle_delta_get)(const JEMU_SYM(j65c02)* inst);
  */
 void JEMU_SYM(j65c02_cycle_delta_set)(JEMU_SYM(j65c02)* inst, int val);
 
+/**
+ * \brief Get the total number of cycles executed by this emulator instance.
+ *
+ * \note This count includes every instruction executed by \ref j65c02_run and
+ * \ref j65c02_step since the instance was created.
+ *
+ * \param inst              The instance to query.
+ *
+ * \returns the cycle count.
+ */
+uint64_t JEMU_SYM(j65c02_cycle_count_get)(const JEMU_SYM(j65c02)* inst);
+
 /**
  * \brief Get the processor personality for this emulator instance.
  *
@@ -333,6 +425,14 @@ int JEMU_SYM(j65c02_emulation_mode_get)(const JEMU_SYM(j65c02)* inst);
         JEMU_SYM(j65c02)** u, JEMU_SYM(j65c02_read_fn) v, \
         JEMU_SYM(j65c02_write_fn) w, void* x, int y, int z) { \
             return JEMU_SYM(j65c02_create)(u,v,w,x,y,z); } \
+    static inline size_t sym ## j65c02_sizeof(void) { \
+            return JEMU_SYM(j65c02_sizeof)(); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_init( \
+        JEMU_SYM(j65c02)** s, void* t, size_t u, \
+        JEMU_SYM(j65c02_read_fn) v, JEMU_SYM(j65c02_write_fn) w, void* x, \
+        int y, int z) { \
+            return JEMU_SYM(j65c02_init)(s,t,u,v,w,x,y,z); } \
     static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
     sym ## j65c02_run(JEMU_SYM(j65c02)* x, int y) { \
             return JEMU_SYM(j65c02_run)(x,y); } \
@@ -351,6 +451,10 @@ int JEMU_SYM(j65c02_emulation_mode_get)(const JEMU_SYM(j65c02)* inst);
     static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
     sym ## j65c02_release(JEMU_SYM(j65c02)* x) { \
             return JEMU_SYM(j65c02_release)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_memory_region_add( \
+        JEMU_SYM(j65c02)* w, uint16_t x, uint8_t* y, size_t z) { \
+            return JEMU_SYM(j65c02_memory_region_add)(w,x,y,z); } \
     static inline uint8_t \
     sym ## j65c02_reg_a_get(const JEMU_SYM(j65c02)* x) { \
             return JEMU_SYM(j65c02_reg_a_get)(x); } \
@@ -402,6 +506,9 @@ int JEMU_SYM(j65c02_emulation_mode_get)(const JEMU_SYM(j65c02)* inst);
     static inline void \
     sym ## j65c02_cycle_delta_set(JEMU_SYM(j65c02)* x, int y) { \
             JEMU_SYM(j65c02_cycle_delta_set)(x,y); } \
+    static inline uint64_t \
+    sym ## j65c02_cycle_count_get(const JEMU_SYM(j65c02)* x) { \
+            return JEMU_SYM(j65c02_cycle_count_get)(x); } \
     static inline int \
     sym ## j65c02_personality_get(const JEMU_SYM(j65c02)* x) { \
             return JEMU_SYM(j65c02_personality_get)(x); } \
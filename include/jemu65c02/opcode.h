@@ -0,0 +1,107 @@
+/**
+ * \file jemu65c02/opcode.h
+ *
+ * \brief Custom opcodes for jemu65c02.
+ *
+ * The opcodes that the 65c02 leaves unused can be given handlers per instance,
+ * so that firmware built for simulation can call a paravirtual coprocessor,
+ * such as a hardware multiply or block copy, with a single instruction. Each
+ * custom opcode has a handler, an operand length, and a cycle count. The
+ * instance fetches the operand, calls the handler, and charges the cycles.
+ * Custom opcodes live in a dispatch table owned by the instance, so the global
+ * table and other instances are untouched.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The handler of a custom opcode.
+ *
+ * \note Guest memory can be read and written from a handler with
+ * \ref j65c02_hle_read and \ref j65c02_hle_write.
+ *
+ * \param context           The context passed when the opcode was set.
+ * \param inst              The instance running this opcode.
+ * \param operand           The operand that followed the opcode, little
+ *                          endian, or 0 if it has none.
+ *
+ * \returns a status code indicating success or failure. A failure is returned
+ * by the run or step.
+ */
+typedef JEMU_SYM(status) (*JEMU_SYM(j65c02_opcode_fn))(
+    void* context, JEMU_SYM(j65c02)* inst, uint16_t operand);
+
+/**
+ * \brief Set the handler of an unused opcode on an instance.
+ *
+ * \note Custom opcodes are run by \ref j65c02_run, \ref j65c02_step, history
+ * runs and their replays, and by batches, which run an instance with custom
+ * opcodes by \ref j65c02_run. Setting an opcode again replaces its handler.
+ *
+ * \param inst              The instance for this operation.
+ * \param opcode            The unused opcode to set.
+ * \param fn                The handler of this opcode.
+ * \param context           The context passed to this handler.
+ * \param operand_length    The number of operand bytes, from 0 to 2.
+ * \param cycles            The cycles charged for each execution, at least 1.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_OPCODE_IN_USE if this opcode is a 65c02 instruction.
+ *      - JEMU_ERROR_OPCODE_BAD_HANDLER if the handler is NULL, or the operand
+ *        length or cycles are out of range.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_opcode_set)(
+    JEMU_SYM(j65c02)* inst, uint8_t opcode, JEMU_SYM(j65c02_opcode_fn) fn,
+    void* context, int operand_length, int cycles);
+
+/**
+ * \brief Clear the handler of a custom opcode, making it invalid again.
+ *
+ * \param inst              The instance for this operation.
+ * \param opcode            The opcode to clear.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_OPCODE_IN_USE if this opcode is a 65c02 instruction.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_opcode_clear)(JEMU_SYM(j65c02)* inst, uint8_t opcode);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_opcode_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_opcode_fn) sym ## j65c02_opcode_fn; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_opcode_set( \
+        JEMU_SYM(j65c02)* u, uint8_t v, JEMU_SYM(j65c02_opcode_fn) w, \
+        void* x, int y, int z) { \
+            return JEMU_SYM(j65c02_opcode_set)(u,v,w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_opcode_clear(JEMU_SYM(j65c02)* x, uint8_t y) { \
+            return JEMU_SYM(j65c02_opcode_clear)(x,y); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_opcode_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_opcode_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_opcode \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_opcode_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,156 @@
+/**
+ * \file jemu65c02/pool.h
+ *
+ * \brief Instance pools for jemu65c02.
+ *
+ * A pool carves many emulator instances out of a single contiguous,
+ * cache-line-aligned allocation, so that instances can be acquired and
+ * released without touching the heap.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief An instance pool.
+ */
+typedef struct JEMU_SYM(j65c02_pool) JEMU_SYM(j65c02_pool);
+
+/**
+ * \brief Create an instance pool.
+ *
+ * \note On success, the caller is given ownership of the pool and must release
+ * it by calling \ref j65c02_pool_release when it is no longer needed. This is
+ * the only allocation made by the pool.
+ *
+ * \param pool              Pointer to the pool pointer to set to the created
+ *                          pool on success.
+ * \param capacity          The number of instance slots in this pool.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_pool_create)(JEMU_SYM(j65c02_pool)** pool, size_t capacity);
+
+/**
+ * \brief Acquire an emulator instance from a pool.
+ *
+ * \note On success, the caller owns the instance and must release it by
+ * calling \ref j65c02_release, which returns its slot to the pool. Releasing
+ * the instance again fails with JEMU_ERROR_POOL_BAD_INSTANCE. An instance
+ * still in use when the pool is reset or released is freed with it.
+ *
+ * \param pool              The pool from which the instance is acquired.
+ * \param inst              Pointer to the instance pointer to set to the
+ *                          acquired instance on success.
+ * \param read              The read callback function.
+ * \param write             The write callback function.
+ * \param context           The user context to be passed to the callback
+ *                          functions.
+ * \param personality       The processor personality (MOS, ROCKWELL, or WDC).
+ * \param emulation_mode    The emulation mode (strict or map invalid opcodes as
+ *                          NOPs).
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_POOL_EXHAUSTED if every slot is in use.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_pool_acquire)(
+    JEMU_SYM(j65c02_pool)* pool, JEMU_SYM(j65c02)** inst,
+    JEMU_SYM(j65c02_read_fn) read, JEMU_SYM(j65c02_write_fn) write,
+    void* context, int personality, int emulation_mode);
+
+/**
+ * \brief Reset a pool, returning every slot to the free list.
+ *
+ * \note Any instance acquired from this pool is invalid after this call and
+ * must not be released. What each instance still in use owns is freed.
+ *
+ * \param pool              The pool to reset.
+ */
+void JEMU_SYM(j65c02_pool_reset)(JEMU_SYM(j65c02_pool)* pool);
+
+/**
+ * \brief Get the number of instance slots in a pool.
+ *
+ * \param pool              The pool to query.
+ *
+ * \returns the pool capacity.
+ */
+size_t JEMU_SYM(j65c02_pool_capacity_get)(const JEMU_SYM(j65c02_pool)* pool);
+
+/**
+ * \brief Get the number of free instance slots in a pool.
+ *
+ * \param pool              The pool to query.
+ *
+ * \returns the number of free slots.
+ */
+size_t JEMU_SYM(j65c02_pool_available_get)(const JEMU_SYM(j65c02_pool)* pool);
+
+/**
+ * \brief Release an instance pool.
+ *
+ * \note After this call, the pool pointer and every instance acquired from it
+ * are no longer valid. What each instance still in use owns is freed.
+ *
+ * \param pool              The pool to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_pool_release)(JEMU_SYM(j65c02_pool)* pool);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_pool_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_pool) sym ## j65c02_pool; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_pool_create(JEMU_SYM(j65c02_pool)** x, size_t y) { \
+            return JEMU_SYM(j65c02_pool_create)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_pool_acquire( \
+        JEMU_SYM(j65c02_pool)* t, JEMU_SYM(j65c02)** u, \
+        JEMU_SYM(j65c02_read_fn) v, JEMU_SYM(j65c02_write_fn) w, void* x, \
+        int y, int z) { \
+            return JEMU_SYM(j65c02_pool_acquire)(t,u,v,w,x,y,z); } \
+    static inline void \
+    sym ## j65c02_pool_reset(JEMU_SYM(j65c02_pool)* x) { \
+            JEMU_SYM(j65c02_pool_reset)(x); } \
+    static inline size_t \
+    sym ## j65c02_pool_capacity_get(const JEMU_SYM(j65c02_pool)* x) { \
+            return JEMU_SYM(j65c02_pool_capacity_get)(x); } \
+    static inline size_t \
+    sym ## j65c02_pool_available_get(const JEMU_SYM(j65c02_pool)* x) { \
+            return JEMU_SYM(j65c02_pool_available_get)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_pool_release(JEMU_SYM(j65c02_pool)* x) { \
+            return JEMU_SYM(j65c02_pool_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_pool_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_pool_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_pool \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_pool_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,385 @@
+/**
+ * \file jemu65c02/profile.h
+ *
+ * \brief Execution profiler for jemu65c02.
+ *
+ * The profiler counts the instructions executed and the cycles spent at each
+ * program counter, and for each opcode, as instances run under
+ * \ref j65c02_run and \ref j65c02_step. It is only built into the core when the
+ * library is configured with the profile option; otherwise, these functions
+ * fail with JEMU_ERROR_PROFILE_DISABLED and the run loops carry no profiling
+ * code at all.
+ *
+ * The profiler also keeps a shadow call stack, pushed by JSR, BRK, interrupts,
+ * and NMIs, and popped by RTS and RTI, and counts the cycles spent on each
+ * call path. These can be written as folded stacks, one line per path, for
+ * flame graph tools, naming each call by its guest label when a symbol table
+ * is given.
+ *
+ * Finally, the profiler counts the IRQs, NMIs, and wakes from WAI raised on an
+ * instance, and times each handler from its entry to the end of its RTI, in a
+ * histogram per source, at the cost of a few counter updates per interrupt.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+#include <jemu65c02/symbols.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Report the counters of each program counter.
+ */
+#define JEMU_PROFILE_REPORT_PC                                      0
+
+/**
+ * \brief Report the counters of each opcode.
+ */
+#define JEMU_PROFILE_REPORT_OPCODE                                  1
+
+/**
+ * \brief The kinds of call in a call path. The root is the path taken before
+ * any call, or after a reset.
+ */
+#define JEMU_PROFILE_CALL_ROOT                                      0
+#define JEMU_PROFILE_CALL_JSR                                       1
+#define JEMU_PROFILE_CALL_BRK                                       2
+#define JEMU_PROFILE_CALL_IRQ                                       3
+#define JEMU_PROFILE_CALL_NMI                                       4
+
+/**
+ * \brief The sources of interrupt timed by the profiler. An IRQ that ends a
+ * WAI is counted as a wake rather than as an IRQ.
+ */
+#define JEMU_PROFILE_INTERRUPT_IRQ                                  0
+#define JEMU_PROFILE_INTERRUPT_NMI                                  1
+#define JEMU_PROFILE_INTERRUPT_WAKE                                 2
+#define JEMU_PROFILE_INTERRUPT_SOURCES                              3
+
+/**
+ * \brief The buckets of a handler duration histogram. Bucket n counts the
+ * handlers whose duration is n bits long, so bucket 0 counts durations of 0,
+ * and bucket 3 counts durations from 4 to 7.
+ */
+#define JEMU_PROFILE_INTERRUPT_BUCKETS                              65
+
+/**
+ * \brief The interrupt counters of a profile, for one source.
+ *
+ * \note Timestamps are cycle counts. This core takes an interrupt on the
+ * instruction boundary where it is raised, and charges no cycles for the
+ * interrupt sequence, so its vector fetch and the entry of its handler share
+ * the timestamp of when it was raised.
+ */
+typedef struct JEMU_SYM(j65c02_profile_interrupts)
+JEMU_SYM(j65c02_profile_interrupts);
+
+struct JEMU_SYM(j65c02_profile_interrupts)
+{
+    /** \brief The number of times this interrupt was raised. */
+    uint64_t raised;
+    /** \brief The number of times it was raised with interrupts disabled,
+     * so that no handler ran. */
+    uint64_t masked;
+    /** \brief The number of handlers timed from entry to the end of their
+     * RTI. */
+    uint64_t handled;
+    /** \brief The shortest, longest, and total handler durations. */
+    uint64_t min_cycles;
+    uint64_t max_cycles;
+    uint64_t total_cycles;
+    /** \brief The handler duration histogram. */
+    uint64_t buckets[JEMU_PROFILE_INTERRUPT_BUCKETS];
+    /** \brief When this interrupt was last raised, when its handler was last
+     * entered, and when a handler last returned. */
+    uint64_t last_raised;
+    uint64_t last_entered;
+    uint64_t last_returned;
+};
+
+/**
+ * \brief A profile report entry.
+ */
+typedef struct JEMU_SYM(j65c02_profile_entry) JEMU_SYM(j65c02_profile_entry);
+
+struct JEMU_SYM(j65c02_profile_entry)
+{
+    /** \brief The program counter or opcode counted. */
+    uint16_t key;
+    /** \brief The number of instructions executed. */
+    uint64_t instructions;
+    /** \brief The number of cycles spent. */
+    uint64_t cycles;
+};
+
+/**
+ * \brief A call path in a profile.
+ */
+typedef struct JEMU_SYM(j65c02_profile_path) JEMU_SYM(j65c02_profile_path);
+
+struct JEMU_SYM(j65c02_profile_path)
+{
+    /** \brief The index of the path of the caller. The root is its own
+     * parent. */
+    uint32_t parent;
+    /** \brief The JEMU_PROFILE_CALL_* kind of the call. */
+    int kind;
+    /** \brief The address called. */
+    uint16_t addr;
+    /** \brief The number of times this path was called. */
+    uint64_t calls;
+    /** \brief The cycles spent on this path and the paths it called. */
+    uint64_t inclusive_cycles;
+    /** \brief The cycles spent on this path alone. */
+    uint64_t exclusive_cycles;
+};
+
+/**
+ * \brief A sink for profile output.
+ *
+ * \param context           The user context for this sink.
+ * \param data              The text to write.
+ * \param size              The size of this text, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+typedef JEMU_SYM(status) (*JEMU_SYM(j65c02_profile_sink_fn))(
+    void* context, const char* data, size_t size);
+
+/**
+ * \brief Enable or disable the profiler of an instance.
+ *
+ * \note The counters are allocated by this call and freed when the instance is
+ * released. Enabling the profiler again clears its counters.
+ *
+ * \param inst              The instance for this operation.
+ * \param enable            true to enable the profiler, or false to disable
+ *                          it and free its counters.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the library was built without the
+ *        profiler.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_enable)(JEMU_SYM(j65c02)* inst, bool enable);
+
+/**
+ * \brief Clear the counters of a profiled instance.
+ *
+ * \param inst              The instance for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_reset)(JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Get the counters of a program counter.
+ *
+ * \param inst              The instance to query.
+ * \param pc                The program counter to query.
+ * \param instructions      Set to the number of instructions executed here.
+ * \param cycles            Set to the number of cycles spent here.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_pc_get)(
+    const JEMU_SYM(j65c02)* inst, uint16_t pc, uint64_t* instructions,
+    uint64_t* cycles);
+
+/**
+ * \brief Get the counters of an opcode.
+ *
+ * \param inst              The instance to query.
+ * \param opcode            The opcode to query.
+ * \param instructions      Set to the number of times it executed.
+ * \param cycles            Set to the number of cycles it spent.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_opcode_get)(
+    const JEMU_SYM(j65c02)* inst, uint8_t opcode, uint64_t* instructions,
+    uint64_t* cycles);
+
+/**
+ * \brief Copy the busiest program counters or opcodes of a profile, most
+ * cycles first.
+ *
+ * \note Only entries that executed at least once are reported. Entries with
+ * the same cycle count are ordered by key.
+ *
+ * \param inst              The instance to query.
+ * \param kind              JEMU_PROFILE_REPORT_PC or
+ *                          JEMU_PROFILE_REPORT_OPCODE.
+ * \param entries           The array to which entries are copied.
+ * \param max               The size of this array, in entries.
+ * \param count             Set to the number of entries copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_report)(
+    const JEMU_SYM(j65c02)* inst, int kind,
+    JEMU_SYM(j65c02_profile_entry)* entries, size_t max, size_t* count);
+
+/**
+ * \brief Copy the call paths of a profile.
+ *
+ * \note The root is path 0, and each path follows the path of its caller, so
+ * the first paths copied always form a whole tree. Each instruction is counted
+ * in the routine it runs in, so the cycles of a JSR are counted in the caller,
+ * and those of an RTS or RTI in the routine it returns from.
+ *
+ * \param inst              The instance to query.
+ * \param paths             The array to which paths are copied.
+ * \param max               The size of this array, in paths.
+ * \param count             Set to the number of paths copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_paths_get)(
+    const JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_profile_path)* paths,
+    size_t max, size_t* count);
+
+/**
+ * \brief Write the call paths of a profile as folded stacks.
+ *
+ * \note Each path that spent cycles of its own is written as one line, such
+ * as "root;$E000;irq:$E050 1234", naming each call from the root, followed by
+ * its exclusive cycles. With a symbol table, calls are named by the labels of
+ * bank 0 instead, such as "root;reset;irq:irq_handler 1234".
+ *
+ * \param inst              The instance to query.
+ * \param symbols           The symbol table used to name calls, or NULL.
+ * \param sink              The sink to which lines are written.
+ * \param context           The user context for this sink.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ *      - the first error returned by the sink.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_folded_write)(
+    const JEMU_SYM(j65c02)* inst, const JEMU_SYM(j65c02_symbols)* symbols,
+    JEMU_SYM(j65c02_profile_sink_fn) sink, void* context);
+
+/**
+ * \brief Get the interrupt counters of a profiled instance for a source.
+ *
+ * \param inst              The instance to query.
+ * \param source            The JEMU_PROFILE_INTERRUPT_* source to query.
+ * \param interrupts        Set to the counters of this source.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ *      - JEMU_ERROR_PROFILE_BAD_SOURCE if this source is not valid.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_interrupts_get)(
+    const JEMU_SYM(j65c02)* inst, int source,
+    JEMU_SYM(j65c02_profile_interrupts)* interrupts);
+
+/**
+ * \brief Estimate a percentile of the handler durations of an interrupt
+ * source.
+ *
+ * \note The estimate is the top of the histogram bucket holding this
+ * percentile, limited to the longest duration seen, so it is never less than
+ * the true value and at most twice it.
+ *
+ * \param interrupts        The counters to query.
+ * \param percent           The percentile to estimate, from 0 to 100.
+ *
+ * \returns the estimated duration in cycles, or 0 if no handler was timed.
+ */
+uint64_t JEMU_SYM(j65c02_profile_interrupts_percentile)(
+    const JEMU_SYM(j65c02_profile_interrupts)* interrupts, unsigned percent);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_profile_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_profile_entry) sym ## j65c02_profile_entry; \
+    typedef JEMU_SYM(j65c02_profile_path) sym ## j65c02_profile_path; \
+    typedef JEMU_SYM(j65c02_profile_sink_fn) sym ## j65c02_profile_sink_fn; \
+    typedef JEMU_SYM(j65c02_profile_interrupts) \
+    sym ## j65c02_profile_interrupts; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_profile_enable(JEMU_SYM(j65c02)* x, bool y) { \
+            return JEMU_SYM(j65c02_profile_enable)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_profile_reset(JEMU_SYM(j65c02)* x) { \
+            return JEMU_SYM(j65c02_profile_reset)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_profile_pc_get( \
+        const JEMU_SYM(j65c02)* w, uint16_t x, uint64_t* y, uint64_t* z) { \
+            return JEMU_SYM(j65c02_profile_pc_get)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_profile_opcode_get( \
+        const JEMU_SYM(j65c02)* w, uint8_t x, uint64_t* y, uint64_t* z) { \
+            return JEMU_SYM(j65c02_profile_opcode_get)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_profile_report( \
+        const JEMU_SYM(j65c02)* v, int w, \
+        JEMU_SYM(j65c02_profile_entry)* x, size_t y, size_t* z) { \
+            return JEMU_SYM(j65c02_profile_report)(v,w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_profile_paths_get( \
+        const JEMU_SYM(j65c02)* w, JEMU_SYM(j65c02_profile_path)* x, \
+        size_t y, size_t* z) { \
+            return JEMU_SYM(j65c02_profile_paths_get)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_profile_folded_write( \
+        const JEMU_SYM(j65c02)* w, const JEMU_SYM(j65c02_symbols)* x, \
+        JEMU_SYM(j65c02_profile_sink_fn) y, void* z) { \
+            return JEMU_SYM(j65c02_profile_folded_write)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_profile_interrupts_get( \
+        const JEMU_SYM(j65c02)* x, int y, \
+        JEMU_SYM(j65c02_profile_interrupts)* z) { \
+            return JEMU_SYM(j65c02_profile_interrupts_get)(x,y,z); } \
+    static inline uint64_t \
+    sym ## j65c02_profile_interrupts_percentile( \
+        const JEMU_SYM(j65c02_profile_interrupts)* x, unsigned y) { \
+            return JEMU_SYM(j65c02_profile_interrupts_percentile)(x,y); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_profile_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_profile_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_profile \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_profile_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,250 @@
+/**
+ * \file jemu65c02/replay.h
+ *
+ * \brief Deterministic record and replay of bus input for jemu65c02.
+ *
+ * A recorder sits between an instance and its read and write callbacks. It
+ * logs the result of every read outside the instance's registered memory
+ * regions, along with the cycle count at which each interrupt, NMI, and reset
+ * is delivered, to a compact binary stream.
+ *
+ * A replayer feeds that stream back to an instance that starts from the same
+ * state. Reads outside the registered regions come from the stream, writes
+ * outside them are dropped, and interrupts are delivered at their recorded
+ * cycle counts. The device callbacks are never called, so a replay runs at
+ * the speed of the processor alone and reproduces the recorded run exactly.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A bus recorder.
+ */
+typedef struct JEMU_SYM(j65c02_recorder) JEMU_SYM(j65c02_recorder);
+
+/**
+ * \brief A bus replayer.
+ */
+typedef struct JEMU_SYM(j65c02_replayer) JEMU_SYM(j65c02_replayer);
+
+/**
+ * \brief Start recording the bus input of an instance.
+ *
+ * \note On success, the caller is given ownership of the recorder and must
+ * release it by calling \ref j65c02_recorder_release when it is no longer
+ * needed. While the recorder exists, the instance is run as usual, but
+ * interrupts, NMIs, and resets must be delivered through the recorder. Every
+ * RAM region must be registered with \ref j65c02_memory_region_add before this
+ * call; reads from any other address are recorded. Code outside the registered
+ * regions, such as ROM that is not registered, still replays exactly, since
+ * each of its opcodes is read once, in order, however the runs are sliced, but
+ * every byte of it fetched goes into the stream. On an instance with a DMA
+ * controller, the recorder sits beneath the controller, so that the device
+ * reads of its transfers are recorded and its registers are not.
+ *
+ * \param recorder          Pointer to the recorder pointer to set to the
+ *                          created recorder on success.
+ * \param inst              The instance to record.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_create)(
+    JEMU_SYM(j65c02_recorder)** recorder, JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Deliver an interrupt to the recorded instance, and record it.
+ *
+ * \param recorder          The recorder for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_interrupt)(JEMU_SYM(j65c02_recorder)* recorder);
+
+/**
+ * \brief Deliver an NMI to the recorded instance, and record it.
+ *
+ * \param recorder          The recorder for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_nmi)(JEMU_SYM(j65c02_recorder)* recorder);
+
+/**
+ * \brief Reset the recorded instance, and record it.
+ *
+ * \param recorder          The recorder for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_reset)(JEMU_SYM(j65c02_recorder)* recorder);
+
+/**
+ * \brief Get the stream recorded so far.
+ *
+ * \note The stream remains owned by the recorder. It is valid until the next
+ * call on the instance or the recorder, and recording may continue after this
+ * call.
+ *
+ * \param recorder          The recorder to query.
+ * \param data              Pointer to be set to the recorded stream.
+ * \param size              Pointer to be set to the size of the stream.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_data_get)(
+    JEMU_SYM(j65c02_recorder)* recorder, const uint8_t** data, size_t* size);
+
+/**
+ * \brief Stop recording and release a recorder.
+ *
+ * \note The original callbacks of the instance are restored. After this call,
+ * the recorder pointer and its stream are no longer valid.
+ *
+ * \param recorder          The recorder to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_release)(JEMU_SYM(j65c02_recorder)* recorder);
+
+/**
+ * \brief Start replaying a recorded stream on an instance.
+ *
+ * \note On success, the caller is given ownership of the replayer and must
+ * release it by calling \ref j65c02_replayer_release when it is no longer
+ * needed. The instance must be in the state that the recorded instance was in
+ * when recording started, with the same memory regions registered, and the
+ * same DMA controller, if any, which runs the recorded transfers again. The
+ * stream is not copied and must outlive the replayer.
+ *
+ * \param replayer          Pointer to the replayer pointer to set to the
+ *                          created replayer on success.
+ * \param inst              The instance on which the stream is replayed.
+ * \param data              The recorded stream.
+ * \param size              The size of the recorded stream.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_BAD_STREAM if the stream is malformed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_replayer_create)(
+    JEMU_SYM(j65c02_replayer)** replayer, JEMU_SYM(j65c02)* inst,
+    const uint8_t* data, size_t size);
+
+/**
+ * \brief Run the replayed instance for the given number of cycles, delivering
+ * recorded interrupts, NMIs, and resets as their cycle counts are reached.
+ *
+ * \note Cycles left over when a run ends mid-instruction are carried over to
+ * the next call. Time spent waiting for an interrupt that is not in the
+ * recording is dropped.
+ *
+ * \param replayer          The replayer for this operation.
+ * \param cycles            The number of cycles to run.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_EXHAUSTED if the instance needs more input than
+ *        was recorded.
+ *      - JEMU_ERROR_REPLAY_DIVERGED if the instance no longer follows the
+ *        recording.
+ *      - the recorded error, if the recorded run failed at this point.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_replayer_run)(
+    JEMU_SYM(j65c02_replayer)* replayer, int cycles);
+
+/**
+ * \brief Stop replaying and release a replayer.
+ *
+ * \note The original callbacks of the instance are restored. After this call,
+ * the replayer pointer is no longer valid.
+ *
+ * \param replayer          The replayer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_replayer_release)(JEMU_SYM(j65c02_replayer)* replayer);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_replay_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_recorder) sym ## j65c02_recorder; \
+    typedef JEMU_SYM(j65c02_replayer) sym ## j65c02_replayer; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_recorder_create( \
+        JEMU_SYM(j65c02_recorder)** x, JEMU_SYM(j65c02)* y) { \
+            return JEMU_SYM(j65c02_recorder_create)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_recorder_interrupt(JEMU_SYM(j65c02_recorder)* x) { \
+            return JEMU_SYM(j65c02_recorder_interrupt)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_recorder_nmi(JEMU_SYM(j65c02_recorder)* x) { \
+            return JEMU_SYM(j65c02_recorder_nmi)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_recorder_reset(JEMU_SYM(j65c02_recorder)* x) { \
+            return JEMU_SYM(j65c02_recorder_reset)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_recorder_data_get( \
+        JEMU_SYM(j65c02_recorder)* x, const uint8_t** y, size_t* z) { \
+            return JEMU_SYM(j65c02_recorder_data_get)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_recorder_release(JEMU_SYM(j65c02_recorder)* x) { \
+            return JEMU_SYM(j65c02_recorder_release)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_replayer_create( \
+        JEMU_SYM(j65c02_replayer)** w, JEMU_SYM(j65c02)* x, \
+        const uint8_t* y, size_t z) { \
+            return JEMU_SYM(j65c02_replayer_create)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_replayer_run(JEMU_SYM(j65c02_replayer)* x, int y) { \
+            return JEMU_SYM(j65c02_replayer_run)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_replayer_release(JEMU_SYM(j65c02_replayer)* x) { \
+            return JEMU_SYM(j65c02_replayer_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_replay_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_replay_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_replay \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_replay_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
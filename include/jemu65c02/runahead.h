@@ -0,0 +1,149 @@
+/**
+ * \file jemu65c02/runahead.h
+ *
+ * \brief Run-ahead for low-latency host input.
+ *
+ * Guest firmware usually polls its inputs once per frame and shows the result
+ * a frame or more later. Run-ahead hides that latency. Each host frame, the
+ * instance runs one real frame, then a snapshot of its state is taken. The
+ * instance then runs a number of speculative frames with the same inputs, and
+ * its outputs are shown. Finally it is rolled back to the snapshot. The
+ * next host frame starts from that snapshot with whatever new input the host
+ * has applied, so a button press shows up in the outputs as if the guest had
+ * seen it several frames earlier.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A run-ahead runner.
+ */
+typedef struct JEMU_SYM(j65c02_runahead) JEMU_SYM(j65c02_runahead);
+
+/**
+ * \brief Output callback, called once per host frame with the instance at the
+ * end of the last speculative frame.
+ *
+ * \param context           The user context for this callback.
+ * \param inst              The instance whose outputs are captured.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+typedef JEMU_SYM(status) (*JEMU_SYM(j65c02_runahead_output_fn))(
+    void* context, JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Create a run-ahead runner for an instance.
+ *
+ * \note On success, the caller is given ownership of the runner and must
+ * release it by calling \ref j65c02_runahead_release when it is no longer
+ * needed. Every memory region that holds guest state must be registered with
+ * \ref j65c02_memory_region_add before this call; state that is not in a
+ * registered region is not rolled back.
+ *
+ * \param runahead          Pointer to the runner pointer to set to the created
+ *                          runner on success.
+ * \param inst              The instance to run; it remains owned by the
+ *                          caller.
+ * \param frame_cycles      The number of cycles in one guest frame.
+ * \param frames            The number of frames to run ahead.
+ * \param output            The output callback.
+ * \param context           The user context for the output callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_runahead_create)(
+    JEMU_SYM(j65c02_runahead)** runahead, JEMU_SYM(j65c02)* inst,
+    int frame_cycles, size_t frames, JEMU_SYM(j65c02_runahead_output_fn) output,
+    void* context);
+
+/**
+ * \brief Run one host frame.
+ *
+ * \note The host applies its current inputs to guest memory or devices before
+ * this call. On return, the instance is in the state it had at the end of the
+ * real frame, ready for the next one.
+ *
+ * \param runahead          The runner for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_runahead_frame)(JEMU_SYM(j65c02_runahead)* runahead);
+
+/**
+ * \brief Set the number of frames to run ahead.
+ *
+ * \param runahead          The runner for this operation.
+ * \param frames            The number of frames to run ahead; zero disables
+ *                          run-ahead.
+ */
+void JEMU_SYM(j65c02_runahead_frames_set)(
+    JEMU_SYM(j65c02_runahead)* runahead, size_t frames);
+
+/**
+ * \brief Release a run-ahead runner.
+ *
+ * \note After this call, the runner pointer is no longer valid. The instance
+ * is not released.
+ *
+ * \param runahead          The runner to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_runahead_release)(JEMU_SYM(j65c02_runahead)* runahead);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_runahead_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_runahead) sym ## j65c02_runahead; \
+    typedef JEMU_SYM(j65c02_runahead_output_fn) \
+        sym ## j65c02_runahead_output_fn; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_runahead_create( \
+        JEMU_SYM(j65c02_runahead)** u, JEMU_SYM(j65c02)* v, int w, \
+        size_t x, JEMU_SYM(j65c02_runahead_output_fn) y, void* z) { \
+            return JEMU_SYM(j65c02_runahead_create)(u,v,w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_runahead_frame(JEMU_SYM(j65c02_runahead)* x) { \
+            return JEMU_SYM(j65c02_runahead_frame)(x); } \
+    static inline void \
+    sym ## j65c02_runahead_frames_set( \
+        JEMU_SYM(j65c02_runahead)* x, size_t y) { \
+            JEMU_SYM(j65c02_runahead_frames_set)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_runahead_release(JEMU_SYM(j65c02_runahead)* x) { \
+            return JEMU_SYM(j65c02_runahead_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_runahead_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_runahead_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_runahead \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_runahead_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
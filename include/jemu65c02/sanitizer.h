@@ -0,0 +1,158 @@
+/**
+ * \file jemu65c02/sanitizer.h
+ *
+ * \brief A guest memory-access sanitizer for jemu65c02.
+ *
+ * An instance with the sanitizer enabled keeps a shadow byte for each guest
+ * address, holding the permissions of that address and whether it has been
+ * initialized. The sanitizer interposes on the bus of the instance to check
+ * each read and write, and swaps in a dispatch table that checks that each
+ * opcode is fetched from executable memory and that no instruction wraps the
+ * stack around page 1. An instance without the sanitizer runs exactly as
+ * before.
+ *
+ * A violation stops the run with JEMU_ERROR_SANITIZER_VIOLATION. The access
+ * that caused it does not reach the bus, and its report can then be read back.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The shadow state of an address, which can be combined.
+ */
+#define JEMU_SANITIZER_READ                                         0x01
+#define JEMU_SANITIZER_WRITE                                        0x02
+#define JEMU_SANITIZER_EXEC                                         0x04
+#define JEMU_SANITIZER_INIT                                         0x08
+
+/**
+ * \brief The kinds of violation.
+ */
+#define JEMU_SANITIZER_VIOLATION_READ                               1
+#define JEMU_SANITIZER_VIOLATION_WRITE                              2
+#define JEMU_SANITIZER_VIOLATION_EXEC                               3
+#define JEMU_SANITIZER_VIOLATION_UNINITIALIZED                      4
+#define JEMU_SANITIZER_VIOLATION_STACK_OVERFLOW                     5
+#define JEMU_SANITIZER_VIOLATION_STACK_UNDERFLOW                    6
+
+/**
+ * \brief A sanitizer violation.
+ */
+typedef struct JEMU_SYM(j65c02_sanitizer_report)
+JEMU_SYM(j65c02_sanitizer_report);
+
+struct JEMU_SYM(j65c02_sanitizer_report)
+{
+    /** \brief The JEMU_SANITIZER_VIOLATION_* kind of violation. */
+    int kind;
+    /** \brief The address accessed, or the stack slot the stack pointer
+     * wrapped to. */
+    uint16_t addr;
+    /** \brief The address of the instruction that made the access. */
+    uint16_t pc;
+    /** \brief The value that was to be written, for a write. */
+    uint8_t value;
+    /** \brief The cycle count at the start of that instruction. */
+    uint64_t cycle_count;
+};
+
+/**
+ * \brief Enable or disable the sanitizer on an instance.
+ *
+ * \note The shadow memory is allocated by this call and freed when the
+ * sanitizer is disabled or the instance is released. Every address starts out
+ * readable, writable, executable, and initialized, so nothing is reported
+ * until permissions are narrowed with \ref j65c02_sanitizer_permissions_set.
+ * The sanitizer interposes on the bus of this instance, so any other bus
+ * interposer created after it must be released before it is disabled.
+ * A batch runs an instance with the sanitizer by \ref j65c02_run, so every
+ * check is made.
+ *
+ * \param inst              The instance for this operation.
+ * \param enable            true to enable the sanitizer, or false to disable
+ *                          it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_sanitizer_enable)(JEMU_SYM(j65c02)* inst, bool enable);
+
+/**
+ * \brief Set the shadow state of a range of addresses.
+ *
+ * \note Writes through the bus mark an address as initialized. Memory loaded
+ * behind the bus, such as a memory region filled by the caller, should be
+ * marked with JEMU_SANITIZER_INIT here.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The first address of the range.
+ * \param size              The size of the range.
+ * \param state             The JEMU_SANITIZER_* permissions of the range,
+ *                          and JEMU_SANITIZER_INIT if it is initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SANITIZER_DISABLED if the sanitizer is not enabled.
+ *      - JEMU_ERROR_SANITIZER_BAD_RANGE if the range runs past the end of the
+ *        address space.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_sanitizer_permissions_set)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, size_t size, uint8_t state);
+
+/**
+ * \brief Get the violation that last stopped a run or step.
+ *
+ * \param inst              The instance to query.
+ * \param report            Set to the last violation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SANITIZER_DISABLED if the sanitizer is not enabled.
+ *      - JEMU_ERROR_SANITIZER_NO_REPORT if nothing has been reported.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_sanitizer_report_get)(
+    const JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_sanitizer_report)* report);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_sanitizer_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_sanitizer_report) \
+    sym ## j65c02_sanitizer_report; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_sanitizer_enable(JEMU_SYM(j65c02)* x, bool y) { \
+            return JEMU_SYM(j65c02_sanitizer_enable)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_sanitizer_permissions_set( \
+        JEMU_SYM(j65c02)* w, uint16_t x, size_t y, uint8_t z) { \
+            return JEMU_SYM(j65c02_sanitizer_permissions_set)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_sanitizer_report_get( \
+        const JEMU_SYM(j65c02)* x, JEMU_SYM(j65c02_sanitizer_report)* y) { \
+            return JEMU_SYM(j65c02_sanitizer_report_get)(x,y); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_sanitizer_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_sanitizer_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_sanitizer \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_sanitizer_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
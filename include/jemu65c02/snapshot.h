@@ -0,0 +1,129 @@
+/**
+ * \file jemu65c02/snapshot.h
+ *
+ * \brief Processor and memory snapshots for jemu65c02.
+ *
+ * A snapshot holds the processor state of an instance, and that of its DMA
+ * controller, along with the contents of every memory region registered with
+ * it. The snapshot buffer is sized once,
+ * when the snapshot is created, so saving and restoring never allocate.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A saved instance state.
+ */
+typedef struct JEMU_SYM(j65c02_snapshot) JEMU_SYM(j65c02_snapshot);
+
+/**
+ * \brief Create a snapshot sized for an instance.
+ *
+ * \note On success, the caller is given ownership of the snapshot and must
+ * release it by calling \ref j65c02_snapshot_release when it is no longer
+ * needed. The snapshot is sized for the memory regions registered with the
+ * instance at the time of this call, and is empty until it is saved.
+ *
+ * \param snapshot          Pointer to the snapshot pointer to set to the
+ *                          created snapshot on success.
+ * \param inst              The instance for which the snapshot is sized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_snapshot_create)(
+    JEMU_SYM(j65c02_snapshot)** snapshot, const JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Save the state of an instance to a snapshot.
+ *
+ * \param snapshot          The snapshot to which the state is saved.
+ * \param inst              The instance whose state is saved.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SNAPSHOT_MISMATCH if the memory regions of this instance
+ *        do not match those for which the snapshot was created.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_snapshot_save)(
+    JEMU_SYM(j65c02_snapshot)* snapshot, const JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Restore the state of an instance from a snapshot.
+ *
+ * \note The callbacks, user context, personality, and emulation mode of the
+ * instance are left as they are, as is the shadow memory of its sanitizer.
+ * The registers, pending transfer, and IRQ line of its DMA controller are
+ * restored; a controller created after the snapshot was saved is left idle.
+ *
+ * \param snapshot          The snapshot from which the state is restored.
+ * \param inst              The instance whose state is restored.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SNAPSHOT_MISMATCH if the memory regions of this instance
+ *        do not match those for which the snapshot was created.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_snapshot_restore)(
+    const JEMU_SYM(j65c02_snapshot)* snapshot, JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Release a snapshot.
+ *
+ * \note After this call, the snapshot pointer is no longer valid.
+ *
+ * \param snapshot          The snapshot to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_snapshot_release)(JEMU_SYM(j65c02_snapshot)* snapshot);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_snapshot_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_snapshot) sym ## j65c02_snapshot; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_snapshot_create( \
+        JEMU_SYM(j65c02_snapshot)** x, const JEMU_SYM(j65c02)* y) { \
+            return JEMU_SYM(j65c02_snapshot_create)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_snapshot_save( \
+        JEMU_SYM(j65c02_snapshot)* x, const JEMU_SYM(j65c02)* y) { \
+            return JEMU_SYM(j65c02_snapshot_save)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_snapshot_restore( \
+        const JEMU_SYM(j65c02_snapshot)* x, JEMU_SYM(j65c02)* y) { \
+            return JEMU_SYM(j65c02_snapshot_restore)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_snapshot_release(JEMU_SYM(j65c02_snapshot)* x) { \
+            return JEMU_SYM(j65c02_snapshot_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_snapshot_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_snapshot_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_snapshot \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_snapshot_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -67,6 +67,225 @@ typedef uint32_t JEMU_SYM(status);
  */
 #define JEMU_ERROR_PERIPHERAL                                       0x80000007
 
+/**
+ * \brief Caller-provided storage is too small or is misaligned.
+ */
+#define JEMU_ERROR_BAD_STORAGE                                      0x80000008
+
+/**
+ * \brief A pool has no free instance slots.
+ */
+#define JEMU_ERROR_POOL_EXHAUSTED                                   0x80000009
+
+/**
+ * \brief An instance was returned to a pool that does not own it.
+ */
+#define JEMU_ERROR_POOL_BAD_INSTANCE                                0x8000000A
+
+/**
+ * \brief An invalid number of worker threads was requested.
+ */
+#define JEMU_ERROR_INVALID_WORKER_COUNT                             0x8000000B
+
+/**
+ * \brief A host thread could not be created.
+ */
+#define JEMU_ERROR_THREAD_CREATE                                    0x8000000C
+
+/**
+ * \brief An invalid number of batch lanes was requested.
+ */
+#define JEMU_ERROR_INVALID_LANE_COUNT                               0x8000000D
+
+/**
+ * \brief An invalid number of CPUs was requested.
+ */
+#define JEMU_ERROR_INVALID_CPU_COUNT                                0x8000000E
+
+/**
+ * \brief An invalid CPU index was given.
+ */
+#define JEMU_ERROR_INVALID_CPU_INDEX                                0x8000000F
+
+/**
+ * \brief An invalid synchronization quantum was requested.
+ */
+#define JEMU_ERROR_INVALID_QUANTUM                                  0x80000010
+
+/**
+ * \brief A system was run before every CPU was attached.
+ */
+#define JEMU_ERROR_SYSTEM_INCOMPLETE                                0x80000011
+
+/**
+ * \brief A mailbox has no room for another message.
+ */
+#define JEMU_ERROR_MAILBOX_FULL                                     0x80000012
+
+/**
+ * \brief A mailbox has no message to receive.
+ */
+#define JEMU_ERROR_MAILBOX_EMPTY                                    0x80000013
+
+/**
+ * \brief A memory region is empty or does not fit in the guest address space.
+ */
+#define JEMU_ERROR_INVALID_MEMORY_REGION                            0x80000014
+
+/**
+ * \brief An instance already has the maximum number of memory regions.
+ */
+#define JEMU_ERROR_MEMORY_REGION_LIMIT                              0x80000015
+
+/**
+ * \brief A snapshot does not match the memory regions of an instance.
+ */
+#define JEMU_ERROR_SNAPSHOT_MISMATCH                                0x80000016
+
+/**
+ * \brief A replay needed more bus input than the recording holds.
+ */
+#define JEMU_ERROR_REPLAY_EXHAUSTED                                 0x80000017
+
+/**
+ * \brief A replay no longer follows the recording.
+ */
+#define JEMU_ERROR_REPLAY_DIVERGED                                  0x80000018
+
+/**
+ * \brief A recording is malformed.
+ */
+#define JEMU_ERROR_REPLAY_BAD_STREAM                                0x80000019
+
+/**
+ * \brief The checkpoint interval or checkpoint count is zero.
+ */
+#define JEMU_ERROR_INVALID_CHECKPOINTS                              0x8000001A
+
+/**
+ * \brief The requested point is older than any state held in history.
+ */
+#define JEMU_ERROR_HISTORY_UNAVAILABLE                              0x8000001B
+
+/**
+ * \brief The instance has been moved back in history, and can't run until it
+ * is returned to the present.
+ */
+#define JEMU_ERROR_HISTORY_REWOUND                                  0x8000001C
+
+/**
+ * \brief A trace has no more records.
+ */
+#define JEMU_ERROR_TRACE_END                                        0x8000001D
+
+/**
+ * \brief A trace is malformed.
+ */
+#define JEMU_ERROR_TRACE_BAD_STREAM                                 0x8000001E
+
+/**
+ * \brief The instance is already being traced.
+ */
+#define JEMU_ERROR_TRACE_ATTACHED                                   0x8000001F
+
+/**
+ * \brief The instance is not being profiled, or the library was built without
+ * the profiler.
+ */
+#define JEMU_ERROR_PROFILE_DISABLED                                 0x80000020
+
+/**
+ * \brief No symbol was found for an address.
+ */
+#define JEMU_ERROR_SYMBOLS_NOT_FOUND                                0x80000021
+
+/**
+ * \brief A symbol file is malformed.
+ */
+#define JEMU_ERROR_SYMBOLS_BAD_FORMAT                               0x80000022
+
+/**
+ * \brief An interrupt source is not valid.
+ */
+#define JEMU_ERROR_PROFILE_BAD_SOURCE                               0x80000023
+
+/**
+ * \brief A timeline track or lane is not valid.
+ */
+#define JEMU_ERROR_TIMELINE_BAD_TRACK                               0x80000024
+
+/**
+ * \brief A run or step stopped at a breakpoint.
+ */
+#define JEMU_ERROR_BREAKPOINT                                       0x80000025
+
+/**
+ * \brief Debugging is not enabled on the instance.
+ */
+#define JEMU_ERROR_DEBUG_DISABLED                                   0x80000026
+
+/**
+ * \brief No breakpoint has fired.
+ */
+#define JEMU_ERROR_BREAKPOINT_NO_HIT                                0x80000027
+
+/**
+ * \brief A breakpoint condition does not compile.
+ */
+#define JEMU_ERROR_BREAKPOINT_BAD_CONDITION                         0x80000028
+
+/**
+ * \brief The options of a fuzzing harness are not valid.
+ */
+#define JEMU_ERROR_FUZZ_BAD_OPTIONS                                 0x80000029
+
+/**
+ * \brief A run or step stopped at a sanitizer violation.
+ */
+#define JEMU_ERROR_SANITIZER_VIOLATION                              0x8000002A
+
+/**
+ * \brief The sanitizer is not enabled on the instance.
+ */
+#define JEMU_ERROR_SANITIZER_DISABLED                               0x8000002B
+
+/**
+ * \brief The sanitizer has not reported a violation.
+ */
+#define JEMU_ERROR_SANITIZER_NO_REPORT                              0x8000002C
+
+/**
+ * \brief A sanitizer range runs past the end of the address space.
+ */
+#define JEMU_ERROR_SANITIZER_BAD_RANGE                              0x8000002D
+
+/**
+ * \brief A native routine is NULL, or charges a negative number of cycles.
+ */
+#define JEMU_ERROR_HLE_BAD_ROUTINE                                  0x8000002E
+
+/**
+ * \brief An opcode is a 65c02 instruction, so it can't be customized.
+ */
+#define JEMU_ERROR_OPCODE_IN_USE                                    0x8000002F
+
+/**
+ * \brief The handler of a custom opcode is NULL, or its operand length or
+ * cycles are out of range.
+ */
+#define JEMU_ERROR_OPCODE_BAD_HANDLER                               0x80000030
+
+/**
+ * \brief The registers of a DMA controller do not fit in the address space, or
+ * its cycles per byte are out of range.
+ */
+#define JEMU_ERROR_DMA_BAD_OPTIONS                                  0x80000031
+
+/**
+ * \brief An instance already has a DMA controller.
+ */
+#define JEMU_ERROR_DMA_IN_USE                                       0x80000032
+
 /* C++ compatibility. */
 # ifdef   __cplusplus
 }
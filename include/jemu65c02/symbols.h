@@ -0,0 +1,183 @@
+/**
+ * \file jemu65c02/symbols.h
+ *
+ * \brief Guest symbol tables for jemu65c02.
+ *
+ * A symbol table maps guest addresses to labels, so that profiles, traces,
+ * and flight recorder dumps can name the routines they show. Labels are loaded
+ * from the debug info written by ld65 (its --dbgfile option), or from VICE
+ * style label lists, into a bank, and are kept sorted by bank and address so
+ * that each lookup is a binary search.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A guest symbol table.
+ */
+typedef struct JEMU_SYM(j65c02_symbols) JEMU_SYM(j65c02_symbols);
+
+/**
+ * \brief Create an empty symbol table.
+ *
+ * \note On success, the caller is given ownership of the table and must
+ * release it by calling \ref j65c02_symbols_release when it is no longer
+ * needed.
+ *
+ * \param symbols           Pointer to the table pointer to set to the created
+ *                          table on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_create)(JEMU_SYM(j65c02_symbols)** symbols);
+
+/**
+ * \brief Load the labels of an ld65 debug info file into a bank.
+ *
+ * \note Only the "sym" lines with a value and a type of "lab" are used; every
+ * other line is skipped. When two labels share an address, the first one
+ * loaded is kept.
+ *
+ * \param symbols           The table for this operation.
+ * \param bank              The bank into which these labels are loaded.
+ * \param text              The contents of the debug info file.
+ * \param size              The size of these contents, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SYMBOLS_BAD_FORMAT if a label line is malformed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_load_dbg)(
+    JEMU_SYM(j65c02_symbols)* symbols, uint8_t bank, const char* text,
+    size_t size);
+
+/**
+ * \brief Load a VICE style label list into a bank.
+ *
+ * \note Each line is either a VICE "al C:e000 .reset" command, or a hex
+ * address and a label, such as "$E000 reset". Labels for other VICE memory
+ * spaces, blank lines, and lines starting with ';' or '#' are skipped. When
+ * two labels share an address, the first one loaded is kept.
+ *
+ * \param symbols           The table for this operation.
+ * \param bank              The bank into which these labels are loaded.
+ * \param text              The contents of the label list.
+ * \param size              The size of these contents, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SYMBOLS_BAD_FORMAT if a line is malformed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_load_vice)(
+    JEMU_SYM(j65c02_symbols)* symbols, uint8_t bank, const char* text,
+    size_t size);
+
+/**
+ * \brief Find the label at or before an address.
+ *
+ * \param symbols           The table to query.
+ * \param bank              The bank of this address.
+ * \param addr              The address to look up.
+ * \param name              Set to the label, which is owned by the table, on
+ *                          success.
+ * \param offset            Set to the distance of the address past the label
+ *                          on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SYMBOLS_NOT_FOUND if there is no label at or before this
+ *        address in this bank.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_lookup)(
+    const JEMU_SYM(j65c02_symbols)* symbols, uint8_t bank, uint16_t addr,
+    const char** name, uint16_t* offset);
+
+/**
+ * \brief Format an address as "label", "label+offset", or "$XXXX".
+ *
+ * \note The output is always terminated, and is cut short if it does not fit.
+ *
+ * \param symbols           The table to use, or NULL to format the address
+ *                          alone.
+ * \param bank              The bank of this address.
+ * \param addr              The address to format.
+ * \param buffer            The buffer to which the text is written.
+ * \param size              The size of this buffer, which must be non-zero.
+ *
+ * \returns the length of the text written, without its terminator.
+ */
+size_t JEMU_SYM(j65c02_symbols_format)(
+    const JEMU_SYM(j65c02_symbols)* symbols, uint8_t bank, uint16_t addr,
+    char* buffer, size_t size);
+
+/**
+ * \brief Release a symbol table.
+ *
+ * \param symbols           The table to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_release)(JEMU_SYM(j65c02_symbols)* symbols);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_symbols_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_symbols) sym ## j65c02_symbols; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_symbols_create(JEMU_SYM(j65c02_symbols)** x) { \
+            return JEMU_SYM(j65c02_symbols_create)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_symbols_load_dbg( \
+        JEMU_SYM(j65c02_symbols)* w, uint8_t x, const char* y, size_t z) { \
+            return JEMU_SYM(j65c02_symbols_load_dbg)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_symbols_load_vice( \
+        JEMU_SYM(j65c02_symbols)* w, uint8_t x, const char* y, size_t z) { \
+            return JEMU_SYM(j65c02_symbols_load_vice)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_symbols_lookup( \
+        const JEMU_SYM(j65c02_symbols)* v, uint8_t w, uint16_t x, \
+        const char** y, uint16_t* z) { \
+            return JEMU_SYM(j65c02_symbols_lookup)(v,w,x,y,z); } \
+    static inline size_t \
+    sym ## j65c02_symbols_format( \
+        const JEMU_SYM(j65c02_symbols)* v, uint8_t w, uint16_t x, char* y, \
+        size_t z) { \
+            return JEMU_SYM(j65c02_symbols_format)(v,w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_symbols_release(JEMU_SYM(j65c02_symbols)* x) { \
+            return JEMU_SYM(j65c02_symbols_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_symbols_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_symbols_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_symbols \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_symbols_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,281 @@
+/**
+ * \file jemu65c02/system.h
+ *
+ * \brief Coupled multi-CPU systems for jemu65c02.
+ *
+ * A system owns several emulator instances that make up one board, along with
+ * the shared memory regions and mailboxes through which they communicate. The
+ * system runs every CPU for a fixed cycle quantum, then synchronizes all of
+ * them at the quantum boundary before starting the next one, so that no CPU
+ * gets more than one quantum ahead of another.
+ *
+ * By default, each CPU runs on its own host thread. With
+ * JEMU_SYSTEM_FLAG_DETERMINISTIC, the CPUs run one after another on the
+ * calling thread, in index order, each for one quantum at a time. This gives
+ * the same result on every run, and the same result as interleaving
+ * \ref j65c02_run calls by hand.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Run the CPUs of a system serially, in index order, on the calling
+ * thread.
+ */
+#define JEMU_SYSTEM_FLAG_DETERMINISTIC                              0x0001
+
+/**
+ * \brief A coupled multi-CPU system.
+ */
+typedef struct JEMU_SYM(j65c02_system) JEMU_SYM(j65c02_system);
+
+/**
+ * \brief A single-producer, single-consumer message ring between two CPUs.
+ */
+typedef struct JEMU_SYM(j65c02_mailbox) JEMU_SYM(j65c02_mailbox);
+
+/**
+ * \brief Create a coupled multi-CPU system.
+ *
+ * \note On success, the caller is given ownership of the system and must
+ * release it by calling \ref j65c02_system_release when it is no longer needed.
+ * Every CPU must be attached with \ref j65c02_system_cpu_attach before the
+ * system is run. When the host does not support threads, the system always
+ * runs deterministically.
+ *
+ * \param system            Pointer to the system pointer to set to the created
+ *                          system on success.
+ * \param cpu_count         The number of CPUs in this system.
+ * \param quantum           The number of cycles each CPU runs between
+ *                          synchronization points.
+ * \param flags             Zero or more JEMU_SYSTEM_FLAG_* values.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_create)(
+    JEMU_SYM(j65c02_system)** system, size_t cpu_count, int quantum,
+    int flags);
+
+/**
+ * \brief Attach an instance to a system as one of its CPUs.
+ *
+ * \note On success, the system takes ownership of the instance and releases it
+ * when the system is released.
+ *
+ * \param system            The system to which the instance is attached.
+ * \param index             The CPU index for this instance.
+ * \param inst              The instance to attach.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_INVALID_CPU_INDEX if the index is out of range or is
+ *        already attached.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_cpu_attach)(
+    JEMU_SYM(j65c02_system)* system, size_t index, JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Get a CPU of a system.
+ *
+ * \param system            The system to query.
+ * \param index             The CPU index.
+ *
+ * \returns the instance attached at this index, or NULL if there is none.
+ */
+JEMU_SYM(j65c02)* JEMU_SYM(j65c02_system_cpu_get)(
+    const JEMU_SYM(j65c02_system)* system, size_t index);
+
+/**
+ * \brief Create a zero-filled memory region that is shared between the CPUs of
+ * a system.
+ *
+ * \note The region is owned by the system and remains valid until the system
+ * is released. The read and write callbacks of each CPU map it into that CPU's
+ * address space. When the CPUs run on their own threads, accesses to shared
+ * memory within a quantum race just as they would on a real dual-port RAM;
+ * use a mailbox for ordered communication.
+ *
+ * \param system            The system that owns the region.
+ * \param size              The size of the region, in bytes.
+ * \param mem               Pointer to be set to the region on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_shared_create)(
+    JEMU_SYM(j65c02_system)* system, size_t size, uint8_t** mem);
+
+/**
+ * \brief Create a mailbox for passing messages from one CPU to another.
+ *
+ * \note The mailbox is owned by the system and remains valid until the system
+ * is released. A mailbox is lock-free, with exactly one sending CPU and one
+ * receiving CPU; a pair of mailboxes gives a two-way channel.
+ *
+ * \param system            The system that owns the mailbox.
+ * \param capacity          The minimum number of messages the mailbox holds;
+ *                          this is rounded up to a power of two.
+ * \param mailbox           Pointer to the mailbox pointer to set to the created
+ *                          mailbox on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_mailbox_create)(
+    JEMU_SYM(j65c02_system)* system, size_t capacity,
+    JEMU_SYM(j65c02_mailbox)** mailbox);
+
+/**
+ * \brief Send a message through a mailbox.
+ *
+ * \note This must only be called by the sending CPU, usually from its write
+ * callback.
+ *
+ * \param mailbox           The mailbox to which the message is sent.
+ * \param message           The message to send.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_MAILBOX_FULL if the mailbox is full.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_mailbox_send)(
+    JEMU_SYM(j65c02_mailbox)* mailbox, uint8_t message);
+
+/**
+ * \brief Receive a message from a mailbox.
+ *
+ * \note This must only be called by the receiving CPU, usually from its read
+ * callback.
+ *
+ * \param mailbox           The mailbox from which the message is received.
+ * \param message           Pointer to be set to the message on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_MAILBOX_EMPTY if the mailbox is empty.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_mailbox_receive)(
+    JEMU_SYM(j65c02_mailbox)* mailbox, uint8_t* message);
+
+/**
+ * \brief Get the number of messages waiting in a mailbox.
+ *
+ * \param mailbox           The mailbox to query.
+ *
+ * \returns the number of messages waiting.
+ */
+size_t JEMU_SYM(j65c02_mailbox_count_get)(
+    const JEMU_SYM(j65c02_mailbox)* mailbox);
+
+/**
+ * \brief Run every CPU of a system for the given number of cycles.
+ *
+ * \note The cycles are run in quanta. After each quantum, every CPU waits for
+ * the others to finish it before starting the next one. A CPU whose run fails
+ * is stopped for the rest of this call; the others keep running.
+ *
+ * \param system            The system to run.
+ * \param cycles            The number of cycles to run each CPU.
+ * \param results           Set to the first failing status returned by
+ *                          \ref j65c02_run for each CPU, or STATUS_SUCCESS.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if the system ran, even if individual CPUs failed.
+ *      - JEMU_ERROR_SYSTEM_INCOMPLETE if a CPU is not attached.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_run)(
+    JEMU_SYM(j65c02_system)* system, int cycles, JEMU_SYM(status)* results);
+
+/**
+ * \brief Release a coupled multi-CPU system.
+ *
+ * \note After this call, the system pointer, its CPUs, its shared memory
+ * regions, and its mailboxes are no longer valid.
+ *
+ * \param system            The system to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_release)(JEMU_SYM(j65c02_system)* system);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_system_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_system) sym ## j65c02_system; \
+    typedef JEMU_SYM(j65c02_mailbox) sym ## j65c02_mailbox; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_system_create( \
+        JEMU_SYM(j65c02_system)** w, size_t x, int y, int z) { \
+            return JEMU_SYM(j65c02_system_create)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_system_cpu_attach( \
+        JEMU_SYM(j65c02_system)* x, size_t y, JEMU_SYM(j65c02)* z) { \
+            return JEMU_SYM(j65c02_system_cpu_attach)(x,y,z); } \
+    static inline JEMU_SYM(j65c02)* \
+    sym ## j65c02_system_cpu_get( \
+        const JEMU_SYM(j65c02_system)* x, size_t y) { \
+            return JEMU_SYM(j65c02_system_cpu_get)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_system_shared_create( \
+        JEMU_SYM(j65c02_system)* x, size_t y, uint8_t** z) { \
+            return JEMU_SYM(j65c02_system_shared_create)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_system_mailbox_create( \
+        JEMU_SYM(j65c02_system)* x, size_t y, \
+        JEMU_SYM(j65c02_mailbox)** z) { \
+            return JEMU_SYM(j65c02_system_mailbox_create)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_mailbox_send(JEMU_SYM(j65c02_mailbox)* x, uint8_t y) { \
+            return JEMU_SYM(j65c02_mailbox_send)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_mailbox_receive(JEMU_SYM(j65c02_mailbox)* x, uint8_t* y) { \
+            return JEMU_SYM(j65c02_mailbox_receive)(x,y); } \
+    static inline size_t \
+    sym ## j65c02_mailbox_count_get(const JEMU_SYM(j65c02_mailbox)* x) { \
+            return JEMU_SYM(j65c02_mailbox_count_get)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_system_run( \
+        JEMU_SYM(j65c02_system)* x, int y, JEMU_SYM(status)* z) { \
+            return JEMU_SYM(j65c02_system_run)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_system_release(JEMU_SYM(j65c02_system)* x) { \
+            return JEMU_SYM(j65c02_system_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_system_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_system_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_system \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_system_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
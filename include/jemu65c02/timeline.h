@@ -0,0 +1,260 @@
+/**
+ * \file jemu65c02/timeline.h
+ *
+ * \brief Trace event timelines for jemu65c02.
+ *
+ * A timeline records spans of emulator activity into one buffer per track,
+ * and writes them out as Chrome trace event JSON, which can be loaded into
+ * Perfetto or chrome://tracing. Each track is written by one thread at a time
+ * without locking, so each instance attached to a timeline should have a track
+ * of its own.
+ *
+ * An attached instance records its \ref j65c02_run slices and the time it
+ * spends at the quantum barrier of a system on its host lane, and its
+ * interrupt handlers and WAI periods on its guest lane. Devices live in user
+ * code, so their callbacks record their own spans on the device lane. Every
+ * event carries both the emulated cycle count and the host monotonic time, and
+ * either can be chosen as the clock when the timeline is written.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The lanes of a track, which are written as the threads of a process.
+ */
+#define JEMU_TIMELINE_LANE_HOST                                     0
+#define JEMU_TIMELINE_LANE_GUEST                                    1
+#define JEMU_TIMELINE_LANE_DEVICE                                   2
+#define JEMU_TIMELINE_LANES                                         3
+
+/**
+ * \brief The clocks a timeline can be written with. Cycles are written as
+ * microseconds, as though the processor ran at 1 MHz.
+ */
+#define JEMU_TIMELINE_CLOCK_CYCLES                                  0
+#define JEMU_TIMELINE_CLOCK_HOST                                    1
+
+/**
+ * \brief A trace event timeline.
+ */
+typedef struct JEMU_SYM(j65c02_timeline) JEMU_SYM(j65c02_timeline);
+
+/**
+ * \brief A sink for timeline output.
+ *
+ * \param context           The user context for this sink.
+ * \param data              The text to write.
+ * \param size              The size of this text, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+typedef JEMU_SYM(status) (*JEMU_SYM(j65c02_timeline_sink_fn))(
+    void* context, const char* data, size_t size);
+
+/**
+ * \brief Create a timeline.
+ *
+ * \note On success, the caller is given ownership of the timeline and must
+ * release it by calling \ref j65c02_timeline_release when it is no longer
+ * needed. Once a track is full, the events that would not fit are dropped,
+ * along with the ends of any spans whose beginnings were dropped.
+ *
+ * \param timeline          Pointer to the timeline pointer to set to the
+ *                          created timeline on success.
+ * \param tracks            The number of tracks in this timeline.
+ * \param capacity          The number of events each track can hold.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TIMELINE_BAD_TRACK if there are no tracks.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_create)(
+    JEMU_SYM(j65c02_timeline)** timeline, size_t tracks, size_t capacity);
+
+/**
+ * \brief Attach an instance to a track of a timeline, or detach it.
+ *
+ * \note The timeline must outlive the attachment. Detach every instance
+ * before releasing the timeline.
+ *
+ * \param inst              The instance for this operation.
+ * \param timeline          The timeline to record into, or NULL to detach.
+ * \param track             The track this instance records into.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TIMELINE_BAD_TRACK if this track is not in the timeline.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_attach)(
+    JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_timeline)* timeline,
+    size_t track);
+
+/**
+ * \brief Begin a span on a lane of a track.
+ *
+ * \note The name is recorded by reference, and must stay valid until the
+ * timeline is written. Spans on a lane must nest.
+ *
+ * \param timeline          The timeline for this operation.
+ * \param track             The track to record into.
+ * \param lane              The JEMU_TIMELINE_LANE_* lane of this span.
+ * \param name              The name of this span.
+ * \param cycles            The emulated cycle count at which it begins.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, even if the event was dropped.
+ *      - JEMU_ERROR_TIMELINE_BAD_TRACK if this track or lane is not valid.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_begin)(
+    JEMU_SYM(j65c02_timeline)* timeline, size_t track, int lane,
+    const char* name, uint64_t cycles);
+
+/**
+ * \brief End the innermost span on a lane of a track.
+ *
+ * \param timeline          The timeline for this operation.
+ * \param track             The track to record into.
+ * \param lane              The JEMU_TIMELINE_LANE_* lane of this span.
+ * \param cycles            The emulated cycle count at which it ends.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, even if the event was dropped.
+ *      - JEMU_ERROR_TIMELINE_BAD_TRACK if this track or lane is not valid.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_end)(
+    JEMU_SYM(j65c02_timeline)* timeline, size_t track, int lane,
+    uint64_t cycles);
+
+/**
+ * \brief Record an instant event on a lane of a track.
+ *
+ * \note The name is recorded by reference, and must stay valid until the
+ * timeline is written.
+ *
+ * \param timeline          The timeline for this operation.
+ * \param track             The track to record into.
+ * \param lane              The JEMU_TIMELINE_LANE_* lane of this event.
+ * \param name              The name of this event.
+ * \param cycles            The emulated cycle count at which it happened.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, even if the event was dropped.
+ *      - JEMU_ERROR_TIMELINE_BAD_TRACK if this track or lane is not valid.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_instant)(
+    JEMU_SYM(j65c02_timeline)* timeline, size_t track, int lane,
+    const char* name, uint64_t cycles);
+
+/**
+ * \brief Get the number of events a timeline has dropped because a track was
+ * full.
+ *
+ * \param timeline          The timeline to query.
+ *
+ * \returns the number of events dropped across every track.
+ */
+uint64_t JEMU_SYM(j65c02_timeline_dropped_get)(
+    const JEMU_SYM(j65c02_timeline)* timeline);
+
+/**
+ * \brief Write a timeline as Chrome trace event JSON.
+ *
+ * \note Each track is written as a process, and each of its lanes as a
+ * thread. No track may be recorded into while the timeline is written.
+ *
+ * \param timeline          The timeline to write.
+ * \param clock             The JEMU_TIMELINE_CLOCK_* clock to write.
+ * \param sink              The sink to which the JSON is written.
+ * \param context           The user context for this sink.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - the first error returned by the sink.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_write)(
+    const JEMU_SYM(j65c02_timeline)* timeline, int clock,
+    JEMU_SYM(j65c02_timeline_sink_fn) sink, void* context);
+
+/**
+ * \brief Release a timeline.
+ *
+ * \param timeline          The timeline to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_release)(JEMU_SYM(j65c02_timeline)* timeline);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_timeline_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_timeline) sym ## j65c02_timeline; \
+    typedef JEMU_SYM(j65c02_timeline_sink_fn) sym ## j65c02_timeline_sink_fn; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_timeline_create( \
+        JEMU_SYM(j65c02_timeline)** x, size_t y, size_t z) { \
+            return JEMU_SYM(j65c02_timeline_create)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_timeline_attach( \
+        JEMU_SYM(j65c02)* x, JEMU_SYM(j65c02_timeline)* y, size_t z) { \
+            return JEMU_SYM(j65c02_timeline_attach)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_timeline_begin( \
+        JEMU_SYM(j65c02_timeline)* v, size_t w, int x, const char* y, \
+        uint64_t z) { \
+            return JEMU_SYM(j65c02_timeline_begin)(v,w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_timeline_end( \
+        JEMU_SYM(j65c02_timeline)* w, size_t x, int y, uint64_t z) { \
+            return JEMU_SYM(j65c02_timeline_end)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_timeline_instant( \
+        JEMU_SYM(j65c02_timeline)* v, size_t w, int x, const char* y, \
+        uint64_t z) { \
+            return JEMU_SYM(j65c02_timeline_instant)(v,w,x,y,z); } \
+    static inline uint64_t \
+    sym ## j65c02_timeline_dropped_get( \
+        const JEMU_SYM(j65c02_timeline)* x) { \
+            return JEMU_SYM(j65c02_timeline_dropped_get)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_timeline_write( \
+        const JEMU_SYM(j65c02_timeline)* w, int x, \
+        JEMU_SYM(j65c02_timeline_sink_fn) y, void* z) { \
+            return JEMU_SYM(j65c02_timeline_write)(w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_timeline_release(JEMU_SYM(j65c02_timeline)* x) { \
+            return JEMU_SYM(j65c02_timeline_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_timeline_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_timeline_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_timeline \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_timeline_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,392 @@
+/**
+ * \file jemu65c02/trace.h
+ *
+ * \brief Streaming execution trace for jemu65c02.
+ *
+ * A trace writes a record of every instruction an instance executes, and
+ * optionally every bus access it makes, for offline analysis of long runs.
+ * Records are delta encoded against the previous record, so that a typical
+ * instruction costs a few bytes: the program counter is omitted when execution
+ * falls through, and only the registers that changed are written.
+ *
+ * Each traced instance fills its own ring of chunks. Full chunks are handed to
+ * a trace writer, which compresses them on a background thread and passes the
+ * result to a sink callback, usually one that writes to a file. The emulation
+ * thread only blocks when every chunk in its ring is waiting to be written. A
+ * trace reader decodes the sink output back into records.
+ *
+ * A control flow trace records only the instructions that don't follow the one
+ * before, the interrupts signalled, and the reads from devices. That is enough
+ * to rebuild the full trace offline by running the same program again from the
+ * same state.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/jemu65c02.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Also record every bus access made by the traced instance.
+ */
+#define JEMU_TRACE_FLAG_BUS                                         0x0001
+
+/**
+ * \brief Record only what is needed to rebuild the full trace later: jumps,
+ * interrupts, and, with JEMU_TRACE_FLAG_BUS, reads from outside the registered
+ * memory regions.
+ */
+#define JEMU_TRACE_FLAG_CONTROL_FLOW                                0x0002
+
+/**
+ * \brief A trace record for an instruction.
+ */
+#define JEMU_TRACE_RECORD_INSTRUCTION                               0
+
+/**
+ * \brief A trace record for a bus read.
+ */
+#define JEMU_TRACE_RECORD_READ                                      1
+
+/**
+ * \brief A trace record for a bus write.
+ */
+#define JEMU_TRACE_RECORD_WRITE                                     2
+
+/**
+ * \brief A trace record for an instruction that does not follow the one
+ * before it, such as the target of a taken branch, a jump, or an interrupt.
+ * These are only made with JEMU_TRACE_FLAG_CONTROL_FLOW.
+ */
+#define JEMU_TRACE_RECORD_JUMP                                      3
+
+/**
+ * \brief Trace records for an interrupt, NMI, or reset, made as the instance is
+ * signalled, before it acts on the signal.
+ */
+#define JEMU_TRACE_RECORD_IRQ                                       4
+#define JEMU_TRACE_RECORD_NMI                                       5
+#define JEMU_TRACE_RECORD_RESET                                     6
+
+/**
+ * \brief The trace record made when a trace is released.
+ */
+#define JEMU_TRACE_RECORD_END                                       7
+
+/**
+ * \brief A trace writer.
+ */
+typedef struct JEMU_SYM(j65c02_trace_writer) JEMU_SYM(j65c02_trace_writer);
+
+/**
+ * \brief The trace of a single instance.
+ */
+typedef struct JEMU_SYM(j65c02_trace) JEMU_SYM(j65c02_trace);
+
+/**
+ * \brief A trace reader.
+ */
+typedef struct JEMU_SYM(j65c02_trace_reader) JEMU_SYM(j65c02_trace_reader);
+
+/**
+ * \brief Trace sink callback function.
+ *
+ * This is called with each block of trace output, in order. It should return
+ * STATUS_SUCCESS if the block was written.
+ */
+typedef JEMU_SYM(status) (*JEMU_SYM(j65c02_trace_sink_fn))(
+    void*, const uint8_t*, size_t);
+
+/**
+ * \brief Trace source callback function.
+ *
+ * This is called to read up to the given number of bytes of trace output into
+ * the given buffer. It returns the number of bytes read, which is zero at the
+ * end of the trace.
+ */
+typedef size_t (*JEMU_SYM(j65c02_trace_source_fn))(void*, uint8_t*, size_t);
+
+/**
+ * \brief A decoded trace record.
+ */
+typedef struct JEMU_SYM(j65c02_trace_record) JEMU_SYM(j65c02_trace_record);
+
+struct JEMU_SYM(j65c02_trace_record)
+{
+    /** \brief The JEMU_TRACE_RECORD_* type of this record. */
+    int type;
+    /** \brief The stream of the instance that made this record, in the order
+     * the traces were created. */
+    uint32_t stream;
+    /** \brief The number of instructions traced before the last instruction
+     * or jump record, or before an event record. */
+    uint64_t position;
+    /** \brief The cycle count as the last instruction began, or as an event
+     * or end record was made. */
+    uint64_t cycle_count;
+    /** \brief The address of the opcode of the last instruction or jump
+     * record. */
+    uint16_t reg_pc;
+    /** \brief The opcode. */
+    uint8_t opcode;
+    /** \brief The operand bytes that follow the opcode. */
+    uint8_t operands[2];
+    /** \brief The number of valid operand bytes. This is zero when the
+     * instruction was fetched from outside the registered memory regions. */
+    uint8_t operand_count;
+    /** \brief The registers as the last instruction record began. */
+    uint8_t reg_a;
+    uint8_t reg_x;
+    uint8_t reg_y;
+    uint8_t reg_sp;
+    uint8_t reg_status;
+    /** \brief The address of a bus access. */
+    uint16_t addr;
+    /** \brief The value read or written by a bus access. */
+    uint8_t value;
+};
+
+/**
+ * \brief Create a trace writer.
+ *
+ * \note On success, the caller is given ownership of the writer and must
+ * release it by calling \ref j65c02_trace_writer_release when it is no longer
+ * needed. The sink is called from the background thread, or from the traced
+ * instance's thread when the host does not support threads.
+ *
+ * \param writer            Pointer to the writer pointer to set to the created
+ *                          writer on success.
+ * \param sink              The sink to which trace output is written.
+ * \param context           The user context to be passed to the sink.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_writer_create)(
+    JEMU_SYM(j65c02_trace_writer)** writer,
+    JEMU_SYM(j65c02_trace_sink_fn) sink, void* context);
+
+/**
+ * \brief Release a trace writer, stopping its background thread.
+ *
+ * \note Every trace created with this writer must be released first. After
+ * this call, the writer pointer is no longer valid.
+ *
+ * \param writer            The writer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - the first error returned by the sink, if any.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_writer_release)(JEMU_SYM(j65c02_trace_writer)* writer);
+
+/**
+ * \brief Start tracing an instance.
+ *
+ * \note On success, the caller is given ownership of the trace and must
+ * release it by calling \ref j65c02_trace_release when it is no longer needed.
+ * The instance is traced by \ref j65c02_run and \ref j65c02_step. With
+ * JEMU_TRACE_FLAG_BUS, the trace interposes on the bus of this instance, so any
+ * other bus interposer created after it must be released first. A control
+ * flow trace interposes beneath any DMA controller, so that it records the
+ * device reads of transfers rather than the reads of the controller's
+ * registers.
+ *
+ * \param trace             Pointer to the trace pointer to set to the created
+ *                          trace on success.
+ * \param writer            The writer that writes this trace.
+ * \param inst              The instance to trace.
+ * \param flags             Zero or more JEMU_TRACE_FLAG_* values.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TRACE_ATTACHED if this instance is already traced.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_create)(
+    JEMU_SYM(j65c02_trace)** trace, JEMU_SYM(j65c02_trace_writer)* writer,
+    JEMU_SYM(j65c02)* inst, int flags);
+
+/**
+ * \brief Hand the records buffered by a trace to its writer.
+ *
+ * \param trace             The trace to flush.
+ */
+void JEMU_SYM(j65c02_trace_flush)(JEMU_SYM(j65c02_trace)* trace);
+
+/**
+ * \brief Stop tracing an instance.
+ *
+ * \note This call waits until every record of this trace has been passed to
+ * the sink. After this call, the trace pointer is no longer valid.
+ *
+ * \param trace             The trace to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_release)(JEMU_SYM(j65c02_trace)* trace);
+
+/**
+ * \brief Rebuild the full trace of an instance from its control flow trace.
+ *
+ * \note The instance must be in the same state as the traced instance was when
+ * its trace was created, for instance by restoring a snapshot, and must have
+ * the same memory regions. It is run until the end record of the stream, and
+ * is traced while it runs by a new trace with the given writer and flags. Reads
+ * from outside the registered memory regions are answered from the control
+ * flow trace, and writes there are dropped, so the devices of the instance are
+ * never touched. A DMA controller on the instance runs the transfers of the
+ * traced run again, and takes its own IRQs. Other interrupts are delivered
+ * where they were taken.
+ *
+ * \param reader            The reader for the control flow trace.
+ * \param stream            The stream of the traced instance.
+ * \param inst              The instance to run.
+ * \param writer            The writer of the rebuilt trace.
+ * \param flags             Zero or more JEMU_TRACE_FLAG_* values for the
+ *                          rebuilt trace.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_EXHAUSTED if the stream ends early.
+ *      - JEMU_ERROR_REPLAY_DIVERGED if the instance no longer follows the
+ *        control flow trace.
+ *      - the error returned by the last instruction, if it failed when
+ *        traced.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_rebuild)(
+    JEMU_SYM(j65c02_trace_reader)* reader, uint32_t stream,
+    JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_trace_writer)* writer, int flags);
+
+/**
+ * \brief Create a trace reader.
+ *
+ * \note On success, the caller is given ownership of the reader and must
+ * release it by calling \ref j65c02_trace_reader_release when it is no longer
+ * needed.
+ *
+ * \param reader            Pointer to the reader pointer to set to the created
+ *                          reader on success.
+ * \param source            The source from which trace output is read.
+ * \param context           The user context to be passed to the source.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TRACE_BAD_STREAM if the source is not a trace.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_reader_create)(
+    JEMU_SYM(j65c02_trace_reader)** reader,
+    JEMU_SYM(j65c02_trace_source_fn) source, void* context);
+
+/**
+ * \brief Read the next record from a trace.
+ *
+ * \note The records of each stream are in the order they were made. Records
+ * of different streams are interleaved a chunk at a time. With
+ * JEMU_TRACE_FLAG_BUS, the opcode fetch of an instruction is the read just
+ * before its instruction record.
+ *
+ * \param reader            The reader for this operation.
+ * \param record            The record to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TRACE_END at the end of the trace.
+ *      - JEMU_ERROR_TRACE_BAD_STREAM if the trace is malformed.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_reader_next)(
+    JEMU_SYM(j65c02_trace_reader)* reader,
+    JEMU_SYM(j65c02_trace_record)* record);
+
+/**
+ * \brief Release a trace reader.
+ *
+ * \note After this call, the reader pointer is no longer valid.
+ *
+ * \param reader            The reader to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_reader_release)(JEMU_SYM(j65c02_trace_reader)* reader);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_trace_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_trace_writer) sym ## j65c02_trace_writer; \
+    typedef JEMU_SYM(j65c02_trace) sym ## j65c02_trace; \
+    typedef JEMU_SYM(j65c02_trace_reader) sym ## j65c02_trace_reader; \
+    typedef JEMU_SYM(j65c02_trace_record) sym ## j65c02_trace_record; \
+    typedef JEMU_SYM(j65c02_trace_sink_fn) sym ## j65c02_trace_sink_fn; \
+    typedef JEMU_SYM(j65c02_trace_source_fn) sym ## j65c02_trace_source_fn; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_trace_writer_create( \
+        JEMU_SYM(j65c02_trace_writer)** x, \
+        JEMU_SYM(j65c02_trace_sink_fn) y, void* z) { \
+            return JEMU_SYM(j65c02_trace_writer_create)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_trace_writer_release(JEMU_SYM(j65c02_trace_writer)* x) { \
+            return JEMU_SYM(j65c02_trace_writer_release)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_trace_create( \
+        JEMU_SYM(j65c02_trace)** w, JEMU_SYM(j65c02_trace_writer)* x, \
+        JEMU_SYM(j65c02)* y, int z) { \
+            return JEMU_SYM(j65c02_trace_create)(w,x,y,z); } \
+    static inline void \
+    sym ## j65c02_trace_flush(JEMU_SYM(j65c02_trace)* x) { \
+            JEMU_SYM(j65c02_trace_flush)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_trace_release(JEMU_SYM(j65c02_trace)* x) { \
+            return JEMU_SYM(j65c02_trace_release)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_trace_rebuild( \
+        JEMU_SYM(j65c02_trace_reader)* v, uint32_t w, JEMU_SYM(j65c02)* x, \
+        JEMU_SYM(j65c02_trace_writer)* y, int z) { \
+            return JEMU_SYM(j65c02_trace_rebuild)(v,w,x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_trace_reader_create( \
+        JEMU_SYM(j65c02_trace_reader)** x, \
+        JEMU_SYM(j65c02_trace_source_fn) y, void* z) { \
+            return JEMU_SYM(j65c02_trace_reader_create)(x,y,z); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_trace_reader_next( \
+        JEMU_SYM(j65c02_trace_reader)* x, \
+        JEMU_SYM(j65c02_trace_record)* y) { \
+            return JEMU_SYM(j65c02_trace_reader_next)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_trace_reader_release(JEMU_SYM(j65c02_trace_reader)* x) { \
+            return JEMU_SYM(j65c02_trace_reader_release)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_trace_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_trace_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_trace \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_trace_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,51 @@
+/**
+ * \file control_transfers.c
+ *
+ * \brief The 65c02 instructions that transfer control.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Whether each instruction transfers control.
+ *
+ * \note These are the branches, including BBR and BBS, and BRK, JMP, JSR, RTI,
+ * and RTS. A branch transfers control whether or not it is taken.
+ */
+const uint8_t JEMU_SYM(global_j65c02_control_transfers)[256] = {
+    /* opcodes 0x00 - 0x0F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0x10 - 0x1F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0x20 - 0x2F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0x30 - 0x3F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0x40 - 0x4F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+    /* opcodes 0x50 - 0x5F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0x60 - 0x6F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+    /* opcodes 0x70 - 0x7F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+    /* opcodes 0x80 - 0x8F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0x90 - 0x9F. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0xA0 - 0xAF. */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0xB0 - 0xBF. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0xC0 - 0xCF. */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0xD0 - 0xDF. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0xE0 - 0xEF. */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    /* opcodes 0xF0 - 0xFF. */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1
+};
@@ -0,0 +1,52 @@
+/**
+ * \file instruction_lengths.c
+ *
+ * \brief The length of each 65c02 instruction.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief The length, in bytes, of each instruction.
+ *
+ * \note BRK counts its signature byte. Opcodes that are not implemented on the
+ * 65C02, such as 0x02 and the rest of the 0x?2 column other than the zero page
+ * indirect forms, are one byte long.
+ */
+const uint8_t JEMU_SYM(global_j65c02_instruction_lengths)[256] = {
+    /* opcodes 0x00 - 0x0F. */
+    2, 2, 1, 1, 2, 2, 2, 1, 1, 2, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0x10 - 0x1F. */
+    2, 2, 2, 1, 2, 2, 2, 1, 1, 3, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0x20 - 0x2F. */
+    3, 2, 1, 1, 2, 2, 2, 1, 1, 2, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0x30 - 0x3F. */
+    2, 2, 2, 1, 2, 2, 2, 1, 1, 3, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0x40 - 0x4F. */
+    1, 2, 1, 1, 1, 2, 2, 1, 1, 2, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0x50 - 0x5F. */
+    2, 2, 2, 1, 1, 2, 2, 1, 1, 3, 1, 1, 1, 3, 3, 1,
+    /* opcodes 0x60 - 0x6F. */
+    1, 2, 1, 1, 2, 2, 2, 1, 1, 2, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0x70 - 0x7F. */
+    2, 2, 2, 1, 2, 2, 2, 1, 1, 3, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0x80 - 0x8F. */
+    2, 2, 1, 1, 2, 2, 2, 1, 1, 2, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0x90 - 0x9F. */
+    2, 2, 2, 1, 2, 2, 2, 1, 1, 3, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0xA0 - 0xAF. */
+    2, 2, 2, 1, 2, 2, 2, 1, 1, 2, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0xB0 - 0xBF. */
+    2, 2, 2, 1, 2, 2, 2, 1, 1, 3, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0xC0 - 0xCF. */
+    2, 2, 1, 1, 2, 2, 2, 1, 1, 2, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0xD0 - 0xDF. */
+    2, 2, 2, 1, 1, 2, 2, 1, 1, 3, 1, 1, 1, 3, 3, 1,
+    /* opcodes 0xE0 - 0xEF. */
+    2, 2, 1, 1, 2, 2, 2, 1, 1, 2, 1, 1, 3, 3, 3, 1,
+    /* opcodes 0xF0 - 0xFF. */
+    2, 2, 2, 1, 1, 2, 2, 1, 1, 3, 1, 1, 1, 3, 3, 1
+};
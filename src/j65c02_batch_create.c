@@ -0,0 +1,70 @@
+/**
+ * \file j65c02_batch_create.c
+ *
+ * \brief Create a lockstep batch.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_batch_internal.h"
+
+JEMU_IMPORT_jemu65c02_batch;
+
+/**
+ * \brief Create a lockstep batch over a set of instances.
+ *
+ * \note On success, the caller is given ownership of the batch and must release
+ * it by calling \ref j65c02_batch_release when it is no longer needed. The
+ * instances remain owned by the caller and must outlive the batch.
+ *
+ * \note Opcodes and operands of lockstep instructions are fetched once, through
+ * the first lane at a given program counter, so every instance in the batch
+ * must present the same code at the addresses it executes.
+ *
+ * \param batch             Pointer to the batch pointer to set to the created
+ *                          batch on success.
+ * \param insts             The instances in this batch, one per lane.
+ * \param count             The number of instances, up to
+ *                          JEMU_BATCH_MAX_LANES.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_batch_create)(
+    JEMU_SYM(j65c02_batch)** batch, JEMU_SYM(j65c02)** insts, size_t count)
+{
+    j65c02_batch* tmp;
+
+    /* verify the lane count. */
+    if (0 == count || count > JEMU_BATCH_MAX_LANES)
+    {
+        return JEMU_ERROR_INVALID_LANE_COUNT;
+    }
+
+    /* allocate memory for the batch. */
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* one lane per instance. */
+    tmp->count = count;
+    for (size_t i = 0; i < count; ++i)
+    {
+        tmp->insts[i] = insts[i];
+    }
+
+    /* success. */
+    *batch = tmp;
+    return STATUS_SUCCESS;
+}
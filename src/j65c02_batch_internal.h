@@ -0,0 +1,80 @@
+/**
+ * \file j65c02_batch_internal.h
+ *
+ * \brief Internal header for the lockstep batch engine.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/batch.h>
+#include <stdbool.h>
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A lockstep batch of instances.
+ *
+ * \note Lane masks hold 0xFF for a lane that takes part in an operation and
+ * 0x00 for one that does not, so that lane updates can be written as selects
+ * that the compiler turns into vector operations.
+ */
+struct JEMU_SYM(j65c02_batch)
+{
+    size_t count;
+    JEMU_SYM(j65c02)* insts[JEMU_BATCH_MAX_LANES];
+
+    /* the per-lane register file. */
+    uint8_t reg_a[JEMU_BATCH_MAX_LANES];
+    uint8_t reg_x[JEMU_BATCH_MAX_LANES];
+    uint8_t reg_y[JEMU_BATCH_MAX_LANES];
+    uint8_t reg_sp[JEMU_BATCH_MAX_LANES];
+    uint8_t reg_status[JEMU_BATCH_MAX_LANES];
+    uint16_t reg_pc[JEMU_BATCH_MAX_LANES];
+
+    /* the per-lane run state. */
+    int budget[JEMU_BATCH_MAX_LANES];
+    int cycles[JEMU_BATCH_MAX_LANES];
+    uint8_t active[JEMU_BATCH_MAX_LANES];
+    uint8_t mask[JEMU_BATCH_MAX_LANES];
+};
+
+/**
+ * \brief Get the length of an instruction that can run in lockstep.
+ *
+ * \param opcode            The opcode to check.
+ *
+ * \returns the instruction length in bytes, or 0 if this opcode must run on
+ * the scalar path.
+ */
+size_t JEMU_SYM(j65c02_batch_lockstep_length)(uint8_t opcode);
+
+/**
+ * \brief Execute one instruction in lockstep across the masked lanes.
+ *
+ * \note Every masked lane must be at the same program counter and have the
+ * budget to run this instruction.
+ *
+ * \param batch             The batch on which this instruction executes.
+ * \param opcode            The opcode to execute.
+ * \param lo                The first operand byte, if any.
+ * \param hi                The second operand byte, if any.
+ *
+ * \returns true if the instruction was executed, or false if a lane needs the
+ * scalar path (for instance, decimal mode arithmetic); in that case, no lane
+ * has been modified.
+ */
+bool JEMU_SYM(j65c02_batch_lockstep)(
+    JEMU_SYM(j65c02_batch)* batch, uint8_t opcode, uint8_t lo, uint8_t hi);
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,351 @@
+/**
+ * \file j65c02_batch_lockstep.c
+ *
+ * \brief Lockstep execution of register-only instructions across lanes.
+ *
+ * Each instruction here is written as a straight loop over the lanes with
+ * branch-free selects, so that the compiler can vectorize it for whatever SIMD
+ * unit the host has (SSE, AVX2, NEON), while the same code still builds for
+ * targets with no SIMD unit at all. The semantics match the scalar
+ * instruction handlers exactly.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_batch_internal.h"
+
+#define N_FLAG      JEMU_65c02_STATUS_NEGATIVE
+#define V_FLAG      JEMU_65c02_STATUS_OVERFLOW
+#define D_FLAG      JEMU_65c02_STATUS_DECIMAL
+#define I_FLAG      JEMU_65c02_STATUS_INTERRUPT
+#define Z_FLAG      JEMU_65c02_STATUS_ZERO
+#define C_FLAG      JEMU_65c02_STATUS_CARRY
+
+/**
+ * \brief Select between two bytes using a lane mask.
+ */
+static inline uint8_t sel8(uint8_t m, uint8_t t, uint8_t f)
+{
+    return (uint8_t)((t & m) | (f & ~m));
+}
+
+/**
+ * \brief Select between two words using a lane mask.
+ */
+static inline uint16_t sel16(uint8_t m, uint16_t t, uint16_t f)
+{
+    uint16_t m16 = (uint16_t)(m * 0x0101);
+
+    return (uint16_t)((t & m16) | (f & ~m16));
+}
+
+/**
+ * \brief Replace the N and Z flags in a status byte based on a value.
+ */
+static inline uint8_t nz(uint8_t status, uint8_t val)
+{
+    return (uint8_t)(
+        (status & ~(N_FLAG | Z_FLAG)) | (val & N_FLAG)
+      | (0 == val ? Z_FLAG : 0));
+}
+
+/**
+ * \brief The lengths of the instructions that can run in lockstep, or 0 for
+ * instructions that must run on the scalar path.
+ */
+static const uint8_t lockstep_length[256] = {
+    /* immediate loads, logic, compares, and arithmetic. */
+    [0xA9] = 2, [0xA2] = 2, [0xA0] = 2,
+    [0x29] = 2, [0x09] = 2, [0x49] = 2,
+    [0xC9] = 2, [0xE0] = 2, [0xC0] = 2,
+    [0x69] = 2, [0xE9] = 2,
+
+    /* transfers. */
+    [0xAA] = 1, [0xA8] = 1, [0x8A] = 1, [0x98] = 1, [0xBA] = 1, [0x9A] = 1,
+
+    /* increments and decrements. */
+    [0xE8] = 1, [0xC8] = 1, [0xCA] = 1, [0x88] = 1, [0x1A] = 1, [0x3A] = 1,
+
+    /* flag operations. */
+    [0x18] = 1, [0x38] = 1, [0x58] = 1, [0x78] = 1, [0xB8] = 1, [0xD8] = 1,
+    [0xF8] = 1,
+
+    /* NOP. */
+    [0xEA] = 1,
+
+    /* accumulator shifts and rotates. */
+    [0x0A] = 1, [0x4A] = 1, [0x2A] = 1, [0x6A] = 1,
+
+    /* branches. */
+    [0x10] = 2, [0x30] = 2, [0x50] = 2, [0x70] = 2, [0x90] = 2, [0xB0] = 2,
+    [0xD0] = 2, [0xF0] = 2, [0x80] = 2,
+
+    /* JMP abs. */
+    [0x4C] = 3,
+};
+
+/**
+ * \brief Get the length of an instruction that can run in lockstep.
+ *
+ * \param opcode            The opcode to check.
+ *
+ * \returns the instruction length in bytes, or 0 if this opcode must run on
+ * the scalar path.
+ */
+size_t JEMU_SYM(j65c02_batch_lockstep_length)(uint8_t opcode)
+{
+    return lockstep_length[opcode];
+}
+
+/*
+ * Loop over every lane, with m set to the lane mask.
+ */
+#define LANES(body) \
+    for (size_t i = 0; i < n; ++i) \
+    { \
+        const uint8_t m = mask[i]; \
+        body \
+    }
+
+/*
+ * Load a register from an immediate value, updating N and Z.
+ */
+#define LOAD_IMM(reg) \
+    LANES( \
+        reg[i] = sel8(m, lo, reg[i]); \
+        st[i] = sel8(m, nz(st[i], lo), st[i]); )
+
+/*
+ * Apply an expression to a register, updating N and Z.
+ */
+#define UPDATE_NZ(dst, expr) \
+    LANES( \
+        uint8_t r = (uint8_t)(expr); \
+        dst[i] = sel8(m, r, dst[i]); \
+        st[i] = sel8(m, nz(st[i], r), st[i]); )
+
+/*
+ * Compare a register against an immediate value.
+ */
+#define COMPARE_IMM(reg) \
+    LANES( \
+        uint8_t r = (uint8_t)(reg[i] - lo); \
+        uint8_t s = \
+            (uint8_t)(nz(st[i], r) & ~C_FLAG) \
+          | (reg[i] >= lo ? C_FLAG : 0); \
+        st[i] = sel8(m, s, st[i]); )
+
+/*
+ * Set or clear a status flag.
+ */
+#define FLAG_SET(flag) \
+    LANES(st[i] = sel8(m, st[i] | (flag), st[i]);)
+#define FLAG_CLEAR(flag) \
+    LANES(st[i] = sel8(m, st[i] & ~(flag), st[i]);)
+
+/*
+ * Take a branch in the lanes where cond holds; fall through in the others.
+ */
+#define BRANCH(cond) \
+    LANES( \
+        bool taken = (cond); \
+        pc[i] = sel16(m, taken ? target : next, pc[i]); \
+        cyc[i] = taken ? 3 : 2; ) \
+    moved = true
+
+/**
+ * \brief Execute one instruction in lockstep across the masked lanes.
+ *
+ * \note Every masked lane must be at the same program counter and have the
+ * budget to run this instruction.
+ *
+ * \param batch             The batch on which this instruction executes.
+ * \param opcode            The opcode to execute.
+ * \param lo                The first operand byte, if any.
+ * \param hi                The second operand byte, if any.
+ *
+ * \returns true if the instruction was executed, or false if a lane needs the
+ * scalar path (for instance, decimal mode arithmetic); in that case, no lane
+ * has been modified.
+ */
+bool JEMU_SYM(j65c02_batch_lockstep)(
+    JEMU_SYM(j65c02_batch)* batch, uint8_t opcode, uint8_t lo, uint8_t hi)
+{
+    const size_t n = batch->count;
+    const uint8_t* mask = batch->mask;
+    uint8_t* a = batch->reg_a;
+    uint8_t* x = batch->reg_x;
+    uint8_t* y = batch->reg_y;
+    uint8_t* sp = batch->reg_sp;
+    uint8_t* st = batch->reg_status;
+    uint16_t* pc = batch->reg_pc;
+    int cyc[JEMU_BATCH_MAX_LANES];
+    uint16_t next = 0, target = 0;
+    bool moved = false;
+
+    /* every masked lane shares the same program counter. */
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (mask[i])
+        {
+            next = (uint16_t)(pc[i] + lockstep_length[opcode]);
+            break;
+        }
+    }
+
+    /* ADC and SBC only run in lockstep in binary mode. */
+    if (0x69 == opcode || 0xE9 == opcode)
+    {
+        uint8_t decimal = 0;
+        LANES(decimal |= m & st[i];)
+        if (decimal & D_FLAG)
+        {
+            return false;
+        }
+    }
+
+    /* branches are relative to the next instruction. */
+    target = (uint16_t)(next + (int8_t)lo);
+
+    /* most instructions take two cycles. */
+    for (size_t i = 0; i < n; ++i)
+    {
+        cyc[i] = 2;
+    }
+
+    switch (opcode)
+    {
+        case 0xA9: LOAD_IMM(a); break;
+        case 0xA2: LOAD_IMM(x); break;
+        case 0xA0: LOAD_IMM(y); break;
+
+        case 0x29: UPDATE_NZ(a, a[i] & lo); break;
+        case 0x09: UPDATE_NZ(a, a[i] | lo); break;
+        case 0x49: UPDATE_NZ(a, a[i] ^ lo); break;
+
+        case 0xC9: COMPARE_IMM(a); break;
+        case 0xE0: COMPARE_IMM(x); break;
+        case 0xC0: COMPARE_IMM(y); break;
+
+        /* ADC imm. */
+        case 0x69:
+            LANES(
+                unsigned int r = a[i] + lo + (st[i] & C_FLAG);
+                uint8_t s =
+                    (uint8_t)(nz(st[i], (uint8_t)r) & ~(C_FLAG | V_FLAG))
+                  | (r > 0xFF ? C_FLAG : 0)
+                  | (((a[i] ^ r) & (lo ^ r) & 0x80) ? V_FLAG : 0);
+                a[i] = sel8(m, (uint8_t)r, a[i]);
+                st[i] = sel8(m, s, st[i]); )
+            break;
+
+        /* SBC imm. */
+        case 0xE9:
+            LANES(
+                unsigned int r =
+                    (unsigned int)a[i] - lo - (1 - (st[i] & C_FLAG));
+                uint8_t s =
+                    (uint8_t)(nz(st[i], (uint8_t)r) & ~(C_FLAG | V_FLAG))
+                  | (r > 0xFF ? 0 : C_FLAG)
+                  | (((a[i] ^ r) & (lo ^ r) & 0x80) ? V_FLAG : 0);
+                a[i] = sel8(m, (uint8_t)r, a[i]);
+                st[i] = sel8(m, s, st[i]); )
+            break;
+
+        case 0xAA: UPDATE_NZ(x, a[i]); break;
+        case 0xA8: UPDATE_NZ(y, a[i]); break;
+        case 0x8A: UPDATE_NZ(a, x[i]); break;
+        case 0x98: UPDATE_NZ(a, y[i]); break;
+        case 0xBA: UPDATE_NZ(x, sp[i]); break;
+        case 0x9A: LANES(sp[i] = sel8(m, x[i], sp[i]);) break;
+
+        case 0xE8: UPDATE_NZ(x, x[i] + 1); break;
+        case 0xC8: UPDATE_NZ(y, y[i] + 1); break;
+        case 0xCA: UPDATE_NZ(x, x[i] - 1); break;
+        case 0x88: UPDATE_NZ(y, y[i] - 1); break;
+        case 0x1A: UPDATE_NZ(a, a[i] + 1); break;
+        case 0x3A: UPDATE_NZ(a, a[i] - 1); break;
+
+        case 0x18: FLAG_CLEAR(C_FLAG); break;
+        case 0x38: FLAG_SET(C_FLAG); break;
+        case 0x58: FLAG_CLEAR(I_FLAG); break;
+        case 0x78: FLAG_SET(I_FLAG); break;
+        case 0xB8: FLAG_CLEAR(V_FLAG); break;
+        case 0xD8: FLAG_CLEAR(D_FLAG); break;
+        case 0xF8: FLAG_SET(D_FLAG); break;
+
+        case 0xEA: break;
+
+        /* ASL A. */
+        case 0x0A:
+            LANES(
+                uint8_t r = (uint8_t)(a[i] << 1);
+                uint8_t s = (uint8_t)(nz(st[i], r) & ~C_FLAG) | (a[i] >> 7);
+                a[i] = sel8(m, r, a[i]);
+                st[i] = sel8(m, s, st[i]); )
+            break;
+
+        /* LSR A. */
+        case 0x4A:
+            LANES(
+                uint8_t r = (uint8_t)(a[i] >> 1);
+                uint8_t s = (uint8_t)(nz(st[i], r) & ~C_FLAG) | (a[i] & 1);
+                a[i] = sel8(m, r, a[i]);
+                st[i] = sel8(m, s, st[i]); )
+            break;
+
+        /* ROL A. */
+        case 0x2A:
+            LANES(
+                uint8_t r = (uint8_t)((a[i] << 1) | (st[i] & C_FLAG));
+                uint8_t s = (uint8_t)(nz(st[i], r) & ~C_FLAG) | (a[i] >> 7);
+                a[i] = sel8(m, r, a[i]);
+                st[i] = sel8(m, s, st[i]); )
+            break;
+
+        /* ROR A. */
+        case 0x6A:
+            LANES(
+                uint8_t r = (uint8_t)((a[i] >> 1) | ((st[i] & C_FLAG) << 7));
+                uint8_t s = (uint8_t)(nz(st[i], r) & ~C_FLAG) | (a[i] & 1);
+                a[i] = sel8(m, r, a[i]);
+                st[i] = sel8(m, s, st[i]); )
+            break;
+
+        case 0x10: BRANCH(!(st[i] & N_FLAG)); break;
+        case 0x30: BRANCH(st[i] & N_FLAG); break;
+        case 0x50: BRANCH(!(st[i] & V_FLAG)); break;
+        case 0x70: BRANCH(st[i] & V_FLAG); break;
+        case 0x90: BRANCH(!(st[i] & C_FLAG)); break;
+        case 0xB0: BRANCH(st[i] & C_FLAG); break;
+        case 0xD0: BRANCH(!(st[i] & Z_FLAG)); break;
+        case 0xF0: BRANCH(st[i] & Z_FLAG); break;
+        case 0x80: BRANCH(1); break;
+
+        /* JMP abs. */
+        case 0x4C:
+            target = (uint16_t)((hi << 8) | lo);
+            LANES(
+                pc[i] = sel16(m, target, pc[i]);
+                cyc[i] = 3; )
+            moved = true;
+            break;
+
+        default:
+            return false;
+    }
+
+    /* advance past instructions that did not set the program counter. */
+    if (!moved)
+    {
+        LANES(pc[i] = sel16(m, next, pc[i]);)
+    }
+
+    /* charge the cycles. */
+    LANES(
+        batch->budget[i] -= m ? cyc[i] : 0;
+        batch->cycles[i] += m ? cyc[i] : 0; )
+
+    return true;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file j65c02_batch_release.c
+ *
+ * \brief Release a lockstep batch.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_batch_internal.h"
+
+/**
+ * \brief Release a lockstep batch.
+ *
+ * \note After this call, the batch pointer is no longer valid. The instances in
+ * this batch are not released.
+ *
+ * \param batch             The batch to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_batch_release)(JEMU_SYM(j65c02_batch)* batch)
+{
+    /* clear the batch memory. */
+    memset(batch, 0, sizeof(*batch));
+
+    /* free memory. */
+    free(batch);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
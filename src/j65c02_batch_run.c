@@ -0,0 +1,309 @@
+/**
+ * \file j65c02_batch_run.c
+ *
+ * \brief Run a lockstep batch.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_batch_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_batch;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Copy a lane's registers from its instance.
+ */
+static void lane_load(JEMU_SYM(j65c02_batch)* batch, size_t i)
+{
+    const j65c02* inst = batch->insts[i];
+
+    batch->reg_a[i] = inst->reg_a;
+    batch->reg_x[i] = inst->reg_x;
+    batch->reg_y[i] = inst->reg_y;
+    batch->reg_sp[i] = inst->reg_sp;
+    batch->reg_status[i] = inst->reg_status;
+    batch->reg_pc[i] = inst->reg_pc;
+}
+
+/**
+ * \brief Copy a lane's registers to its instance.
+ */
+static void lane_store(JEMU_SYM(j65c02_batch)* batch, size_t i)
+{
+    j65c02* inst = batch->insts[i];
+
+    inst->reg_a = batch->reg_a[i];
+    inst->reg_x = batch->reg_x[i];
+    inst->reg_y = batch->reg_y[i];
+    inst->reg_sp = batch->reg_sp[i];
+    inst->reg_status = batch->reg_status[i];
+    inst->reg_pc = batch->reg_pc[i];
+}
+
+/**
+ * \brief Retire a lane that no longer has the budget for its next instruction.
+ */
+static void lane_out_of_budget(JEMU_SYM(j65c02_batch)* batch, size_t i)
+{
+    batch->insts[i]->cycle_delta = batch->budget[i];
+    batch->active[i] = 0;
+    batch->mask[i] = 0;
+}
+
+/**
+ * \brief Run a single instruction on a lane's own instance.
+ */
+static void lane_scalar_step(
+    JEMU_SYM(j65c02_batch)* batch, size_t i, JEMU_SYM(status)* results)
+{
+    j65c02* inst = batch->insts[i];
+    status retval;
+    uint8_t ins;
+    int ins_cycles = 0;
+
+    lane_store(batch, i);
+
+    /* fetch an instruction, or take the one the last run fetched. */
+    retval = j65c02_opcode_fetch(&ins, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        results[i] = retval;
+        batch->active[i] = 0;
+        goto done;
+    }
+
+    /* decode the instruction. */
+    const j65c02_instruction* ins_fn =
+        JEMU_SYM(global_j65c02_instructions) + ins;
+
+    /* do we have the budget to run this instruction? */
+    if (batch->budget[i] <= ins_fn->max_cycles)
+    {
+        j65c02_opcode_keep(inst, ins);
+        lane_out_of_budget(batch, i);
+        goto done;
+    }
+
+    /* execute the instruction. */
+    retval = ins_fn->exec(inst, &ins_cycles);
+    if (STATUS_SUCCESS != retval)
+    {
+        results[i] = retval;
+        batch->active[i] = 0;
+        goto done;
+    }
+
+    batch->budget[i] -= ins_cycles;
+    inst->cycle_count += ins_cycles;
+
+    /* a stopped or waiting lane is done for this run. */
+    if (inst->crash || inst->stopped || inst->wait)
+    {
+        batch->active[i] = 0;
+    }
+
+done:
+    lane_load(batch, i);
+}
+
+/**
+ * \brief Run every lane of a batch for the given number of cycles.
+ *
+ * \note Each lane ends in the same state, with the same cycle delta and cycle
+ * count, as if its instance had been run by \ref j65c02_run for this many
+ * cycles.
+ *
+ * \param batch             The batch to run.
+ * \param cycles            The number of cycles to run each lane.
+ * \param results           Set to the status of each lane, as would be
+ *                          returned by \ref j65c02_run.
+ * \param stats             Optional pointer set to the statistics for this
+ *                          run; may be NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if the batch ran, even if individual lanes failed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_batch_run)(
+    JEMU_SYM(j65c02_batch)* batch, int cycles, JEMU_SYM(status)* results,
+    JEMU_SYM(j65c02_batch_stats)* stats)
+{
+    uint64_t lockstep = 0, scalar = 0;
+
+    /* load each lane from its instance. */
+    for (size_t i = 0; i < batch->count; ++i)
+    {
+        j65c02* inst = batch->insts[i];
+
+        /* a lane with its own dispatch table, or with anything to do between
+         * instructions, is run on its own instance. */
+        if (j65c02_run_instrumented(inst)
+         || inst->instructions != JEMU_SYM(global_j65c02_instructions))
+        {
+            results[i] = j65c02_run(inst, cycles);
+            lane_load(batch, i);
+            batch->cycles[i] = 0;
+            batch->active[i] = 0;
+            continue;
+        }
+
+        lane_load(batch, i);
+        batch->budget[i] = cycles + inst->cycle_delta;
+        batch->cycles[i] = 0;
+        inst->cycle_delta = 0;
+        results[i] = STATUS_SUCCESS;
+
+        if (inst->crash)
+        {
+            results[i] = JEMU_ERROR_INVALID_PROCESSOR_STATE;
+            batch->active[i] = 0;
+        }
+        else
+        {
+            batch->active[i] = (inst->stopped || inst->wait) ? 0 : 0xFF;
+        }
+
+        /* a lane left with a fetched opcode by its last run takes it alone. */
+        if (batch->active[i] && inst->opcode_pending)
+        {
+            lane_scalar_step(batch, i, results);
+            ++scalar;
+        }
+    }
+
+    for (;;)
+    {
+        size_t leader = batch->count;
+        size_t members = 0;
+        uint8_t opcode, lo = 0, hi = 0;
+        size_t length;
+
+        /* the first active lane leads this instruction. */
+        for (size_t i = 0; i < batch->count; ++i)
+        {
+            if (batch->active[i])
+            {
+                leader = i;
+                break;
+            }
+        }
+
+        if (leader == batch->count)
+        {
+            break;
+        }
+
+        /* gather every active lane at the leader's program counter. */
+        uint16_t pc = batch->reg_pc[leader];
+        for (size_t i = 0; i < batch->count; ++i)
+        {
+            batch->mask[i] =
+                (batch->active[i] && batch->reg_pc[i] == pc) ? 0xFF : 0x00;
+        }
+
+        /* fetch the opcode once, through the leader, which keeps it pending
+         * until it is executed. */
+        j65c02* lead = batch->insts[leader];
+        if (lead->opcode_pending)
+        {
+            opcode = lead->pending_opcode;
+        }
+        else if (STATUS_SUCCESS
+                    != lead->read(lead->user_context, pc, &opcode))
+        {
+            goto scalar_path;
+        }
+        else
+        {
+            lead->pending_opcode = opcode;
+            lead->opcode_pending = true;
+        }
+
+        length = JEMU_SYM(j65c02_batch_lockstep_length)(opcode);
+        if (0 == length)
+        {
+            goto scalar_path;
+        }
+
+        /* retire the lanes without the budget for this instruction. */
+        const j65c02_instruction* ins_fn =
+            JEMU_SYM(global_j65c02_instructions) + opcode;
+        for (size_t i = 0; i < batch->count; ++i)
+        {
+            if (batch->mask[i])
+            {
+                if (batch->budget[i] <= ins_fn->max_cycles)
+                {
+                    lane_out_of_budget(batch, i);
+                }
+                else
+                {
+                    ++members;
+                }
+            }
+        }
+
+        if (0 == members)
+        {
+            continue;
+        }
+
+        /* fetch the operands once, through the leader. */
+        if (length > 1
+         && STATUS_SUCCESS
+                != lead->read(lead->user_context, (uint16_t)(pc + 1), &lo))
+        {
+            goto scalar_path;
+        }
+        if (length > 2
+         && STATUS_SUCCESS
+                != lead->read(lead->user_context, (uint16_t)(pc + 2), &hi))
+        {
+            goto scalar_path;
+        }
+
+        /* execute the instruction across the lanes. */
+        if (JEMU_SYM(j65c02_batch_lockstep)(batch, opcode, lo, hi))
+        {
+            if (batch->mask[leader])
+            {
+                lead->opcode_pending = false;
+            }
+
+            lockstep += members;
+            continue;
+        }
+
+    scalar_path:
+        /* run each lane at this program counter on its own instance. */
+        for (size_t i = 0; i < batch->count; ++i)
+        {
+            if (batch->mask[i])
+            {
+                lane_scalar_step(batch, i, results);
+                ++scalar;
+            }
+        }
+    }
+
+    /* store each lane back to its instance. */
+    for (size_t i = 0; i < batch->count; ++i)
+    {
+        lane_store(batch, i);
+        batch->insts[i]->cycle_count += batch->cycles[i];
+    }
+
+    if (NULL != stats)
+    {
+        stats->lockstep_instructions = lockstep;
+        stats->scalar_instructions = scalar;
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file j65c02_breakpoint_clear.c
+ *
+ * \brief Clear breakpoints at an address.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Clear breakpoints at an address.
+ *
+ * \note The watchpoint bus stays interposed once installed; with no
+ * watchpoints set, it costs a page count check per access.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address to clear.
+ * \param kinds             The JEMU_BREAKPOINT_* kinds to clear.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DEBUG_DISABLED if debugging is not enabled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_breakpoint_clear)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, int kinds)
+{
+    j65c02_debug* debug = inst->debug;
+    uint8_t mask = 1 << (addr & 7);
+
+    if (NULL == debug)
+    {
+        return JEMU_ERROR_DEBUG_DISABLED;
+    }
+
+    /* clear the bit for each kind, uncounting it in its page. */
+    for (int index = 0; index < JEMU_DEBUG_INDEXES; ++index)
+    {
+        if ((kinds & (1 << index))
+         && (debug->bits[index][addr >> 3] & mask))
+        {
+            debug->bits[index][addr >> 3] &= ~mask;
+            --debug->page_counts[index][addr >> 8];
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
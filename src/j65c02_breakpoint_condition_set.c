@@ -0,0 +1,519 @@
+/**
+ * \file j65c02_breakpoint_condition_set.c
+ *
+ * \brief Compile a condition on the breakpoints at an address.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief The state of a condition compiler.
+ */
+typedef struct compiler compiler;
+
+struct compiler
+{
+    const char* pos;
+    bool error;
+    int depth;
+    int nesting;
+    size_t count;
+    j65c02_debug_op ops[JEMU_DEBUG_CONDITION_MAX_OPS];
+};
+
+/**
+ * \brief The deepest nesting of parentheses, memory references, and unary
+ * operators.
+ */
+#define MAX_NESTING 32
+
+/**
+ * \brief A binary operator.
+ */
+typedef struct binary_op binary_op;
+
+struct binary_op
+{
+    const char* token;
+    uint8_t op;
+};
+
+static const binary_op bitor_ops[] = {
+    { "|", JEMU_DEBUG_OP_OR }, { NULL, 0 } };
+static const binary_op bitxor_ops[] = {
+    { "^", JEMU_DEBUG_OP_XOR }, { NULL, 0 } };
+static const binary_op bitand_ops[] = {
+    { "&", JEMU_DEBUG_OP_AND }, { NULL, 0 } };
+static const binary_op equality_ops[] = {
+    { "==", JEMU_DEBUG_OP_EQ }, { "!=", JEMU_DEBUG_OP_NE }, { NULL, 0 } };
+static const binary_op relational_ops[] = {
+    { "<=", JEMU_DEBUG_OP_LE }, { ">=", JEMU_DEBUG_OP_GE },
+    { "<", JEMU_DEBUG_OP_LT }, { ">", JEMU_DEBUG_OP_GT }, { NULL, 0 } };
+static const binary_op shift_ops[] = {
+    { "<<", JEMU_DEBUG_OP_SHL }, { ">>", JEMU_DEBUG_OP_SHR }, { NULL, 0 } };
+static const binary_op additive_ops[] = {
+    { "+", JEMU_DEBUG_OP_ADD }, { "-", JEMU_DEBUG_OP_SUB }, { NULL, 0 } };
+static const binary_op multiplicative_ops[] = {
+    { "*", JEMU_DEBUG_OP_MUL }, { "/", JEMU_DEBUG_OP_DIV },
+    { "%", JEMU_DEBUG_OP_MOD }, { NULL, 0 } };
+
+/**
+ * \brief The binary operators from the loosest binding to the tightest, as in
+ * C.
+ */
+static const binary_op* const binary_levels[] = {
+    bitor_ops, bitxor_ops, bitand_ops, equality_ops, relational_ops,
+    shift_ops, additive_ops, multiplicative_ops };
+
+#define BINARY_LEVELS (sizeof(binary_levels) / sizeof(binary_levels[0]))
+
+/**
+ * \brief The names that can be used in a condition, and the code for each.
+ * A flag pushes the status register masked to its bit.
+ */
+typedef struct name_op name_op;
+
+struct name_op
+{
+    const char* name;
+    uint8_t op;
+    uint8_t flag;
+};
+
+static const name_op names[] = {
+    { "A", JEMU_DEBUG_OP_A, 0 },
+    { "X", JEMU_DEBUG_OP_X, 0 },
+    { "Y", JEMU_DEBUG_OP_Y, 0 },
+    { "SP", JEMU_DEBUG_OP_SP, 0 },
+    { "S", JEMU_DEBUG_OP_SP, 0 },
+    { "P", JEMU_DEBUG_OP_P, 0 },
+    { "PC", JEMU_DEBUG_OP_PC, 0 },
+    { "CYCLES", JEMU_DEBUG_OP_CYCLES, 0 },
+    { "N", JEMU_DEBUG_OP_P, 0x80 },
+    { "V", JEMU_DEBUG_OP_P, 0x40 },
+    { "D", JEMU_DEBUG_OP_P, 0x08 },
+    { "I", JEMU_DEBUG_OP_P, 0x04 },
+    { "Z", JEMU_DEBUG_OP_P, 0x02 },
+    { "C", JEMU_DEBUG_OP_P, 0x01 },
+    { NULL, 0, 0 } };
+
+static void emit(compiler* c, uint8_t op, int64_t imm, int depth);
+static bool match(compiler* c, const char* token);
+static void parse_logical(compiler* c, bool is_or);
+static void parse_binary(compiler* c, size_t level);
+static void parse_unary(compiler* c);
+static void parse_primary(compiler* c);
+static void parse_number(compiler* c);
+static void parse_name(compiler* c);
+
+/**
+ * \brief Set the condition on the breakpoints at an address.
+ *
+ * \note A condition is an expression in C syntax over the registers A, X, Y,
+ * SP, P, and PC, the flags N, V, D, I, Z, and C, CYCLES, and memory as
+ * mem[addr]. The operators are the unary ! - ~, and the binary * / % + - << >>
+ * < <= > >= == != & ^ | && ||, with the precedence they have in C. Values are
+ * signed 64-bit integers whose arithmetic wraps around, and a division or
+ * remainder by zero gives zero. Numbers are decimal, or hex with a '$' or "0x"
+ * prefix, or binary with a '%' prefix. The condition is compiled into bytecode
+ * by this call, and the breakpoints at this address only fire when it is
+ * non-zero. PC is the address of the instruction that hit the breakpoint, and
+ * memory is read through the bus of the instance, beneath its watchpoints.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address of the breakpoints.
+ * \param condition         The condition, or NULL to remove it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DEBUG_DISABLED if debugging is not enabled.
+ *      - JEMU_ERROR_BREAKPOINT_BAD_CONDITION if the condition does not
+ *        compile; the previous condition is kept.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_breakpoint_condition_set)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, const char* condition)
+{
+    j65c02_debug* debug = inst->debug;
+    j65c02_debug_condition* compiled = NULL;
+    j65c02_debug_condition** link;
+    compiler c;
+
+    if (NULL == debug)
+    {
+        return JEMU_ERROR_DEBUG_DISABLED;
+    }
+
+    if (NULL != condition)
+    {
+        memset(&c, 0, sizeof(c));
+        c.pos = condition;
+
+        /* the whole condition must compile. */
+        parse_logical(&c, true);
+        match(&c, "");
+        if (c.error || '\0' != *c.pos)
+        {
+            return JEMU_ERROR_BREAKPOINT_BAD_CONDITION;
+        }
+
+        compiled = malloc(sizeof(*compiled) + c.count * sizeof(c.ops[0]));
+        if (NULL == compiled)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        compiled->addr = addr;
+        compiled->count = c.count;
+        compiled->ops = (j65c02_debug_op*)(compiled + 1);
+        memcpy(compiled->ops, c.ops, c.count * sizeof(c.ops[0]));
+    }
+
+    /* replace the condition at this address. */
+    for (link = &debug->conditions; NULL != *link; link = &(*link)->next)
+    {
+        if (addr == (*link)->addr)
+        {
+            j65c02_debug_condition* old = *link;
+
+            *link = old->next;
+            free(old);
+            break;
+        }
+    }
+
+    if (NULL != compiled)
+    {
+        compiled->next = debug->conditions;
+        debug->conditions = compiled;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Emit an operation, tracking the depth of the stack it runs on.
+ */
+static void emit(compiler* c, uint8_t op, int64_t imm, int depth)
+{
+    if (JEMU_DEBUG_CONDITION_MAX_OPS == c->count)
+    {
+        c->error = true;
+        return;
+    }
+
+    c->ops[c->count].op = op;
+    c->ops[c->count].imm = imm;
+    ++c->count;
+
+    c->depth += depth;
+    if (c->depth > JEMU_DEBUG_CONDITION_MAX_DEPTH)
+    {
+        c->error = true;
+    }
+}
+
+/**
+ * \brief Skip spaces, then match a token, which must not be the start of a
+ * longer operator.
+ */
+static bool match(compiler* c, const char* token)
+{
+    size_t len = strlen(token);
+    const char* pos = c->pos;
+
+    while (isspace((unsigned char)*pos))
+    {
+        ++pos;
+    }
+
+    c->pos = pos;
+
+    if (0 != strncmp(pos, token, len))
+    {
+        return false;
+    }
+
+    /* "&" is not the start of "&&", nor "<" the start of "<=" or "<<". */
+    if (1 == len
+     && ((pos[0] == pos[1] && NULL != strchr("&|<>", pos[0]))
+      || ('=' == pos[1] && NULL != strchr("<>!=", pos[0]))))
+    {
+        return false;
+    }
+
+    c->pos = pos + len;
+
+    return true;
+}
+
+/**
+ * \brief Parse a chain of || or && operators, which short circuit.
+ */
+static void parse_logical(compiler* c, bool is_or)
+{
+    if (is_or)
+    {
+        parse_logical(c, false);
+    }
+    else
+    {
+        parse_binary(c, 0);
+    }
+
+    while (!c->error && match(c, is_or ? "||" : "&&"))
+    {
+        size_t jump = c->count;
+
+        /* the jump pops the left hand side when it falls through. */
+        emit(
+            c, is_or ? JEMU_DEBUG_OP_JUMP_TRUE : JEMU_DEBUG_OP_JUMP_FALSE, 0,
+            -1);
+
+        if (is_or)
+        {
+            parse_logical(c, false);
+        }
+        else
+        {
+            parse_binary(c, 0);
+        }
+
+        if (!c->error)
+        {
+            c->ops[jump].imm = c->count - jump - 1;
+            emit(c, JEMU_DEBUG_OP_BOOL, 0, 0);
+        }
+    }
+}
+
+/**
+ * \brief Parse the binary operators of a level, and those binding tighter.
+ */
+static void parse_binary(compiler* c, size_t level)
+{
+    if (BINARY_LEVELS == level)
+    {
+        parse_unary(c);
+        return;
+    }
+
+    parse_binary(c, level + 1);
+
+    while (!c->error)
+    {
+        const binary_op* op = binary_levels[level];
+
+        while (NULL != op->token && !match(c, op->token))
+        {
+            ++op;
+        }
+
+        if (NULL == op->token)
+        {
+            return;
+        }
+
+        parse_binary(c, level + 1);
+        emit(c, op->op, 0, -1);
+    }
+}
+
+/**
+ * \brief Parse a unary operator, or a primary expression.
+ */
+static void parse_unary(compiler* c)
+{
+    uint8_t op;
+
+    if (match(c, "!"))
+    {
+        op = JEMU_DEBUG_OP_NOT;
+    }
+    else if (match(c, "-"))
+    {
+        op = JEMU_DEBUG_OP_NEG;
+    }
+    else if (match(c, "~"))
+    {
+        op = JEMU_DEBUG_OP_INV;
+    }
+    else
+    {
+        parse_primary(c);
+        return;
+    }
+
+    /* a unary operator nests its operand, like a parenthesis. */
+    if (c->error || ++c->nesting > MAX_NESTING)
+    {
+        c->error = true;
+        return;
+    }
+
+    parse_unary(c);
+    emit(c, op, 0, 0);
+
+    --c->nesting;
+}
+
+/**
+ * \brief Parse a parenthesized expression, a number, or a name.
+ */
+static void parse_primary(compiler* c)
+{
+    if (c->error || ++c->nesting > MAX_NESTING)
+    {
+        c->error = true;
+        return;
+    }
+
+    if (match(c, "("))
+    {
+        parse_logical(c, true);
+        if (!match(c, ")"))
+        {
+            c->error = true;
+        }
+    }
+    else if (isalpha((unsigned char)*c->pos))
+    {
+        parse_name(c);
+    }
+    else
+    {
+        parse_number(c);
+    }
+
+    --c->nesting;
+}
+
+/**
+ * \brief Parse a decimal, hex, or binary number.
+ */
+static void parse_number(compiler* c)
+{
+    const char* pos = c->pos;
+    int64_t value = 0;
+    int base = 10;
+    int digits = 0;
+
+    if ('$' == *pos)
+    {
+        base = 16;
+        ++pos;
+    }
+    else if ('0' == pos[0] && ('x' == pos[1] || 'X' == pos[1]))
+    {
+        base = 16;
+        pos += 2;
+    }
+    else if ('%' == *pos)
+    {
+        base = 2;
+        ++pos;
+    }
+
+    for (;; ++pos, ++digits)
+    {
+        int digit;
+
+        if (isdigit((unsigned char)*pos))
+        {
+            digit = *pos - '0';
+        }
+        else if (isxdigit((unsigned char)*pos))
+        {
+            digit = tolower((unsigned char)*pos) - 'a' + 10;
+        }
+        else
+        {
+            break;
+        }
+
+        if (digit >= base || value > (INT64_MAX - digit) / base)
+        {
+            c->error = true;
+            return;
+        }
+
+        value = value * base + digit;
+    }
+
+    if (0 == digits)
+    {
+        c->error = true;
+        return;
+    }
+
+    c->pos = pos;
+    emit(c, JEMU_DEBUG_OP_PUSH, value, 1);
+}
+
+/**
+ * \brief Parse a register, a flag, CYCLES, or a memory reference.
+ */
+static void parse_name(compiler* c)
+{
+    const char* start = c->pos;
+    size_t len = 0;
+
+    while (isalnum((unsigned char)start[len]) || '_' == start[len])
+    {
+        ++len;
+    }
+
+    c->pos = start + len;
+
+    /* mem[addr] reads a byte of guest memory. */
+    if (3 == len && 0 == strncasecmp(start, "mem", 3))
+    {
+        if (!match(c, "["))
+        {
+            c->error = true;
+            return;
+        }
+
+        parse_logical(c, true);
+        if (!match(c, "]"))
+        {
+            c->error = true;
+            return;
+        }
+
+        emit(c, JEMU_DEBUG_OP_MEM, 0, 0);
+        return;
+    }
+
+    for (const name_op* name = names; NULL != name->name; ++name)
+    {
+        if (len == strlen(name->name)
+         && 0 == strncasecmp(start, name->name, len))
+        {
+            emit(c, name->op, 0, 1);
+            if (0 != name->flag)
+            {
+                emit(c, JEMU_DEBUG_OP_PUSH, name->flag, 1);
+                emit(c, JEMU_DEBUG_OP_AND, 0, -1);
+                emit(c, JEMU_DEBUG_OP_BOOL, 0, 0);
+            }
+
+            return;
+        }
+    }
+
+    c->error = true;
+}
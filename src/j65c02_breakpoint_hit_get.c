@@ -0,0 +1,46 @@
+/**
+ * \file j65c02_breakpoint_hit_get.c
+ *
+ * \brief Get the breakpoint hit that last stopped a run or step.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Get the breakpoint hit that last stopped a run or step.
+ *
+ * \param inst              The instance to query.
+ * \param hit               Set to the last hit.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DEBUG_DISABLED if debugging is not enabled.
+ *      - JEMU_ERROR_BREAKPOINT_NO_HIT if no breakpoint has fired.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_breakpoint_hit_get)(
+    const JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_breakpoint_hit)* hit)
+{
+    const j65c02_debug* debug = inst->debug;
+
+    if (NULL == debug)
+    {
+        return JEMU_ERROR_DEBUG_DISABLED;
+    }
+
+    if (!debug->has_hit)
+    {
+        return JEMU_ERROR_BREAKPOINT_NO_HIT;
+    }
+
+    *hit = debug->hit;
+
+    return STATUS_SUCCESS;
+}
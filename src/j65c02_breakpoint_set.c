@@ -0,0 +1,68 @@
+/**
+ * \file j65c02_breakpoint_set.c
+ *
+ * \brief Set breakpoints at an address.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Set breakpoints at an address.
+ *
+ * \note Read watchpoints fire on every bus read of the address, including
+ * instruction fetches and stack pulls.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address to break at.
+ * \param kinds             The JEMU_BREAKPOINT_* kinds to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DEBUG_DISABLED if debugging is not enabled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_breakpoint_set)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, int kinds)
+{
+    j65c02_debug* debug = inst->debug;
+    uint8_t mask = 1 << (addr & 7);
+
+    if (NULL == debug)
+    {
+        return JEMU_ERROR_DEBUG_DISABLED;
+    }
+
+    /* set the bit for each kind, counting it in its page. */
+    for (int index = 0; index < JEMU_DEBUG_INDEXES; ++index)
+    {
+        if ((kinds & (1 << index))
+         && !(debug->bits[index][addr >> 3] & mask))
+        {
+            debug->bits[index][addr >> 3] |= mask;
+            ++debug->page_counts[index][addr >> 8];
+        }
+    }
+
+    /* interpose on the bus for the first watchpoint. */
+    if ((kinds & (JEMU_BREAKPOINT_READ | JEMU_BREAKPOINT_WRITE))
+     && !debug->interposed)
+    {
+        debug->read = inst->read;
+        debug->write = inst->write;
+        debug->context = inst->user_context;
+        debug->interposed = true;
+
+        inst->read = &JEMU_SYM(j65c02_debug_read);
+        inst->write = &JEMU_SYM(j65c02_debug_write);
+        inst->user_context = debug;
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,36 @@
+/**
+ * \file j65c02_coverage_attach.c
+ *
+ * \brief Attach a coverage map to an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_coverage;
+
+/**
+ * \brief Attach a coverage map to an instance, or detach it.
+ *
+ * \note The map must hold JEMU_COVERAGE_MAP_SIZE bytes, and must outlive its
+ * attachment. It is not cleared by this call. Edges are counted by
+ * \ref j65c02_run, \ref j65c02_step, history runs, and interrupts, but not by
+ * batches.
+ *
+ * \param inst              The instance for this operation.
+ * \param map               The coverage map, or NULL to detach the map.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_coverage_attach)(JEMU_SYM(j65c02)* inst, uint8_t* map)
+{
+    inst->coverage = map;
+
+    return STATUS_SUCCESS;
+}
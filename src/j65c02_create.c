@@ -3,12 +3,11 @@
  *
  * \brief Create an emulator instance.
  *
- * \copyright 2022 Justin Handville.  Please see LICENSE.txt in this
+ * \copyright 2022-2026 Justin Handville.  Please see LICENSE.txt in this
  * distribution for the license terms under which this software is distributed.
  */
 
 #include <stdlib.h>
-#include <string.h>
 
 #include "jemu65c02_internal.h"
 
@@ -41,7 +40,7 @@ JEMU_SYM(j65c02_create)(
     JEMU_SYM(j65c02_write_fn) write, void* context, int personality,
     int emulation_mode)
 {
-    status retval, release_retval;
+    status retval;
     j65c02* tmp;
 
     /* allocate memory for the emulator instance. */
@@ -52,43 +51,18 @@ JEMU_SYM(j65c02_create)(
         goto done;
     }
 
-    /* clear out the structure. */
-    memset(tmp, 0, sizeof(*tmp));
-
-    /* start the processor in crash mode; reset must be called to reset it. */
-    tmp->crash = true;
-
-    /* verify and set the personality. */
-    switch (personality)
+    /* initialize the instance in this memory. */
+    retval =
+        j65c02_init(
+            &tmp, tmp, sizeof(*tmp), read, write, context, personality,
+            emulation_mode);
+    if (STATUS_SUCCESS != retval)
     {
-        case JEMU_65c02_PERSONALITY_MOS:
-        case JEMU_65c02_PERSONALITY_ROCKWELL:
-        case JEMU_65c02_PERSONALITY_WDC:
-            tmp->personality = personality;
-            break;
-
-        default:
-            retval = JEMU_ERROR_INVALID_PERSONALITY;
-            goto cleanup_tmp;
+        goto cleanup_tmp;
     }
 
-    /* verify and set the emulation mode. */
-    switch (emulation_mode)
-    {
-        case JEMU_65c02_EMULATION_MODE_STRICT:
-        case JEMU_65c02_EMULATION_MODE_NOP:
-            tmp->emulation_mode = emulation_mode;
-            break;
-
-        default:
-            retval = JEMU_ERROR_INVALID_EMULATION_MODE;
-            goto cleanup_tmp;
-    }
-
-    /* set user values. */
-    tmp->user_context = context;
-    tmp->read = read;
-    tmp->write = write;
+    /* this instance owns its memory. */
+    tmp->storage = JEMU_J65C02_STORAGE_HEAP;
 
     /* success. */
     *inst = tmp;
@@ -96,11 +70,7 @@ JEMU_SYM(j65c02_create)(
     goto done;
 
 cleanup_tmp:
-    release_retval = j65c02_release(tmp);
-    if (STATUS_SUCCESS != release_retval)
-    {
-        retval = release_retval;
-    }
+    free(tmp);
 
 done:
     return retval;
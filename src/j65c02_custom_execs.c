@@ -0,0 +1,82 @@
+/**
+ * \file j65c02_custom_execs.c
+ *
+ * \brief The custom opcode handlers.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Fetch the operand of a custom opcode, call its handler, and charge
+ * its cycles.
+ */
+static status custom_exec(j65c02* inst, int* cycles, uint8_t opcode)
+{
+    const j65c02_custom_opcode* custom = inst->custom->opcodes + opcode;
+    uint16_t operand = 0;
+    uint8_t val;
+    status retval;
+
+    for (int i = 0; i < custom->operand_length; ++i)
+    {
+        retval = j65c02_fetch(&val, inst);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        operand |= val << (8 * i);
+    }
+
+    retval = custom->fn(custom->context, inst, operand);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *cycles = custom->cycles;
+
+    return STATUS_SUCCESS;
+}
+
+/* one handler per opcode, each passing its opcode to custom_exec. */
+#define CUSTOM(n) \
+    static status custom_ ## n(j65c02* inst, int* cycles) { \
+        return custom_exec(inst, cycles, 0x ## n); }
+#define CUSTOM_ROW(r) \
+    CUSTOM(r ## 0) CUSTOM(r ## 1) CUSTOM(r ## 2) CUSTOM(r ## 3) \
+    CUSTOM(r ## 4) CUSTOM(r ## 5) CUSTOM(r ## 6) CUSTOM(r ## 7) \
+    CUSTOM(r ## 8) CUSTOM(r ## 9) CUSTOM(r ## A) CUSTOM(r ## B) \
+    CUSTOM(r ## C) CUSTOM(r ## D) CUSTOM(r ## E) CUSTOM(r ## F)
+
+CUSTOM_ROW(0) CUSTOM_ROW(1) CUSTOM_ROW(2) CUSTOM_ROW(3)
+CUSTOM_ROW(4) CUSTOM_ROW(5) CUSTOM_ROW(6) CUSTOM_ROW(7)
+CUSTOM_ROW(8) CUSTOM_ROW(9) CUSTOM_ROW(A) CUSTOM_ROW(B)
+CUSTOM_ROW(C) CUSTOM_ROW(D) CUSTOM_ROW(E) CUSTOM_ROW(F)
+
+#define CUSTOM_ENTRY_ROW(r) \
+    &custom_ ## r ## 0, &custom_ ## r ## 1, &custom_ ## r ## 2, \
+    &custom_ ## r ## 3, &custom_ ## r ## 4, &custom_ ## r ## 5, \
+    &custom_ ## r ## 6, &custom_ ## r ## 7, &custom_ ## r ## 8, \
+    &custom_ ## r ## 9, &custom_ ## r ## A, &custom_ ## r ## B, \
+    &custom_ ## r ## C, &custom_ ## r ## D, &custom_ ## r ## E, \
+    &custom_ ## r ## F
+
+/**
+ * \brief The custom opcode handlers, which fetch the operand of a custom
+ * opcode of an instance and call its handler.
+ */
+JEMU_SYM(status) (* const JEMU_SYM(global_j65c02_custom_execs)[256])(
+    JEMU_SYM(j65c02)* inst, int* cycles) = {
+    CUSTOM_ENTRY_ROW(0), CUSTOM_ENTRY_ROW(1), CUSTOM_ENTRY_ROW(2),
+    CUSTOM_ENTRY_ROW(3), CUSTOM_ENTRY_ROW(4), CUSTOM_ENTRY_ROW(5),
+    CUSTOM_ENTRY_ROW(6), CUSTOM_ENTRY_ROW(7), CUSTOM_ENTRY_ROW(8),
+    CUSTOM_ENTRY_ROW(9), CUSTOM_ENTRY_ROW(A), CUSTOM_ENTRY_ROW(B),
+    CUSTOM_ENTRY_ROW(C), CUSTOM_ENTRY_ROW(D), CUSTOM_ENTRY_ROW(E),
+    CUSTOM_ENTRY_ROW(F) };
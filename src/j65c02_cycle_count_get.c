@@ -0,0 +1,25 @@
+/**
+ * \file j65c02_cycle_count_get.c
+ *
+ * \brief Getter for the cycle count.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Get the total number of cycles executed by this emulator instance.
+ *
+ * \note This count includes every instruction executed by \ref j65c02_run and
+ * \ref j65c02_step since the instance was created.
+ *
+ * \param inst              The instance to query.
+ *
+ * \returns the cycle count.
+ */
+uint64_t JEMU_SYM(j65c02_cycle_count_get)(const JEMU_SYM(j65c02)* inst)
+{
+    return inst->cycle_count;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file j65c02_debug_bus.c
+ *
+ * \brief The bus callbacks installed by watchpoints.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief The read callback installed by watchpoints.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_debug_read)(
+    void* context, uint16_t addr, uint8_t* val)
+{
+    j65c02_debug* debug = (j65c02_debug*)context;
+    status retval;
+
+    /* the access completes, and the instance stops after this
+     * instruction. */
+    retval = debug->read(debug->context, addr, val);
+    if (STATUS_SUCCESS == retval
+     && j65c02_debug_check(debug, JEMU_DEBUG_INDEX_READ, addr))
+    {
+        j65c02_debug_watch_hit(debug, JEMU_BREAKPOINT_READ, addr, *val);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief The write callback installed by watchpoints.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_debug_write)(
+    void* context, uint16_t addr, uint8_t val)
+{
+    j65c02_debug* debug = (j65c02_debug*)context;
+    status retval;
+
+    retval = debug->write(debug->context, addr, val);
+    if (STATUS_SUCCESS == retval
+     && j65c02_debug_check(debug, JEMU_DEBUG_INDEX_WRITE, addr))
+    {
+        j65c02_debug_watch_hit(debug, JEMU_BREAKPOINT_WRITE, addr, val);
+    }
+
+    return retval;
+}
@@ -0,0 +1,210 @@
+/**
+ * \file j65c02_debug_condition_eval.c
+ *
+ * \brief Evaluate the condition on the breakpoints at an address.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Read a byte of guest memory for a condition, beneath the
+ * watchpoints. A failed read reads as zero.
+ */
+static int64_t debug_condition_mem(j65c02_debug* debug, int64_t addr)
+{
+    j65c02* inst = debug->inst;
+    uint8_t val = 0;
+    status retval;
+
+    if (debug->interposed)
+    {
+        retval = debug->read(debug->context, (uint16_t)addr, &val);
+    }
+    else
+    {
+        retval = inst->read(inst->user_context, (uint16_t)addr, &val);
+    }
+
+    return STATUS_SUCCESS == retval ? val : 0;
+}
+
+/**
+ * \brief Divide two values for a condition, or take the remainder. Division
+ * by zero gives zero, and the one quotient that overflows wraps around.
+ */
+static int64_t debug_condition_divide(int64_t lhs, int64_t rhs, uint8_t op)
+{
+    if (0 == rhs)
+    {
+        return 0;
+    }
+
+    if (-1 == rhs)
+    {
+        return
+            JEMU_DEBUG_OP_DIV == op ? (int64_t)(0 - (uint64_t)lhs) : 0;
+    }
+
+    return JEMU_DEBUG_OP_DIV == op ? lhs / rhs : lhs % rhs;
+}
+
+/**
+ * \brief Evaluate the condition on the breakpoints at an address.
+ *
+ * \note Memory in a condition is read through the bus of the instance, beneath
+ * its watchpoints.
+ *
+ * \param debug             The breakpoints of this instance.
+ * \param addr              The address of the breakpoint that fired.
+ *
+ * \returns true if there is no condition at this address, or if it holds.
+ */
+bool JEMU_SYM(j65c02_debug_condition_eval)(
+    JEMU_SYM(j65c02_debug)* debug, uint16_t addr)
+{
+    const j65c02_debug_condition* condition = debug->conditions;
+    const j65c02* inst = debug->inst;
+    int64_t stack[JEMU_DEBUG_CONDITION_MAX_DEPTH];
+    size_t top = 0;
+
+    while (NULL != condition && addr != condition->addr)
+    {
+        condition = condition->next;
+    }
+
+    if (NULL == condition)
+    {
+        return true;
+    }
+
+    /* the compiler has checked the depth of the stack, and the jumps. */
+    for (size_t i = 0; i < condition->count; ++i)
+    {
+        const j65c02_debug_op* op = condition->ops + i;
+        int64_t rhs, *lhs;
+        bool jump_true;
+
+        switch (op->op)
+        {
+            case JEMU_DEBUG_OP_PUSH:
+                stack[top++] = op->imm;
+                break;
+
+            case JEMU_DEBUG_OP_A:
+                stack[top++] = inst->reg_a;
+                break;
+
+            case JEMU_DEBUG_OP_X:
+                stack[top++] = inst->reg_x;
+                break;
+
+            case JEMU_DEBUG_OP_Y:
+                stack[top++] = inst->reg_y;
+                break;
+
+            case JEMU_DEBUG_OP_SP:
+                stack[top++] = inst->reg_sp;
+                break;
+
+            case JEMU_DEBUG_OP_P:
+                stack[top++] = inst->reg_status;
+                break;
+
+            case JEMU_DEBUG_OP_PC:
+                stack[top++] = debug->pc;
+                break;
+
+            case JEMU_DEBUG_OP_CYCLES:
+                stack[top++] = (int64_t)inst->cycle_count;
+                break;
+
+            case JEMU_DEBUG_OP_MEM:
+                stack[top - 1] = debug_condition_mem(debug, stack[top - 1]);
+                break;
+
+            case JEMU_DEBUG_OP_NOT:
+                stack[top - 1] = !stack[top - 1];
+                break;
+
+            case JEMU_DEBUG_OP_NEG:
+                stack[top - 1] = (int64_t)(0 - (uint64_t)stack[top - 1]);
+                break;
+
+            case JEMU_DEBUG_OP_INV:
+                stack[top - 1] = ~stack[top - 1];
+                break;
+
+            case JEMU_DEBUG_OP_BOOL:
+                stack[top - 1] = !!stack[top - 1];
+                break;
+
+            /* a jump that is taken leaves its value on the stack. */
+            case JEMU_DEBUG_OP_JUMP_FALSE:
+            case JEMU_DEBUG_OP_JUMP_TRUE:
+                jump_true = JEMU_DEBUG_OP_JUMP_TRUE == op->op;
+                if ((0 != stack[top - 1]) == jump_true)
+                {
+                    i += op->imm;
+                }
+                else
+                {
+                    --top;
+                }
+                break;
+
+            /* the rest are binary operations. */
+            default:
+                rhs = stack[--top];
+                lhs = stack + top - 1;
+                switch (op->op)
+                {
+                    case JEMU_DEBUG_OP_MUL:
+                        *lhs = (int64_t)((uint64_t)*lhs * (uint64_t)rhs);
+                        break;
+
+                    case JEMU_DEBUG_OP_DIV:
+                    case JEMU_DEBUG_OP_MOD:
+                        *lhs = debug_condition_divide(*lhs, rhs, op->op);
+                        break;
+
+                    case JEMU_DEBUG_OP_ADD:
+                        *lhs = (int64_t)((uint64_t)*lhs + (uint64_t)rhs);
+                        break;
+
+                    case JEMU_DEBUG_OP_SUB:
+                        *lhs = (int64_t)((uint64_t)*lhs - (uint64_t)rhs);
+                        break;
+
+                    case JEMU_DEBUG_OP_SHL:
+                        *lhs =
+                            rhs < 0 || rhs > 63
+                                ? 0 : (int64_t)((uint64_t)*lhs << rhs);
+                        break;
+
+                    /* a right shift out of range keeps only the sign. */
+                    case JEMU_DEBUG_OP_SHR:
+                        *lhs = *lhs >> (rhs < 0 || rhs > 63 ? 63 : rhs);
+                        break;
+
+                    case JEMU_DEBUG_OP_AND: *lhs &= rhs; break;
+                    case JEMU_DEBUG_OP_OR:  *lhs |= rhs; break;
+                    case JEMU_DEBUG_OP_XOR: *lhs ^= rhs; break;
+                    case JEMU_DEBUG_OP_EQ:  *lhs = *lhs == rhs; break;
+                    case JEMU_DEBUG_OP_NE:  *lhs = *lhs != rhs; break;
+                    case JEMU_DEBUG_OP_LT:  *lhs = *lhs < rhs; break;
+                    case JEMU_DEBUG_OP_LE:  *lhs = *lhs <= rhs; break;
+                    case JEMU_DEBUG_OP_GT:  *lhs = *lhs > rhs; break;
+                    case JEMU_DEBUG_OP_GE:  *lhs = *lhs >= rhs; break;
+                }
+                break;
+        }
+    }
+
+    return 0 != stack[0];
+}
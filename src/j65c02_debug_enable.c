@@ -0,0 +1,79 @@
+/**
+ * \file j65c02_debug_enable.c
+ *
+ * \brief Enable or disable debugging on an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Enable or disable debugging on an instance.
+ *
+ * \note The bitmaps are allocated by this call and freed when the instance is
+ * released. Disabling debugging clears every breakpoint and condition. Once a
+ * watchpoint is set, debugging interposes on the bus of this instance, so any
+ * other bus interposer created after that must be released before debugging
+ * is disabled.
+ *
+ * \param inst              The instance for this operation.
+ * \param enable            true to enable debugging, or false to disable it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_debug_enable)(JEMU_SYM(j65c02)* inst, bool enable)
+{
+    j65c02_debug* debug = inst->debug;
+
+    if (enable)
+    {
+        /* enabling debugging again keeps its breakpoints. */
+        if (NULL != debug)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        debug = malloc(sizeof(*debug));
+        if (NULL == debug)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        memset(debug, 0, sizeof(*debug));
+        debug->inst = inst;
+        debug->resume_cycles = UINT64_MAX;
+        inst->debug = debug;
+
+        return STATUS_SUCCESS;
+    }
+
+    if (NULL == debug)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* restore the bus wrapped by the watchpoints. */
+    if (debug->interposed)
+    {
+        inst->read = debug->read;
+        inst->write = debug->write;
+        inst->user_context = debug->context;
+    }
+
+    j65c02_debug_release(debug);
+    inst->debug = NULL;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,63 @@
+/**
+ * \file j65c02_debug_exec.c
+ *
+ * \brief Check for an execution breakpoint at the program counter.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Check for an execution breakpoint at the program counter of an
+ * instance, recording the hit if there is one.
+ *
+ * \note This is called only when the page of the program counter has an
+ * execution breakpoint. The breakpoint that stopped the last run does not
+ * fire again unless the instance has run since, and a breakpoint with a
+ * condition does not fire unless it holds.
+ *
+ * \param inst              The instance for this operation.
+ *
+ * \returns true if the instance should stop before this instruction.
+ */
+bool JEMU_SYM(j65c02_debug_exec)(JEMU_SYM(j65c02)* inst)
+{
+    j65c02_debug* debug = inst->debug;
+    uint16_t pc = inst->reg_pc;
+
+    if (!j65c02_debug_check(debug, JEMU_DEBUG_INDEX_EXEC, pc))
+    {
+        return false;
+    }
+
+    /* step over the breakpoint that stopped the last run. */
+    if (pc == debug->resume_pc && inst->cycle_count == debug->resume_cycles)
+    {
+        return false;
+    }
+
+    /* a breakpoint with a condition fires only when it holds. */
+    if (NULL != debug->conditions
+     && !j65c02_debug_condition_eval(debug, pc))
+    {
+        return false;
+    }
+
+    debug->hit.kind = JEMU_BREAKPOINT_EXEC;
+    debug->hit.addr = pc;
+    debug->hit.pc = pc;
+    debug->hit.value = 0;
+    debug->hit.cycle_count = inst->cycle_count;
+    debug->has_hit = true;
+
+    debug->resume_pc = pc;
+    debug->resume_cycles = inst->cycle_count;
+
+    return true;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file j65c02_debug_release.c
+ *
+ * \brief Free the breakpoints of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Free the breakpoints of an instance, and their conditions.
+ *
+ * \param debug             The breakpoints to free.
+ */
+void JEMU_SYM(j65c02_debug_release)(JEMU_SYM(j65c02_debug)* debug)
+{
+    j65c02_debug_condition* condition = debug->conditions;
+
+    while (NULL != condition)
+    {
+        j65c02_debug_condition* next = condition->next;
+
+        free(condition);
+        condition = next;
+    }
+
+    memset(debug, 0, sizeof(*debug));
+    free(debug);
+}
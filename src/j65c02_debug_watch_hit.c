@@ -0,0 +1,42 @@
+/**
+ * \file j65c02_debug_watch_hit.c
+ *
+ * \brief Record a watchpoint hit.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Record a watchpoint hit, unless one already fired in this instruction
+ * or its condition does not hold.
+ *
+ * \param debug             The breakpoints of this instance.
+ * \param kind              The JEMU_BREAKPOINT_* kind of watchpoint.
+ * \param addr              The address accessed.
+ * \param val               The value read or written.
+ */
+void JEMU_SYM(j65c02_debug_watch_hit)(
+    JEMU_SYM(j65c02_debug)* debug, int kind, uint16_t addr, uint8_t val)
+{
+    if (debug->triggered
+     || (NULL != debug->conditions
+      && !j65c02_debug_condition_eval(debug, addr)))
+    {
+        return;
+    }
+
+    debug->hit.kind = kind;
+    debug->hit.addr = addr;
+    debug->hit.pc = debug->pc;
+    debug->hit.value = val;
+    debug->hit.cycle_count = debug->inst->cycle_count;
+    debug->has_hit = true;
+    debug->triggered = true;
+}
@@ -0,0 +1,72 @@
+/**
+ * \file j65c02_dma_bus.c
+ *
+ * \brief The bus callbacks installed by a DMA controller.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_dma;
+
+/**
+ * \brief The read callback installed by a DMA controller.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_dma_read)(
+    void* context, uint16_t addr, uint8_t* val)
+{
+    j65c02_dma* dma = (j65c02_dma*)context;
+    uint16_t offset = addr - dma->base;
+
+    /* reading a register has no side effects. */
+    if (offset < JEMU_DMA_REGISTER_COUNT)
+    {
+        *val = dma->registers[offset];
+
+        return STATUS_SUCCESS;
+    }
+
+    return dma->read(dma->context, addr, val);
+}
+
+/**
+ * \brief The write callback installed by a DMA controller.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_dma_write)(
+    void* context, uint16_t addr, uint8_t val)
+{
+    j65c02_dma* dma = (j65c02_dma*)context;
+    uint16_t offset = addr - dma->base;
+
+    if (offset >= JEMU_DMA_REGISTER_COUNT)
+    {
+        return dma->write(dma->context, addr, val);
+    }
+
+    switch (offset)
+    {
+        /* the start bit runs a transfer once this instruction finishes. */
+        case JEMU_DMA_REG_CONTROL:
+            dma->registers[offset] = val & ~JEMU_DMA_CONTROL_START;
+            if (val & JEMU_DMA_CONTROL_START)
+            {
+                dma->pending = true;
+            }
+            break;
+
+        /* any write acknowledges a finished transfer, releasing the IRQ. */
+        case JEMU_DMA_REG_STATUS:
+            dma->registers[offset] = 0;
+            dma->irq = false;
+            break;
+
+        default:
+            dma->registers[offset] = val;
+            break;
+    }
+
+    return STATUS_SUCCESS;
+}
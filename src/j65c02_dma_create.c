@@ -0,0 +1,84 @@
+/**
+ * \file j65c02_dma_create.c
+ *
+ * \brief Create a DMA controller.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_dma;
+
+/**
+ * \brief Create a DMA controller on the bus of an instance.
+ *
+ * \note On success, the caller is given ownership of the controller and must
+ * release it by calling \ref j65c02_dma_release before the instance is
+ * released. The controller interposes on the bus of the instance, so any other
+ * bus interposer created after it must be released first.
+ *
+ * \param dma               Pointer to the controller pointer to set to the
+ *                          created controller on success.
+ * \param inst              The instance whose bus the controller sits on.
+ * \param base              The address of the first register.
+ * \param cycles_per_byte   The cycles stolen from the processor for each byte
+ *                          moved, from 0 to 32767.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_DMA_BAD_OPTIONS if the registers do not fit in the address
+ *        space, or the cycles per byte are out of range.
+ *      - JEMU_ERROR_DMA_IN_USE if the instance already has a controller.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_dma_create)(
+    JEMU_SYM(j65c02_dma)** dma, JEMU_SYM(j65c02)* inst, uint16_t base,
+    int cycles_per_byte)
+{
+    j65c02_dma* tmp;
+
+    /* the cycles of the longest transfer must fit in an int. */
+    if (base > 65536 - JEMU_DMA_REGISTER_COUNT
+     || cycles_per_byte < 0 || cycles_per_byte > INT_MAX / 65536)
+    {
+        return JEMU_ERROR_DMA_BAD_OPTIONS;
+    }
+
+    if (NULL != inst->dma)
+    {
+        return JEMU_ERROR_DMA_IN_USE;
+    }
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->inst = inst;
+    tmp->base = base;
+    tmp->cycles_per_byte = cycles_per_byte;
+
+    /* interpose the controller on the bus. */
+    tmp->read = inst->read;
+    tmp->write = inst->write;
+    tmp->context = inst->user_context;
+
+    inst->read = &JEMU_SYM(j65c02_dma_read);
+    inst->write = &JEMU_SYM(j65c02_dma_write);
+    inst->user_context = tmp;
+    inst->dma = tmp;
+
+    /* success. */
+    *dma = tmp;
+    return STATUS_SUCCESS;
+}
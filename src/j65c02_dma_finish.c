@@ -0,0 +1,312 @@
+/**
+ * \file j65c02_dma_finish.c
+ *
+ * \brief Run the transfer started on a DMA controller.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_dma;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Find the host bytes backing guest memory from an address.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The first guest address.
+ * \param length            The most bytes wanted.
+ * \param mem               Set to the host bytes, or NULL if this address is
+ *                          not in a registered memory region.
+ *
+ * \returns the number of bytes backed by the same region, up to length.
+ */
+static size_t dma_span(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, size_t length, uint8_t** mem)
+{
+    j65c02_memory_region* region = j65c02_memory_region_find(inst, addr);
+    if (NULL == region)
+    {
+        *mem = NULL;
+        return length;
+    }
+
+    size_t offset = (size_t)(addr - region->base);
+    size_t available = region->size - offset;
+
+    *mem = region->mem + offset;
+    return length < available ? length : available;
+}
+
+/**
+ * \brief Read a byte for a transfer through the bus beneath the controller,
+ * checking it against the sanitizer and watchpoints as an instruction's read
+ * would be.
+ *
+ * \param dma               The controller for this operation.
+ * \param addr              The address to read.
+ * \param val               Set to the byte read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static JEMU_SYM(status) dma_read_byte(
+    JEMU_SYM(j65c02_dma)* dma, uint16_t addr, uint8_t* val)
+{
+    j65c02* inst = dma->inst;
+    j65c02_sanitizer* sanitizer = inst->sanitizer;
+    status retval;
+
+    if (NULL != sanitizer)
+    {
+        if (!(sanitizer->shadow[addr] & JEMU_SANITIZER_READ))
+        {
+            return
+                j65c02_sanitizer_violation(
+                    sanitizer, JEMU_SANITIZER_VIOLATION_READ, addr, 0);
+        }
+
+        if (!(sanitizer->shadow[addr] & JEMU_SANITIZER_INIT))
+        {
+            return
+                j65c02_sanitizer_violation(
+                    sanitizer, JEMU_SANITIZER_VIOLATION_UNINITIALIZED, addr,
+                    0);
+        }
+    }
+
+    retval = dma->read(dma->context, addr, val);
+    if (STATUS_SUCCESS == retval && NULL != inst->debug
+     && j65c02_debug_check(inst->debug, JEMU_DEBUG_INDEX_READ, addr))
+    {
+        j65c02_debug_watch_hit(inst->debug, JEMU_BREAKPOINT_READ, addr, *val);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Write a byte for a transfer through the bus beneath the controller,
+ * checking it against the sanitizer and watchpoints as an instruction's write
+ * would be.
+ *
+ * \param dma               The controller for this operation.
+ * \param addr              The address to write.
+ * \param val               The byte to write.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static JEMU_SYM(status) dma_write_byte(
+    JEMU_SYM(j65c02_dma)* dma, uint16_t addr, uint8_t val)
+{
+    j65c02* inst = dma->inst;
+    j65c02_sanitizer* sanitizer = inst->sanitizer;
+    status retval;
+
+    if (NULL != sanitizer && !(sanitizer->shadow[addr] & JEMU_SANITIZER_WRITE))
+    {
+        return
+            j65c02_sanitizer_violation(
+                sanitizer, JEMU_SANITIZER_VIOLATION_WRITE, addr, val);
+    }
+
+    retval = dma->write(dma->context, addr, val);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (NULL != sanitizer)
+    {
+        sanitizer->shadow[addr] |= JEMU_SANITIZER_INIT;
+    }
+
+    if (NULL != inst->debug
+     && j65c02_debug_check(inst->debug, JEMU_DEBUG_INDEX_WRITE, addr))
+    {
+        j65c02_debug_watch_hit(inst->debug, JEMU_BREAKPOINT_WRITE, addr, val);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Move a block of guest memory in ascending address order.
+ *
+ * \note An instance with the sanitizer or debugging enabled has every byte
+ * moved through the bus, so that each is checked.
+ *
+ * \param dma               The controller for this operation.
+ * \param source            The source address.
+ * \param destination       The destination address.
+ * \param length            The number of bytes to move.
+ * \param fill              Whether the byte at the source address is written
+ *                          to every destination byte.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static JEMU_SYM(status) dma_transfer(
+    JEMU_SYM(j65c02_dma)* dma, uint16_t source, uint16_t destination,
+    size_t length, bool fill)
+{
+    status retval;
+    uint8_t val = 0;
+    uint8_t* src_mem = NULL;
+    uint8_t* dst_mem = NULL;
+    bool checked = NULL != dma->inst->sanitizer || NULL != dma->inst->debug;
+
+    /* a fill reads its byte once. */
+    if (fill && length > 0)
+    {
+        retval = dma_read_byte(dma, source, &val);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    while (length > 0)
+    {
+        size_t chunk = length;
+        if (!checked)
+        {
+            chunk = dma_span(dma->inst, destination, chunk, &dst_mem);
+            if (!fill)
+            {
+                chunk = dma_span(dma->inst, source, chunk, &src_mem);
+            }
+        }
+
+        if (NULL != dst_mem && (fill || NULL != src_mem))
+        {
+            if (fill)
+            {
+                memset(dst_mem, val, chunk);
+            }
+            else if (destination > source
+                  && (size_t)(destination - source) < chunk)
+            {
+                /* a copy to an overlapping higher address repeats bytes. */
+                for (size_t i = 0; i < chunk; ++i)
+                {
+                    dst_mem[i] = src_mem[i];
+                }
+            }
+            else
+            {
+                memmove(dst_mem, src_mem, chunk);
+            }
+        }
+        else
+        {
+            /* any other byte goes through the bus. */
+            chunk = 1;
+            if (!fill)
+            {
+                retval = dma_read_byte(dma, source, &val);
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+            }
+
+            retval = dma_write_byte(dma, destination, val);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        if (!fill)
+        {
+            source += chunk;
+        }
+
+        destination += chunk;
+        length -= chunk;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Run the transfer started on the DMA controller of an instance, and
+ * take its IRQ if the processor accepts it.
+ *
+ * \note This is called after an instruction, only when
+ * \ref j65c02_dma_due holds. The stolen cycles are charged by the caller. The
+ * IRQ line is level triggered: it is held from the end of a transfer until
+ * the status register is written, and taken after any instruction that leaves
+ * interrupts enabled, or that waits.
+ *
+ * \param inst              The instance for this operation.
+ * \param cycles            Set to the cycles stolen by a transfer, or zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_dma_finish)(JEMU_SYM(j65c02)* inst, int* cycles)
+{
+    status retval;
+    j65c02_dma* dma = inst->dma;
+    uint8_t* reg = dma->registers;
+
+    *cycles = 0;
+
+    if (dma->pending)
+    {
+        uint16_t source =
+            reg[JEMU_DMA_REG_SOURCE_LOW]
+          | (reg[JEMU_DMA_REG_SOURCE_HIGH] << 8);
+        uint16_t destination =
+            reg[JEMU_DMA_REG_DESTINATION_LOW]
+          | (reg[JEMU_DMA_REG_DESTINATION_HIGH] << 8);
+        size_t length =
+            reg[JEMU_DMA_REG_LENGTH_LOW]
+          | (reg[JEMU_DMA_REG_LENGTH_HIGH] << 8);
+
+        dma->pending = false;
+
+        retval =
+            dma_transfer(
+                dma, source, destination, length,
+                0 != (reg[JEMU_DMA_REG_CONTROL] & JEMU_DMA_CONTROL_FILL));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* steal the cycles of the transfer, and report that it is done. */
+        *cycles = (int)length * dma->cycles_per_byte;
+        reg[JEMU_DMA_REG_STATUS] = JEMU_DMA_STATUS_DONE;
+        ++dma->transfer_count;
+
+        if (reg[JEMU_DMA_REG_CONTROL] & JEMU_DMA_CONTROL_IRQ)
+        {
+            dma->irq = true;
+        }
+    }
+
+    /* the IRQ line is held until it is acknowledged, so it is taken once
+     * interrupts are enabled, and it ends a wait. */
+    if (dma->irq
+     && (!(inst->reg_status & JEMU_65c02_STATUS_INTERRUPT) || inst->wait))
+    {
+        ++dma->irq_count;
+        return j65c02_interrupt(inst);
+    }
+
+    return STATUS_SUCCESS;
+}
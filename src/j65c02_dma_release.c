@@ -0,0 +1,46 @@
+/**
+ * \file j65c02_dma_release.c
+ *
+ * \brief Release a DMA controller.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_dma;
+
+/**
+ * \brief Release a DMA controller.
+ *
+ * \note The bus of the instance is restored, and a transfer that was started
+ * but not yet run is dropped. After this call, the controller pointer is no
+ * longer valid.
+ *
+ * \param dma               The controller to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_dma_release)(JEMU_SYM(j65c02_dma)* dma)
+{
+    /* restore the bus wrapped by the controller. */
+    dma->inst->read = dma->read;
+    dma->inst->write = dma->write;
+    dma->inst->user_context = dma->context;
+    dma->inst->dma = NULL;
+
+    /* clear the controller memory. */
+    memset(dma, 0, sizeof(*dma));
+
+    /* free memory. */
+    free(dma);
+
+    return STATUS_SUCCESS;
+}
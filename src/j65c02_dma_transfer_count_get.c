@@ -0,0 +1,23 @@
+/**
+ * \file j65c02_dma_transfer_count_get.c
+ *
+ * \brief Getter for the number of transfers done by a DMA controller.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Get the number of transfers a DMA controller has done.
+ *
+ * \param dma               The controller to query.
+ *
+ * \returns the number of transfers done.
+ */
+uint64_t JEMU_SYM(j65c02_dma_transfer_count_get)(
+    const JEMU_SYM(j65c02_dma)* dma)
+{
+    return dma->transfer_count;
+}
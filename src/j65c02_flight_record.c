@@ -0,0 +1,62 @@
+/**
+ * \file j65c02_flight_record.c
+ *
+ * \brief Record an instruction in the flight recorder.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02_flight_recorder;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Record an instruction in the flight recorder of an instance.
+ *
+ * \note This is called after the opcode is fetched and before it executes,
+ * only when the flight recorder is enabled.
+ *
+ * \param inst              The instance for this operation.
+ * \param opcode            The opcode that is about to execute.
+ */
+void JEMU_SYM(j65c02_flight_record)(JEMU_SYM(j65c02)* inst, uint8_t opcode)
+{
+    j65c02_flight_entry* entry =
+        inst->flight + (inst->flight_count++ & inst->flight_mask);
+    const j65c02_memory_region* region = inst->flight_region;
+    uint16_t pc = inst->reg_pc - 1;
+    size_t offset;
+
+    entry->cycle_count = inst->cycle_count;
+    entry->reg_pc = pc;
+    entry->opcode = opcode;
+    entry->reg_a = inst->reg_a;
+    entry->reg_x = inst->reg_x;
+    entry->reg_y = inst->reg_y;
+    entry->reg_sp = inst->reg_sp;
+    entry->reg_status = inst->reg_status;
+    entry->operand_count = 0;
+
+    /* code usually runs from one region, so check the last one first. */
+    if (NULL == region
+     || pc < region->base || (size_t)(pc - region->base) >= region->size)
+    {
+        region = j65c02_memory_region_find(inst, pc);
+        inst->flight_region = region;
+        if (NULL == region)
+        {
+            return;
+        }
+    }
+
+    /* copy the operands that lie within this region. */
+    offset = pc - region->base;
+    for (uint8_t i = 1; i < JEMU_SYM(global_j65c02_instruction_lengths)[opcode]
+                     && offset + i < region->size; ++i)
+    {
+        entry->operands[i - 1] = region->mem[offset + i];
+        entry->operand_count = i;
+    }
+}
@@ -0,0 +1,51 @@
+/**
+ * \file j65c02_flight_recorder_dump.c
+ *
+ * \brief Copy the most recent flight recorder entries.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Copy the most recent flight recorder entries, oldest first.
+ *
+ * \param inst              The instance to query.
+ * \param entries           The array to which entries are copied.
+ * \param max               The size of this array, in entries.
+ *
+ * \returns the number of entries copied.
+ */
+size_t JEMU_SYM(j65c02_flight_recorder_dump)(
+    const JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_flight_entry)* entries,
+    size_t max)
+{
+    uint64_t count = inst->flight_count;
+
+    if (NULL == inst->flight)
+    {
+        return 0;
+    }
+
+    /* the ring holds at most mask + 1 entries. */
+    if (count > inst->flight_mask + 1)
+    {
+        count = inst->flight_mask + 1;
+    }
+
+    if (count > max)
+    {
+        count = max;
+    }
+
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        entries[i] =
+            inst->flight[
+                (inst->flight_count - count + i) & inst->flight_mask];
+    }
+
+    return (size_t)count;
+}
@@ -0,0 +1,71 @@
+/**
+ * \file j65c02_flight_recorder_enable.c
+ *
+ * \brief Enable, resize, or disable the flight recorder of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_flight_recorder;
+
+/**
+ * \brief Enable, resize, or disable the flight recorder of an instance.
+ *
+ * \note The ring is allocated by this call and freed when the instance is
+ * released. Any entries already held are discarded.
+ *
+ * \param inst              The instance for this operation.
+ * \param entries           The number of entries to hold, rounded up to a
+ *                          power of two, or zero to disable the recorder.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_flight_recorder_enable)(
+    JEMU_SYM(j65c02)* inst, size_t entries)
+{
+    j65c02_flight_entry* flight = NULL;
+    size_t capacity = 0;
+
+    if (entries > 0)
+    {
+        /* round up to a power of two, so that the ring index is a mask. */
+        capacity = 1;
+        while (capacity < entries)
+        {
+            if (capacity > SIZE_MAX / 2 / sizeof(*flight))
+            {
+                return JEMU_ERROR_OUT_OF_MEMORY;
+            }
+
+            capacity *= 2;
+        }
+
+        flight = malloc(capacity * sizeof(*flight));
+        if (NULL == flight)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        memset(flight, 0, capacity * sizeof(*flight));
+    }
+
+    /* replace the ring. */
+    free(inst->flight);
+    inst->flight = flight;
+    inst->flight_mask = capacity ? capacity - 1 : 0;
+    inst->flight_count = 0;
+    inst->flight_region = NULL;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,63 @@
+/**
+ * \file j65c02_fuzz_bus.c
+ *
+ * \brief The bus callbacks installed by an input device.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_fuzz_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_fuzz;
+
+/**
+ * \brief The read callback installed by an input device.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_fuzz_read)(
+    void* context, uint16_t addr, uint8_t* val)
+{
+    j65c02_fuzz* fuzz = (j65c02_fuzz*)context;
+    uint16_t input_addr = fuzz->options.input_addr;
+
+    /* the data register pops the next byte, or reads 0 once empty. */
+    if (input_addr == addr)
+    {
+        *val = 0;
+        if (fuzz->input_offset < fuzz->input_size)
+        {
+            *val = fuzz->input[fuzz->input_offset++];
+        }
+
+        return STATUS_SUCCESS;
+    }
+
+    /* the status register reads 1 while input remains. */
+    if ((uint16_t)(input_addr + 1) == addr)
+    {
+        *val = fuzz->input_offset < fuzz->input_size;
+
+        return STATUS_SUCCESS;
+    }
+
+    return fuzz->read(fuzz->context, addr, val);
+}
+
+/**
+ * \brief The write callback installed by an input device.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_fuzz_write)(
+    void* context, uint16_t addr, uint8_t val)
+{
+    j65c02_fuzz* fuzz = (j65c02_fuzz*)context;
+    uint16_t input_addr = fuzz->options.input_addr;
+
+    /* writes to the input device are ignored. */
+    if (input_addr == addr || (uint16_t)(input_addr + 1) == addr)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    return fuzz->write(fuzz->context, addr, val);
+}
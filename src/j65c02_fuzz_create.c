@@ -0,0 +1,124 @@
+/**
+ * \file j65c02_fuzz_create.c
+ *
+ * \brief Create a fuzzing harness.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_fuzz_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_fuzz;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+/**
+ * \brief Create a fuzzing harness for an instance that has booted.
+ *
+ * \note On success, the caller is given ownership of the harness and must
+ * release it by calling \ref j65c02_fuzz_release when it is no longer needed.
+ * The current state of the instance is the snapshot restored for each input.
+ * An input device interposes on the bus of the instance, so watchpoints must
+ * be set before the harness is created. The shadow memory of the sanitizer is
+ * saved with the snapshot, so the sanitizer must be enabled and its
+ * permissions set before the harness is created.
+ *
+ * \param fuzz              Pointer to the harness pointer to set to the
+ *                          created harness on success.
+ * \param inst              The instance to fuzz.
+ * \param options           The configuration of this harness.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_FUZZ_BAD_OPTIONS if the options are not valid.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_fuzz_create)(
+    JEMU_SYM(j65c02_fuzz)** fuzz, JEMU_SYM(j65c02)* inst,
+    const JEMU_SYM(j65c02_fuzz_options)* options)
+{
+    status retval, release_retval;
+    j65c02_fuzz* tmp;
+
+    /* verify the options. */
+    if (options->cycle_cap <= 0
+     || (JEMU_FUZZ_INPUT_MEMORY != options->input_mode
+      && JEMU_FUZZ_INPUT_DEVICE != options->input_mode)
+     || (JEMU_FUZZ_INPUT_MEMORY == options->input_mode
+      && options->input_capacity > 65536u - options->input_addr))
+    {
+        return JEMU_ERROR_FUZZ_BAD_OPTIONS;
+    }
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->inst = inst;
+    tmp->options = *options;
+
+    /* snapshot the booted instance. */
+    retval = j65c02_snapshot_create(&tmp->snapshot, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    retval = j65c02_snapshot_save(tmp->snapshot, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_snapshot;
+    }
+
+    /* save the shadow memory, which the snapshot does not hold. */
+    if (NULL != inst->sanitizer)
+    {
+        tmp->shadow = malloc(sizeof(inst->sanitizer->shadow));
+        if (NULL == tmp->shadow)
+        {
+            retval = JEMU_ERROR_OUT_OF_MEMORY;
+            goto cleanup_snapshot;
+        }
+
+        memcpy(
+            tmp->shadow, inst->sanitizer->shadow,
+            sizeof(inst->sanitizer->shadow));
+    }
+
+    /* interpose the input device on the bus. */
+    if (JEMU_FUZZ_INPUT_DEVICE == options->input_mode)
+    {
+        tmp->read = inst->read;
+        tmp->write = inst->write;
+        tmp->context = inst->user_context;
+
+        inst->read = &JEMU_SYM(j65c02_fuzz_read);
+        inst->write = &JEMU_SYM(j65c02_fuzz_write);
+        inst->user_context = tmp;
+    }
+
+    /* success. */
+    *fuzz = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_snapshot:
+    release_retval = j65c02_snapshot_release(tmp->snapshot);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    free(tmp);
+
+    return retval;
+}
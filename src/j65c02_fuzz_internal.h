@@ -0,0 +1,61 @@
+/**
+ * \file j65c02_fuzz_internal.h
+ *
+ * \brief Internal header for the fuzzing harness.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/fuzz.h>
+#include <jemu65c02/snapshot.h>
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A fuzzing harness.
+ */
+struct JEMU_SYM(j65c02_fuzz)
+{
+    JEMU_SYM(j65c02)* inst;
+    JEMU_SYM(j65c02_fuzz_options) options;
+    JEMU_SYM(j65c02_snapshot)* snapshot;
+
+    /* the shadow memory of the sanitizer when the snapshot was taken, if the
+     * sanitizer was enabled. */
+    uint8_t* shadow;
+
+    /* the input being delivered by the input device. */
+    const uint8_t* input;
+    size_t input_size;
+    size_t input_offset;
+
+    /* the bus callbacks wrapped by the input device. */
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* context;
+};
+
+/**
+ * \brief The read callback installed by an input device.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_fuzz_read)(
+    void* context, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief The write callback installed by an input device.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_fuzz_write)(
+    void* context, uint16_t addr, uint8_t val);
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
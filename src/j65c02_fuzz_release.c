@@ -0,0 +1,55 @@
+/**
+ * \file j65c02_fuzz_release.c
+ *
+ * \brief Release a fuzzing harness.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_fuzz_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_fuzz;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+/**
+ * \brief Release a fuzzing harness.
+ *
+ * \note The bus of the instance is restored, and the instance is left in the
+ * state of its last input. After this call, the harness pointer is no longer
+ * valid.
+ *
+ * \param fuzz              The harness to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_fuzz_release)(JEMU_SYM(j65c02_fuzz)* fuzz)
+{
+    status retval;
+
+    /* restore the bus wrapped by the input device. */
+    if (NULL != fuzz->read)
+    {
+        fuzz->inst->read = fuzz->read;
+        fuzz->inst->write = fuzz->write;
+        fuzz->inst->user_context = fuzz->context;
+    }
+
+    retval = j65c02_snapshot_release(fuzz->snapshot);
+    free(fuzz->shadow);
+
+    /* clear the harness memory. */
+    memset(fuzz, 0, sizeof(*fuzz));
+
+    /* free memory. */
+    free(fuzz);
+
+    return retval;
+}
@@ -0,0 +1,165 @@
+/**
+ * \file j65c02_fuzz_run.c
+ *
+ * \brief Run an input from the snapshot of a fuzzing harness.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_fuzz_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_fuzz;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+static status fuzz_input_write(
+    j65c02_fuzz* fuzz, const uint8_t* data, size_t size);
+
+/**
+ * \brief Run an input from the snapshot of a harness.
+ *
+ * \note The run ends when the instance stops or waits, when it reaches the
+ * cycle cap, or when it fails. An invalid opcode or a breakpoint hit is an
+ * outcome of the input rather than a failure.
+ *
+ * \param fuzz              The harness for this operation.
+ * \param data              The input.
+ * \param size              The size of this input, in bytes.
+ * \param result            Set to the JEMU_FUZZ_RESULT_* outcome of this
+ *                          input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_fuzz_run)(
+    JEMU_SYM(j65c02_fuzz)* fuzz, const uint8_t* data, size_t size,
+    int* result)
+{
+    status retval;
+    j65c02* inst = fuzz->inst;
+
+    /* start over from the booted instance. */
+    retval = j65c02_snapshot_restore(fuzz->snapshot, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* forget what the last input initialized. */
+    if (NULL != fuzz->shadow && NULL != inst->sanitizer)
+    {
+        memcpy(
+            inst->sanitizer->shadow, fuzz->shadow,
+            sizeof(inst->sanitizer->shadow));
+    }
+
+    /* deliver the input. */
+    if (size > fuzz->options.input_capacity)
+    {
+        size = fuzz->options.input_capacity;
+    }
+
+    if (JEMU_FUZZ_INPUT_DEVICE == fuzz->options.input_mode)
+    {
+        fuzz->input = data;
+        fuzz->input_size = size;
+        fuzz->input_offset = 0;
+    }
+    else
+    {
+        retval = fuzz_input_write(fuzz, data, size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* run up to the cycle cap. */
+    retval = j65c02_run(inst, fuzz->options.cycle_cap);
+    switch (retval)
+    {
+        case STATUS_SUCCESS:
+            *result =
+                inst->stopped || inst->wait
+                    ? JEMU_FUZZ_RESULT_OK : JEMU_FUZZ_RESULT_TIMEOUT;
+            return STATUS_SUCCESS;
+
+        case JEMU_ERROR_INVALID_OPCODE:
+            *result = JEMU_FUZZ_RESULT_INVALID_OPCODE;
+            return STATUS_SUCCESS;
+
+        case JEMU_ERROR_BREAKPOINT:
+            *result = JEMU_FUZZ_RESULT_BREAKPOINT;
+            return STATUS_SUCCESS;
+
+        case JEMU_ERROR_SANITIZER_VIOLATION:
+            *result = JEMU_FUZZ_RESULT_SANITIZER;
+            return STATUS_SUCCESS;
+
+        default:
+            return retval;
+    }
+}
+
+/**
+ * \brief Write an input, and its length, to guest memory. An input that lies
+ * in a registered memory region is copied there directly, and marked as
+ * initialized for the sanitizer.
+ */
+static status fuzz_input_write(
+    j65c02_fuzz* fuzz, const uint8_t* data, size_t size)
+{
+    status retval;
+    j65c02* inst = fuzz->inst;
+    uint16_t addr = fuzz->options.input_addr;
+    j65c02_memory_region* region = j65c02_memory_region_find(inst, addr);
+
+    if (NULL != region && addr - region->base + size <= region->size)
+    {
+        memcpy(region->mem + (addr - region->base), data, size);
+        if (NULL != inst->sanitizer)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                inst->sanitizer->shadow[addr + i] |= JEMU_SANITIZER_INIT;
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            retval = inst->write(inst->user_context, addr + i, data[i]);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    if (fuzz->options.length_enabled)
+    {
+        addr = fuzz->options.length_addr;
+
+        retval = inst->write(inst->user_context, addr, (uint8_t)size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            inst->write(inst->user_context, addr + 1, (uint8_t)(size >> 8));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
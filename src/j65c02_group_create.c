@@ -0,0 +1,181 @@
+/**
+ * \file j65c02_group_create.c
+ *
+ * \brief Create a group runner.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+# define _GNU_SOURCE
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "j65c02_group_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_group;
+JEMU_IMPORT_jemu65c02_group_internal;
+
+#if JEMU_THREADS_ENABLED
+/**
+ * \brief Pin a worker thread to a CPU, if the host supports it.
+ *
+ * \param worker            The worker to pin.
+ */
+static void pin_worker(JEMU_SYM(j65c02_group_worker)* worker)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (cpus > 0)
+    {
+        CPU_ZERO(&set);
+        CPU_SET(worker->index % (size_t)cpus, &set);
+
+        /* pinning is best effort; an unpinned worker still runs. */
+        (void)pthread_setaffinity_np(worker->thread, sizeof(set), &set);
+    }
+#else
+    (void)worker;
+#endif
+}
+#endif
+
+/**
+ * \brief Start the worker threads for a group.
+ *
+ * \param group             The group whose workers are started.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static JEMU_SYM(status) start_workers(JEMU_SYM(j65c02_group)* group)
+{
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_init(&group->lock, NULL);
+    pthread_cond_init(&group->start, NULL);
+    pthread_cond_init(&group->done, NULL);
+
+    /* a single worker runs on the calling thread. */
+    if (1 == group->worker_count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    for (size_t i = 0; i < group->worker_count; ++i)
+    {
+        if (0 != pthread_create(
+                    &group->workers[i].thread, NULL,
+                    &JEMU_SYM(j65c02_group_worker_thread),
+                    group->workers + i))
+        {
+            return JEMU_ERROR_THREAD_CREATE;
+        }
+
+        ++group->threads_started;
+
+        if (group->flags & JEMU_GROUP_FLAG_PIN_CPUS)
+        {
+            pin_worker(group->workers + i);
+        }
+    }
+#else
+    (void)group;
+#endif
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Create a group runner.
+ *
+ * \note On success, the caller is given ownership of the group and must release
+ * it by calling \ref j65c02_group_release when it is no longer needed. When the
+ * host does not support threads, the group runs every instance on the calling
+ * thread.
+ *
+ * \param group             Pointer to the group pointer to set to the created
+ *                          group on success.
+ * \param worker_count      The number of worker threads, usually the number of
+ *                          host cores.
+ * \param flags             Zero or more JEMU_GROUP_FLAG_* values.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_group_create)(
+    JEMU_SYM(j65c02_group)** group, size_t worker_count, int flags)
+{
+    status retval, release_retval;
+    j65c02_group* tmp;
+    uintptr_t workers;
+
+#if !JEMU_THREADS_ENABLED
+    /* without threads, the calling thread is the only worker. */
+    worker_count = 1;
+#endif
+
+    if (0 == worker_count || worker_count > SIZE_MAX / 2 / JEMU_CACHE_LINE_SIZE)
+    {
+        return JEMU_ERROR_INVALID_WORKER_COUNT;
+    }
+
+    /* the workers share the group allocation, starting on a cache line. */
+    tmp =
+        malloc(
+            sizeof(*tmp) + JEMU_CACHE_LINE_SIZE
+          + worker_count * sizeof(j65c02_group_worker));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->worker_count = worker_count;
+    tmp->flags = flags;
+
+    /* set up the workers. */
+    workers = (uintptr_t)(tmp + 1);
+    workers =
+        (workers + JEMU_CACHE_LINE_SIZE - 1)
+            & ~((uintptr_t)JEMU_CACHE_LINE_SIZE - 1);
+    tmp->workers = (j65c02_group_worker*)workers;
+    memset(tmp->workers, 0, worker_count * sizeof(j65c02_group_worker));
+    for (size_t i = 0; i < worker_count; ++i)
+    {
+        tmp->workers[i].index = i;
+        tmp->workers[i].group = tmp;
+        atomic_init(&tmp->workers[i].next, 0);
+    }
+
+    /* start the worker threads. */
+    retval = start_workers(tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *group = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_tmp:
+    release_retval = j65c02_group_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
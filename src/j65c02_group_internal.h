@@ -0,0 +1,110 @@
+/**
+ * \file j65c02_group_internal.h
+ *
+ * \brief Internal header for the multi-instance batch runner.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/group.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#if JEMU_THREADS_ENABLED
+# include <pthread.h>
+#endif
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A group worker.
+ *
+ * \note Each worker owns a contiguous range of the batch, [next, end). The
+ * worker and any thief claim instances from this range by atomically
+ * incrementing next, so each instance is run exactly once. Workers are padded
+ * to a cache line so that claims on one range do not disturb another.
+ */
+typedef struct JEMU_SYM(j65c02_group_worker) JEMU_SYM(j65c02_group_worker);
+
+struct JEMU_SYM(j65c02_group_worker)
+{
+    _Alignas(JEMU_CACHE_LINE_SIZE) atomic_size_t next;
+    size_t end;
+    size_t index;
+    uint64_t cycles;
+    uint64_t steals;
+    JEMU_SYM(j65c02_group)* group;
+#if JEMU_THREADS_ENABLED
+    pthread_t thread;
+#endif
+};
+
+/**
+ * \brief A multi-instance batch runner.
+ */
+struct JEMU_SYM(j65c02_group)
+{
+    size_t worker_count;
+    int flags;
+    JEMU_SYM(j65c02_group_worker)* workers;
+
+    /* the batch currently being run. */
+    JEMU_SYM(j65c02)** insts;
+    const int* budgets;
+    JEMU_SYM(status)* results;
+
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    uint64_t generation;
+    size_t running;
+    size_t threads_started;
+    bool shutdown;
+#endif
+};
+
+/**
+ * \brief Run the instances owned by a worker, then steal from the others
+ * until the batch is exhausted.
+ *
+ * \param worker            The worker doing the running.
+ */
+void JEMU_SYM(j65c02_group_worker_run)(JEMU_SYM(j65c02_group_worker)* worker);
+
+#if JEMU_THREADS_ENABLED
+/**
+ * \brief The entry point for a group worker thread.
+ *
+ * \param arg               The worker for this thread.
+ *
+ * \returns NULL.
+ */
+void* JEMU_SYM(j65c02_group_worker_thread)(void* arg);
+#endif
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_group_internal_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_group_worker) sym ## j65c02_group_worker; \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_group_internal_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_group_internal_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_group_internal \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_group_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
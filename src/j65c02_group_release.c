@@ -0,0 +1,56 @@
+/**
+ * \file j65c02_group_release.c
+ *
+ * \brief Release a group runner.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_group_internal.h"
+
+/**
+ * \brief Release a group runner, stopping its worker threads.
+ *
+ * \note After this call, the group pointer is no longer valid. The instances
+ * run by this group are not released.
+ *
+ * \param group             The group to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_group_release)(JEMU_SYM(j65c02_group)* group)
+{
+#if JEMU_THREADS_ENABLED
+    /* tell the workers to exit. */
+    pthread_mutex_lock(&group->lock);
+    group->shutdown = true;
+    pthread_cond_broadcast(&group->start);
+    pthread_mutex_unlock(&group->lock);
+
+    /* wait for them to do so. */
+    for (size_t i = 0; i < group->threads_started; ++i)
+    {
+        pthread_join(group->workers[i].thread, NULL);
+    }
+
+    pthread_cond_destroy(&group->done);
+    pthread_cond_destroy(&group->start);
+    pthread_mutex_destroy(&group->lock);
+#endif
+
+    /* clear the group memory. */
+    memset(group, 0, sizeof(*group));
+
+    /* free memory. */
+    free(group);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
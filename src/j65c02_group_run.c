@@ -0,0 +1,122 @@
+/**
+ * \file j65c02_group_run.c
+ *
+ * \brief Run a batch of instances on a group.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "j65c02_group_internal.h"
+
+JEMU_IMPORT_jemu65c02_group;
+JEMU_IMPORT_jemu65c02_group_internal;
+
+/**
+ * \brief Get the host monotonic time, in nanoseconds.
+ *
+ * \returns the current time, or 0 if the host has no clock.
+ */
+static uint64_t now_ns(void)
+{
+#if JEMU_THREADS_ENABLED
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * \brief Run every instance in a batch for its own cycle budget.
+ *
+ * \note Each instance is run by \ref j65c02_run on exactly one worker, and an
+ * instance must not appear in the batch more than once. Instance i is homed on
+ * the same worker for every run with the same count.
+ *
+ * \param group             The group that runs this batch.
+ * \param insts             The instances to run.
+ * \param budgets           The cycle budget for each instance.
+ * \param results           Set to the status returned by \ref j65c02_run for
+ *                          each instance.
+ * \param count             The number of instances in this batch.
+ * \param stats             Optional pointer set to the statistics for this
+ *                          run; may be NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if the batch ran, even if individual instances failed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_group_run)(
+    JEMU_SYM(j65c02_group)* group, JEMU_SYM(j65c02)** insts,
+    const int* budgets, JEMU_SYM(status)* results, size_t count,
+    JEMU_SYM(j65c02_group_stats)* stats)
+{
+    uint64_t start = now_ns();
+
+    /* set up the batch. */
+    group->insts = insts;
+    group->budgets = budgets;
+    group->results = results;
+
+    /* give each worker the same contiguous slice of the batch every run. */
+    for (size_t w = 0; w < group->worker_count; ++w)
+    {
+        j65c02_group_worker* worker = group->workers + w;
+
+        atomic_store_explicit(
+            &worker->next, (w * count) / group->worker_count,
+            memory_order_relaxed);
+        worker->end = ((w + 1) * count) / group->worker_count;
+        worker->cycles = 0;
+        worker->steals = 0;
+    }
+
+#if JEMU_THREADS_ENABLED
+    if (group->threads_started > 0)
+    {
+        /* wake the workers and wait for all of them to finish. */
+        pthread_mutex_lock(&group->lock);
+        group->running = group->threads_started;
+        ++group->generation;
+        pthread_cond_broadcast(&group->start);
+        while (group->running > 0)
+        {
+            pthread_cond_wait(&group->done, &group->lock);
+        }
+        pthread_mutex_unlock(&group->lock);
+    }
+    else
+#endif
+    {
+        /* run the batch on the calling thread. */
+        JEMU_SYM(j65c02_group_worker_run)(group->workers);
+    }
+
+    /* gather statistics. */
+    if (NULL != stats)
+    {
+        memset(stats, 0, sizeof(*stats));
+        for (size_t w = 0; w < group->worker_count; ++w)
+        {
+            stats->cycles += group->workers[w].cycles;
+            stats->steals += group->workers[w].steals;
+        }
+
+        stats->elapsed_ns = now_ns() - start;
+    }
+
+    /* the batch is no longer referenced. */
+    group->insts = NULL;
+    group->budgets = NULL;
+    group->results = NULL;
+
+    return STATUS_SUCCESS;
+}
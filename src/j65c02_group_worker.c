@@ -0,0 +1,110 @@
+/**
+ * \file j65c02_group_worker.c
+ *
+ * \brief Group worker loop and thread entry point.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_group_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_group;
+JEMU_IMPORT_jemu65c02_group_internal;
+
+/**
+ * \brief Run a single instance of the batch.
+ *
+ * \param worker            The worker doing the running.
+ * \param i                 The index of the instance in the batch.
+ */
+static void run_one(JEMU_SYM(j65c02_group_worker)* worker, size_t i)
+{
+    j65c02_group* group = worker->group;
+    j65c02* inst = group->insts[i];
+    uint64_t before = inst->cycle_count;
+
+    group->results[i] = j65c02_run(inst, group->budgets[i]);
+    worker->cycles += inst->cycle_count - before;
+}
+
+/**
+ * \brief Run the instances owned by a worker, then steal from the others
+ * until the batch is exhausted.
+ *
+ * \param worker            The worker doing the running.
+ */
+void JEMU_SYM(j65c02_group_worker_run)(JEMU_SYM(j65c02_group_worker)* worker)
+{
+    j65c02_group* group = worker->group;
+    size_t i;
+
+    /* drain our own range first, so instances stay on their home worker. */
+    while ((i = atomic_fetch_add_explicit(
+                    &worker->next, 1, memory_order_relaxed)) < worker->end)
+    {
+        run_one(worker, i);
+    }
+
+    /* then steal from the other workers, starting with our neighbor. */
+    for (size_t n = 1; n < group->worker_count; ++n)
+    {
+        j65c02_group_worker* victim =
+            group->workers + (worker->index + n) % group->worker_count;
+
+        while ((i = atomic_fetch_add_explicit(
+                        &victim->next, 1, memory_order_relaxed)) < victim->end)
+        {
+            run_one(worker, i);
+            ++worker->steals;
+        }
+    }
+}
+
+#if JEMU_THREADS_ENABLED
+/**
+ * \brief The entry point for a group worker thread.
+ *
+ * \param arg               The worker for this thread.
+ *
+ * \returns NULL.
+ */
+void* JEMU_SYM(j65c02_group_worker_thread)(void* arg)
+{
+    j65c02_group_worker* worker = (j65c02_group_worker*)arg;
+    j65c02_group* group = worker->group;
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&group->lock);
+    for (;;)
+    {
+        /* wait for a new batch or shutdown. */
+        while (!group->shutdown && group->generation == seen)
+        {
+            pthread_cond_wait(&group->start, &group->lock);
+        }
+
+        if (group->shutdown)
+        {
+            break;
+        }
+
+        seen = group->generation;
+        pthread_mutex_unlock(&group->lock);
+
+        /* run our share of the batch. */
+        JEMU_SYM(j65c02_group_worker_run)(worker);
+
+        /* let the caller know when the last worker finishes. */
+        pthread_mutex_lock(&group->lock);
+        if (0 == --group->running)
+        {
+            pthread_cond_signal(&group->done);
+        }
+    }
+    pthread_mutex_unlock(&group->lock);
+
+    return NULL;
+}
+#endif
@@ -0,0 +1,23 @@
+/**
+ * \file j65c02_group_worker_count_get.c
+ *
+ * \brief Getter for the group worker count.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_group_internal.h"
+
+/**
+ * \brief Get the number of workers in a group.
+ *
+ * \param group             The group to query.
+ *
+ * \returns the number of workers.
+ */
+size_t JEMU_SYM(j65c02_group_worker_count_get)(
+    const JEMU_SYM(j65c02_group)* group)
+{
+    return group->worker_count;
+}
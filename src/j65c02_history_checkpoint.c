@@ -0,0 +1,101 @@
+/**
+ * \file j65c02_history_checkpoint.c
+ *
+ * \brief Save a checkpoint at the present position.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_snapshot;
+JEMU_IMPORT_jemu65c02_history_internal;
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Drop the part of the recorded stream that comes before the oldest
+ * checkpoint, once it outweighs the part that is kept.
+ *
+ * \param history           The history for this operation.
+ */
+static void stream_compact(JEMU_SYM(j65c02_history)* history)
+{
+    j65c02_recorder* recorder = history->recorder;
+    size_t keep_from =
+        JEMU_SYM(j65c02_history_checkpoint_get)(history, 0)->stream_pos;
+    size_t discard = keep_from - JEMU_REPLAY_HEADER_SIZE;
+
+    /* each byte is moved at most once per discarded byte. */
+    if (discard <= recorder->size - keep_from)
+    {
+        return;
+    }
+
+    memmove(
+        recorder->data + JEMU_REPLAY_HEADER_SIZE, recorder->data + keep_from,
+        recorder->size - keep_from);
+    recorder->size -= discard;
+
+    for (size_t i = 0; i < history->checkpoint_count; ++i)
+    {
+        history->checkpoints[i].stream_pos -= discard;
+    }
+}
+
+/**
+ * \brief Save a checkpoint at the present position, dropping the oldest
+ * checkpoint if the ring is full.
+ *
+ * \param history           The history for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_checkpoint)(JEMU_SYM(j65c02_history)* history)
+{
+    status retval;
+    j65c02_checkpoint* checkpoint;
+    size_t slot =
+        (history->checkpoint_oldest + history->checkpoint_used)
+            % history->checkpoint_count;
+
+    /* the checkpoint must start at a record boundary. */
+    retval = JEMU_SYM(j65c02_recorder_flush)(history->recorder);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* save the instance. */
+    checkpoint = history->checkpoints + slot;
+    retval = j65c02_snapshot_save(checkpoint->snapshot, history->inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    checkpoint->position = history->position;
+    checkpoint->stream_pos = history->recorder->size;
+    checkpoint->last_event = history->recorder->last_event;
+    history->next_checkpoint = history->inst->cycle_count + history->interval;
+
+    /* add this checkpoint to the ring, dropping the oldest if it is full. */
+    if (history->checkpoint_used < history->checkpoint_count)
+    {
+        ++history->checkpoint_used;
+    }
+    else
+    {
+        history->checkpoint_oldest =
+            (history->checkpoint_oldest + 1) % history->checkpoint_count;
+        stream_compact(history);
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,27 @@
+/**
+ * \file j65c02_history_checkpoint_get.c
+ *
+ * \brief Get a held checkpoint.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+/**
+ * \brief Get a held checkpoint.
+ *
+ * \param history           The history to query.
+ * \param index             The index of the checkpoint, starting from the
+ *                          oldest.
+ *
+ * \returns the checkpoint.
+ */
+const JEMU_SYM(j65c02_checkpoint)* JEMU_SYM(j65c02_history_checkpoint_get)(
+    const JEMU_SYM(j65c02_history)* history, size_t index)
+{
+    return
+        history->checkpoints
+      + (history->checkpoint_oldest + index) % history->checkpoint_count;
+}
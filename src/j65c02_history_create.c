@@ -0,0 +1,114 @@
+/**
+ * \file j65c02_history_create.c
+ *
+ * \brief Start keeping a history for an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_history;
+JEMU_IMPORT_jemu65c02_replay;
+JEMU_IMPORT_jemu65c02_snapshot;
+JEMU_IMPORT_jemu65c02_history_internal;
+
+/**
+ * \brief Start keeping a history for an instance.
+ *
+ * \note On success, the caller is given ownership of the history and must
+ * release it by calling \ref j65c02_history_release when it is no longer
+ * needed. While the history exists, the instance is run, interrupted, and
+ * reset through the history. Every RAM and ROM region must be registered with
+ * \ref j65c02_memory_region_add before this call, as for a recorder.
+ *
+ * \param history           Pointer to the history pointer to set to the
+ *                          created history on success.
+ * \param inst              The instance for this history.
+ * \param interval          The number of cycles between checkpoints.
+ * \param checkpoints       The number of checkpoints held; older ones are
+ *                          dropped.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_INVALID_CHECKPOINTS if interval or checkpoints is zero.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_create)(
+    JEMU_SYM(j65c02_history)** history, JEMU_SYM(j65c02)* inst,
+    uint64_t interval, size_t checkpoints)
+{
+    status retval, release_retval;
+    j65c02_history* tmp;
+    size_t size;
+
+    /* verify the checkpoint schedule. */
+    if (0 == interval || 0 == checkpoints)
+    {
+        return JEMU_ERROR_INVALID_CHECKPOINTS;
+    }
+
+    /* verify that the checkpoint ring size doesn't overflow. */
+    if (checkpoints
+            > (SIZE_MAX - sizeof(*tmp)) / sizeof(j65c02_checkpoint))
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    size = sizeof(*tmp) + checkpoints * sizeof(j65c02_checkpoint);
+    tmp = malloc(size);
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, size);
+    tmp->inst = inst;
+    tmp->interval = interval;
+    tmp->checkpoint_count = checkpoints;
+
+    /* create the checkpoint snapshots. */
+    for (size_t i = 0; i < checkpoints; ++i)
+    {
+        retval = j65c02_snapshot_create(&tmp->checkpoints[i].snapshot, inst);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_tmp;
+        }
+    }
+
+    /* start recording. */
+    retval = j65c02_recorder_create(&tmp->recorder, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* history starts with a checkpoint. */
+    retval = JEMU_SYM(j65c02_history_checkpoint)(tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *history = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_tmp:
+    release_retval = j65c02_history_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
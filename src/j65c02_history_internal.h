@@ -0,0 +1,135 @@
+/**
+ * \file j65c02_history_internal.h
+ *
+ * \brief Internal header for reverse execution.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/history.h>
+#include <jemu65c02/snapshot.h>
+
+#include "j65c02_replay_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A checkpoint in a history.
+ */
+typedef struct JEMU_SYM(j65c02_checkpoint) JEMU_SYM(j65c02_checkpoint);
+
+struct JEMU_SYM(j65c02_checkpoint)
+{
+    JEMU_SYM(j65c02_snapshot)* snapshot;
+
+    /* the position of this checkpoint. */
+    uint64_t position;
+
+    /* the recorded stream offset and last event cycle at this checkpoint. */
+    size_t stream_pos;
+    uint64_t last_event;
+};
+
+/**
+ * \brief A reverse execution history.
+ *
+ * \note Checkpoints form a ring; the oldest held checkpoint is at index
+ * oldest, and positions increase from there.
+ */
+struct JEMU_SYM(j65c02_history)
+{
+    JEMU_SYM(j65c02)* inst;
+    JEMU_SYM(j65c02_recorder)* recorder;
+
+    /* the current and present positions. */
+    uint64_t position;
+    uint64_t present;
+    int present_delta;
+    bool present_opcode_pending;
+    uint8_t present_pending_opcode;
+
+    /* the checkpoint schedule. */
+    uint64_t interval;
+    uint64_t next_checkpoint;
+
+    /* the checkpoint ring. */
+    size_t checkpoint_count;
+    size_t checkpoint_used;
+    size_t checkpoint_oldest;
+    JEMU_SYM(j65c02_checkpoint) checkpoints[];
+};
+
+/**
+ * \brief Save a checkpoint at the present position, dropping the oldest
+ * checkpoint if the ring is full.
+ *
+ * \param history           The history for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_checkpoint)(JEMU_SYM(j65c02_history)* history);
+
+/**
+ * \brief Get a held checkpoint.
+ *
+ * \param history           The history to query.
+ * \param index             The index of the checkpoint, starting from the
+ *                          oldest.
+ *
+ * \returns the checkpoint.
+ */
+const JEMU_SYM(j65c02_checkpoint)* JEMU_SYM(j65c02_history_checkpoint_get)(
+    const JEMU_SYM(j65c02_history)* history, size_t index);
+
+/**
+ * \brief Restore a checkpoint, then replay forward to a target position.
+ *
+ * \param history           The history for this operation.
+ * \param checkpoint        The checkpoint from which to replay.
+ * \param target            The target position, which must not be before the
+ *                          checkpoint.
+ * \param stop              Optional stop condition, checked at every position
+ *                          from the checkpoint to the target; may be NULL.
+ * \param context           The user context passed to the stop condition.
+ * \param match             Set to the last position at which the stop
+ *                          condition held.
+ * \param matched           Set to true if the stop condition held at any
+ *                          position, or false otherwise.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_replay)(
+    JEMU_SYM(j65c02_history)* history,
+    const JEMU_SYM(j65c02_checkpoint)* checkpoint, uint64_t target,
+    JEMU_SYM(j65c02_history_stop_fn) stop, void* context, uint64_t* match,
+    bool* matched);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_history_internal_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_checkpoint) sym ## j65c02_checkpoint; \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_history_internal_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_history_internal_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_history_internal \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_history_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,34 @@
+/**
+ * \file j65c02_history_nmi.c
+ *
+ * \brief Deliver an NMI through a history.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Deliver an NMI to the instance, and record it.
+ *
+ * \param history           The history for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_REWOUND if the instance is not at the present.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_nmi)(JEMU_SYM(j65c02_history)* history)
+{
+    /* the past can't be changed. */
+    if (history->position != history->present)
+    {
+        return JEMU_ERROR_HISTORY_REWOUND;
+    }
+
+    return j65c02_recorder_nmi(history->recorder);
+}
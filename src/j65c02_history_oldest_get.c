@@ -0,0 +1,23 @@
+/**
+ * \file j65c02_history_oldest_get.c
+ *
+ * \brief Get the oldest position still held in history.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+/**
+ * \brief Get the oldest position still held in history.
+ *
+ * \param history           The history to query.
+ *
+ * \returns the oldest held position.
+ */
+uint64_t JEMU_SYM(j65c02_history_oldest_get)(
+    const JEMU_SYM(j65c02_history)* history)
+{
+    return JEMU_SYM(j65c02_history_checkpoint_get)(history, 0)->position;
+}
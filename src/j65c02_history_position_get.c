@@ -0,0 +1,23 @@
+/**
+ * \file j65c02_history_position_get.c
+ *
+ * \brief Get the current position of the instance in its history.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+/**
+ * \brief Get the current position of the instance in its history.
+ *
+ * \param history           The history to query.
+ *
+ * \returns the current position.
+ */
+uint64_t JEMU_SYM(j65c02_history_position_get)(
+    const JEMU_SYM(j65c02_history)* history)
+{
+    return history->position;
+}
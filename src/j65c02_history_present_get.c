@@ -0,0 +1,24 @@
+/**
+ * \file j65c02_history_present_get.c
+ *
+ * \brief Get the present position in a history.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+/**
+ * \brief Get the present position, which is the number of instructions run
+ * since the history was created.
+ *
+ * \param history           The history to query.
+ *
+ * \returns the present position.
+ */
+uint64_t JEMU_SYM(j65c02_history_present_get)(
+    const JEMU_SYM(j65c02_history)* history)
+{
+    return history->present;
+}
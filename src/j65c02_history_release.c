@@ -0,0 +1,72 @@
+/**
+ * \file j65c02_history_release.c
+ *
+ * \brief Stop keeping a history and release it.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_replay;
+JEMU_IMPORT_jemu65c02_snapshot;
+JEMU_IMPORT_jemu65c02_history_internal;
+
+/**
+ * \brief Stop keeping a history and release it.
+ *
+ * \note The original callbacks of the instance are restored, and the instance
+ * is left at its current position. After this call, the history pointer is no
+ * longer valid.
+ *
+ * \param history           The history to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_release)(JEMU_SYM(j65c02_history)* history)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+
+    /* stop recording, restoring the original callbacks. */
+    if (NULL != history->recorder)
+    {
+        release_retval = j65c02_recorder_release(history->recorder);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* release the checkpoint snapshots. */
+    for (size_t i = 0; i < history->checkpoint_count; ++i)
+    {
+        if (NULL != history->checkpoints[i].snapshot)
+        {
+            release_retval =
+                j65c02_snapshot_release(history->checkpoints[i].snapshot);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    /* clear the history memory. */
+    memset(
+        history, 0,
+        sizeof(*history)
+            + history->checkpoint_count * sizeof(j65c02_checkpoint));
+
+    /* free memory. */
+    free(history);
+
+    return retval;
+}
@@ -0,0 +1,190 @@
+/**
+ * \file j65c02_history_replay.c
+ *
+ * \brief Replay a history forward from a checkpoint.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_snapshot;
+JEMU_IMPORT_jemu65c02_history_internal;
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Restore a checkpoint, then replay forward to a target position.
+ *
+ * \param history           The history for this operation.
+ * \param checkpoint        The checkpoint from which to replay.
+ * \param target            The target position, which must not be before the
+ *                          checkpoint.
+ * \param stop              Optional stop condition, checked at every position
+ *                          from the checkpoint to the target; may be NULL.
+ * \param context           The user context passed to the stop condition.
+ * \param match             Set to the last position at which the stop
+ *                          condition held.
+ * \param matched           Set to true if the stop condition held at any
+ *                          position, or false otherwise.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_replay)(
+    JEMU_SYM(j65c02_history)* history,
+    const JEMU_SYM(j65c02_checkpoint)* checkpoint, uint64_t target,
+    JEMU_SYM(j65c02_history_stop_fn) stop, void* context, uint64_t* match,
+    bool* matched)
+{
+    status retval, exec_retval;
+    j65c02* inst = history->inst;
+    j65c02_replayer replayer;
+    j65c02_instruction* hooked;
+    const j65c02_instruction* table;
+    j65c02_bus bus = j65c02_input_bus(inst);
+    uint8_t ins;
+    int ins_cycles;
+
+    *matched = false;
+
+    /* keep the cycle carry and pending opcode of the present while away from
+     * it. */
+    if (history->position == history->present)
+    {
+        history->present_delta = inst->cycle_delta;
+        history->present_opcode_pending = inst->opcode_pending;
+        history->present_pending_opcode = inst->pending_opcode;
+    }
+
+    /* every read up to the present must be in the stream. */
+    retval = JEMU_SYM(j65c02_recorder_flush)(history->recorder);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* restore the checkpoint. */
+    retval = j65c02_snapshot_restore(checkpoint->snapshot, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    history->position = checkpoint->position;
+
+    /* dispatch through the table of the history run, so that the sanitizer
+     * stops the same instructions, but leave out the hooks. */
+    hooked = inst->hooked;
+    inst->hooked = NULL;
+    table =
+        NULL != inst->sanitizer
+            ? inst->sanitizer->instructions
+            : j65c02_instructions_base(inst);
+
+    /* replay the stream from this checkpoint. */
+    JEMU_SYM(j65c02_replayer_init)(
+        &replayer, inst, history->recorder->data, history->recorder->size,
+        checkpoint->stream_pos, checkpoint->last_event);
+
+    for (;;)
+    {
+        /* a position includes the events delivered before its next
+         * instruction. */
+        retval = JEMU_SYM(j65c02_replayer_events_deliver)(&replayer);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto detach_replayer;
+        }
+
+        if (NULL != stop && stop(context, inst))
+        {
+            *match = history->position;
+            *matched = true;
+        }
+
+        if (history->position >= target)
+        {
+            break;
+        }
+
+        /* the recorded run executed another instruction here. */
+        if (inst->crash || inst->stopped || inst->wait)
+        {
+            retval = JEMU_ERROR_REPLAY_DIVERGED;
+            goto detach_replayer;
+        }
+
+        ins_cycles = 0;
+        if (NULL != inst->hle && j65c02_hle_check(inst->hle, inst->reg_pc))
+        {
+            /* run the native routine here as the history run did. */
+            const j65c02_hle_entry* entry =
+                j65c02_hle_get(inst->hle, inst->reg_pc);
+
+            exec_retval = j65c02_hle_exec(inst, entry);
+            if (STATUS_SUCCESS == exec_retval)
+            {
+                inst->cycle_count += entry->cycles;
+            }
+        }
+        else
+        {
+            retval = j65c02_opcode_fetch(&ins, inst);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto detach_replayer;
+            }
+
+            /* execute the instruction as the history run did. */
+            exec_retval = table[ins].exec(inst, &ins_cycles);
+            if (STATUS_SUCCESS == exec_retval)
+            {
+                inst->cycle_count += ins_cycles;
+
+                /* run a DMA transfer started by this instruction, and take
+                 * its IRQ, stealing its cycles as the history run did. */
+                if (j65c02_dma_due(inst))
+                {
+                    int dma_cycles;
+
+                    exec_retval = j65c02_dma_finish(inst, &dma_cycles);
+                    inst->cycle_count += dma_cycles;
+                }
+            }
+        }
+
+        ++history->position;
+        if (JEMU_ERROR_REPLAY_DIVERGED == exec_retval
+         || JEMU_ERROR_REPLAY_EXHAUSTED == exec_retval)
+        {
+            retval = exec_retval;
+            goto detach_replayer;
+        }
+    }
+
+    retval = STATUS_SUCCESS;
+
+detach_replayer:
+    inst->hooked = hooked;
+    *bus.read = replayer.read;
+    *bus.write = replayer.write;
+    *bus.context = replayer.context;
+    if (history->position == history->present)
+    {
+        inst->cycle_delta = history->present_delta;
+        inst->opcode_pending = history->present_opcode_pending;
+        inst->pending_opcode = history->present_pending_opcode;
+    }
+    else
+    {
+        inst->cycle_delta = 0;
+        inst->opcode_pending = false;
+    }
+
+    return retval;
+}
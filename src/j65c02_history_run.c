@@ -0,0 +1,86 @@
+/**
+ * \file j65c02_history_run.c
+ *
+ * \brief Run an instance forward while keeping its history.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Count an instruction run by a history, saving a checkpoint when one
+ * is due.
+ */
+static JEMU_SYM(status) history_executed(
+    void* context, JEMU_SYM(j65c02)* inst, JEMU_SYM(status) exec_status)
+{
+    JEMU_SYM(j65c02_history)* history = (JEMU_SYM(j65c02_history)*)context;
+
+    /* a failed instruction still takes a position, as it does on replay. */
+    ++history->position;
+    if (STATUS_SUCCESS != exec_status)
+    {
+        return exec_status;
+    }
+
+    /* is a checkpoint due? */
+    if (inst->cycle_count >= history->next_checkpoint)
+    {
+        history->present = history->position;
+        return JEMU_SYM(j65c02_history_checkpoint)(history);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Run the instance forward for the given number of cycles, as
+ * \ref j65c02_run would, while keeping its history.
+ *
+ * \param history           The history for this operation.
+ * \param cycles            The number of cycles to run the instance.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_REWOUND if the instance is not at the present.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_run)(JEMU_SYM(j65c02_history)* history, int cycles)
+{
+    status retval;
+    j65c02* inst = history->inst;
+
+    /* the past can't be changed. */
+    if (history->position != history->present)
+    {
+        return JEMU_ERROR_HISTORY_REWOUND;
+    }
+
+    /* begin the run slice on the timeline. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_span(
+            inst->timeline, JEMU_TIMELINE_LANE_HOST, 'B', "run",
+            inst->cycle_count);
+    }
+
+    /* run as j65c02_run does, counting each instruction. */
+    retval = j65c02_run_loop(inst, cycles, &history_executed, history);
+    history->present = history->position;
+
+    /* end the run slice on the timeline. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_span(
+            inst->timeline, JEMU_TIMELINE_LANE_HOST, 'E', NULL,
+            inst->cycle_count);
+    }
+
+    return retval;
+}
@@ -0,0 +1,86 @@
+/**
+ * \file j65c02_history_run_back.c
+ *
+ * \brief Move an instance back to where a stop condition last held.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_history;
+JEMU_IMPORT_jemu65c02_history_internal;
+
+/**
+ * \brief Move the instance back to the most recent earlier position at which
+ * a stop condition holds.
+ *
+ * \param history           The history for this operation.
+ * \param stop              The stop condition.
+ * \param context           The user context passed to the stop condition.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_UNAVAILABLE if the condition holds at no earlier
+ *        held position; the instance is left at the oldest held position.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_run_back)(
+    JEMU_SYM(j65c02_history)* history, JEMU_SYM(j65c02_history_stop_fn) stop,
+    void* context)
+{
+    status retval;
+    const j65c02_checkpoint* checkpoint;
+    uint64_t start = history->position;
+    uint64_t end, match;
+    bool matched;
+
+    /* search each checkpoint interval before the start, newest first. */
+    for (size_t index = history->checkpoint_used; index-- > 0; )
+    {
+        checkpoint = JEMU_SYM(j65c02_history_checkpoint_get)(history, index);
+        if (checkpoint->position >= start)
+        {
+            continue;
+        }
+
+        /* this interval ends at the next checkpoint, or before the start. */
+        end = start - 1;
+        if (index + 1 < history->checkpoint_used)
+        {
+            uint64_t next =
+                JEMU_SYM(j65c02_history_checkpoint_get)(
+                    history, index + 1)->position;
+
+            if (next - 1 < end)
+            {
+                end = next - 1;
+            }
+        }
+
+        retval =
+            JEMU_SYM(j65c02_history_replay)(
+                history, checkpoint, end, stop, context, &match, &matched);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (matched)
+        {
+            return j65c02_history_seek(history, match);
+        }
+    }
+
+    /* the condition never held; stop at the start of history. */
+    retval = j65c02_history_seek(history, j65c02_history_oldest_get(history));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return JEMU_ERROR_HISTORY_UNAVAILABLE;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file j65c02_history_seek.c
+ *
+ * \brief Move an instance to a position in its history.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02_history_internal;
+
+/**
+ * \brief Move the instance to a position in its history.
+ *
+ * \note Device callbacks are not called while moving through history. Seeking
+ * to the present position returns the instance to live execution.
+ *
+ * \param history           The history for this operation.
+ * \param position          The position to which the instance is moved, from
+ *                          the oldest held position up to the present.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_UNAVAILABLE if the position is not held.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_seek)(
+    JEMU_SYM(j65c02_history)* history, uint64_t position)
+{
+    const j65c02_checkpoint* checkpoint;
+    uint64_t match;
+    bool matched;
+    size_t index = history->checkpoint_used;
+
+    /* verify that this position is held. */
+    if (position > history->present
+     || position < JEMU_SYM(j65c02_history_checkpoint_get)(history, 0)->position)
+    {
+        return JEMU_ERROR_HISTORY_UNAVAILABLE;
+    }
+
+    /* find the newest checkpoint at or before this position. */
+    do
+    {
+        checkpoint = JEMU_SYM(j65c02_history_checkpoint_get)(history, --index);
+    } while (checkpoint->position > position);
+
+    return
+        JEMU_SYM(j65c02_history_replay)(
+            history, checkpoint, position, NULL, NULL, &match, &matched);
+}
@@ -0,0 +1,34 @@
+/**
+ * \file j65c02_history_step_back.c
+ *
+ * \brief Move an instance back by one instruction.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_history_internal.h"
+
+JEMU_IMPORT_jemu65c02_history;
+
+/**
+ * \brief Move the instance back by one instruction.
+ *
+ * \param history           The history for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HISTORY_UNAVAILABLE if the instance is at the oldest held
+ *        position.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_history_step_back)(JEMU_SYM(j65c02_history)* history)
+{
+    if (0 == history->position)
+    {
+        return JEMU_ERROR_HISTORY_UNAVAILABLE;
+    }
+
+    return j65c02_history_seek(history, history->position - 1);
+}
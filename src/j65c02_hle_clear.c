@@ -0,0 +1,43 @@
+/**
+ * \file j65c02_hle_clear.c
+ *
+ * \brief Clear the native routine at a guest address.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_hle;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Clear the native routine at a guest address, if there is one.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The entry address of the guest routine.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_clear)(JEMU_SYM(j65c02)* inst, uint16_t addr)
+{
+    j65c02_hle* hle = inst->hle;
+
+    if (NULL == hle || !j65c02_hle_check(hle, addr))
+    {
+        return STATUS_SUCCESS;
+    }
+
+    hle->bits[addr >> 3] &= ~(1 << (addr & 7));
+    memset(
+        hle->pages[addr >> 8] + (addr & 0xFF), 0,
+        sizeof(*hle->pages[addr >> 8]));
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/**
+ * \file j65c02_hle_exec.c
+ *
+ * \brief Run a native routine in place of a guest routine.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Run a native routine, then return from it as an RTS would.
+ *
+ * \note The routine returns to the instruction after the JSR that called it.
+ * The cycles of the routine are charged by the caller.
+ *
+ * \param inst              The instance for this operation.
+ * \param entry             The routine to run.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure, with the program counter left at
+ *        the entry of the routine.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_exec)(
+    JEMU_SYM(j65c02)* inst, const JEMU_SYM(j65c02_hle_entry)* entry)
+{
+    status retval;
+    uint8_t addr_low, addr_high;
+
+    retval = entry->fn(entry->context, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* pull the address of the last byte of the calling JSR, which pushed its
+     * low byte first. */
+    retval = j65c02_pull(inst, &addr_high);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+    retval = j65c02_pull(inst, &addr_low);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* return to the instruction after the JSR, dropping an opcode left
+     * pending at the routine. */
+    inst->reg_pc = ((addr_high << 8) | addr_low) + 1;
+    inst->opcode_pending = false;
+
+#if JEMU_PROFILE_ENABLED
+    /* pop the calls this returns from off of the shadow call stack. */
+    j65c02_profile_return(inst);
+#endif /* JEMU_PROFILE_ENABLED */
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file j65c02_hle_read.c
+ *
+ * \brief Read guest memory from a native routine.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_hle;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Read guest memory from a native routine.
+ *
+ * \note The read goes through the bus of the instance, so it is seen by any
+ * watchpoints and devices on that bus.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The address to read.
+ * \param val               Set to the value read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code from the bus on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_read)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, uint8_t* val)
+{
+    return inst->read(inst->user_context, addr, val);
+}
@@ -0,0 +1,32 @@
+/**
+ * \file j65c02_hle_release.c
+ *
+ * \brief Free the native routines of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Free the native routines of an instance.
+ *
+ * \param hle               The native routines to free.
+ */
+void JEMU_SYM(j65c02_hle_release)(JEMU_SYM(j65c02_hle)* hle)
+{
+    for (int i = 0; i < 256; ++i)
+    {
+        free(hle->pages[i]);
+    }
+
+    memset(hle, 0, sizeof(*hle));
+    free(hle);
+}
@@ -0,0 +1,85 @@
+/**
+ * \file j65c02_hle_set.c
+ *
+ * \brief Set the native routine at a guest address.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_hle;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Set the native routine at a guest address.
+ *
+ * \note The routine is called by \ref j65c02_run and \ref j65c02_step, but not
+ * by batches or history runs, which must replay exactly what the guest did.
+ * An execution breakpoint at the same address fires before the routine runs.
+ * Setting a routine again replaces it.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The entry address of the guest routine.
+ * \param fn                The native routine to run in its place.
+ * \param context           The context passed to this routine.
+ * \param cycles            The cycles charged for each call, including the
+ *                          return.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_HLE_BAD_ROUTINE if the routine is NULL or the cycles are
+ *        negative.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_set)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, JEMU_SYM(j65c02_hle_fn) fn,
+    void* context, int cycles)
+{
+    j65c02_hle* hle = inst->hle;
+    j65c02_hle_entry* page;
+
+    if (NULL == fn || cycles < 0)
+    {
+        return JEMU_ERROR_HLE_BAD_ROUTINE;
+    }
+
+    /* the routines are allocated with the first of them. */
+    if (NULL == hle)
+    {
+        hle = malloc(sizeof(*hle));
+        if (NULL == hle)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        memset(hle, 0, sizeof(*hle));
+        inst->hle = hle;
+    }
+
+    page = hle->pages[addr >> 8];
+    if (NULL == page)
+    {
+        page = malloc(256 * sizeof(*page));
+        if (NULL == page)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        memset(page, 0, 256 * sizeof(*page));
+        hle->pages[addr >> 8] = page;
+    }
+
+    page[addr & 0xFF].fn = fn;
+    page[addr & 0xFF].context = context;
+    page[addr & 0xFF].cycles = cycles;
+    hle->bits[addr >> 3] |= 1 << (addr & 7);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,79 @@
+/**
+ * \file j65c02_hooked_execs.c
+ *
+ * \brief The instrumented instruction handlers.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Call the hooks of an instance around an instruction handler.
+ *
+ * \note The opcode has been fetched, so it sits just before the program
+ * counter.
+ */
+static status hooked_exec(j65c02* inst, int* cycles, uint8_t opcode)
+{
+    uint16_t pc = inst->reg_pc - 1;
+    status retval;
+
+    if (NULL != inst->hook_pre)
+    {
+        retval = inst->hook_pre(inst->hook_context, inst, pc, opcode, 0);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    retval = j65c02_instructions_base(inst)[opcode].exec(inst, cycles);
+    if (STATUS_SUCCESS == retval && NULL != inst->hook_post)
+    {
+        retval =
+            inst->hook_post(inst->hook_context, inst, pc, opcode, *cycles);
+    }
+
+    return retval;
+}
+
+/* one handler per opcode, each passing its opcode to hooked_exec. */
+#define HOOKED(n) \
+    static status hooked_ ## n(j65c02* inst, int* cycles) { \
+        return hooked_exec(inst, cycles, 0x ## n); }
+#define HOOKED_ROW(r) \
+    HOOKED(r ## 0) HOOKED(r ## 1) HOOKED(r ## 2) HOOKED(r ## 3) \
+    HOOKED(r ## 4) HOOKED(r ## 5) HOOKED(r ## 6) HOOKED(r ## 7) \
+    HOOKED(r ## 8) HOOKED(r ## 9) HOOKED(r ## A) HOOKED(r ## B) \
+    HOOKED(r ## C) HOOKED(r ## D) HOOKED(r ## E) HOOKED(r ## F)
+
+HOOKED_ROW(0) HOOKED_ROW(1) HOOKED_ROW(2) HOOKED_ROW(3)
+HOOKED_ROW(4) HOOKED_ROW(5) HOOKED_ROW(6) HOOKED_ROW(7)
+HOOKED_ROW(8) HOOKED_ROW(9) HOOKED_ROW(A) HOOKED_ROW(B)
+HOOKED_ROW(C) HOOKED_ROW(D) HOOKED_ROW(E) HOOKED_ROW(F)
+
+#define HOOKED_ENTRY_ROW(r) \
+    &hooked_ ## r ## 0, &hooked_ ## r ## 1, &hooked_ ## r ## 2, \
+    &hooked_ ## r ## 3, &hooked_ ## r ## 4, &hooked_ ## r ## 5, \
+    &hooked_ ## r ## 6, &hooked_ ## r ## 7, &hooked_ ## r ## 8, \
+    &hooked_ ## r ## 9, &hooked_ ## r ## A, &hooked_ ## r ## B, \
+    &hooked_ ## r ## C, &hooked_ ## r ## D, &hooked_ ## r ## E, \
+    &hooked_ ## r ## F
+
+/**
+ * \brief The instrumented instruction handlers, which call the hooks of an
+ * instance around the handlers in its custom or global table.
+ */
+JEMU_SYM(status) (* const JEMU_SYM(global_j65c02_hooked_execs)[256])(
+    JEMU_SYM(j65c02)* inst, int* cycles) = {
+    HOOKED_ENTRY_ROW(0), HOOKED_ENTRY_ROW(1), HOOKED_ENTRY_ROW(2),
+    HOOKED_ENTRY_ROW(3), HOOKED_ENTRY_ROW(4), HOOKED_ENTRY_ROW(5),
+    HOOKED_ENTRY_ROW(6), HOOKED_ENTRY_ROW(7), HOOKED_ENTRY_ROW(8),
+    HOOKED_ENTRY_ROW(9), HOOKED_ENTRY_ROW(A), HOOKED_ENTRY_ROW(B),
+    HOOKED_ENTRY_ROW(C), HOOKED_ENTRY_ROW(D), HOOKED_ENTRY_ROW(E),
+    HOOKED_ENTRY_ROW(F) };
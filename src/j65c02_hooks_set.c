@@ -0,0 +1,75 @@
+/**
+ * \file j65c02_hooks_set.c
+ *
+ * \brief Set the instruction hooks of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_hooks;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Set the instruction hooks of an instance.
+ *
+ * \note The hooks are called by \ref j65c02_run, \ref j65c02_step, and history
+ * runs, but not by batches. Setting both hooks to NULL restores the plain
+ * dispatch table.
+ *
+ * \param inst              The instance for this operation.
+ * \param pre               The hook called before each instruction, or NULL.
+ * \param post              The hook called after each instruction that ran,
+ *                          or NULL.
+ * \param context           The context passed to these hooks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hooks_set)(
+    JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_hook_fn) pre,
+    JEMU_SYM(j65c02_hook_fn) post, void* context)
+{
+    /* without hooks, swap the plain table back. */
+    if (NULL == pre && NULL == post)
+    {
+        free(inst->hooked);
+        inst->hooked = NULL;
+        inst->hook_pre = NULL;
+        inst->hook_post = NULL;
+        inst->hook_context = NULL;
+        j65c02_instructions_update(inst);
+
+        return STATUS_SUCCESS;
+    }
+
+    /* build the instrumented table; its cycle budget is copied when it is
+     * swapped in. */
+    if (NULL == inst->hooked)
+    {
+        inst->hooked = malloc(256 * sizeof(*inst->hooked));
+        if (NULL == inst->hooked)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        for (int i = 0; i < 256; ++i)
+        {
+            inst->hooked[i].exec = JEMU_SYM(global_j65c02_hooked_execs)[i];
+        }
+    }
+
+    inst->hook_pre = pre;
+    inst->hook_post = post;
+    inst->hook_context = context;
+    j65c02_instructions_update(inst);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,25 @@
+/**
+ * \file j65c02_idiom_count_get.c
+ *
+ * \brief Getter for the number of loops run natively.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Get the number of loops run natively by an instance.
+ *
+ * \note A loop that is cut short by the end of a run and picked up by the
+ * next run is counted once for each run.
+ *
+ * \param inst              The instance to query.
+ *
+ * \returns the number of times a loop was run natively.
+ */
+uint64_t JEMU_SYM(j65c02_idiom_count_get)(const JEMU_SYM(j65c02)* inst)
+{
+    return inst->idiom_count;
+}
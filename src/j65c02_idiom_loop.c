@@ -0,0 +1,412 @@
+/**
+ * \file j65c02_idiom_loop.c
+ *
+ * \brief Run the rest of a copy or fill loop natively.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief The index registers of a loop.
+ */
+#define IDIOM_X 1
+#define IDIOM_Y 2
+
+/**
+ * \brief An indexed load or store that can appear in a loop.
+ */
+typedef struct idiom_op idiom_op;
+
+struct idiom_op
+{
+    uint8_t opcode;
+    int reg;
+    bool indirect;
+    int cycles;
+};
+
+static const idiom_op idiom_loads[] = {
+    { 0xB1, IDIOM_Y, true, 5 }, { 0xBD, IDIOM_X, false, 4 },
+    { 0xB9, IDIOM_Y, false, 4 }, { 0x00, 0, false, 0 } };
+static const idiom_op idiom_stores[] = {
+    { 0x91, IDIOM_Y, true, 6 }, { 0x9D, IDIOM_X, false, 5 },
+    { 0x99, IDIOM_Y, false, 5 }, { 0x9E, IDIOM_X, false, 5 },
+    { 0x00, 0, false, 0 } };
+
+/**
+ * \brief The cycles taken by a step of the index, and by a BNE that is taken.
+ */
+#define IDIOM_STEP_CYCLES 2
+#define IDIOM_BNE_CYCLES 3
+
+/**
+ * \brief The longest loop body, from its head to its BNE.
+ */
+#define IDIOM_MAX_BODY 7
+
+/**
+ * \brief A memory operand of a loop.
+ */
+typedef struct idiom_access idiom_access;
+
+struct idiom_access
+{
+    const idiom_op* op;
+    int zp;
+    int base;
+};
+
+/**
+ * \brief Get the host bytes backing a range of guest addresses.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The first guest address of the range.
+ * \param size              The size of the range.
+ *
+ * \returns the host bytes, or NULL if this range wraps or is not held by a
+ * single registered memory region.
+ */
+static uint8_t* idiom_range(JEMU_SYM(j65c02)* inst, int addr, int size)
+{
+    if (addr < 0 || addr + size > 0x10000)
+    {
+        return NULL;
+    }
+
+    j65c02_memory_region* region =
+        j65c02_memory_region_find(inst, (uint16_t)addr);
+    if (NULL == region)
+    {
+        return NULL;
+    }
+
+    size_t offset = (size_t)(addr - region->base);
+    if (offset + (size_t)size > region->size)
+    {
+        return NULL;
+    }
+
+    return region->mem + offset;
+}
+
+/**
+ * \brief Decode a load or store at the given position in a loop body.
+ *
+ * \param inst              The instance for this operation.
+ * \param access            The operand to decode.
+ * \param ops               The operations accepted here.
+ * \param code              The code of the loop body.
+ * \param pos               The position in the loop body, updated past this
+ *                          instruction if it is decoded.
+ * \param length            The length of the loop body.
+ *
+ * \returns true if an accepted operation was decoded.
+ */
+static bool idiom_decode(
+    JEMU_SYM(j65c02)* inst, idiom_access* access, const idiom_op* ops,
+    const uint8_t* code, int* pos, int length)
+{
+    for (; 0 != ops->reg; ++ops)
+    {
+        if (code[*pos] == ops->opcode)
+        {
+            break;
+        }
+    }
+
+    if (0 == ops->reg || *pos + (ops->indirect ? 2 : 3) > length)
+    {
+        return false;
+    }
+
+    access->op = ops;
+    if (ops->indirect)
+    {
+        /* the pointer wraps around the zero page, as it does for the
+         * instruction. */
+        const uint8_t* low;
+        const uint8_t* high;
+
+        access->zp = code[*pos + 1];
+        low = idiom_range(inst, access->zp, 1);
+        high = idiom_range(inst, (uint8_t)(access->zp + 1), 1);
+        if (NULL == low || NULL == high)
+        {
+            return false;
+        }
+
+        access->base = *low | (*high << 8);
+        *pos += 2;
+    }
+    else
+    {
+        access->zp = -1;
+        access->base = code[*pos + 1] | (code[*pos + 2] << 8);
+        *pos += 3;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Check whether two ranges of guest addresses overlap.
+ */
+static bool idiom_overlaps(int a, int a_size, int b, int b_size)
+{
+    return a < b + b_size && b < a + a_size;
+}
+
+/**
+ * \brief Check whether a store overlaps the code or a pointer of a loop.
+ */
+static bool idiom_clobbers(
+    int dst, int count, int head, int length, const idiom_access* load,
+    const idiom_access* store)
+{
+    if (idiom_overlaps(dst, count, head, length))
+    {
+        return true;
+    }
+
+    if (NULL != load && load->zp >= 0
+     && (idiom_overlaps(dst, count, load->zp, 1)
+      || idiom_overlaps(dst, count, (uint8_t)(load->zp + 1), 1)))
+    {
+        return true;
+    }
+
+    if (store->zp >= 0
+     && (idiom_overlaps(dst, count, store->zp, 1)
+      || idiom_overlaps(dst, count, (uint8_t)(store->zp + 1), 1)))
+    {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * \brief Run the rest of a copy or fill loop natively.
+ *
+ * \note This is called after a BNE branches back to the head of its loop. If
+ * the loop is a recognized idiom, the iterations that fit in the cycles left
+ * are run natively, and the instance is left at the head of the loop, or
+ * after the BNE once the loop is done.
+ *
+ * \param inst              The instance for this operation.
+ * \param bne_pc            The address of the BNE.
+ * \param cycles            The cycles left in this run.
+ *
+ * \returns the cycles consumed by the iterations run natively, or zero if
+ * the loop was not run natively.
+ */
+int JEMU_SYM(j65c02_idiom_loop)(
+    JEMU_SYM(j65c02)* inst, uint16_t bne_pc, int cycles)
+{
+    idiom_access load_access, store_access;
+    const idiom_access* load = NULL;
+    int head = inst->reg_pc;
+    int length = bne_pc + 2 - head;
+    int pos = 0;
+    int reg, step, max_cycles;
+
+    /* instrumentation must see every instruction, so leave the loop to it. */
+    if (NULL != inst->debug || NULL != inst->trace || NULL != inst->flight
+     || NULL != inst->coverage
+     || inst->instructions != j65c02_instructions_base(inst))
+    {
+        return 0;
+    }
+
+#if JEMU_PROFILE_ENABLED
+    if (NULL != inst->profile)
+    {
+        return 0;
+    }
+#endif /* JEMU_PROFILE_ENABLED */
+
+    /* the loop body must be short, and held by a single region. */
+    if (length - 2 > IDIOM_MAX_BODY)
+    {
+        return 0;
+    }
+
+    const uint8_t* code = idiom_range(inst, head, length);
+    if (NULL == code)
+    {
+        return 0;
+    }
+
+    /* a native routine in the loop must be called. */
+    if (NULL != inst->hle)
+    {
+        for (int i = 0; i < length; ++i)
+        {
+            if (j65c02_hle_check(inst->hle, (uint16_t)(head + i)))
+            {
+                return 0;
+            }
+        }
+    }
+
+    /* decode an optional load, then a store. */
+    if (idiom_decode(inst, &load_access, idiom_loads, code, &pos, length))
+    {
+        load = &load_access;
+    }
+
+    if (!idiom_decode(inst, &store_access, idiom_stores, code, &pos, length))
+    {
+        return 0;
+    }
+
+    /* decode the step of the index, which must be followed by the BNE. */
+    if (pos != length - 3)
+    {
+        return 0;
+    }
+
+    switch (code[pos])
+    {
+        case 0xC8: reg = IDIOM_Y; step = 1; break;
+        case 0x88: reg = IDIOM_Y; step = -1; break;
+        case 0xE8: reg = IDIOM_X; step = 1; break;
+        case 0xCA: reg = IDIOM_X; step = -1; break;
+        default: return 0;
+    }
+
+    if (0xD0 != code[pos + 1] || store_access.op->reg != reg
+     || (NULL != load && load->op->reg != reg))
+    {
+        return 0;
+    }
+
+    /* the BNE was taken, so the index is not zero. */
+    int index = IDIOM_X == reg ? inst->reg_x : inst->reg_y;
+    int remaining = step > 0 ? 256 - index : index;
+
+    /* run only the iterations after which a run would still have the budget
+     * for every instruction in the loop. */
+    int per_iteration =
+        (NULL != load ? load->op->cycles : 0) + store_access.op->cycles
+      + IDIOM_STEP_CYCLES + IDIOM_BNE_CYCLES;
+
+    max_cycles = inst->instructions[0xD0].max_cycles;
+    for (int i = 0; i < length - 2;
+         i += JEMU_SYM(global_j65c02_instruction_lengths)[code[i]])
+    {
+        if (inst->instructions[code[i]].max_cycles > max_cycles)
+        {
+            max_cycles = inst->instructions[code[i]].max_cycles;
+        }
+    }
+
+    int count = (cycles - max_cycles - 1) / per_iteration;
+    if (cycles - max_cycles - 1 < 0 || count < 1)
+    {
+        return 0;
+    }
+
+    int consumed;
+    if (count >= remaining)
+    {
+        /* the last BNE falls through. */
+        count = remaining;
+        consumed = count * per_iteration - 1;
+    }
+    else
+    {
+        consumed = count * per_iteration;
+    }
+
+    /* find the memory touched, lowest address first. */
+    int first = step > 0 ? index : index - count + 1;
+    int dst = store_access.base + first;
+    int src = NULL != load ? load->base + first : 0;
+    uint8_t* dst_mem = idiom_range(inst, dst, count);
+    const uint8_t* src_mem = NULL;
+
+    if (NULL == dst_mem
+     || idiom_clobbers(dst, count, head, length, load, &store_access))
+    {
+        return 0;
+    }
+
+    if (NULL != load)
+    {
+        src_mem = idiom_range(inst, src, count);
+        if (NULL == src_mem)
+        {
+            return 0;
+        }
+    }
+
+    /* copy or fill the memory. */
+    if (NULL != load && idiom_overlaps(src, count, dst, count))
+    {
+        /* overlapping ranges are copied a byte at a time, in loop order. */
+        for (int i = 0; i < count; ++i)
+        {
+            int j = step > 0 ? i : count - 1 - i;
+
+            inst->reg_a = src_mem[j];
+            dst_mem[j] = 0x9E == store_access.op->opcode ? 0 : inst->reg_a;
+        }
+    }
+    else
+    {
+        if (NULL != load)
+        {
+            inst->reg_a = src_mem[step > 0 ? count - 1 : 0];
+        }
+
+        if (0x9E == store_access.op->opcode)
+        {
+            memset(dst_mem, 0, count);
+        }
+        else if (NULL != load)
+        {
+            memcpy(dst_mem, src_mem, count);
+        }
+        else
+        {
+            memset(dst_mem, inst->reg_a, count);
+        }
+    }
+
+    /* step the index, and set the flags from it. */
+    uint8_t value = (uint8_t)(index + step * count);
+    if (IDIOM_X == reg)
+    {
+        inst->reg_x = value;
+    }
+    else
+    {
+        inst->reg_y = value;
+    }
+
+    inst->reg_status &=
+        ~(JEMU_65c02_STATUS_NEGATIVE | JEMU_65c02_STATUS_ZERO);
+    if (value & 0x80)
+    {
+        inst->reg_status |= JEMU_65c02_STATUS_NEGATIVE;
+    }
+    if (0x00 == value)
+    {
+        inst->reg_status |= JEMU_65c02_STATUS_ZERO;
+    }
+
+    /* leave the loop once it is done, or return to its head. */
+    inst->reg_pc = count == remaining ? bne_pc + 2 : head;
+    ++inst->idiom_count;
+
+    return consumed;
+}
@@ -0,0 +1,31 @@
+/**
+ * \file j65c02_idioms_enable.c
+ *
+ * \brief Enable or disable loop idiom recognition on an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_idiom;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Enable or disable loop idiom recognition on an instance.
+ *
+ * \param inst              The instance for this operation.
+ * \param enable            true to enable idioms, or false to disable them.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_idioms_enable)(JEMU_SYM(j65c02)* inst, bool enable)
+{
+    inst->idioms = enable;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,104 @@
+/**
+ * \file j65c02_init.c
+ *
+ * \brief Initialize an emulator instance in caller-provided storage.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Initialize an emulator instance in caller-provided storage.
+ *
+ * \note No memory is allocated by this call. The storage must be at least
+ * \ref j65c02_sizeof bytes in size, must be aligned for a pointer, and must
+ * outlive the instance. Aligning the storage to a cache line keeps the hot
+ * fields of the instance in a single line. On success, the caller must still
+ * call \ref j65c02_release when the instance is no longer needed; this clears
+ * the storage but does not free it.
+ *
+ * \param inst              Pointer to the instance pointer to set to the
+ *                          initialized instance on success.
+ * \param storage           The storage in which the instance is placed.
+ * \param size              The size of this storage, in bytes.
+ * \param read              The read callback function.
+ * \param write             The write callback function.
+ * \param context           The user context to be passed to the callback
+ *                          functions.
+ * \param personality       The processor personality (MOS, ROCKWELL, or WDC).
+ * \param emulation_mode    The emulation mode (strict or map invalid opcodes as
+ *                          NOPs).
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_init)(
+    JEMU_SYM(j65c02)** inst, void* storage, size_t size,
+    JEMU_SYM(j65c02_read_fn) read, JEMU_SYM(j65c02_write_fn) write,
+    void* context, int personality, int emulation_mode)
+{
+    j65c02* tmp = (j65c02*)storage;
+
+    /* verify that the storage can hold an instance. */
+    if (NULL == storage || size < sizeof(*tmp)
+     || 0 != ((uintptr_t)storage % _Alignof(j65c02)))
+    {
+        return JEMU_ERROR_BAD_STORAGE;
+    }
+
+    /* verify the personality. */
+    switch (personality)
+    {
+        case JEMU_65c02_PERSONALITY_MOS:
+        case JEMU_65c02_PERSONALITY_ROCKWELL:
+        case JEMU_65c02_PERSONALITY_WDC:
+            break;
+
+        default:
+            return JEMU_ERROR_INVALID_PERSONALITY;
+    }
+
+    /* verify the emulation mode. */
+    switch (emulation_mode)
+    {
+        case JEMU_65c02_EMULATION_MODE_STRICT:
+        case JEMU_65c02_EMULATION_MODE_NOP:
+            break;
+
+        default:
+            return JEMU_ERROR_INVALID_EMULATION_MODE;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* start the processor in crash mode; reset must be called to reset it. */
+    tmp->crash = true;
+
+    /* set the processor configuration. */
+    tmp->personality = personality;
+    tmp->emulation_mode = emulation_mode;
+    tmp->storage = JEMU_J65C02_STORAGE_PLACEMENT;
+
+    /* set user values. */
+    tmp->user_context = context;
+    tmp->read = read;
+    tmp->write = write;
+
+    /* dispatch through the plain instruction table. */
+    tmp->instructions = JEMU_SYM(global_j65c02_instructions);
+
+    /* success. */
+    *inst = tmp;
+    return STATUS_SUCCESS;
+}
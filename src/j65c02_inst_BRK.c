@@ -75,6 +75,12 @@ JEMU_SYM(status) JEMU_SYM(j65c02_inst_BRK)(
     /* set the new address. */
     inst->reg_pc = (addr_high << 8) | addr_low;
 
+#if JEMU_PROFILE_ENABLED
+    /* push the call onto the shadow call stack. */
+    j65c02_profile_call(
+        inst, JEMU_PROFILE_CALL_BRK, (uint8_t)(inst->reg_sp + 3));
+#endif /* JEMU_PROFILE_ENABLED */
+
     /* this instruction takes 7 cycles. */
     *cycles = 7;
 
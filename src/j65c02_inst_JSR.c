@@ -57,6 +57,12 @@ JEMU_SYM(status) JEMU_SYM(j65c02_inst_JSR)(
     /* set PC to the address. */
     inst->reg_pc = addr;
 
+#if JEMU_PROFILE_ENABLED
+    /* push the call onto the shadow call stack. */
+    j65c02_profile_call(
+        inst, JEMU_PROFILE_CALL_JSR, (uint8_t)(inst->reg_sp + 2));
+#endif /* JEMU_PROFILE_ENABLED */
+
     /* this instruction takes 6 cycles. */
     *cycles = 6;
 
@@ -57,6 +57,19 @@ JEMU_SYM(status) JEMU_SYM(j65c02_inst_RTI)(
     /* set the address. */
     inst->reg_pc = (addr_high << 8) | addr_low;
 
+    /* end the handlers this returns from on the timeline. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_return(inst, 6);
+    }
+
+#if JEMU_PROFILE_ENABLED
+    /* pop the calls this returns from off of the shadow call stack, and stop
+     * timing their handlers. */
+    j65c02_profile_return(inst);
+    j65c02_profile_interrupt_return(inst, 6);
+#endif /* JEMU_PROFILE_ENABLED */
+
     /* this instruction takes 6 cycles. */
     *cycles = 6;
 
@@ -45,6 +45,11 @@ JEMU_SYM(status) JEMU_SYM(j65c02_inst_RTS)(
     /* set the address. */
     inst->reg_pc = (addr_high << 8) | addr_low;
 
+#if JEMU_PROFILE_ENABLED
+    /* pop the calls this returns from off of the shadow call stack. */
+    j65c02_profile_return(inst);
+#endif /* JEMU_PROFILE_ENABLED */
+
     /* this instruction takes 6 cycles. */
     *cycles = 6;
 
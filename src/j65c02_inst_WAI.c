@@ -30,6 +30,12 @@ JEMU_SYM(status) JEMU_SYM(j65c02_inst_WAI)(
     /* set the wait flag. */
     inst->wait = true;
 
+    /* begin the wait on the timeline, once this instruction is done. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_wait(inst, inst->cycle_count + 3);
+    }
+
     /* this instruction takes three cycles. */
     *cycles = 3;
 
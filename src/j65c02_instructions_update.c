@@ -0,0 +1,50 @@
+/**
+ * \file j65c02_instructions_update.c
+ *
+ * \brief Select the dispatch table of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Select the dispatch table of an instance after its custom opcodes,
+ * hooks, or sanitizer change.
+ *
+ * \note The sanitized table calls the hooked table, which calls the custom
+ * or global table, and the instance dispatches through the outermost of them.
+ * The cycle budget of each wrapping table is copied from the table beneath.
+ *
+ * \param inst              The instance for this operation.
+ */
+void JEMU_SYM(j65c02_instructions_update)(JEMU_SYM(j65c02)* inst)
+{
+    const j65c02_instruction* table = j65c02_instructions_base(inst);
+
+    if (NULL != inst->hooked)
+    {
+        for (int i = 0; i < 256; ++i)
+        {
+            inst->hooked[i].max_cycles = table[i].max_cycles;
+        }
+
+        table = inst->hooked;
+    }
+
+    if (NULL != inst->sanitizer)
+    {
+        for (int i = 0; i < 256; ++i)
+        {
+            inst->sanitizer->instructions[i].max_cycles = table[i].max_cycles;
+        }
+
+        table = inst->sanitizer->instructions;
+    }
+
+    inst->instructions = table;
+}
@@ -26,6 +26,22 @@ JEMU_SYM(j65c02_interrupt)(JEMU_SYM(j65c02)* inst)
 {
     status retval;
     uint8_t addr_low, addr_high;
+#if JEMU_PROFILE_ENABLED
+    int source =
+        inst->wait ? JEMU_PROFILE_INTERRUPT_WAKE : JEMU_PROFILE_INTERRUPT_IRQ;
+#endif /* JEMU_PROFILE_ENABLED */
+
+    /* note the interrupt in the trace, even if it only ends a wait. */
+    if (NULL != inst->trace)
+    {
+        j65c02_trace_control(inst->trace, JEMU_TRACE_RECORD_IRQ, 0);
+    }
+
+    /* end any wait on the timeline. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_wake(inst);
+    }
 
     /* disable the wait flag on interrupt. */
     inst->wait = false;
@@ -72,14 +88,39 @@ JEMU_SYM(j65c02_interrupt)(JEMU_SYM(j65c02)* inst)
             return retval;
         }
 
-        /* set the new address. */
+        /* set the new address, dropping an opcode left pending by the last
+         * run, and counting the edge to it in the coverage map. */
+        uint16_t from = inst->reg_pc;
         inst->reg_pc = (addr_high << 8) | addr_low;
+        inst->opcode_pending = false;
+        if (NULL != inst->coverage)
+        {
+            j65c02_coverage_edge(inst->coverage, from, inst->reg_pc);
+        }
+
+        /* begin the handler on the timeline. */
+        if (NULL != inst->timeline)
+        {
+            j65c02_timeline_interrupt(inst, "irq");
+        }
+
+#if JEMU_PROFILE_ENABLED
+        /* push the call onto the shadow call stack, and time the handler. */
+        j65c02_profile_call(
+            inst, JEMU_PROFILE_CALL_IRQ, (uint8_t)(inst->reg_sp + 3));
+        j65c02_profile_interrupt(inst, source, true);
+#endif /* JEMU_PROFILE_ENABLED */
 
         /* success. */
         return STATUS_SUCCESS;
     }
     else
     {
+#if JEMU_PROFILE_ENABLED
+        /* count the masked interrupt. */
+        j65c02_profile_interrupt(inst, source, false);
+#endif /* JEMU_PROFILE_ENABLED */
+
         /* Do nothing if interrupts are disabled. */
         return STATUS_SUCCESS;
     }
@@ -0,0 +1,26 @@
+/**
+ * \file j65c02_mailbox_count_get.c
+ *
+ * \brief Get the number of messages waiting in a mailbox.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_system_internal.h"
+
+/**
+ * \brief Get the number of messages waiting in a mailbox.
+ *
+ * \param mailbox           The mailbox to query.
+ *
+ * \returns the number of messages waiting.
+ */
+size_t JEMU_SYM(j65c02_mailbox_count_get)(
+    const JEMU_SYM(j65c02_mailbox)* mailbox)
+{
+    size_t head = atomic_load_explicit(&mailbox->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&mailbox->tail, memory_order_acquire);
+
+    return tail - head;
+}
@@ -0,0 +1,43 @@
+/**
+ * \file j65c02_mailbox_receive.c
+ *
+ * \brief Receive a message from a mailbox.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_system_internal.h"
+
+/**
+ * \brief Receive a message from a mailbox.
+ *
+ * \note This must only be called by the receiving CPU, usually from its read
+ * callback.
+ *
+ * \param mailbox           The mailbox from which the message is received.
+ * \param message           Pointer to be set to the message on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_MAILBOX_EMPTY if the mailbox is empty.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_mailbox_receive)(
+    JEMU_SYM(j65c02_mailbox)* mailbox, uint8_t* message)
+{
+    size_t head = atomic_load_explicit(&mailbox->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&mailbox->tail, memory_order_acquire);
+
+    /* verify that there is a message to receive. */
+    if (head == tail)
+    {
+        return JEMU_ERROR_MAILBOX_EMPTY;
+    }
+
+    /* hand the slot back to the sender. */
+    *message = mailbox->ring[head & mailbox->mask];
+    atomic_store_explicit(&mailbox->head, head + 1, memory_order_release);
+
+    return STATUS_SUCCESS;
+}
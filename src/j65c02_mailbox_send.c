@@ -0,0 +1,43 @@
+/**
+ * \file j65c02_mailbox_send.c
+ *
+ * \brief Send a message through a mailbox.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_system_internal.h"
+
+/**
+ * \brief Send a message through a mailbox.
+ *
+ * \note This must only be called by the sending CPU, usually from its write
+ * callback.
+ *
+ * \param mailbox           The mailbox to which the message is sent.
+ * \param message           The message to send.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_MAILBOX_FULL if the mailbox is full.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_mailbox_send)(
+    JEMU_SYM(j65c02_mailbox)* mailbox, uint8_t message)
+{
+    size_t tail = atomic_load_explicit(&mailbox->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&mailbox->head, memory_order_acquire);
+
+    /* verify that there is room for this message. */
+    if (tail - head > mailbox->mask)
+    {
+        return JEMU_ERROR_MAILBOX_FULL;
+    }
+
+    /* publish the message to the receiver. */
+    mailbox->ring[tail & mailbox->mask] = message;
+    atomic_store_explicit(&mailbox->tail, tail + 1, memory_order_release);
+
+    return STATUS_SUCCESS;
+}
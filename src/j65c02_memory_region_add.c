@@ -0,0 +1,61 @@
+/**
+ * \file j65c02_memory_region_add.c
+ *
+ * \brief Register a region of host memory with an emulator instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Register a region of host memory that backs part of the guest address
+ * space.
+ *
+ * \note The read and write callbacks remain the only way the processor reaches
+ * memory; a region tells the library which host bytes hold the guest's state,
+ * so that features such as snapshots can save and restore it directly. Any
+ * device state that must be rolled back with the processor should live in a
+ * registered region. The memory must outlive the instance.
+ *
+ * \param inst              The instance for this operation.
+ * \param base              The guest address at which this region starts.
+ * \param mem               The host memory backing this region.
+ * \param size              The size of this region, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_INVALID_MEMORY_REGION if the region is empty or does not
+ *        fit in the guest address space.
+ *      - JEMU_ERROR_MEMORY_REGION_LIMIT if JEMU_MAX_MEMORY_REGIONS regions are
+ *        already registered.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_memory_region_add)(
+    JEMU_SYM(j65c02)* inst, uint16_t base, uint8_t* mem, size_t size)
+{
+    j65c02_memory_region* region;
+
+    /* verify the region. */
+    if (NULL == mem || 0 == size || size > 0x10000 - (size_t)base)
+    {
+        return JEMU_ERROR_INVALID_MEMORY_REGION;
+    }
+
+    /* verify that there is room for another region. */
+    if (inst->region_count >= JEMU_MAX_MEMORY_REGIONS)
+    {
+        return JEMU_ERROR_MEMORY_REGION_LIMIT;
+    }
+
+    region = inst->regions + inst->region_count;
+    region->mem = mem;
+    region->size = size;
+    region->base = base;
+    ++inst->region_count;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file j65c02_memory_region_find.c
+ *
+ * \brief Find the registered memory region that holds a guest address.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Find the registered memory region that holds a guest address.
+ *
+ * \param inst              The instance to search.
+ * \param addr              The guest address to find.
+ *
+ * \returns the region holding this address, or NULL if there is none.
+ */
+JEMU_SYM(j65c02_memory_region)* JEMU_SYM(j65c02_memory_region_find)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr)
+{
+    for (size_t i = 0; i < inst->region_count; ++i)
+    {
+        JEMU_SYM(j65c02_memory_region)* region = inst->regions + i;
+
+        if (addr >= region->base
+         && (size_t)(addr - region->base) < region->size)
+        {
+            return region;
+        }
+    }
+
+    return NULL;
+}
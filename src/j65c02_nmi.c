@@ -27,6 +27,12 @@ JEMU_SYM(j65c02_nmi)(JEMU_SYM(j65c02)* inst)
     status retval;
     uint8_t addr_low, addr_high;
 
+    /* note the NMI in the trace. */
+    if (NULL != inst->trace)
+    {
+        j65c02_trace_control(inst->trace, JEMU_TRACE_RECORD_NMI, 0);
+    }
+
     /* push the PC onto the stack. */
     retval = j65c02_push(inst, inst->reg_pc >> 8);
     if (STATUS_SUCCESS != retval)
@@ -66,8 +72,28 @@ JEMU_SYM(j65c02_nmi)(JEMU_SYM(j65c02)* inst)
         return retval;
     }
 
-    /* set the new address. */
+    /* set the new address, dropping an opcode left pending by the last run,
+     * and counting the edge to it in the coverage map. */
+    uint16_t from = inst->reg_pc;
     inst->reg_pc = (addr_high << 8) | addr_low;
+    inst->opcode_pending = false;
+    if (NULL != inst->coverage)
+    {
+        j65c02_coverage_edge(inst->coverage, from, inst->reg_pc);
+    }
+
+    /* begin the handler on the timeline. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_interrupt(inst, "nmi");
+    }
+
+#if JEMU_PROFILE_ENABLED
+    /* push the call onto the shadow call stack, and time the handler. */
+    j65c02_profile_call(
+        inst, JEMU_PROFILE_CALL_NMI, (uint8_t)(inst->reg_sp + 3));
+    j65c02_profile_interrupt(inst, JEMU_PROFILE_INTERRUPT_NMI, true);
+#endif /* JEMU_PROFILE_ENABLED */
 
     /* success. */
     return STATUS_SUCCESS;
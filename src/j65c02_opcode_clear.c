@@ -0,0 +1,51 @@
+/**
+ * \file j65c02_opcode_clear.c
+ *
+ * \brief Clear the handler of a custom opcode.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_opcode;
+
+/**
+ * \brief Clear the handler of a custom opcode, making it invalid again.
+ *
+ * \param inst              The instance for this operation.
+ * \param opcode            The opcode to clear.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_OPCODE_IN_USE if this opcode is a 65c02 instruction.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_opcode_clear)(JEMU_SYM(j65c02)* inst, uint8_t opcode)
+{
+    j65c02_custom* custom = inst->custom;
+
+    if (&JEMU_SYM(j65c02_inst_invalid_opcode)
+            != JEMU_SYM(global_j65c02_instructions)[opcode].exec)
+    {
+        return JEMU_ERROR_OPCODE_IN_USE;
+    }
+
+    if (NULL == custom)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    memset(custom->opcodes + opcode, 0, sizeof(*custom->opcodes));
+    custom->instructions[opcode] =
+        JEMU_SYM(global_j65c02_instructions)[opcode];
+
+    j65c02_instructions_update(inst);
+
+    return STATUS_SUCCESS;
+}
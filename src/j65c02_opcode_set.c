@@ -0,0 +1,85 @@
+/**
+ * \file j65c02_opcode_set.c
+ *
+ * \brief Set the handler of an unused opcode on an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_opcode;
+
+/**
+ * \brief Set the handler of an unused opcode on an instance.
+ *
+ * \note Custom opcodes are run by \ref j65c02_run, \ref j65c02_step, history
+ * runs and their replays, but not by batches. Setting an opcode again
+ * replaces its handler.
+ *
+ * \param inst              The instance for this operation.
+ * \param opcode            The unused opcode to set.
+ * \param fn                The handler of this opcode.
+ * \param context           The context passed to this handler.
+ * \param operand_length    The number of operand bytes, from 0 to 2.
+ * \param cycles            The cycles charged for each execution, at least 1.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_OPCODE_IN_USE if this opcode is a 65c02 instruction.
+ *      - JEMU_ERROR_OPCODE_BAD_HANDLER if the handler is NULL, or the operand
+ *        length or cycles are out of range.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_opcode_set)(
+    JEMU_SYM(j65c02)* inst, uint8_t opcode, JEMU_SYM(j65c02_opcode_fn) fn,
+    void* context, int operand_length, int cycles)
+{
+    j65c02_custom* custom = inst->custom;
+
+    if (&JEMU_SYM(j65c02_inst_invalid_opcode)
+            != JEMU_SYM(global_j65c02_instructions)[opcode].exec)
+    {
+        return JEMU_ERROR_OPCODE_IN_USE;
+    }
+
+    if (NULL == fn || operand_length < 0 || operand_length > 2 || cycles < 1)
+    {
+        return JEMU_ERROR_OPCODE_BAD_HANDLER;
+    }
+
+    /* the custom table starts out as a copy of the global table. */
+    if (NULL == custom)
+    {
+        custom = malloc(sizeof(*custom));
+        if (NULL == custom)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        memset(custom, 0, sizeof(*custom));
+        memcpy(
+            custom->instructions, JEMU_SYM(global_j65c02_instructions),
+            sizeof(custom->instructions));
+        inst->custom = custom;
+    }
+
+    custom->opcodes[opcode].fn = fn;
+    custom->opcodes[opcode].context = context;
+    custom->opcodes[opcode].operand_length = operand_length;
+    custom->opcodes[opcode].cycles = cycles;
+    custom->instructions[opcode].exec =
+        JEMU_SYM(global_j65c02_custom_execs)[opcode];
+    custom->instructions[opcode].max_cycles = cycles;
+
+    j65c02_instructions_update(inst);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file j65c02_pool_acquire.c
+ *
+ * \brief Acquire an emulator instance from a pool.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_pool;
+
+/**
+ * \brief Acquire an emulator instance from a pool.
+ *
+ * \note On success, the caller owns the instance and must release it by
+ * calling \ref j65c02_release, which returns its slot to the pool. All
+ * instances must be released before the pool is released.
+ *
+ * \param pool              The pool from which the instance is acquired.
+ * \param inst              Pointer to the instance pointer to set to the
+ *                          acquired instance on success.
+ * \param read              The read callback function.
+ * \param write             The write callback function.
+ * \param context           The user context to be passed to the callback
+ *                          functions.
+ * \param personality       The processor personality (MOS, ROCKWELL, or WDC).
+ * \param emulation_mode    The emulation mode (strict or map invalid opcodes as
+ *                          NOPs).
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_POOL_EXHAUSTED if every slot is in use.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_pool_acquire)(
+    JEMU_SYM(j65c02_pool)* pool, JEMU_SYM(j65c02)** inst,
+    JEMU_SYM(j65c02_read_fn) read, JEMU_SYM(j65c02_write_fn) write,
+    void* context, int personality, int emulation_mode)
+{
+    status retval;
+    j65c02* tmp;
+
+    /* verify that a slot is available. */
+    if (0 == pool->available)
+    {
+        return JEMU_ERROR_POOL_EXHAUSTED;
+    }
+
+    /* initialize an instance in the most recently freed slot. */
+    size_t slot = pool->free_list[pool->available - 1];
+    retval =
+        j65c02_init(
+            &tmp, pool->slots + slot * pool->stride, pool->stride, read,
+            write, context, personality, emulation_mode);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* this slot is now in use. */
+    --pool->available;
+    pool->in_use[slot] = true;
+
+    /* releasing the instance returns it to this pool. */
+    tmp->storage = JEMU_J65C02_STORAGE_POOL;
+    tmp->pool = pool;
+
+    /* success. */
+    *inst = tmp;
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,22 @@
+/**
+ * \file j65c02_pool_available_get.c
+ *
+ * \brief Getter for the pool available.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Get the number of free instance slots in a pool.
+ *
+ * \param pool              The pool to query.
+ *
+ * \returns the number of free slots.
+ */
+size_t JEMU_SYM(j65c02_pool_available_get)(const JEMU_SYM(j65c02_pool)* pool)
+{
+    return pool->available;
+}
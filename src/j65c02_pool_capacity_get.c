@@ -0,0 +1,22 @@
+/**
+ * \file j65c02_pool_capacity_get.c
+ *
+ * \brief Getter for the pool capacity.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Get the number of instance slots in a pool.
+ *
+ * \param pool              The pool to query.
+ *
+ * \returns the pool capacity.
+ */
+size_t JEMU_SYM(j65c02_pool_capacity_get)(const JEMU_SYM(j65c02_pool)* pool)
+{
+    return pool->capacity;
+}
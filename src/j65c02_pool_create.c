@@ -0,0 +1,93 @@
+/**
+ * \file j65c02_pool_create.c
+ *
+ * \brief Create an instance pool.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02_pool;
+
+/**
+ * \brief Create an instance pool.
+ *
+ * \note On success, the caller is given ownership of the pool and must release
+ * it by calling \ref j65c02_pool_release when it is no longer needed. This is
+ * the only allocation made by the pool.
+ *
+ * \param pool              Pointer to the pool pointer to set to the created
+ *                          pool on success.
+ * \param capacity          The number of instance slots in this pool.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_pool_create)(JEMU_SYM(j65c02_pool)** pool, size_t capacity)
+{
+    j65c02_pool* tmp;
+    size_t stride, header_size, free_list_size, in_use_size, total_size;
+    uintptr_t slots;
+
+    /* pad each slot to a whole number of cache lines. */
+    stride =
+        (sizeof(JEMU_SYM(j65c02)) + JEMU_CACHE_LINE_SIZE - 1)
+            & ~((size_t)JEMU_CACHE_LINE_SIZE - 1);
+
+    /* guard against overflow when sizing the allocation. */
+    if (0 == capacity || capacity > (SIZE_MAX / 2) / stride)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* the pool header, free list, in use flags, and slots share a single
+     * allocation. */
+    header_size = sizeof(*tmp);
+    free_list_size = capacity * sizeof(size_t);
+    in_use_size = capacity * sizeof(bool);
+    total_size =
+        header_size + free_list_size + in_use_size + JEMU_CACHE_LINE_SIZE
+      + capacity * stride;
+
+    /* allocate memory for the pool. */
+    tmp = malloc(total_size);
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* the free list follows the header. */
+    tmp->free_list = (size_t*)(tmp + 1);
+
+    /* the in use flags follow the free list; no slot is in use yet. */
+    tmp->in_use = (bool*)(tmp->free_list + capacity);
+    memset(tmp->in_use, 0, in_use_size);
+
+    /* the slots start on the first cache line after the in use flags. */
+    slots = (uintptr_t)(tmp->in_use + capacity);
+    slots =
+        (slots + JEMU_CACHE_LINE_SIZE - 1)
+            & ~((uintptr_t)JEMU_CACHE_LINE_SIZE - 1);
+
+    tmp->slots = (uint8_t*)slots;
+    tmp->stride = stride;
+    tmp->capacity = capacity;
+
+    /* every slot starts out free. */
+    j65c02_pool_reset(tmp);
+
+    /* success. */
+    *pool = tmp;
+    return STATUS_SUCCESS;
+}
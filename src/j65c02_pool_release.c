@@ -0,0 +1,41 @@
+/**
+ * \file j65c02_pool_release.c
+ *
+ * \brief Release an instance pool.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Release an instance pool.
+ *
+ * \note After this call, the pool pointer and every instance acquired from it
+ * are no longer valid. What each instance still in use owns is freed.
+ *
+ * \param pool              The pool to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_pool_release)(JEMU_SYM(j65c02_pool)* pool)
+{
+    /* free the instances still in use, and clear the slots. */
+    JEMU_SYM(j65c02_pool_reset)(pool);
+
+    /* clear the pool header. */
+    memset(pool, 0, sizeof(*pool));
+
+    /* free memory. */
+    free(pool);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,45 @@
+/**
+ * \file j65c02_pool_reset.c
+ *
+ * \brief Reset an instance pool.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Reset a pool, returning every slot to the free list.
+ *
+ * \note Any instance acquired from this pool is invalid after this call and
+ * must not be released. What each instance still in use owns is freed.
+ *
+ * \param pool              The pool to reset.
+ */
+void JEMU_SYM(j65c02_pool_reset)(JEMU_SYM(j65c02_pool)* pool)
+{
+    /* free what each instance still in use owns. */
+    for (size_t i = 0; i < pool->capacity; ++i)
+    {
+        if (pool->in_use[i])
+        {
+            JEMU_SYM(j65c02_release_owned)(
+                (JEMU_SYM(j65c02)*)(pool->slots + i * pool->stride));
+        }
+    }
+
+    /* clear every slot. */
+    memset(pool->slots, 0, pool->capacity * pool->stride);
+    memset(pool->in_use, 0, pool->capacity * sizeof(bool));
+
+    /* the free list is a stack; hand out the lowest slots first. */
+    for (size_t i = 0; i < pool->capacity; ++i)
+    {
+        pool->free_list[i] = pool->capacity - 1 - i;
+    }
+
+    pool->available = pool->capacity;
+}
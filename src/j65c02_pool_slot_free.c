@@ -0,0 +1,52 @@
+/**
+ * \file j65c02_pool_slot_free.c
+ *
+ * \brief Return the slot backing a pool instance to its pool.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Return the slot backing a pool instance to its pool.
+ *
+ * \param pool              The pool that owns this instance.
+ * \param inst              The instance whose slot is returned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_POOL_BAD_INSTANCE if this instance is not from this pool,
+ *        or its slot is already free.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_pool_slot_free)(
+    JEMU_SYM(j65c02_pool)* pool, JEMU_SYM(j65c02)* inst)
+{
+    uint8_t* ptr = (uint8_t*)inst;
+    size_t slot;
+
+    /* verify that this instance lives in one of our slots. */
+    if (NULL == pool || ptr < pool->slots
+     || ptr >= pool->slots + pool->capacity * pool->stride
+     || 0 != (size_t)(ptr - pool->slots) % pool->stride
+     || pool->available >= pool->capacity)
+    {
+        return JEMU_ERROR_POOL_BAD_INSTANCE;
+    }
+
+    /* verify that this slot is in use, so it is not freed twice. */
+    slot = (size_t)(ptr - pool->slots) / pool->stride;
+    if (!pool->in_use[slot])
+    {
+        return JEMU_ERROR_POOL_BAD_INSTANCE;
+    }
+
+    /* push this slot onto the free list. */
+    pool->in_use[slot] = false;
+    pool->free_list[pool->available++] = slot;
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
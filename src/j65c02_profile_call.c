@@ -0,0 +1,104 @@
+/**
+ * \file j65c02_profile_call.c
+ *
+ * \brief Push a call onto the shadow call stack of a profiled instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Push a call onto the shadow call stack of a profiled instance.
+ *
+ * \note This is called once the call has been taken, so the program counter
+ * holds its target. It does nothing unless the instance is profiled.
+ *
+ * \param inst              The instance for this operation.
+ * \param kind              The JEMU_PROFILE_CALL_* kind of this call.
+ * \param sp                The stack pointer before the call pushed its
+ *                          return address.
+ */
+void JEMU_SYM(j65c02_profile_call)(
+    JEMU_SYM(j65c02)* inst, int kind, uint8_t sp)
+{
+#if JEMU_PROFILE_ENABLED
+    JEMU_SYM(j65c02_profile)* profile = inst->profile;
+    JEMU_SYM(j65c02_profile_node)* nodes;
+    uint32_t child;
+
+    if (NULL == profile)
+    {
+        return;
+    }
+
+    /* past the deepest stack we keep, calls are counted in their caller. */
+    if (JEMU_PROFILE_MAX_DEPTH == profile->depth)
+    {
+        return;
+    }
+
+    /* find the path of this call from the current one. */
+    child = profile->nodes[profile->node].first_child;
+    while (0 != child
+        && (profile->nodes[child].addr != inst->reg_pc
+         || profile->nodes[child].kind != kind))
+    {
+        child = profile->nodes[child].next_sibling;
+    }
+
+    /* add a new path, if there is room for it. */
+    if (0 == child && profile->node_count < JEMU_PROFILE_MAX_CALL_PATHS)
+    {
+        if (profile->node_count == profile->node_capacity)
+        {
+            nodes =
+                realloc(
+                    profile->nodes,
+                    2 * profile->node_capacity * sizeof(*nodes));
+            if (NULL != nodes)
+            {
+                profile->nodes = nodes;
+                profile->node_capacity *= 2;
+            }
+        }
+
+        if (profile->node_count < profile->node_capacity)
+        {
+            child = (uint32_t)profile->node_count++;
+            memset(profile->nodes + child, 0, sizeof(*profile->nodes));
+            profile->nodes[child].parent = profile->node;
+            profile->nodes[child].addr = inst->reg_pc;
+            profile->nodes[child].kind = (uint8_t)kind;
+            profile->nodes[child].next_sibling =
+                profile->nodes[profile->node].first_child;
+            profile->nodes[profile->node].first_child = child;
+        }
+    }
+
+    /* a call with no room for its path is counted in its caller. */
+    if (0 == child)
+    {
+        child = profile->node;
+    }
+    else
+    {
+        ++profile->nodes[child].calls;
+    }
+
+    profile->frames[profile->depth].node = profile->node;
+    profile->frames[profile->depth].sp = sp;
+    ++profile->depth;
+    profile->node = child;
+#else
+    (void)inst;
+    (void)kind;
+    (void)sp;
+#endif /* JEMU_PROFILE_ENABLED */
+}
@@ -0,0 +1,80 @@
+/**
+ * \file j65c02_profile_enable.c
+ *
+ * \brief Enable or disable the profiler of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+
+/**
+ * \brief Enable or disable the profiler of an instance.
+ *
+ * \note The counters are allocated by this call and freed when the instance is
+ * released. Enabling the profiler again clears its counters.
+ *
+ * \param inst              The instance for this operation.
+ * \param enable            true to enable the profiler, or false to disable
+ *                          it and free its counters.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the library was built without the
+ *        profiler.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_enable)(JEMU_SYM(j65c02)* inst, bool enable)
+{
+#if JEMU_PROFILE_ENABLED
+    JEMU_SYM(j65c02_profile)* profile = NULL;
+
+    if (enable)
+    {
+        profile = malloc(sizeof(*profile));
+        if (NULL == profile)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        memset(profile, 0, sizeof(*profile));
+
+        /* start the call graph with its root. */
+        profile->node_capacity = 64;
+        profile->nodes =
+            malloc(profile->node_capacity * sizeof(*profile->nodes));
+        if (NULL == profile->nodes)
+        {
+            free(profile);
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        memset(profile->nodes, 0, sizeof(*profile->nodes));
+        profile->node_count = 1;
+    }
+
+    /* replace the counters. */
+    if (NULL != inst->profile)
+    {
+        free(inst->profile->nodes);
+        free(inst->profile);
+    }
+
+    inst->profile = profile;
+
+    return STATUS_SUCCESS;
+#else
+    (void)inst;
+    (void)enable;
+
+    return JEMU_ERROR_PROFILE_DISABLED;
+#endif /* JEMU_PROFILE_ENABLED */
+}
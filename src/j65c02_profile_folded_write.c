@@ -0,0 +1,185 @@
+/**
+ * \file j65c02_profile_folded_write.c
+ *
+ * \brief Write the call paths of a profile as folded stacks.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+JEMU_IMPORT_jemu65c02_symbols;
+
+#if JEMU_PROFILE_ENABLED
+/* the longest label used to name a frame. */
+#define LABEL_MAX 64
+
+/* the longest frame name, such as "irq:" and a label, then a ';'. */
+#define FRAME_NAME_MAX (4 + LABEL_MAX + 1)
+
+/* the longest cycle count, with its leading space and trailing newline. */
+#define COUNT_MAX 22
+
+static size_t frame_name(
+    char* out, const JEMU_SYM(j65c02_symbols)* symbols,
+    const JEMU_SYM(j65c02_profile_node)* node);
+static size_t count_format(char* out, uint64_t count);
+#endif /* JEMU_PROFILE_ENABLED */
+
+/**
+ * \brief Write the call paths of a profile as folded stacks.
+ *
+ * \note Each path that spent cycles of its own is written as one line, such
+ * as "root;$E000;irq:$E050 1234", naming each call from the root, followed by
+ * its exclusive cycles. With a symbol table, calls are named by the labels of
+ * bank 0 instead, such as "root;reset;irq:irq_handler 1234".
+ *
+ * \param inst              The instance to query.
+ * \param symbols           The symbol table used to name calls, or NULL.
+ * \param sink              The sink to which lines are written.
+ * \param context           The user context for this sink.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ *      - the first error returned by the sink.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_folded_write)(
+    const JEMU_SYM(j65c02)* inst, const JEMU_SYM(j65c02_symbols)* symbols,
+    JEMU_SYM(j65c02_profile_sink_fn) sink, void* context)
+{
+#if JEMU_PROFILE_ENABLED
+    const JEMU_SYM(j65c02_profile)* profile = inst->profile;
+    status retval = STATUS_SUCCESS;
+    char* line;
+    size_t line_max, pos;
+    uint32_t node;
+
+    if (NULL == profile)
+    {
+        return JEMU_ERROR_PROFILE_DISABLED;
+    }
+
+    /* a path is never deeper than the shadow call stack. */
+    line_max = (JEMU_PROFILE_MAX_DEPTH + 1) * FRAME_NAME_MAX + COUNT_MAX;
+    line = malloc(line_max);
+    if (NULL == line)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (size_t i = 0; i < profile->node_count; ++i)
+    {
+        if (0 == profile->nodes[i].cycles)
+        {
+            continue;
+        }
+
+        /* name the frames from the callee back to the root, at the end of
+         * the line, then move them to its start. */
+        pos = line_max - COUNT_MAX;
+        node = (uint32_t)i;
+        for (;;)
+        {
+            char name[FRAME_NAME_MAX];
+            size_t size = frame_name(name, symbols, profile->nodes + node);
+
+            if (pos != line_max - COUNT_MAX)
+            {
+                line[--pos] = ';';
+            }
+
+            pos -= size;
+            memcpy(line + pos, name, size);
+
+            if (0 == node)
+            {
+                break;
+            }
+
+            node = profile->nodes[node].parent;
+        }
+
+        memmove(line, line + pos, line_max - COUNT_MAX - pos);
+        pos = line_max - COUNT_MAX - pos;
+        pos += count_format(line + pos, profile->nodes[i].cycles);
+
+        retval = sink(context, line, pos);
+        if (STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+    }
+
+    free(line);
+
+    return retval;
+#else
+    (void)inst;
+    (void)symbols;
+    (void)sink;
+    (void)context;
+
+    return JEMU_ERROR_PROFILE_DISABLED;
+#endif /* JEMU_PROFILE_ENABLED */
+}
+
+#if JEMU_PROFILE_ENABLED
+/**
+ * \brief Name a frame of a folded stack.
+ */
+static size_t frame_name(
+    char* out, const JEMU_SYM(j65c02_symbols)* symbols,
+    const JEMU_SYM(j65c02_profile_node)* node)
+{
+    static const char* prefixes[] = { "", "", "brk:", "irq:", "nmi:" };
+    size_t size;
+
+    if (JEMU_PROFILE_CALL_ROOT == node->kind)
+    {
+        memcpy(out, "root", 4);
+        return 4;
+    }
+
+    size = strlen(prefixes[node->kind]);
+    memcpy(out, prefixes[node->kind], size);
+
+    return
+        size
+      + j65c02_symbols_format(
+            symbols, 0, node->addr, out + size, LABEL_MAX + 1);
+}
+
+/**
+ * \brief Format the cycle count that ends a folded stack line.
+ */
+static size_t count_format(char* out, uint64_t count)
+{
+    char digits[20];
+    size_t size = 0, digit_count = 0;
+
+    do
+    {
+        digits[digit_count++] = (char)('0' + count % 10);
+        count /= 10;
+    } while (count > 0);
+
+    out[size++] = ' ';
+    while (digit_count > 0)
+    {
+        out[size++] = digits[--digit_count];
+    }
+
+    out[size++] = '\n';
+
+    return size;
+}
+#endif /* JEMU_PROFILE_ENABLED */
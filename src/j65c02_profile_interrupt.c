@@ -0,0 +1,67 @@
+/**
+ * \file j65c02_profile_interrupt.c
+ *
+ * \brief Count an interrupt raised on a profiled instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Count an interrupt raised on a profiled instance, and start timing
+ * its handler if it was taken.
+ *
+ * \note This is called once the interrupt has been taken, so the stack holds
+ * its return address, or once it has been masked. It does nothing unless the
+ * instance is profiled.
+ *
+ * \param inst              The instance for this operation.
+ * \param source            The JEMU_PROFILE_INTERRUPT_* source of this
+ *                          interrupt.
+ * \param taken             true if the handler was entered, or false if the
+ *                          interrupt was masked.
+ */
+void JEMU_SYM(j65c02_profile_interrupt)(
+    JEMU_SYM(j65c02)* inst, int source, bool taken)
+{
+#if JEMU_PROFILE_ENABLED
+    JEMU_SYM(j65c02_profile)* profile = inst->profile;
+    JEMU_SYM(j65c02_profile_interrupts)* interrupts;
+    JEMU_SYM(j65c02_profile_handler)* handler;
+
+    if (NULL == profile)
+    {
+        return;
+    }
+
+    interrupts = profile->interrupts + source;
+    ++interrupts->raised;
+    interrupts->last_raised = inst->cycle_count;
+
+    if (!taken)
+    {
+        ++interrupts->masked;
+        return;
+    }
+
+    /* the vector has been fetched, and the handler starts on the next
+     * instruction. */
+    interrupts->last_entered = inst->cycle_count;
+
+    if (profile->handler_depth < JEMU_PROFILE_MAX_HANDLERS)
+    {
+        handler = profile->handlers + profile->handler_depth++;
+        handler->source = source;
+        handler->sp = (uint8_t)(inst->reg_sp + 3);
+        handler->entered = inst->cycle_count;
+    }
+#else
+    (void)inst;
+    (void)source;
+    (void)taken;
+#endif /* JEMU_PROFILE_ENABLED */
+}
@@ -0,0 +1,74 @@
+/**
+ * \file j65c02_profile_interrupt_return.c
+ *
+ * \brief Stop timing the interrupt handlers returned from by an RTI.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Stop timing the interrupt handlers returned from by an RTI on a
+ * profiled instance.
+ *
+ * \note This does nothing unless the instance is profiled.
+ *
+ * \param inst              The instance for this operation.
+ * \param cycles            The cycles taken by the RTI, which are counted in
+ *                          the handler.
+ */
+void JEMU_SYM(j65c02_profile_interrupt_return)(
+    JEMU_SYM(j65c02)* inst, int cycles)
+{
+#if JEMU_PROFILE_ENABLED
+    JEMU_SYM(j65c02_profile)* profile = inst->profile;
+    JEMU_SYM(j65c02_profile_interrupts)* interrupts;
+    JEMU_SYM(j65c02_profile_handler)* handler;
+    uint64_t now, duration;
+    int bucket;
+
+    if (NULL == profile)
+    {
+        return;
+    }
+
+    /* an RTI that ends a BRK leaves the stack above the handlers it is
+     * nested in, so only handlers whose stack has been unwound are done. */
+    now = inst->cycle_count + cycles;
+    while (profile->handler_depth > 0
+        && JEMU_SYM(j65c02_profile_unwound)(
+            profile->handlers[profile->handler_depth - 1].sp, inst->reg_sp))
+    {
+        handler = profile->handlers + --profile->handler_depth;
+        interrupts = profile->interrupts + handler->source;
+        duration = now - handler->entered;
+
+        if (0 == interrupts->handled || duration < interrupts->min_cycles)
+        {
+            interrupts->min_cycles = duration;
+        }
+
+        if (duration > interrupts->max_cycles)
+        {
+            interrupts->max_cycles = duration;
+        }
+
+        for (bucket = 0; duration > 0; ++bucket)
+        {
+            duration >>= 1;
+        }
+
+        ++interrupts->handled;
+        interrupts->total_cycles += now - handler->entered;
+        ++interrupts->buckets[bucket];
+        interrupts->last_returned = now;
+    }
+#else
+    (void)inst;
+    (void)cycles;
+#endif /* JEMU_PROFILE_ENABLED */
+}
@@ -0,0 +1,56 @@
+/**
+ * \file j65c02_profile_interrupts_get.c
+ *
+ * \brief Get the interrupt counters of a profiled instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+
+/**
+ * \brief Get the interrupt counters of a profiled instance for a source.
+ *
+ * \param inst              The instance to query.
+ * \param source            The JEMU_PROFILE_INTERRUPT_* source to query.
+ * \param interrupts        Set to the counters of this source.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ *      - JEMU_ERROR_PROFILE_BAD_SOURCE if this source is not valid.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_interrupts_get)(
+    const JEMU_SYM(j65c02)* inst, int source,
+    JEMU_SYM(j65c02_profile_interrupts)* interrupts)
+{
+#if JEMU_PROFILE_ENABLED
+    if (NULL == inst->profile)
+    {
+        return JEMU_ERROR_PROFILE_DISABLED;
+    }
+
+    if (source < 0 || source >= JEMU_PROFILE_INTERRUPT_SOURCES)
+    {
+        return JEMU_ERROR_PROFILE_BAD_SOURCE;
+    }
+
+    memcpy(
+        interrupts, inst->profile->interrupts + source, sizeof(*interrupts));
+
+    return STATUS_SUCCESS;
+#else
+    (void)inst;
+    (void)source;
+    (void)interrupts;
+
+    return JEMU_ERROR_PROFILE_DISABLED;
+#endif /* JEMU_PROFILE_ENABLED */
+}
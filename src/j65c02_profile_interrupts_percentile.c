@@ -0,0 +1,68 @@
+/**
+ * \file j65c02_profile_interrupts_percentile.c
+ *
+ * \brief Estimate a percentile of interrupt handler durations.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+
+/**
+ * \brief Estimate a percentile of the handler durations of an interrupt
+ * source.
+ *
+ * \note The estimate is the top of the histogram bucket holding this
+ * percentile, limited to the longest duration seen, so it is never less than
+ * the true value and at most twice it.
+ *
+ * \param interrupts        The counters to query.
+ * \param percent           The percentile to estimate, from 0 to 100.
+ *
+ * \returns the estimated duration in cycles, or 0 if no handler was timed.
+ */
+uint64_t JEMU_SYM(j65c02_profile_interrupts_percentile)(
+    const JEMU_SYM(j65c02_profile_interrupts)* interrupts, unsigned percent)
+{
+    uint64_t rank, seen = 0, top;
+
+    if (0 == interrupts->handled)
+    {
+        return 0;
+    }
+
+    /* find the rank of this percentile, counting from 1. */
+    if (percent > 100)
+    {
+        percent = 100;
+    }
+
+    rank = (interrupts->handled * percent + 99) / 100;
+    if (0 == rank)
+    {
+        return interrupts->min_cycles;
+    }
+
+    for (int bucket = 0; bucket < JEMU_PROFILE_INTERRUPT_BUCKETS; ++bucket)
+    {
+        seen += interrupts->buckets[bucket];
+        if (seen >= rank)
+        {
+            top =
+                bucket >= 64 ? UINT64_MAX : ((uint64_t)1 << bucket) - 1;
+
+            if (top < interrupts->min_cycles)
+            {
+                return interrupts->min_cycles;
+            }
+
+            return top < interrupts->max_cycles ? top : interrupts->max_cycles;
+        }
+    }
+
+    return interrupts->max_cycles;
+}
@@ -0,0 +1,50 @@
+/**
+ * \file j65c02_profile_opcode_get.c
+ *
+ * \brief Get the counters of an opcode.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+
+/**
+ * \brief Get the counters of an opcode.
+ *
+ * \param inst              The instance to query.
+ * \param opcode            The opcode to query.
+ * \param instructions      Set to the number of times it executed.
+ * \param cycles            Set to the number of cycles it spent.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_opcode_get)(
+    const JEMU_SYM(j65c02)* inst, uint8_t opcode, uint64_t* instructions,
+    uint64_t* cycles)
+{
+#if JEMU_PROFILE_ENABLED
+    if (NULL == inst->profile)
+    {
+        return JEMU_ERROR_PROFILE_DISABLED;
+    }
+
+    *instructions = inst->profile->opcode_instructions[opcode];
+    *cycles = inst->profile->opcode_cycles[opcode];
+
+    return STATUS_SUCCESS;
+#else
+    (void)inst;
+    (void)opcode;
+    (void)instructions;
+    (void)cycles;
+
+    return JEMU_ERROR_PROFILE_DISABLED;
+#endif /* JEMU_PROFILE_ENABLED */
+}
@@ -0,0 +1,92 @@
+/**
+ * \file j65c02_profile_paths_get.c
+ *
+ * \brief Copy the call paths of a profile.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+
+/**
+ * \brief Copy the call paths of a profile.
+ *
+ * \note The root is path 0, and each path follows the path of its caller, so
+ * the first paths copied always form a whole tree. Each instruction is counted
+ * in the routine it runs in, so the cycles of a JSR are counted in the caller,
+ * and those of an RTS or RTI in the routine it returns from.
+ *
+ * \param inst              The instance to query.
+ * \param paths             The array to which paths are copied.
+ * \param max               The size of this array, in paths.
+ * \param count             Set to the number of paths copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_paths_get)(
+    const JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_profile_path)* paths,
+    size_t max, size_t* count)
+{
+#if JEMU_PROFILE_ENABLED
+    const JEMU_SYM(j65c02_profile)* profile = inst->profile;
+    uint64_t* inclusive;
+
+    *count = 0;
+
+    if (NULL == profile)
+    {
+        return JEMU_ERROR_PROFILE_DISABLED;
+    }
+
+    inclusive = malloc(profile->node_count * sizeof(*inclusive));
+    if (NULL == inclusive)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* children follow their parents, so a backwards pass sums each subtree
+     * before it is added to its parent. */
+    for (size_t i = 0; i < profile->node_count; ++i)
+    {
+        inclusive[i] = profile->nodes[i].cycles;
+    }
+
+    for (size_t i = profile->node_count - 1; i > 0; --i)
+    {
+        inclusive[profile->nodes[i].parent] += inclusive[i];
+    }
+
+    *count = profile->node_count < max ? profile->node_count : max;
+    for (size_t i = 0; i < *count; ++i)
+    {
+        paths[i].parent = profile->nodes[i].parent;
+        paths[i].kind = profile->nodes[i].kind;
+        paths[i].addr = profile->nodes[i].addr;
+        paths[i].calls = profile->nodes[i].calls;
+        paths[i].inclusive_cycles = inclusive[i];
+        paths[i].exclusive_cycles = profile->nodes[i].cycles;
+    }
+
+    free(inclusive);
+
+    return STATUS_SUCCESS;
+#else
+    (void)inst;
+    (void)paths;
+    (void)max;
+
+    *count = 0;
+
+    return JEMU_ERROR_PROFILE_DISABLED;
+#endif /* JEMU_PROFILE_ENABLED */
+}
@@ -0,0 +1,130 @@
+/**
+ * \file j65c02_profile_report.c
+ *
+ * \brief Copy a sorted report of a profile.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+
+#if JEMU_PROFILE_ENABLED
+static int entry_compare(const void* vlhs, const void* vrhs);
+#endif /* JEMU_PROFILE_ENABLED */
+
+/**
+ * \brief Copy the busiest program counters or opcodes of a profile, most
+ * cycles first.
+ *
+ * \note Only entries that executed at least once are reported. Entries with
+ * the same cycle count are ordered by key.
+ *
+ * \param inst              The instance to query.
+ * \param kind              JEMU_PROFILE_REPORT_PC or
+ *                          JEMU_PROFILE_REPORT_OPCODE.
+ * \param entries           The array to which entries are copied.
+ * \param max               The size of this array, in entries.
+ * \param count             Set to the number of entries copied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_report)(
+    const JEMU_SYM(j65c02)* inst, int kind,
+    JEMU_SYM(j65c02_profile_entry)* entries, size_t max, size_t* count)
+{
+#if JEMU_PROFILE_ENABLED
+    const JEMU_SYM(j65c02_profile)* profile = inst->profile;
+    const uint64_t* instructions;
+    const uint64_t* cycles;
+    j65c02_profile_entry* sorted;
+    size_t keys, used = 0;
+
+    *count = 0;
+
+    if (NULL == profile)
+    {
+        return JEMU_ERROR_PROFILE_DISABLED;
+    }
+
+    if (JEMU_PROFILE_REPORT_OPCODE == kind)
+    {
+        instructions = profile->opcode_instructions;
+        cycles = profile->opcode_cycles;
+        keys = 256;
+    }
+    else
+    {
+        instructions = profile->pc_instructions;
+        cycles = profile->pc_cycles;
+        keys = 65536;
+    }
+
+    sorted = malloc(keys * sizeof(*sorted));
+    if (NULL == sorted)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* gather the keys that executed. */
+    for (size_t key = 0; key < keys; ++key)
+    {
+        if (instructions[key] > 0)
+        {
+            sorted[used].key = (uint16_t)key;
+            sorted[used].instructions = instructions[key];
+            sorted[used].cycles = cycles[key];
+            ++used;
+        }
+    }
+
+    qsort(sorted, used, sizeof(*sorted), &entry_compare);
+
+    /* copy out as many as fit. */
+    *count = used < max ? used : max;
+    if (*count > 0)
+    {
+        memcpy(entries, sorted, *count * sizeof(*sorted));
+    }
+    free(sorted);
+
+    return STATUS_SUCCESS;
+#else
+    (void)inst;
+    (void)kind;
+    (void)entries;
+    (void)max;
+
+    *count = 0;
+
+    return JEMU_ERROR_PROFILE_DISABLED;
+#endif /* JEMU_PROFILE_ENABLED */
+}
+
+#if JEMU_PROFILE_ENABLED
+/**
+ * \brief Order report entries by descending cycles, then by key.
+ */
+static int entry_compare(const void* vlhs, const void* vrhs)
+{
+    const j65c02_profile_entry* lhs = (const j65c02_profile_entry*)vlhs;
+    const j65c02_profile_entry* rhs = (const j65c02_profile_entry*)vrhs;
+
+    if (lhs->cycles != rhs->cycles)
+    {
+        return lhs->cycles < rhs->cycles ? 1 : -1;
+    }
+
+    return (int)lhs->key - (int)rhs->key;
+}
+#endif /* JEMU_PROFILE_ENABLED */
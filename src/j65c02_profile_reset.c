@@ -0,0 +1,58 @@
+/**
+ * \file j65c02_profile_reset.c
+ *
+ * \brief Clear the counters of a profiled instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+
+/**
+ * \brief Clear the counters of a profiled instance.
+ *
+ * \param inst              The instance for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_PROFILE_DISABLED if the instance is not being profiled.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_profile_reset)(JEMU_SYM(j65c02)* inst)
+{
+#if JEMU_PROFILE_ENABLED
+    JEMU_SYM(j65c02_profile)* profile = inst->profile;
+
+    if (NULL == profile)
+    {
+        return JEMU_ERROR_PROFILE_DISABLED;
+    }
+
+    memset(profile->pc_instructions, 0, sizeof(profile->pc_instructions));
+    memset(profile->pc_cycles, 0, sizeof(profile->pc_cycles));
+    memset(
+        profile->opcode_instructions, 0,
+        sizeof(profile->opcode_instructions));
+    memset(profile->opcode_cycles, 0, sizeof(profile->opcode_cycles));
+    memset(profile->interrupts, 0, sizeof(profile->interrupts));
+
+    /* keep the call paths, so the shadow call stack stays valid. */
+    for (size_t i = 0; i < profile->node_count; ++i)
+    {
+        profile->nodes[i].calls = 0;
+        profile->nodes[i].cycles = 0;
+    }
+
+    return STATUS_SUCCESS;
+#else
+    (void)inst;
+
+    return JEMU_ERROR_PROFILE_DISABLED;
+#endif /* JEMU_PROFILE_ENABLED */
+}
@@ -0,0 +1,46 @@
+/**
+ * \file j65c02_profile_return.c
+ *
+ * \brief Pop returned calls off of the shadow call stack of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Pop the calls returned from by an RTS or RTI off of the shadow call
+ * stack of a profiled instance.
+ *
+ * \note A call has returned once the stack pointer is back where it was
+ * before the call, so an RTS that only jumps through an address pushed by hand
+ * pops nothing. This does nothing unless the instance is profiled.
+ *
+ * \param inst              The instance for this operation.
+ */
+void JEMU_SYM(j65c02_profile_return)(JEMU_SYM(j65c02)* inst)
+{
+#if JEMU_PROFILE_ENABLED
+    JEMU_SYM(j65c02_profile)* profile = inst->profile;
+
+    if (NULL == profile)
+    {
+        return;
+    }
+
+    /* pop every call whose stack has been unwound, including any that were
+     * left by a routine that dropped its own return address. */
+    while (profile->depth > 0
+        && JEMU_SYM(j65c02_profile_unwound)(
+            profile->frames[profile->depth - 1].sp, inst->reg_sp))
+    {
+        --profile->depth;
+        profile->node = profile->frames[profile->depth].node;
+    }
+#else
+    (void)inst;
+#endif /* JEMU_PROFILE_ENABLED */
+}
@@ -0,0 +1,63 @@
+/**
+ * \file j65c02_recorder_append.c
+ *
+ * \brief Append bytes to a recorder stream.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Append bytes to a recorder stream.
+ *
+ * \param recorder          The recorder for this operation.
+ * \param bytes             The bytes to append.
+ * \param size              The number of bytes to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_append)(
+    JEMU_SYM(j65c02_recorder)* recorder, const uint8_t* bytes, size_t size)
+{
+    /* grow the stream by doubling. */
+    if (size > recorder->capacity - recorder->size)
+    {
+        size_t capacity = recorder->capacity ? recorder->capacity : 4096;
+        uint8_t* data;
+
+        while (size > capacity - recorder->size)
+        {
+            if (capacity > SIZE_MAX / 2)
+            {
+                return JEMU_ERROR_OUT_OF_MEMORY;
+            }
+
+            capacity *= 2;
+        }
+
+        data = realloc(recorder->data, capacity);
+        if (NULL == data)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        recorder->data = data;
+        recorder->capacity = capacity;
+    }
+
+    memcpy(recorder->data + recorder->size, bytes, size);
+    recorder->size += size;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,100 @@
+/**
+ * \file j65c02_recorder_bus.c
+ *
+ * \brief Bus callbacks installed by a recorder.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Record a failing callback status.
+ *
+ * \param recorder          The recorder for this operation.
+ * \param tag               The fault tag.
+ * \param fault             The status returned by the callback.
+ *
+ * \returns the fault, or a recording error.
+ */
+static JEMU_SYM(status) record_fault(
+    JEMU_SYM(j65c02_recorder)* recorder, uint8_t tag, JEMU_SYM(status) fault)
+{
+    status retval;
+    uint32_t code = (uint32_t)fault;
+    uint8_t record[5] = {
+        tag, (uint8_t)code, (uint8_t)(code >> 8), (uint8_t)(code >> 16),
+        (uint8_t)(code >> 24) };
+
+    retval = JEMU_SYM(j65c02_recorder_flush)(recorder);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = JEMU_SYM(j65c02_recorder_append)(recorder, record, sizeof(record));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return fault;
+}
+
+/**
+ * \brief The read callback installed by a recorder.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_recorder_read)(
+    void* context, uint16_t addr, uint8_t* val)
+{
+    j65c02_recorder* recorder = (j65c02_recorder*)context;
+    status retval;
+
+    retval = recorder->read(recorder->context, addr, val);
+
+    /* RAM reads replay themselves. */
+    if (NULL != j65c02_memory_region_find(recorder->inst, addr))
+    {
+        return retval;
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return record_fault(recorder, JEMU_REPLAY_TAG_READ_FAULT, retval);
+    }
+
+    /* queue the result, writing a record when the queue is full. */
+    recorder->pending[recorder->pending_count++] = *val;
+    if (JEMU_REPLAY_MAX_READS == recorder->pending_count)
+    {
+        return JEMU_SYM(j65c02_recorder_flush)(recorder);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief The write callback installed by a recorder.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_recorder_write)(
+    void* context, uint16_t addr, uint8_t val)
+{
+    j65c02_recorder* recorder = (j65c02_recorder*)context;
+    status retval;
+
+    retval = recorder->write(recorder->context, addr, val);
+
+    /* only failing device writes are recorded. */
+    if (STATUS_SUCCESS != retval
+     && NULL == j65c02_memory_region_find(recorder->inst, addr))
+    {
+        return record_fault(recorder, JEMU_REPLAY_TAG_WRITE_FAULT, retval);
+    }
+
+    return retval;
+}
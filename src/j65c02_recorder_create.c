@@ -0,0 +1,88 @@
+/**
+ * \file j65c02_recorder_create.c
+ *
+ * \brief Start recording the bus input of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Start recording the bus input of an instance.
+ *
+ * \note On success, the caller is given ownership of the recorder and must
+ * release it by calling \ref j65c02_recorder_release when it is no longer
+ * needed. While the recorder exists, the instance is run as usual, but
+ * interrupts, NMIs, and resets must be delivered through the recorder. Every
+ * RAM region must be registered with \ref j65c02_memory_region_add before this
+ * call; reads from any other address are recorded. On an instance with a DMA
+ * controller, the recorder sits beneath the controller, so that the device
+ * reads of its transfers are recorded and its registers are not.
+ *
+ * \param recorder          Pointer to the recorder pointer to set to the
+ *                          created recorder on success.
+ * \param inst              The instance to record.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_create)(
+    JEMU_SYM(j65c02_recorder)** recorder, JEMU_SYM(j65c02)* inst)
+{
+    status retval, release_retval;
+    j65c02_recorder* tmp;
+    j65c02_bus bus = j65c02_input_bus(inst);
+    const uint8_t header[JEMU_REPLAY_HEADER_SIZE] = {
+        'J', '6', '5', 'R', JEMU_REPLAY_VERSION };
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->inst = inst;
+    tmp->last_event = inst->cycle_count;
+
+    /* write the stream header. */
+    retval =
+        JEMU_SYM(j65c02_recorder_append)(tmp, header, sizeof(header));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* interpose on the bus, beneath any DMA controller. */
+    tmp->read = *bus.read;
+    tmp->write = *bus.write;
+    tmp->context = *bus.context;
+    *bus.read = &JEMU_SYM(j65c02_recorder_read);
+    *bus.write = &JEMU_SYM(j65c02_recorder_write);
+    *bus.context = tmp;
+
+    /* success. */
+    *recorder = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_tmp:
+    release_retval = j65c02_recorder_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,46 @@
+/**
+ * \file j65c02_recorder_data_get.c
+ *
+ * \brief Get the stream recorded so far.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Get the stream recorded so far.
+ *
+ * \note The stream remains owned by the recorder. It is valid until the next
+ * call on the instance or the recorder, and recording may continue after this
+ * call.
+ *
+ * \param recorder          The recorder to query.
+ * \param data              Pointer to be set to the recorded stream.
+ * \param size              Pointer to be set to the size of the stream.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_data_get)(
+    JEMU_SYM(j65c02_recorder)* recorder, const uint8_t** data, size_t* size)
+{
+    status retval;
+
+    /* write out any pending reads. */
+    retval = JEMU_SYM(j65c02_recorder_flush)(recorder);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *data = recorder->data;
+    *size = recorder->size;
+
+    return STATUS_SUCCESS;
+}
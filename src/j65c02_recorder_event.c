@@ -0,0 +1,59 @@
+/**
+ * \file j65c02_recorder_event.c
+ *
+ * \brief Append an event record to a recorder stream.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Append an event record to a recorder stream.
+ *
+ * \param recorder          The recorder for this operation.
+ * \param tag               The event tag.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_event)(
+    JEMU_SYM(j65c02_recorder)* recorder, uint8_t tag)
+{
+    status retval;
+    uint8_t record[11];
+    size_t size = 0;
+    uint64_t delta = recorder->inst->cycle_count - recorder->last_event;
+
+    /* reads before this event come first. */
+    retval = JEMU_SYM(j65c02_recorder_flush)(recorder);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* encode the tag and the cycle delta. */
+    record[size++] = tag;
+    do
+    {
+        uint8_t byte = delta & 0x7F;
+
+        delta >>= 7;
+        record[size++] = delta ? (byte | 0x80) : byte;
+    } while (delta);
+
+    retval = JEMU_SYM(j65c02_recorder_append)(recorder, record, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    recorder->last_event = recorder->inst->cycle_count;
+
+    return STATUS_SUCCESS;
+}
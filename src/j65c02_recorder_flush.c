@@ -0,0 +1,55 @@
+/**
+ * \file j65c02_recorder_flush.c
+ *
+ * \brief Write any pending read results to a recorder stream.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Write any pending read results to a recorder stream.
+ *
+ * \param recorder          The recorder for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_flush)(JEMU_SYM(j65c02_recorder)* recorder)
+{
+    status retval;
+    uint8_t header[2];
+
+    if (0 == recorder->pending_count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    header[0] = JEMU_REPLAY_TAG_READS;
+    header[1] = (uint8_t)recorder->pending_count;
+
+    retval =
+        JEMU_SYM(j65c02_recorder_append)(recorder, header, sizeof(header));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        JEMU_SYM(j65c02_recorder_append)(
+            recorder, recorder->pending, recorder->pending_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    recorder->pending_count = 0;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file j65c02_recorder_interrupt.c
+ *
+ * \brief Record an interrupt.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Deliver an interrupt to the recorded instance, and record it.
+ *
+ * \param recorder          The recorder for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_interrupt)(JEMU_SYM(j65c02_recorder)* recorder)
+{
+    status retval;
+
+    retval = JEMU_SYM(j65c02_recorder_event)(recorder, JEMU_REPLAY_TAG_IRQ);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return j65c02_interrupt(recorder->inst);
+}
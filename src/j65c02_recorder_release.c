@@ -0,0 +1,50 @@
+/**
+ * \file j65c02_recorder_release.c
+ *
+ * \brief Stop recording and release a recorder.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_replay_internal.h"
+
+/**
+ * \brief Stop recording and release a recorder.
+ *
+ * \note The original callbacks of the instance are restored. After this call,
+ * the recorder pointer and its stream are no longer valid.
+ *
+ * \param recorder          The recorder to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_release)(JEMU_SYM(j65c02_recorder)* recorder)
+{
+    /* restore the original callbacks. */
+    if (NULL != recorder->read)
+    {
+        JEMU_SYM(j65c02_bus) bus = JEMU_SYM(j65c02_input_bus)(recorder->inst);
+
+        *bus.read = recorder->read;
+        *bus.write = recorder->write;
+        *bus.context = recorder->context;
+    }
+
+    /* free the stream. */
+    free(recorder->data);
+
+    /* clear the recorder memory. */
+    memset(recorder, 0, sizeof(*recorder));
+
+    /* free memory. */
+    free(recorder);
+
+    return STATUS_SUCCESS;
+}
@@ -18,4 +18,5 @@
 void JEMU_SYM(j65c02_reg_pc_set)(JEMU_SYM(j65c02)* inst, uint16_t val)
 {
     inst->reg_pc = val;
+    inst->opcode_pending = false;
 }
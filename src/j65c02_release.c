@@ -3,7 +3,7 @@
  *
  * \brief Release an emulator instance.
  *
- * \copyright 2022 Justin Handville.  Please see LICENSE.txt in this
+ * \copyright 2022-2026 Justin Handville.  Please see LICENSE.txt in this
  * distribution for the license terms under which this software is distributed.
  */
 
@@ -12,10 +12,14 @@
 
 #include "jemu65c02_internal.h"
 
+JEMU_IMPORT_jemu65c02_pool;
+
 /**
  * \brief Release an emulator instance.
  *
- * \note After this call, the instance pointer is no longer valid.
+ * \note After this call, the instance pointer is no longer valid. Heap
+ * instances are freed, pool instances are returned to their pool, and
+ * instances initialized in caller-provided storage are cleared.
  *
  * \param inst              The instance to release.
  *
@@ -26,12 +30,30 @@
 JEMU_SYM(status) FN_DECL_MUST_CHECK
 JEMU_SYM(j65c02_release)(JEMU_SYM(j65c02)* inst)
 {
+    int storage = inst->storage;
+    j65c02_pool* pool = inst->pool;
+
+    /* free what this instance owns. */
+    JEMU_SYM(j65c02_release_owned)(inst);
+
     /* clear the emulator memory. */
     memset(inst, 0, sizeof(*inst));
 
-    /* free memory. */
-    free(inst);
+    /* return the storage to its owner. */
+    switch (storage)
+    {
+        case JEMU_J65C02_STORAGE_POOL:
+            /* a slot stays tagged, so releasing it again fails in its pool. */
+            inst->storage = JEMU_J65C02_STORAGE_POOL;
+            inst->pool = pool;
+            return JEMU_SYM(j65c02_pool_slot_free)(pool, inst);
+
+        case JEMU_J65C02_STORAGE_PLACEMENT:
+            /* the caller owns this storage. */
+            return STATUS_SUCCESS;
 
-    /* success. */
-    return STATUS_SUCCESS;
+        default:
+            free(inst);
+            return STATUS_SUCCESS;
+    }
 }
@@ -0,0 +1,56 @@
+/**
+ * \file j65c02_release_owned.c
+ *
+ * \brief Free what an emulator instance owns.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Free the allocations owned by an instance, leaving its storage.
+ *
+ * \note This is shared by \ref j65c02_release and by the pool, which frees
+ * the instances still in its slots when it is reset or released.
+ *
+ * \param inst              The instance whose allocations are freed.
+ */
+void JEMU_SYM(j65c02_release_owned)(JEMU_SYM(j65c02)* inst)
+{
+    /* free the flight recorder ring. */
+    free(inst->flight);
+
+    /* free the instrumented instruction table. */
+    free(inst->hooked);
+
+    /* free the native routines. */
+    if (NULL != inst->hle)
+    {
+        JEMU_SYM(j65c02_hle_release)(inst->hle);
+    }
+
+    /* free the shadow memory of the sanitizer. */
+    free(inst->sanitizer);
+
+    /* free the custom opcodes. */
+    free(inst->custom);
+
+    /* free the breakpoints. */
+    if (NULL != inst->debug)
+    {
+        JEMU_SYM(j65c02_debug_release)(inst->debug);
+    }
+
+#if JEMU_PROFILE_ENABLED
+    /* free the profile. */
+    if (NULL != inst->profile)
+    {
+        free(inst->profile->nodes);
+        free(inst->profile);
+    }
+#endif /* JEMU_PROFILE_ENABLED */
+}
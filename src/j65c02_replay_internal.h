@@ -0,0 +1,226 @@
+/**
+ * \file j65c02_replay_internal.h
+ *
+ * \brief Internal header for record and replay.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/replay.h>
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The stream header: a four byte magic value, then a version byte.
+ */
+#define JEMU_REPLAY_MAGIC                                           "J65R"
+#define JEMU_REPLAY_MAGIC_SIZE                                      4
+#define JEMU_REPLAY_VERSION                                         1
+#define JEMU_REPLAY_HEADER_SIZE                                     5
+
+/**
+ * \brief Stream records.
+ *
+ * Each record starts with a tag byte.
+ *      - READS is followed by a one byte count, then that many read results.
+ *      - READ_FAULT and WRITE_FAULT are followed by the four byte little
+ *        endian status returned by the callback.
+ *      - IRQ, NMI, and RESET are followed by the number of cycles since the
+ *        previous event, or since recording started, as an unsigned LEB128
+ *        value.
+ */
+#define JEMU_REPLAY_TAG_READS                                       0x01
+#define JEMU_REPLAY_TAG_READ_FAULT                                  0x02
+#define JEMU_REPLAY_TAG_WRITE_FAULT                                 0x03
+#define JEMU_REPLAY_TAG_IRQ                                         0x04
+#define JEMU_REPLAY_TAG_NMI                                         0x05
+#define JEMU_REPLAY_TAG_RESET                                       0x06
+
+/**
+ * \brief The maximum number of read results in one READS record.
+ */
+#define JEMU_REPLAY_MAX_READS                                       255
+
+/**
+ * \brief A bus recorder.
+ */
+struct JEMU_SYM(j65c02_recorder)
+{
+    JEMU_SYM(j65c02)* inst;
+
+    /* the callbacks of the recorded instance. */
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* context;
+
+    /* the recorded stream. */
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+
+    /* read results not yet written to a READS record. */
+    uint8_t pending[JEMU_REPLAY_MAX_READS];
+    size_t pending_count;
+
+    /* the cycle count of the last event. */
+    uint64_t last_event;
+};
+
+/**
+ * \brief A bus replayer.
+ */
+struct JEMU_SYM(j65c02_replayer)
+{
+    JEMU_SYM(j65c02)* inst;
+
+    /* the callbacks of the replayed instance. */
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* context;
+
+    /* the stream, the next unread byte, and the reads left in this record. */
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    size_t reads_left;
+
+    /* the next event after the read position, if any. */
+    bool has_event;
+    uint8_t event_tag;
+    size_t event_pos;
+    size_t event_end;
+    uint64_t event_cycle;
+    uint64_t last_event;
+
+    /* the cycle count at which the current run ends. */
+    uint64_t target;
+};
+
+/**
+ * \brief Append an event record to a recorder stream.
+ *
+ * \param recorder          The recorder for this operation.
+ * \param tag               The event tag.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_event)(
+    JEMU_SYM(j65c02_recorder)* recorder, uint8_t tag);
+
+/**
+ * \brief Write any pending read results to a recorder stream.
+ *
+ * \param recorder          The recorder for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_flush)(JEMU_SYM(j65c02_recorder)* recorder);
+
+/**
+ * \brief Append bytes to a recorder stream.
+ *
+ * \param recorder          The recorder for this operation.
+ * \param bytes             The bytes to append.
+ * \param size              The number of bytes to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_recorder_append)(
+    JEMU_SYM(j65c02_recorder)* recorder, const uint8_t* bytes, size_t size);
+
+/**
+ * \brief The read callback installed by a recorder.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_recorder_read)(
+    void* context, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief The write callback installed by a recorder.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_recorder_write)(
+    void* context, uint16_t addr, uint8_t val);
+
+/**
+ * \brief Start a replayer at a record boundary of a verified stream, and
+ * interpose it on the bus of an instance.
+ *
+ * \param replayer          The replayer to initialize.
+ * \param inst              The instance on which the stream is replayed.
+ * \param data              The recorded stream.
+ * \param size              The size of the recorded stream.
+ * \param pos               The position of the first record to replay.
+ * \param last_event        The cycle count of the last event before this
+ *                          record.
+ */
+void JEMU_SYM(j65c02_replayer_init)(
+    JEMU_SYM(j65c02_replayer)* replayer, JEMU_SYM(j65c02)* inst,
+    const uint8_t* data, size_t size, size_t pos, uint64_t last_event);
+
+/**
+ * \brief Deliver every recorded event that is due at the current cycle count.
+ *
+ * \param replayer          The replayer for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_DIVERGED if the instance no longer follows the
+ *        recording.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_replayer_events_deliver)(JEMU_SYM(j65c02_replayer)* replayer);
+
+/**
+ * \brief Find the next event record after the read position of a replayer.
+ *
+ * \param replayer          The replayer for this operation.
+ */
+void JEMU_SYM(j65c02_replayer_lookahead)(JEMU_SYM(j65c02_replayer)* replayer);
+
+/**
+ * \brief The read callback installed by a replayer.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_replayer_read)(
+    void* context, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief The write callback installed by a replayer.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_replayer_write)(
+    void* context, uint16_t addr, uint8_t val);
+
+/**
+ * \brief Decode an unsigned LEB128 value from a stream.
+ *
+ * \param data              The stream.
+ * \param size              The size of the stream.
+ * \param pos               The position of the value; on success, this is
+ *                          set to the position just past it.
+ * \param val               Pointer to be set to the value on success.
+ *
+ * \returns true on success, or false if the value is truncated or too large.
+ */
+bool JEMU_SYM(j65c02_replay_varint_decode)(
+    const uint8_t* data, size_t size, size_t* pos, uint64_t* val);
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,48 @@
+/**
+ * \file j65c02_replay_varint_decode.c
+ *
+ * \brief Decode an unsigned LEB128 value from a replay stream.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+/**
+ * \brief Decode an unsigned LEB128 value from a stream.
+ *
+ * \param data              The stream.
+ * \param size              The size of the stream.
+ * \param pos               The position of the value; on success, this is
+ *                          set to the position just past it.
+ * \param val               Pointer to be set to the value on success.
+ *
+ * \returns true on success, or false if the value is truncated or too large.
+ */
+bool JEMU_SYM(j65c02_replay_varint_decode)(
+    const uint8_t* data, size_t size, size_t* pos, uint64_t* val)
+{
+    uint64_t result = 0;
+    size_t p = *pos;
+
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        if (p >= size)
+        {
+            return false;
+        }
+
+        uint8_t byte = data[p++];
+        result |= (uint64_t)(byte & 0x7F) << shift;
+
+        if (!(byte & 0x80))
+        {
+            *pos = p;
+            *val = result;
+            return true;
+        }
+    }
+
+    return false;
+}
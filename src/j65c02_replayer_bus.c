@@ -0,0 +1,106 @@
+/**
+ * \file j65c02_replayer_bus.c
+ *
+ * \brief Bus callbacks installed by a replayer.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Decode the status of a fault record.
+ *
+ * \param replayer          The replayer for this operation.
+ *
+ * \returns the recorded status.
+ */
+static JEMU_SYM(status) fault_consume(JEMU_SYM(j65c02_replayer)* replayer)
+{
+    const uint8_t* record = replayer->data + replayer->pos;
+
+    replayer->pos += 5;
+
+    return
+        (uint32_t)record[1] | ((uint32_t)record[2] << 8)
+      | ((uint32_t)record[3] << 16) | ((uint32_t)record[4] << 24);
+}
+
+/**
+ * \brief The read callback installed by a replayer.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_replayer_read)(
+    void* context, uint16_t addr, uint8_t* val)
+{
+    j65c02_replayer* replayer = (j65c02_replayer*)context;
+    j65c02_memory_region* region;
+
+    /* RAM is read directly. */
+    region = j65c02_memory_region_find(replayer->inst, addr);
+    if (NULL != region)
+    {
+        *val = region->mem[addr - region->base];
+        return STATUS_SUCCESS;
+    }
+
+    /* move to the next record of read results. */
+    while (0 == replayer->reads_left)
+    {
+        if (replayer->pos >= replayer->size)
+        {
+            return JEMU_ERROR_REPLAY_EXHAUSTED;
+        }
+
+        switch (replayer->data[replayer->pos])
+        {
+            case JEMU_REPLAY_TAG_READS:
+                replayer->reads_left = replayer->data[replayer->pos + 1];
+                replayer->pos += 2;
+                break;
+
+            case JEMU_REPLAY_TAG_READ_FAULT:
+                return fault_consume(replayer);
+
+            default:
+                return JEMU_ERROR_REPLAY_DIVERGED;
+        }
+    }
+
+    *val = replayer->data[replayer->pos++];
+    --replayer->reads_left;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief The write callback installed by a replayer.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_replayer_write)(
+    void* context, uint16_t addr, uint8_t val)
+{
+    j65c02_replayer* replayer = (j65c02_replayer*)context;
+    j65c02_memory_region* region;
+
+    /* RAM is written directly. */
+    region = j65c02_memory_region_find(replayer->inst, addr);
+    if (NULL != region)
+    {
+        region->mem[addr - region->base] = val;
+        return STATUS_SUCCESS;
+    }
+
+    /* a device write fails here if it failed when it was recorded. */
+    if (0 == replayer->reads_left && replayer->pos < replayer->size
+     && JEMU_REPLAY_TAG_WRITE_FAULT == replayer->data[replayer->pos])
+    {
+        return fault_consume(replayer);
+    }
+
+    /* otherwise, device writes are dropped. */
+    return STATUS_SUCCESS;
+}
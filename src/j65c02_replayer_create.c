@@ -0,0 +1,127 @@
+/**
+ * \file j65c02_replayer_create.c
+ *
+ * \brief Start replaying a recorded stream on an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Verify that a recorded stream is well formed.
+ *
+ * \param data              The recorded stream.
+ * \param size              The size of the recorded stream.
+ *
+ * \returns true if the stream is well formed, or false otherwise.
+ */
+static bool stream_valid(const uint8_t* data, size_t size)
+{
+    size_t pos = JEMU_REPLAY_HEADER_SIZE;
+    uint64_t delta;
+
+    /* verify the header. */
+    if (size < JEMU_REPLAY_HEADER_SIZE
+     || memcmp(data, JEMU_REPLAY_MAGIC, JEMU_REPLAY_MAGIC_SIZE)
+     || JEMU_REPLAY_VERSION != data[JEMU_REPLAY_MAGIC_SIZE])
+    {
+        return false;
+    }
+
+    /* verify each record. */
+    while (pos < size)
+    {
+        switch (data[pos++])
+        {
+            case JEMU_REPLAY_TAG_READS:
+                if (pos >= size || 0 == data[pos]
+                 || data[pos] > size - pos - 1)
+                {
+                    return false;
+                }
+                pos += 1 + data[pos];
+                break;
+
+            case JEMU_REPLAY_TAG_READ_FAULT:
+            case JEMU_REPLAY_TAG_WRITE_FAULT:
+                if (size - pos < 4)
+                {
+                    return false;
+                }
+                pos += 4;
+                break;
+
+            case JEMU_REPLAY_TAG_IRQ:
+            case JEMU_REPLAY_TAG_NMI:
+            case JEMU_REPLAY_TAG_RESET:
+                if (!JEMU_SYM(j65c02_replay_varint_decode)(
+                        data, size, &pos, &delta))
+                {
+                    return false;
+                }
+                break;
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Start replaying a recorded stream on an instance.
+ *
+ * \note On success, the caller is given ownership of the replayer and must
+ * release it by calling \ref j65c02_replayer_release when it is no longer
+ * needed. The instance must be in the state that the recorded instance was in
+ * when recording started, with the same memory regions registered, and the
+ * same DMA controller, if any, which runs the recorded transfers again. The
+ * stream is not copied and must outlive the replayer.
+ *
+ * \param replayer          Pointer to the replayer pointer to set to the
+ *                          created replayer on success.
+ * \param inst              The instance on which the stream is replayed.
+ * \param data              The recorded stream.
+ * \param size              The size of the recorded stream.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_BAD_STREAM if the stream is malformed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_replayer_create)(
+    JEMU_SYM(j65c02_replayer)** replayer, JEMU_SYM(j65c02)* inst,
+    const uint8_t* data, size_t size)
+{
+    j65c02_replayer* tmp;
+
+    /* verify the stream up front, so that replay never reads past it. */
+    if (NULL == data || !stream_valid(data, size))
+    {
+        return JEMU_ERROR_REPLAY_BAD_STREAM;
+    }
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* start at the first record. */
+    JEMU_SYM(j65c02_replayer_init)(
+        tmp, inst, data, size, JEMU_REPLAY_HEADER_SIZE, inst->cycle_count);
+
+    /* success. */
+    *replayer = tmp;
+    return STATUS_SUCCESS;
+}
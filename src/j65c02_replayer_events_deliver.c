@@ -0,0 +1,72 @@
+/**
+ * \file j65c02_replayer_events_deliver.c
+ *
+ * \brief Deliver the recorded events that are due.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Deliver every recorded event that is due at the current cycle count.
+ *
+ * \param replayer          The replayer for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_DIVERGED if the instance no longer follows the
+ *        recording.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_replayer_events_deliver)(JEMU_SYM(j65c02_replayer)* replayer)
+{
+    status retval;
+    j65c02* inst = replayer->inst;
+    uint8_t tag;
+
+    while (replayer->has_event && replayer->event_cycle <= inst->cycle_count)
+    {
+        /* an instruction ran past this event, or a read recorded before it
+         * has not been replayed. */
+        if (replayer->event_cycle < inst->cycle_count
+         || 0 != replayer->reads_left
+         || replayer->pos != replayer->event_pos)
+        {
+            return JEMU_ERROR_REPLAY_DIVERGED;
+        }
+
+        /* move past this event. */
+        tag = replayer->event_tag;
+        replayer->pos = replayer->event_end;
+        replayer->last_event = replayer->event_cycle;
+        JEMU_SYM(j65c02_replayer_lookahead)(replayer);
+
+        switch (tag)
+        {
+            case JEMU_REPLAY_TAG_IRQ:
+                retval = j65c02_interrupt(inst);
+                break;
+
+            case JEMU_REPLAY_TAG_NMI:
+                retval = j65c02_nmi(inst);
+                break;
+
+            default:
+                retval = j65c02_reset(inst);
+                break;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file j65c02_replayer_init.c
+ *
+ * \brief Start a replayer at a record boundary of a verified stream.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_replay_internal.h"
+
+/**
+ * \brief Start a replayer at a record boundary of a verified stream, and
+ * interpose it on the bus of an instance.
+ *
+ * \param replayer          The replayer to initialize.
+ * \param inst              The instance on which the stream is replayed.
+ * \param data              The recorded stream.
+ * \param size              The size of the recorded stream.
+ * \param pos               The position of the first record to replay.
+ * \param last_event        The cycle count of the last event before this
+ *                          record.
+ */
+void JEMU_SYM(j65c02_replayer_init)(
+    JEMU_SYM(j65c02_replayer)* replayer, JEMU_SYM(j65c02)* inst,
+    const uint8_t* data, size_t size, size_t pos, uint64_t last_event)
+{
+    JEMU_SYM(j65c02_bus) bus = JEMU_SYM(j65c02_input_bus)(inst);
+
+    /* clear out the structure. */
+    memset(replayer, 0, sizeof(*replayer));
+    replayer->inst = inst;
+    replayer->data = data;
+    replayer->size = size;
+    replayer->pos = pos;
+    replayer->last_event = last_event;
+    replayer->target = inst->cycle_count;
+
+    /* find the first event. */
+    JEMU_SYM(j65c02_replayer_lookahead)(replayer);
+
+    /* interpose on the bus, beneath any DMA controller, so that the
+     * controller still sees its register writes; the replayer keeps its own
+     * cycle carry. */
+    replayer->read = *bus.read;
+    replayer->write = *bus.write;
+    replayer->context = *bus.context;
+    *bus.read = &JEMU_SYM(j65c02_replayer_read);
+    *bus.write = &JEMU_SYM(j65c02_replayer_write);
+    *bus.context = replayer;
+    inst->cycle_delta = 0;
+}
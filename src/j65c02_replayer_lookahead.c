@@ -0,0 +1,51 @@
+/**
+ * \file j65c02_replayer_lookahead.c
+ *
+ * \brief Find the next event record in a replayed stream.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+
+/**
+ * \brief Find the next event record after the read position of a replayer.
+ *
+ * \param replayer          The replayer for this operation.
+ */
+void JEMU_SYM(j65c02_replayer_lookahead)(JEMU_SYM(j65c02_replayer)* replayer)
+{
+    const uint8_t* data = replayer->data;
+    size_t size = replayer->size;
+    size_t pos = replayer->pos + replayer->reads_left;
+    uint64_t delta;
+
+    replayer->has_event = false;
+
+    /* the stream has been verified, so records can be skipped blindly. */
+    while (pos < size)
+    {
+        switch (data[pos])
+        {
+            case JEMU_REPLAY_TAG_READS:
+                pos += 2 + data[pos + 1];
+                break;
+
+            case JEMU_REPLAY_TAG_READ_FAULT:
+            case JEMU_REPLAY_TAG_WRITE_FAULT:
+                pos += 5;
+                break;
+
+            default:
+                replayer->event_tag = data[pos];
+                replayer->event_pos = pos++;
+                (void)JEMU_SYM(j65c02_replay_varint_decode)(
+                    data, size, &pos, &delta);
+                replayer->event_end = pos;
+                replayer->event_cycle = replayer->last_event + delta;
+                replayer->has_event = true;
+                return;
+        }
+    }
+}
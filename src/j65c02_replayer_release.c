@@ -0,0 +1,44 @@
+/**
+ * \file j65c02_replayer_release.c
+ *
+ * \brief Stop replaying and release a replayer.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_replay_internal.h"
+
+/**
+ * \brief Stop replaying and release a replayer.
+ *
+ * \note The original callbacks of the instance are restored. After this call,
+ * the replayer pointer is no longer valid.
+ *
+ * \param replayer          The replayer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_replayer_release)(JEMU_SYM(j65c02_replayer)* replayer)
+{
+    JEMU_SYM(j65c02_bus) bus = JEMU_SYM(j65c02_input_bus)(replayer->inst);
+
+    /* restore the original callbacks. */
+    *bus.read = replayer->read;
+    *bus.write = replayer->write;
+    *bus.context = replayer->context;
+
+    /* clear the replayer memory. */
+    memset(replayer, 0, sizeof(*replayer));
+
+    /* free memory. */
+    free(replayer);
+
+    return STATUS_SUCCESS;
+}
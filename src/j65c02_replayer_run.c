@@ -0,0 +1,113 @@
+/**
+ * \file j65c02_replayer_run.c
+ *
+ * \brief Run a replayed instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <limits.h>
+
+#include "j65c02_replay_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_replay;
+
+/**
+ * \brief Run the replayed instance for the given number of cycles, delivering
+ * recorded interrupts, NMIs, and resets as their cycle counts are reached.
+ *
+ * \note Cycles left over when a run ends mid-instruction are carried over to
+ * the next call. Time spent waiting for an interrupt that is not in the
+ * recording is dropped.
+ *
+ * \param replayer          The replayer for this operation.
+ * \param cycles            The number of cycles to run.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_EXHAUSTED if the instance needs more input than
+ *        was recorded.
+ *      - JEMU_ERROR_REPLAY_DIVERGED if the instance no longer follows the
+ *        recording.
+ *      - the recorded error, if the recorded run failed at this point.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_replayer_run)(
+    JEMU_SYM(j65c02_replayer)* replayer, int cycles)
+{
+    status retval;
+    j65c02* inst = replayer->inst;
+    uint64_t limit;
+
+    if (cycles > 0)
+    {
+        replayer->target += (uint64_t)cycles;
+    }
+
+    for (;;)
+    {
+        /* deliver every event that is due. */
+        retval = JEMU_SYM(j65c02_replayer_events_deliver)(replayer);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* is this run complete? */
+        if (inst->cycle_count >= replayer->target)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        /* if the processor is in a bad state, return an error. */
+        if (inst->crash)
+        {
+            return JEMU_ERROR_INVALID_PROCESSOR_STATE;
+        }
+
+        /* a stopped or waiting processor is only woken by an event, which is
+         * delivered at the cycle count where it stopped. */
+        if (inst->stopped || inst->wait)
+        {
+            if (replayer->has_event)
+            {
+                return JEMU_ERROR_REPLAY_DIVERGED;
+            }
+
+            replayer->target = inst->cycle_count;
+            return STATUS_SUCCESS;
+        }
+
+        /* run up to the next event or the end of this run. */
+        limit = replayer->target;
+        if (replayer->has_event && replayer->event_cycle < limit)
+        {
+            limit = replayer->event_cycle;
+        }
+
+        retval =
+            j65c02_run(
+                inst,
+                limit - inst->cycle_count > INT_MAX
+                    ? INT_MAX : (int)(limit - inst->cycle_count));
+        inst->cycle_delta = 0;
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* the run stops short of the limit; step the rest of the way. */
+        while (inst->cycle_count < limit
+            && !inst->stopped && !inst->wait && !inst->crash)
+        {
+            retval = j65c02_step(inst);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+}
@@ -28,6 +28,18 @@ JEMU_SYM(j65c02_reset)(JEMU_SYM(j65c02)* inst)
 {
     status retval;
 
+    /* note the reset in the trace. */
+    if (NULL != inst->trace)
+    {
+        j65c02_trace_control(inst->trace, JEMU_TRACE_RECORD_RESET, 0);
+    }
+
+    /* a reset ends every handler and wait on the timeline. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_unwind(inst);
+    }
+
     inst->reg_a = 0;
     inst->reg_x = 0;
     inst->reg_y = 0;
@@ -37,6 +49,16 @@ JEMU_SYM(j65c02_reset)(JEMU_SYM(j65c02)* inst)
     inst->stopped = false;
     inst->wait = false;
 
+#if JEMU_PROFILE_ENABLED
+    /* a reset unwinds the shadow call stack. */
+    if (NULL != inst->profile)
+    {
+        inst->profile->depth = 0;
+        inst->profile->node = 0;
+        inst->profile->handler_depth = 0;
+    }
+#endif /* JEMU_PROFILE_ENABLED */
+
     /* read the low PC counter. */
     uint8_t pc_low;
     retval = inst->read(inst->user_context, 0xFFFC, &pc_low);
@@ -45,8 +67,10 @@ JEMU_SYM(j65c02_reset)(JEMU_SYM(j65c02)* inst)
         goto done;
     }
 
-    /* set the low PC counter. */
+    /* set the low PC counter, dropping an opcode left pending by the last
+     * run. */
     inst->reg_pc = pc_low;
+    inst->opcode_pending = false;
 
     /* read the high PC counter. */
     uint8_t pc_high;
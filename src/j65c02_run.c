@@ -7,11 +7,18 @@
  * distribution for the license terms under which this software is distributed.
  */
 
+#include <stddef.h>
+
 #include "jemu65c02_internal.h"
 
 JEMU_IMPORT_jemu65c02;
 JEMU_IMPORT_jemu65c02_internal;
 
+/* the fields touched by every instruction must share a cache line. */
+_Static_assert(
+    offsetof(struct JEMU_SYM(j65c02), pending_opcode) < JEMU_CACHE_LINE_SIZE,
+    "the hot fields of an instance must fit in its first cache line");
+
 /**
  * \brief Run the emulator instance for the given number of cycles.
  *
@@ -30,11 +37,35 @@ JEMU_SYM(j65c02_run)(JEMU_SYM(j65c02)* inst, int cycles)
     status retval;
     uint8_t ins;
     int ins_cycles = 0;
+    const j65c02_instruction* ins_fn;
+
+    /* begin the run slice on the timeline. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_span(
+            inst->timeline, JEMU_TIMELINE_LANE_HOST, 'B', "run",
+            inst->cycle_count);
+    }
+
+    /* an instance with anything to do between instructions takes the
+     * instrumented loop. */
+    if (j65c02_run_instrumented(inst))
+    {
+        retval = j65c02_run_loop(inst, cycles, NULL, NULL);
+        goto done;
+    }
 
     /* increment cycles with the cycle delta from the last run. */
     cycles += inst->cycle_delta;
     inst->cycle_delta = 0;
 
+    /* execute an opcode fetched by the last run before fetching another. */
+    if (inst->opcode_pending && !inst->crash && !inst->stopped && !inst->wait)
+    {
+        retval = j65c02_opcode_fetch(&ins, inst);
+        goto decode;
+    }
+
     /* loop until cycles are consumed. */
     for (;;)
     {
@@ -60,9 +91,9 @@ JEMU_SYM(j65c02_run)(JEMU_SYM(j65c02)* inst, int cycles)
             goto done;
         }
 
+    decode:
         /* decode the instruction. */
-        const j65c02_instruction* ins_fn =
-            JEMU_SYM(global_j65c02_instructions) + ins;
+        ins_fn = inst->instructions + ins;
 
         /* do we have the budget to run this instruction? */
         if (cycles > ins_fn->max_cycles)
@@ -76,16 +107,27 @@ JEMU_SYM(j65c02_run)(JEMU_SYM(j65c02)* inst, int cycles)
 
             /* decrement cycles. */
             cycles -= ins_cycles;
+            inst->cycle_count += ins_cycles;
         }
         else
         {
-            inst->cycle_delta = cycles > 0 ? cycles : 0;
+            /* keep the instruction for the next run. */
+            j65c02_opcode_keep(inst, ins);
+            inst->cycle_delta = cycles;
             retval = STATUS_SUCCESS;
             goto done;
         }
     }
 
 done:
+    /* end the run slice on the timeline. */
+    if (NULL != inst->timeline)
+    {
+        j65c02_timeline_span(
+            inst->timeline, JEMU_TIMELINE_LANE_HOST, 'E', NULL,
+            inst->cycle_count);
+    }
+
     return retval;
 
 }
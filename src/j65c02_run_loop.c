@@ -0,0 +1,243 @@
+/**
+ * \file j65c02_run_loop.c
+ *
+ * \brief The loop behind runs and history runs.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Run an instance for the given number of cycles.
+ *
+ * \note This is the instrumented loop behind \ref j65c02_run, and the loop
+ * behind history runs. With a
+ * callback, each instruction is run on its own, so copy and fill loops are not
+ * run natively.
+ *
+ * \param inst              The instance to run.
+ * \param cycles            The number of cycles to run the instance.
+ * \param executed          Optional function called after each instruction or
+ *                          native routine; may be NULL.
+ * \param context           The context passed to the callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_run_loop)(
+    JEMU_SYM(j65c02)* inst, int cycles, JEMU_SYM(j65c02_run_fn) executed,
+    void* context)
+{
+    status retval;
+    uint8_t ins;
+    int ins_cycles = 0;
+
+    /* increment cycles with the cycle delta from the last run. */
+    cycles += inst->cycle_delta;
+    inst->cycle_delta = 0;
+
+    /* a watchpoint hit by an earlier step has been reported. */
+    if (NULL != inst->debug)
+    {
+        inst->debug->triggered = false;
+    }
+
+    /* loop until cycles are consumed. */
+    for (;;)
+    {
+        /* if the processor is in a bad state, return an error. */
+        if (inst->crash)
+        {
+            retval = JEMU_ERROR_INVALID_PROCESSOR_STATE;
+            goto done;
+        }
+
+        /* if the processor is stopped or waiting, consume all cycles and
+         * return. */
+        if (inst->stopped || inst->wait)
+        {
+            retval = STATUS_SUCCESS;
+            goto done;
+        }
+
+        /* stop before an instruction at an execution breakpoint, keeping the
+         * cycles left for the next run. */
+        j65c02_debug* debug = inst->debug;
+        if (NULL != debug)
+        {
+            debug->pc = inst->reg_pc;
+            if (0 != debug->page_counts[JEMU_DEBUG_INDEX_EXEC][debug->pc >> 8]
+             && j65c02_debug_exec(inst))
+            {
+                inst->cycle_delta = cycles;
+                retval = JEMU_ERROR_BREAKPOINT;
+                goto done;
+            }
+        }
+
+        /* run a native routine in place of the guest routine here. */
+        if (NULL != inst->hle && j65c02_hle_check(inst->hle, inst->reg_pc))
+        {
+            const j65c02_hle_entry* entry =
+                j65c02_hle_get(inst->hle, inst->reg_pc);
+
+            /* leave the routine to be called on the next run. */
+            if (cycles <= entry->cycles)
+            {
+                inst->cycle_delta = cycles;
+                retval = STATUS_SUCCESS;
+                goto done;
+            }
+
+            retval = j65c02_hle_exec(inst, entry);
+            if (STATUS_SUCCESS == retval)
+            {
+                cycles -= entry->cycles;
+                inst->cycle_count += entry->cycles;
+            }
+
+            /* report the routine to the caller. */
+            if (NULL != executed)
+            {
+                retval = executed(context, inst, retval);
+            }
+
+            if (STATUS_SUCCESS != retval)
+            {
+                goto done;
+            }
+
+            continue;
+        }
+
+        /* fetch an instruction, or take the one the last run fetched. */
+        retval = j65c02_opcode_fetch(&ins, inst);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+
+        /* decode the instruction. */
+        const j65c02_instruction* ins_fn = inst->instructions + ins;
+
+        /* do we have the budget to run this instruction? */
+        if (cycles > ins_fn->max_cycles)
+        {
+            /* log the instruction to the flight recorder. */
+            if (NULL != inst->flight)
+            {
+                j65c02_flight_record(inst, ins);
+            }
+
+            /* write the instruction to the trace. */
+            if (NULL != inst->trace)
+            {
+                j65c02_trace_instruction(inst->trace, ins);
+            }
+
+            /* note where the instruction began, for the profile and the
+             * coverage map. */
+            uint16_t ins_pc = inst->reg_pc - 1;
+
+#if JEMU_PROFILE_ENABLED
+            /* note the call path it began in, for the profile. */
+            uint32_t ins_node =
+                NULL != inst->profile ? inst->profile->node : 0;
+#endif /* JEMU_PROFILE_ENABLED */
+
+            /* execute the instruction. */
+            retval = ins_fn->exec(inst, &ins_cycles);
+            if (STATUS_SUCCESS != retval)
+            {
+                /* a failed instruction is still reported to the caller. */
+                if (NULL != executed)
+                {
+                    retval = executed(context, inst, retval);
+                }
+
+                goto done;
+            }
+
+            /* count a control transfer in the coverage map. */
+            if (NULL != inst->coverage
+             && JEMU_SYM(global_j65c02_control_transfers)[ins])
+            {
+                j65c02_coverage_edge(inst->coverage, ins_pc, inst->reg_pc);
+            }
+
+#if JEMU_PROFILE_ENABLED
+            /* count the instruction in the profile. */
+            if (NULL != inst->profile)
+            {
+                JEMU_SYM(j65c02_profile_record)(
+                    inst->profile, ins_node, ins_pc, ins, ins_cycles);
+            }
+#endif /* JEMU_PROFILE_ENABLED */
+
+            /* decrement cycles. */
+            cycles -= ins_cycles;
+            inst->cycle_count += ins_cycles;
+
+            /* run a DMA transfer started by this instruction, and take
+             * its IRQ. */
+            if (j65c02_dma_due(inst))
+            {
+                int dma_cycles;
+
+                retval = j65c02_dma_finish(inst, &dma_cycles);
+                cycles -= dma_cycles;
+                inst->cycle_count += dma_cycles;
+            }
+
+            /* report the instruction to the caller. */
+            if (NULL != executed)
+            {
+                retval = executed(context, inst, retval);
+            }
+
+            if (STATUS_SUCCESS != retval)
+            {
+                goto done;
+            }
+
+            /* stop after an instruction that hit a watchpoint. */
+            if (NULL != inst->debug && inst->debug->triggered)
+            {
+                inst->debug->triggered = false;
+                inst->cycle_delta = cycles;
+                retval = JEMU_ERROR_BREAKPOINT;
+                goto done;
+            }
+
+            /* run the rest of a copy or fill loop natively, unless the caller
+             * counts each instruction. */
+            if (inst->idioms && NULL == executed
+             && 0xD0 == ins && inst->reg_pc < ins_pc)
+            {
+                int idiom_cycles = j65c02_idiom_loop(inst, ins_pc, cycles);
+
+                cycles -= idiom_cycles;
+                inst->cycle_count += idiom_cycles;
+            }
+        }
+        else
+        {
+            /* keep the instruction for the next run, along with the cycles
+             * left, which are negative when a transfer overran this run. */
+            j65c02_opcode_keep(inst, ins);
+            inst->cycle_delta = cycles;
+            retval = STATUS_SUCCESS;
+            goto done;
+        }
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,80 @@
+/**
+ * \file j65c02_runahead_create.c
+ *
+ * \brief Create a run-ahead runner.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_runahead_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_runahead;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+/**
+ * \brief Create a run-ahead runner for an instance.
+ *
+ * \note On success, the caller is given ownership of the runner and must
+ * release it by calling \ref j65c02_runahead_release when it is no longer
+ * needed. Every memory region that holds guest state must be registered with
+ * \ref j65c02_memory_region_add before this call; state that is not in a
+ * registered region is not rolled back.
+ *
+ * \param runahead          Pointer to the runner pointer to set to the created
+ *                          runner on success.
+ * \param inst              The instance to run; it remains owned by the
+ *                          caller.
+ * \param frame_cycles      The number of cycles in one guest frame.
+ * \param frames            The number of frames to run ahead.
+ * \param output            The output callback.
+ * \param context           The user context for the output callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_runahead_create)(
+    JEMU_SYM(j65c02_runahead)** runahead, JEMU_SYM(j65c02)* inst,
+    int frame_cycles, size_t frames, JEMU_SYM(j65c02_runahead_output_fn) output,
+    void* context)
+{
+    status retval;
+    j65c02_runahead* tmp;
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->inst = inst;
+    tmp->frame_cycles = frame_cycles;
+    tmp->frames = frames;
+    tmp->output = output;
+    tmp->context = context;
+
+    /* the snapshot is created once, so frames never allocate. */
+    retval = j65c02_snapshot_create(&tmp->snapshot, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *runahead = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_tmp:
+    memset(tmp, 0, sizeof(*tmp));
+    free(tmp);
+
+    return retval;
+}
@@ -0,0 +1,77 @@
+/**
+ * \file j65c02_runahead_frame.c
+ *
+ * \brief Run one host frame with run-ahead.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_runahead_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+/**
+ * \brief Run one host frame.
+ *
+ * \note The host applies its current inputs to guest memory or devices before
+ * this call. On return, the instance is in the state it had at the end of the
+ * real frame, ready for the next one.
+ *
+ * \param runahead          The runner for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_runahead_frame)(JEMU_SYM(j65c02_runahead)* runahead)
+{
+    status retval, restore_retval;
+    j65c02* inst = runahead->inst;
+
+    /* run the real frame. */
+    retval = j65c02_run(inst, runahead->frame_cycles);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* without run-ahead, the real frame produces the outputs. */
+    if (0 == runahead->frames)
+    {
+        retval = runahead->output(runahead->context, inst);
+        goto done;
+    }
+
+    /* save the real state. */
+    retval = j65c02_snapshot_save(runahead->snapshot, inst);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* run the speculative frames. */
+    for (size_t i = 0; i < runahead->frames; ++i)
+    {
+        retval = j65c02_run(inst, runahead->frame_cycles);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto restore_state;
+        }
+    }
+
+    /* capture the speculative outputs. */
+    retval = runahead->output(runahead->context, inst);
+
+restore_state:
+    restore_retval = j65c02_snapshot_restore(runahead->snapshot, inst);
+    if (STATUS_SUCCESS != restore_retval)
+    {
+        retval = restore_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,23 @@
+/**
+ * \file j65c02_runahead_frames_set.c
+ *
+ * \brief Set the number of frames to run ahead.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_runahead_internal.h"
+
+/**
+ * \brief Set the number of frames to run ahead.
+ *
+ * \param runahead          The runner for this operation.
+ * \param frames            The number of frames to run ahead; zero disables
+ *                          run-ahead.
+ */
+void JEMU_SYM(j65c02_runahead_frames_set)(
+    JEMU_SYM(j65c02_runahead)* runahead, size_t frames)
+{
+    runahead->frames = frames;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file j65c02_runahead_internal.h
+ *
+ * \brief Internal header for run-ahead.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/runahead.h>
+#include <jemu65c02/snapshot.h>
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A run-ahead runner.
+ */
+struct JEMU_SYM(j65c02_runahead)
+{
+    JEMU_SYM(j65c02)* inst;
+    JEMU_SYM(j65c02_snapshot)* snapshot;
+    int frame_cycles;
+    size_t frames;
+    JEMU_SYM(j65c02_runahead_output_fn) output;
+    void* context;
+};
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,45 @@
+/**
+ * \file j65c02_runahead_release.c
+ *
+ * \brief Release a run-ahead runner.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_runahead_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+/**
+ * \brief Release a run-ahead runner.
+ *
+ * \note After this call, the runner pointer is no longer valid. The instance
+ * is not released.
+ *
+ * \param runahead          The runner to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_runahead_release)(JEMU_SYM(j65c02_runahead)* runahead)
+{
+    status retval;
+
+    /* release the snapshot. */
+    retval = j65c02_snapshot_release(runahead->snapshot);
+
+    /* clear the runner memory. */
+    memset(runahead, 0, sizeof(*runahead));
+
+    /* free memory. */
+    free(runahead);
+
+    return retval;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file j65c02_sanitized_execs.c
+ *
+ * \brief The sanitized instruction handlers.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+#define STACK_PUSH                                                  1
+#define STACK_PULL                                                  2
+
+/**
+ * \brief The instructions that move the stack pointer by pushing or pulling.
+ */
+static const uint8_t stack_effects[256] = {
+    [0x00] = STACK_PUSH,                /* BRK */
+    [0x08] = STACK_PUSH,                /* PHP */
+    [0x20] = STACK_PUSH,                /* JSR */
+    [0x48] = STACK_PUSH,                /* PHA */
+    [0x5A] = STACK_PUSH,                /* PHY */
+    [0xDA] = STACK_PUSH,                /* PHX */
+    [0x28] = STACK_PULL,                /* PLP */
+    [0x40] = STACK_PULL,                /* RTI */
+    [0x60] = STACK_PULL,                /* RTS */
+    [0x68] = STACK_PULL,                /* PLA */
+    [0x7A] = STACK_PULL,                /* PLY */
+    [0xFA] = STACK_PULL,                /* PLX */
+};
+
+/**
+ * \brief Check the opcode address of an instruction, run it through the
+ * hooks or the table beneath them, then check that it did not wrap the stack.
+ *
+ * \note The opcode has been fetched, so it sits just before the program
+ * counter. A push that wraps leaves the stack pointer above where it started,
+ * and a pull that wraps leaves it below.
+ */
+static status sanitized_exec(j65c02* inst, int* cycles, uint8_t opcode)
+{
+    j65c02_sanitizer* sanitizer = inst->sanitizer;
+    uint16_t pc = inst->reg_pc - 1;
+    uint8_t sp = inst->reg_sp;
+    status retval;
+
+    sanitizer->pc = pc;
+    sanitizer->running = true;
+
+    if (!(sanitizer->shadow[pc] & JEMU_SANITIZER_EXEC))
+    {
+        /* leave the program counter at the instruction. */
+        inst->reg_pc = pc;
+        retval =
+            j65c02_sanitizer_violation(
+                sanitizer, JEMU_SANITIZER_VIOLATION_EXEC, pc, 0);
+    }
+    else if (NULL != inst->hooked)
+    {
+        retval = inst->hooked[opcode].exec(inst, cycles);
+    }
+    else
+    {
+        retval = j65c02_instructions_base(inst)[opcode].exec(inst, cycles);
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        if (STACK_PUSH == stack_effects[opcode] && inst->reg_sp > sp)
+        {
+            retval =
+                j65c02_sanitizer_violation(
+                    sanitizer, JEMU_SANITIZER_VIOLATION_STACK_OVERFLOW,
+                    0x0100 | inst->reg_sp, 0);
+        }
+        else if (STACK_PULL == stack_effects[opcode] && inst->reg_sp < sp)
+        {
+            retval =
+                j65c02_sanitizer_violation(
+                    sanitizer, JEMU_SANITIZER_VIOLATION_STACK_UNDERFLOW,
+                    0x0100 | inst->reg_sp, 0);
+        }
+    }
+
+    sanitizer->running = false;
+
+    return retval;
+}
+
+/* one handler per opcode, each passing its opcode to sanitized_exec. */
+#define SANITIZED(n) \
+    static status sanitized_ ## n(j65c02* inst, int* cycles) { \
+        return sanitized_exec(inst, cycles, 0x ## n); }
+#define SANITIZED_ROW(r) \
+    SANITIZED(r ## 0) SANITIZED(r ## 1) SANITIZED(r ## 2) SANITIZED(r ## 3) \
+    SANITIZED(r ## 4) SANITIZED(r ## 5) SANITIZED(r ## 6) SANITIZED(r ## 7) \
+    SANITIZED(r ## 8) SANITIZED(r ## 9) SANITIZED(r ## A) SANITIZED(r ## B) \
+    SANITIZED(r ## C) SANITIZED(r ## D) SANITIZED(r ## E) SANITIZED(r ## F)
+
+SANITIZED_ROW(0) SANITIZED_ROW(1) SANITIZED_ROW(2) SANITIZED_ROW(3)
+SANITIZED_ROW(4) SANITIZED_ROW(5) SANITIZED_ROW(6) SANITIZED_ROW(7)
+SANITIZED_ROW(8) SANITIZED_ROW(9) SANITIZED_ROW(A) SANITIZED_ROW(B)
+SANITIZED_ROW(C) SANITIZED_ROW(D) SANITIZED_ROW(E) SANITIZED_ROW(F)
+
+#define SANITIZED_ENTRY_ROW(r) \
+    &sanitized_ ## r ## 0, &sanitized_ ## r ## 1, &sanitized_ ## r ## 2, \
+    &sanitized_ ## r ## 3, &sanitized_ ## r ## 4, &sanitized_ ## r ## 5, \
+    &sanitized_ ## r ## 6, &sanitized_ ## r ## 7, &sanitized_ ## r ## 8, \
+    &sanitized_ ## r ## 9, &sanitized_ ## r ## A, &sanitized_ ## r ## B, \
+    &sanitized_ ## r ## C, &sanitized_ ## r ## D, &sanitized_ ## r ## E, \
+    &sanitized_ ## r ## F
+
+/**
+ * \brief The sanitized instruction handlers, which check the opcode address
+ * and the stack pointer of an instance around the handlers it would otherwise
+ * run.
+ */
+JEMU_SYM(status) (* const JEMU_SYM(global_j65c02_sanitized_execs)[256])(
+    JEMU_SYM(j65c02)* inst, int* cycles) = {
+    SANITIZED_ENTRY_ROW(0), SANITIZED_ENTRY_ROW(1), SANITIZED_ENTRY_ROW(2),
+    SANITIZED_ENTRY_ROW(3), SANITIZED_ENTRY_ROW(4), SANITIZED_ENTRY_ROW(5),
+    SANITIZED_ENTRY_ROW(6), SANITIZED_ENTRY_ROW(7), SANITIZED_ENTRY_ROW(8),
+    SANITIZED_ENTRY_ROW(9), SANITIZED_ENTRY_ROW(A), SANITIZED_ENTRY_ROW(B),
+    SANITIZED_ENTRY_ROW(C), SANITIZED_ENTRY_ROW(D), SANITIZED_ENTRY_ROW(E),
+    SANITIZED_ENTRY_ROW(F) };
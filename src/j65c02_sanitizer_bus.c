@@ -0,0 +1,65 @@
+/**
+ * \file j65c02_sanitizer_bus.c
+ *
+ * \brief The bus callbacks installed by the sanitizer.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+/**
+ * \brief The read callback installed by the sanitizer.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_sanitizer_read)(
+    void* context, uint16_t addr, uint8_t* val)
+{
+    j65c02_sanitizer* sanitizer = (j65c02_sanitizer*)context;
+    uint8_t state = sanitizer->shadow[addr];
+
+    if (!(state & JEMU_SANITIZER_READ))
+    {
+        return
+            j65c02_sanitizer_violation(
+                sanitizer, JEMU_SANITIZER_VIOLATION_READ, addr, 0);
+    }
+
+    if (!(state & JEMU_SANITIZER_INIT))
+    {
+        return
+            j65c02_sanitizer_violation(
+                sanitizer, JEMU_SANITIZER_VIOLATION_UNINITIALIZED, addr, 0);
+    }
+
+    return sanitizer->read(sanitizer->context, addr, val);
+}
+
+/**
+ * \brief The write callback installed by the sanitizer.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_sanitizer_write)(
+    void* context, uint16_t addr, uint8_t val)
+{
+    j65c02_sanitizer* sanitizer = (j65c02_sanitizer*)context;
+    status retval;
+
+    if (!(sanitizer->shadow[addr] & JEMU_SANITIZER_WRITE))
+    {
+        return
+            j65c02_sanitizer_violation(
+                sanitizer, JEMU_SANITIZER_VIOLATION_WRITE, addr, val);
+    }
+
+    retval = sanitizer->write(sanitizer->context, addr, val);
+    if (STATUS_SUCCESS == retval)
+    {
+        sanitizer->shadow[addr] |= JEMU_SANITIZER_INIT;
+    }
+
+    return retval;
+}
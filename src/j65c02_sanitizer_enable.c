@@ -0,0 +1,104 @@
+/**
+ * \file j65c02_sanitizer_enable.c
+ *
+ * \brief Enable or disable the sanitizer on an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+/**
+ * \brief Enable or disable the sanitizer on an instance.
+ *
+ * \note The shadow memory is allocated by this call and freed when the
+ * sanitizer is disabled or the instance is released. Every address starts out
+ * readable, writable, executable, and initialized, so nothing is reported
+ * until permissions are narrowed with \ref j65c02_sanitizer_permissions_set.
+ * The sanitizer interposes on the bus of this instance, so any other bus
+ * interposer created after it must be released before it is disabled.
+ * Batches use the plain dispatch table, so only their bus accesses are
+ * checked.
+ *
+ * \param inst              The instance for this operation.
+ * \param enable            true to enable the sanitizer, or false to disable
+ *                          it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_sanitizer_enable)(JEMU_SYM(j65c02)* inst, bool enable)
+{
+    j65c02_sanitizer* sanitizer = inst->sanitizer;
+
+    if (enable)
+    {
+        /* enabling the sanitizer again keeps its shadow memory. */
+        if (NULL != sanitizer)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        sanitizer = malloc(sizeof(*sanitizer));
+        if (NULL == sanitizer)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        memset(sanitizer, 0, sizeof(*sanitizer));
+        memset(
+            sanitizer->shadow,
+            JEMU_SANITIZER_READ | JEMU_SANITIZER_WRITE | JEMU_SANITIZER_EXEC
+          | JEMU_SANITIZER_INIT,
+            sizeof(sanitizer->shadow));
+
+        /* build the sanitized table; its cycle budget is copied when it is
+         * swapped in. */
+        for (int i = 0; i < 256; ++i)
+        {
+            sanitizer->instructions[i].exec =
+                JEMU_SYM(global_j65c02_sanitized_execs)[i];
+        }
+
+        /* interpose on the bus. */
+        sanitizer->inst = inst;
+        sanitizer->read = inst->read;
+        sanitizer->write = inst->write;
+        sanitizer->context = inst->user_context;
+        inst->read = &JEMU_SYM(j65c02_sanitizer_read);
+        inst->write = &JEMU_SYM(j65c02_sanitizer_write);
+        inst->user_context = sanitizer;
+
+        inst->sanitizer = sanitizer;
+        j65c02_instructions_update(inst);
+
+        return STATUS_SUCCESS;
+    }
+
+    if (NULL == sanitizer)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* restore the bus and the table the sanitizer wrapped. */
+    inst->read = sanitizer->read;
+    inst->write = sanitizer->write;
+    inst->user_context = sanitizer->context;
+
+    memset(sanitizer, 0, sizeof(*sanitizer));
+    free(sanitizer);
+    inst->sanitizer = NULL;
+    j65c02_instructions_update(inst);
+
+    return STATUS_SUCCESS;
+}
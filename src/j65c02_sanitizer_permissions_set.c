@@ -0,0 +1,56 @@
+/**
+ * \file j65c02_sanitizer_permissions_set.c
+ *
+ * \brief Set the shadow state of a range of addresses.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+/**
+ * \brief Set the shadow state of a range of addresses.
+ *
+ * \note Writes through the bus mark an address as initialized. Memory loaded
+ * behind the bus, such as a memory region filled by the caller, should be
+ * marked with JEMU_SANITIZER_INIT here.
+ *
+ * \param inst              The instance for this operation.
+ * \param addr              The first address of the range.
+ * \param size              The size of the range.
+ * \param state             The JEMU_SANITIZER_* permissions of the range,
+ *                          and JEMU_SANITIZER_INIT if it is initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SANITIZER_DISABLED if the sanitizer is not enabled.
+ *      - JEMU_ERROR_SANITIZER_BAD_RANGE if the range runs past the end of the
+ *        address space.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_sanitizer_permissions_set)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr, size_t size, uint8_t state)
+{
+    j65c02_sanitizer* sanitizer = inst->sanitizer;
+
+    if (NULL == sanitizer)
+    {
+        return JEMU_ERROR_SANITIZER_DISABLED;
+    }
+
+    if (size > sizeof(sanitizer->shadow) - addr)
+    {
+        return JEMU_ERROR_SANITIZER_BAD_RANGE;
+    }
+
+    memset(sanitizer->shadow + addr, state, size);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,46 @@
+/**
+ * \file j65c02_sanitizer_report_get.c
+ *
+ * \brief Get the violation that last stopped a run or step.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+/**
+ * \brief Get the violation that last stopped a run or step.
+ *
+ * \param inst              The instance to query.
+ * \param report            Set to the last violation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SANITIZER_DISABLED if the sanitizer is not enabled.
+ *      - JEMU_ERROR_SANITIZER_NO_REPORT if nothing has been reported.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_sanitizer_report_get)(
+    const JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_sanitizer_report)* report)
+{
+    const j65c02_sanitizer* sanitizer = inst->sanitizer;
+
+    if (NULL == sanitizer)
+    {
+        return JEMU_ERROR_SANITIZER_DISABLED;
+    }
+
+    if (!sanitizer->has_report)
+    {
+        return JEMU_ERROR_SANITIZER_NO_REPORT;
+    }
+
+    *report = sanitizer->report;
+
+    return STATUS_SUCCESS;
+}
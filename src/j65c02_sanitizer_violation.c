@@ -0,0 +1,44 @@
+/**
+ * \file j65c02_sanitizer_violation.c
+ *
+ * \brief Record a sanitizer violation.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+/**
+ * \brief Record a sanitizer violation.
+ *
+ * \note An access made outside of an instruction is an opcode fetch or an
+ * interrupt, which is charged to the address before the program counter.
+ *
+ * \param sanitizer         The sanitizer of this instance.
+ * \param kind              The JEMU_SANITIZER_VIOLATION_* kind of violation.
+ * \param addr              The address of the violation.
+ * \param value             The value that was to be written, or zero.
+ *
+ * \returns JEMU_ERROR_SANITIZER_VIOLATION.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_sanitizer_violation)(
+    JEMU_SYM(j65c02_sanitizer)* sanitizer, int kind, uint16_t addr,
+    uint8_t value)
+{
+    j65c02* inst = sanitizer->inst;
+
+    sanitizer->report.kind = kind;
+    sanitizer->report.addr = addr;
+    sanitizer->report.pc =
+        sanitizer->running ? sanitizer->pc : (uint16_t)(inst->reg_pc - 1);
+    sanitizer->report.value = value;
+    sanitizer->report.cycle_count = inst->cycle_count;
+    sanitizer->has_report = true;
+
+    return JEMU_ERROR_SANITIZER_VIOLATION;
+}
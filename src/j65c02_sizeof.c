@@ -0,0 +1,22 @@
+/**
+ * \file j65c02_sizeof.c
+ *
+ * \brief Get the size of an emulator instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "jemu65c02_internal.h"
+
+/**
+ * \brief Get the size of an emulator instance, in bytes.
+ *
+ * \note This is the minimum size of the storage passed to \ref j65c02_init.
+ *
+ * \returns the size of an emulator instance.
+ */
+size_t JEMU_SYM(j65c02_sizeof)(void)
+{
+    return sizeof(JEMU_SYM(j65c02));
+}
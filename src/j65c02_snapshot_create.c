@@ -0,0 +1,67 @@
+/**
+ * \file j65c02_snapshot_create.c
+ *
+ * \brief Create a snapshot sized for an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_snapshot_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+/**
+ * \brief Create a snapshot sized for an instance.
+ *
+ * \note On success, the caller is given ownership of the snapshot and must
+ * release it by calling \ref j65c02_snapshot_release when it is no longer
+ * needed. The snapshot is sized for the memory regions registered with the
+ * instance at the time of this call, and is empty until it is saved.
+ *
+ * \param snapshot          Pointer to the snapshot pointer to set to the
+ *                          created snapshot on success.
+ * \param inst              The instance for which the snapshot is sized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_snapshot_create)(
+    JEMU_SYM(j65c02_snapshot)** snapshot, const JEMU_SYM(j65c02)* inst)
+{
+    j65c02_snapshot* tmp;
+    size_t size = 0;
+
+    /* each region is at most 64K, so this can't overflow. */
+    for (size_t i = 0; i < inst->region_count; ++i)
+    {
+        size += inst->regions[i].size;
+    }
+
+    tmp = malloc(sizeof(*tmp) + size);
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp) + size);
+
+    /* record the memory layout. */
+    tmp->region_count = inst->region_count;
+    for (size_t i = 0; i < inst->region_count; ++i)
+    {
+        tmp->region_size[i] = inst->regions[i].size;
+    }
+    tmp->size = size;
+
+    /* success. */
+    *snapshot = tmp;
+    return STATUS_SUCCESS;
+}
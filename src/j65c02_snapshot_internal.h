@@ -0,0 +1,72 @@
+/**
+ * \file j65c02_snapshot_internal.h
+ *
+ * \brief Internal header for snapshots.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/snapshot.h>
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A saved instance state.
+ *
+ * \note The contents of each memory region are stored back to back in data,
+ * in registration order.
+ */
+struct JEMU_SYM(j65c02_snapshot)
+{
+    /* the processor state. */
+    uint64_t cycle_count;
+    int cycle_delta;
+    uint16_t reg_pc;
+    uint8_t reg_a;
+    uint8_t reg_x;
+    uint8_t reg_y;
+    uint8_t reg_sp;
+    uint8_t reg_status;
+    bool stopped;
+    bool wait;
+    bool crash;
+    bool opcode_pending;
+    uint8_t pending_opcode;
+
+    /* the state of the DMA controller, if the instance had one. */
+    bool has_dma;
+    bool dma_pending;
+    bool dma_irq;
+    uint8_t dma_registers[JEMU_DMA_REGISTER_COUNT];
+    uint64_t dma_transfer_count;
+
+    /* the memory layout for which this snapshot was created. */
+    size_t region_count;
+    size_t region_size[JEMU_MAX_MEMORY_REGIONS];
+    size_t size;
+    uint8_t data[];
+};
+
+/**
+ * \brief Check that an instance has the memory layout of a snapshot.
+ *
+ * \param snapshot          The snapshot to check.
+ * \param inst              The instance to check.
+ *
+ * \returns true if the layouts match, or false otherwise.
+ */
+bool JEMU_SYM(j65c02_snapshot_layout_matches)(
+    const JEMU_SYM(j65c02_snapshot)* snapshot, const JEMU_SYM(j65c02)* inst);
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
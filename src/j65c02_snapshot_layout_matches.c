@@ -0,0 +1,37 @@
+/**
+ * \file j65c02_snapshot_layout_matches.c
+ *
+ * \brief Check that an instance has the memory layout of a snapshot.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_snapshot_internal.h"
+
+/**
+ * \brief Check that an instance has the memory layout of a snapshot.
+ *
+ * \param snapshot          The snapshot to check.
+ * \param inst              The instance to check.
+ *
+ * \returns true if the layouts match, or false otherwise.
+ */
+bool JEMU_SYM(j65c02_snapshot_layout_matches)(
+    const JEMU_SYM(j65c02_snapshot)* snapshot, const JEMU_SYM(j65c02)* inst)
+{
+    if (snapshot->region_count != inst->region_count)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < inst->region_count; ++i)
+    {
+        if (snapshot->region_size[i] != inst->regions[i].size)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
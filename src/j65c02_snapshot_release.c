@@ -0,0 +1,37 @@
+/**
+ * \file j65c02_snapshot_release.c
+ *
+ * \brief Release a snapshot.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_snapshot_internal.h"
+
+/**
+ * \brief Release a snapshot.
+ *
+ * \note After this call, the snapshot pointer is no longer valid.
+ *
+ * \param snapshot          The snapshot to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_snapshot_release)(JEMU_SYM(j65c02_snapshot)* snapshot)
+{
+    /* clear the snapshot memory. */
+    memset(snapshot, 0, sizeof(*snapshot) + snapshot->size);
+
+    /* free memory. */
+    free(snapshot);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/**
+ * \file j65c02_snapshot_restore.c
+ *
+ * \brief Restore the state of an instance from a snapshot.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_snapshot_internal.h"
+
+/**
+ * \brief Restore the state of an instance from a snapshot.
+ *
+ * \note The callbacks, user context, personality, and emulation mode of the
+ * instance are left as they are, as is the shadow memory of its sanitizer.
+ * The registers, pending transfer, and IRQ line of its DMA controller are
+ * restored; a controller created after the snapshot was saved is left idle.
+ *
+ * \param snapshot          The snapshot from which the state is restored.
+ * \param inst              The instance whose state is restored.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SNAPSHOT_MISMATCH if the memory regions of this instance
+ *        do not match those for which the snapshot was created.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_snapshot_restore)(
+    const JEMU_SYM(j65c02_snapshot)* snapshot, JEMU_SYM(j65c02)* inst)
+{
+    const uint8_t* in = snapshot->data;
+
+    /* verify the memory layout. */
+    if (!JEMU_SYM(j65c02_snapshot_layout_matches)(snapshot, inst))
+    {
+        return JEMU_ERROR_SNAPSHOT_MISMATCH;
+    }
+
+    /* restore the processor state. */
+    inst->cycle_count = snapshot->cycle_count;
+    inst->cycle_delta = snapshot->cycle_delta;
+    inst->reg_pc = snapshot->reg_pc;
+    inst->reg_a = snapshot->reg_a;
+    inst->reg_x = snapshot->reg_x;
+    inst->reg_y = snapshot->reg_y;
+    inst->reg_sp = snapshot->reg_sp;
+    inst->reg_status = snapshot->reg_status;
+    inst->stopped = snapshot->stopped;
+    inst->wait = snapshot->wait;
+    inst->crash = snapshot->crash;
+    inst->opcode_pending = snapshot->opcode_pending;
+    inst->pending_opcode = snapshot->pending_opcode;
+
+    /* restore the state of the DMA controller; one that was not there when
+     * the snapshot was saved is left idle. */
+    if (NULL != inst->dma)
+    {
+        if (snapshot->has_dma)
+        {
+            inst->dma->pending = snapshot->dma_pending;
+            inst->dma->irq = snapshot->dma_irq;
+            memcpy(
+                inst->dma->registers, snapshot->dma_registers,
+                sizeof(inst->dma->registers));
+            inst->dma->transfer_count = snapshot->dma_transfer_count;
+        }
+        else
+        {
+            inst->dma->pending = false;
+            inst->dma->irq = false;
+            memset(inst->dma->registers, 0, sizeof(inst->dma->registers));
+        }
+    }
+
+    /* a restored instance has not stopped at a breakpoint. */
+    if (NULL != inst->debug)
+    {
+        inst->debug->resume_cycles = UINT64_MAX;
+        inst->debug->triggered = false;
+    }
+
+    /* restore each memory region. */
+    for (size_t i = 0; i < inst->region_count; ++i)
+    {
+        memcpy(inst->regions[i].mem, in, inst->regions[i].size);
+        in += inst->regions[i].size;
+    }
+
+    return STATUS_SUCCESS;
+}
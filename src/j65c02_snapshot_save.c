@@ -0,0 +1,72 @@
+/**
+ * \file j65c02_snapshot_save.c
+ *
+ * \brief Save the state of an instance to a snapshot.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_snapshot_internal.h"
+
+/**
+ * \brief Save the state of an instance to a snapshot.
+ *
+ * \param snapshot          The snapshot to which the state is saved.
+ * \param inst              The instance whose state is saved.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SNAPSHOT_MISMATCH if the memory regions of this instance
+ *        do not match those for which the snapshot was created.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_snapshot_save)(
+    JEMU_SYM(j65c02_snapshot)* snapshot, const JEMU_SYM(j65c02)* inst)
+{
+    uint8_t* out = snapshot->data;
+
+    /* verify the memory layout. */
+    if (!JEMU_SYM(j65c02_snapshot_layout_matches)(snapshot, inst))
+    {
+        return JEMU_ERROR_SNAPSHOT_MISMATCH;
+    }
+
+    /* save the processor state. */
+    snapshot->cycle_count = inst->cycle_count;
+    snapshot->cycle_delta = inst->cycle_delta;
+    snapshot->reg_pc = inst->reg_pc;
+    snapshot->reg_a = inst->reg_a;
+    snapshot->reg_x = inst->reg_x;
+    snapshot->reg_y = inst->reg_y;
+    snapshot->reg_sp = inst->reg_sp;
+    snapshot->reg_status = inst->reg_status;
+    snapshot->stopped = inst->stopped;
+    snapshot->wait = inst->wait;
+    snapshot->crash = inst->crash;
+    snapshot->opcode_pending = inst->opcode_pending;
+    snapshot->pending_opcode = inst->pending_opcode;
+
+    /* save the state of the DMA controller. */
+    snapshot->has_dma = NULL != inst->dma;
+    if (NULL != inst->dma)
+    {
+        snapshot->dma_pending = inst->dma->pending;
+        snapshot->dma_irq = inst->dma->irq;
+        memcpy(
+            snapshot->dma_registers, inst->dma->registers,
+            sizeof(snapshot->dma_registers));
+        snapshot->dma_transfer_count = inst->dma->transfer_count;
+    }
+
+    /* save each memory region. */
+    for (size_t i = 0; i < inst->region_count; ++i)
+    {
+        memcpy(out, inst->regions[i].mem, inst->regions[i].size);
+        out += inst->regions[i].size;
+    }
+
+    return STATUS_SUCCESS;
+}
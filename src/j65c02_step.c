@@ -28,7 +28,7 @@ JEMU_SYM(j65c02_step)(JEMU_SYM(j65c02)* inst)
 {
     status retval;
     uint8_t ins;
-    int unused_cycles = 0;
+    int ins_cycles = 0;
 
     /* if the processor is in a bad state, return an error. */
     if (inst->crash)
@@ -51,19 +51,96 @@ JEMU_SYM(j65c02_step)(JEMU_SYM(j65c02)* inst)
         goto done;
     }
 
-    /* fetch an instruction. */
-    retval = j65c02_fetch(&ins, inst);
+    /* note where the instruction began, for its watchpoints. */
+    if (NULL != inst->debug)
+    {
+        inst->debug->pc = inst->reg_pc;
+        inst->debug->triggered = false;
+    }
+
+    /* run a native routine in place of the guest routine here. */
+    if (NULL != inst->hle && j65c02_hle_check(inst->hle, inst->reg_pc))
+    {
+        const j65c02_hle_entry* entry =
+            j65c02_hle_get(inst->hle, inst->reg_pc);
+
+        retval = j65c02_hle_exec(inst, entry);
+        if (STATUS_SUCCESS == retval)
+        {
+            inst->cycle_count += entry->cycles;
+        }
+
+        goto done;
+    }
+
+    /* fetch an instruction, or take the one the last run fetched. */
+    retval = j65c02_opcode_fetch(&ins, inst);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
     }
 
     /* decode the instruction. */
-    const j65c02_instruction* ins_fn =
-        JEMU_SYM(global_j65c02_instructions) + ins;
+    const j65c02_instruction* ins_fn = inst->instructions + ins;
+
+    /* log the instruction to the flight recorder. */
+    if (NULL != inst->flight)
+    {
+        j65c02_flight_record(inst, ins);
+    }
+
+    /* write the instruction to the trace. */
+    if (NULL != inst->trace)
+    {
+        j65c02_trace_instruction(inst->trace, ins);
+    }
+
+    /* note where the instruction began, for the profile and the coverage
+     * map. */
+    uint16_t ins_pc = inst->reg_pc - 1;
+
+#if JEMU_PROFILE_ENABLED
+    /* note the call path it began in, for the profile. */
+    uint32_t ins_node = NULL != inst->profile ? inst->profile->node : 0;
+#endif /* JEMU_PROFILE_ENABLED */
 
     /* execute the instruction. */
-    retval = ins_fn->exec(inst, &unused_cycles);
+    retval = ins_fn->exec(inst, &ins_cycles);
+    inst->cycle_count += ins_cycles;
+
+    /* count a control transfer in the coverage map. */
+    if (STATUS_SUCCESS == retval && NULL != inst->coverage
+     && JEMU_SYM(global_j65c02_control_transfers)[ins])
+    {
+        j65c02_coverage_edge(inst->coverage, ins_pc, inst->reg_pc);
+    }
+
+#if JEMU_PROFILE_ENABLED
+    /* count the instruction in the profile. */
+    if (STATUS_SUCCESS == retval && NULL != inst->profile)
+    {
+        JEMU_SYM(j65c02_profile_record)(
+            inst->profile, ins_node, ins_pc, ins, ins_cycles);
+    }
+#endif /* JEMU_PROFILE_ENABLED */
+
+    /* run a DMA transfer started by this instruction, and take its IRQ. */
+    if (STATUS_SUCCESS == retval && j65c02_dma_due(inst))
+    {
+        int dma_cycles;
+
+        retval = j65c02_dma_finish(inst, &dma_cycles);
+        inst->cycle_count += dma_cycles;
+    }
+
+    /* report an instruction that hit a watchpoint. */
+    if (STATUS_SUCCESS == retval
+     && NULL != inst->debug && inst->debug->triggered)
+    {
+        inst->debug->triggered = false;
+        retval = JEMU_ERROR_BREAKPOINT;
+    }
+
     goto done;
 
 done:
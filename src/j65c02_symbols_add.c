@@ -0,0 +1,88 @@
+/**
+ * \file j65c02_symbols_add.c
+ *
+ * \brief Append a symbol to a table.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_symbols_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+JEMU_IMPORT_jemu65c02_symbols_internal;
+
+/**
+ * \brief Append a symbol to a table, leaving it unsorted.
+ *
+ * \param symbols           The table for this operation.
+ * \param key               The key of this symbol.
+ * \param name              The label of this symbol.
+ * \param length            The length of this label.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_add)(
+    JEMU_SYM(j65c02_symbols)* symbols, uint32_t key, const char* name,
+    size_t length)
+{
+    j65c02_symbol* entries;
+    char* names;
+    size_t capacity;
+
+    /* the name pool is indexed with 32-bit offsets. */
+    if (length >= UINT32_MAX - symbols->names_size)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* grow the symbol array. */
+    if (symbols->count == symbols->capacity)
+    {
+        capacity = symbols->capacity ? 2 * symbols->capacity : 256;
+        entries = realloc(symbols->entries, capacity * sizeof(*entries));
+        if (NULL == entries)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        symbols->entries = entries;
+        symbols->capacity = capacity;
+    }
+
+    /* grow the name pool. */
+    if (symbols->names_size + length + 1 > symbols->names_capacity)
+    {
+        capacity = symbols->names_capacity ? symbols->names_capacity : 4096;
+        while (symbols->names_size + length + 1 > capacity)
+        {
+            capacity *= 2;
+        }
+
+        names = realloc(symbols->names, capacity);
+        if (NULL == names)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        symbols->names = names;
+        symbols->names_capacity = capacity;
+    }
+
+    symbols->entries[symbols->count].key = key;
+    symbols->entries[symbols->count].name = (uint32_t)symbols->names_size;
+    ++symbols->count;
+
+    memcpy(symbols->names + symbols->names_size, name, length);
+    symbols->names_size += length;
+    symbols->names[symbols->names_size++] = 0;
+
+    return STATUS_SUCCESS;
+}
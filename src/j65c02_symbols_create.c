@@ -0,0 +1,49 @@
+/**
+ * \file j65c02_symbols_create.c
+ *
+ * \brief Create an empty symbol table.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_symbols_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+
+/**
+ * \brief Create an empty symbol table.
+ *
+ * \note On success, the caller is given ownership of the table and must
+ * release it by calling \ref j65c02_symbols_release when it is no longer
+ * needed.
+ *
+ * \param symbols           Pointer to the table pointer to set to the created
+ *                          table on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_create)(JEMU_SYM(j65c02_symbols)** symbols)
+{
+    j65c02_symbols* tmp;
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    *symbols = tmp;
+
+    return STATUS_SUCCESS;
+}
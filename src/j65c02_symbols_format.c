@@ -0,0 +1,84 @@
+/**
+ * \file j65c02_symbols_format.c
+ *
+ * \brief Format an address with its label.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_symbols_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+
+/**
+ * \brief Format an address as "label", "label+offset", or "$XXXX".
+ *
+ * \note The output is always terminated, and is cut short if it does not fit.
+ *
+ * \param symbols           The table to use, or NULL to format the address
+ *                          alone.
+ * \param bank              The bank of this address.
+ * \param addr              The address to format.
+ * \param buffer            The buffer to which the text is written.
+ * \param size              The size of this buffer, which must be non-zero.
+ *
+ * \returns the length of the text written, without its terminator.
+ */
+size_t JEMU_SYM(j65c02_symbols_format)(
+    const JEMU_SYM(j65c02_symbols)* symbols, uint8_t bank, uint16_t addr,
+    char* buffer, size_t size)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    char text[8];
+    const char* name;
+    uint16_t offset;
+    size_t length, text_length = 0, used = 0;
+
+    if (NULL != symbols
+     && STATUS_SUCCESS
+            == j65c02_symbols_lookup(symbols, bank, addr, &name, &offset))
+    {
+        /* copy as much of the label as fits. */
+        length = strlen(name);
+        used = length < size - 1 ? length : size - 1;
+        memcpy(buffer, name, used);
+
+        /* follow it with a decimal offset. */
+        if (offset > 0)
+        {
+            char digits[5];
+            size_t digit_count = 0;
+
+            do
+            {
+                digits[digit_count++] = (char)('0' + offset % 10);
+                offset /= 10;
+            } while (offset > 0);
+
+            text[text_length++] = '+';
+            while (digit_count > 0)
+            {
+                text[text_length++] = digits[--digit_count];
+            }
+        }
+    }
+    else
+    {
+        text[text_length++] = '$';
+        for (int shift = 12; shift >= 0; shift -= 4)
+        {
+            text[text_length++] = hex[(addr >> shift) & 0x0F];
+        }
+    }
+
+    length = text_length < size - 1 - used ? text_length : size - 1 - used;
+    memcpy(buffer + used, text, length);
+    used += length;
+    buffer[used] = 0;
+
+    return used;
+}
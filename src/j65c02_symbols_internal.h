@@ -0,0 +1,102 @@
+/**
+ * \file j65c02_symbols_internal.h
+ *
+ * \brief Internal header for guest symbol tables.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/symbols.h>
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The sort key of a symbol: its bank, then its address.
+ */
+#define JEMU_SYMBOLS_KEY(bank, addr) \
+    (((uint32_t)(bank) << 16) | (uint32_t)(addr))
+
+/**
+ * \brief A symbol, naming an address by the offset of its label in the name
+ * pool of its table.
+ */
+typedef struct JEMU_SYM(j65c02_symbol) JEMU_SYM(j65c02_symbol);
+
+struct JEMU_SYM(j65c02_symbol)
+{
+    uint32_t key;
+    uint32_t name;
+};
+
+/**
+ * \brief A guest symbol table. The symbols are sorted by key between loads.
+ */
+struct JEMU_SYM(j65c02_symbols)
+{
+    JEMU_SYM(j65c02_symbol)* entries;
+    size_t count;
+    size_t capacity;
+
+    /* the terminated labels, back to back. */
+    char* names;
+    size_t names_size;
+    size_t names_capacity;
+};
+
+/**
+ * \brief Append a symbol to a table, leaving it unsorted.
+ *
+ * \param symbols           The table for this operation.
+ * \param key               The key of this symbol.
+ * \param name              The label of this symbol.
+ * \param length            The length of this label.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_add)(
+    JEMU_SYM(j65c02_symbols)* symbols, uint32_t key, const char* name,
+    size_t length);
+
+/**
+ * \brief Sort the symbols of a table by key, keeping only the first symbol
+ * added for each key.
+ *
+ * \param symbols           The table for this operation.
+ */
+void JEMU_SYM(j65c02_symbols_sort)(JEMU_SYM(j65c02_symbols)* symbols);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_symbols_internal_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_symbol) sym ## j65c02_symbol; \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_symbols_add( \
+        JEMU_SYM(j65c02_symbols)* w, uint32_t x, const char* y, size_t z) { \
+            return JEMU_SYM(j65c02_symbols_add)(w,x,y,z); } \
+    static inline void \
+    sym ## j65c02_symbols_sort(JEMU_SYM(j65c02_symbols)* x) { \
+            JEMU_SYM(j65c02_symbols_sort)(x); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_symbols_internal_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_symbols_internal_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_symbols_internal \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_symbols_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,205 @@
+/**
+ * \file j65c02_symbols_load_dbg.c
+ *
+ * \brief Load the labels of an ld65 debug info file.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "j65c02_symbols_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+JEMU_IMPORT_jemu65c02_symbols_internal;
+
+static status line_load(
+    j65c02_symbols* symbols, uint8_t bank, const char* line,
+    const char* end);
+static bool field_is(
+    const char* key, const char* key_end, const char* expected);
+
+/**
+ * \brief Load the labels of an ld65 debug info file into a bank.
+ *
+ * \note Only the "sym" lines with a value and a type of "lab" are used; every
+ * other line is skipped. When two labels share an address, the first one
+ * loaded is kept.
+ *
+ * \param symbols           The table for this operation.
+ * \param bank              The bank into which these labels are loaded.
+ * \param text              The contents of the debug info file.
+ * \param size              The size of these contents, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SYMBOLS_BAD_FORMAT if a label line is malformed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_load_dbg)(
+    JEMU_SYM(j65c02_symbols)* symbols, uint8_t bank, const char* text,
+    size_t size)
+{
+    status retval = STATUS_SUCCESS;
+    const char* end = text + size;
+    const char* line_end;
+
+    while (text < end)
+    {
+        for (line_end = text; line_end < end && '\n' != *line_end; ++line_end)
+            ;
+
+        /* only symbol lines name addresses. */
+        if (line_end - text > 4 && 0 == memcmp(text, "sym", 3)
+         && isspace((unsigned char)text[3]))
+        {
+            retval = line_load(symbols, bank, text + 4, line_end);
+            if (STATUS_SUCCESS != retval)
+            {
+                break;
+            }
+        }
+
+        text = line_end + (line_end < end);
+    }
+
+    /* keep the table sorted, even after a failed load. */
+    j65c02_symbols_sort(symbols);
+
+    return retval;
+}
+
+/**
+ * \brief Load the key=value fields of a symbol line.
+ */
+static status line_load(
+    j65c02_symbols* symbols, uint8_t bank, const char* line,
+    const char* end)
+{
+    const char* name = NULL;
+    const char* name_end = NULL;
+    const char* key;
+    const char* key_end;
+    const char* value;
+    const char* value_end;
+    bool label = false, valued = false;
+    uint32_t addr = 0;
+
+    while (line < end)
+    {
+        /* read the key. */
+        key = line;
+        while (line < end && '=' != *line && ',' != *line)
+        {
+            ++line;
+        }
+
+        key_end = line;
+        if (line == end || '=' != *line)
+        {
+            return JEMU_ERROR_SYMBOLS_BAD_FORMAT;
+        }
+
+        /* read the value, which may be quoted. */
+        ++line;
+        if (line < end && '"' == *line)
+        {
+            value = ++line;
+            while (line < end && '"' != *line)
+            {
+                ++line;
+            }
+
+            if (line == end)
+            {
+                return JEMU_ERROR_SYMBOLS_BAD_FORMAT;
+            }
+
+            value_end = line++;
+        }
+        else
+        {
+            value = line;
+            while (line < end && ',' != *line && !isspace((unsigned char)*line))
+            {
+                ++line;
+            }
+
+            value_end = line;
+        }
+
+        if (field_is(key, key_end, "name"))
+        {
+            name = value;
+            name_end = value_end;
+        }
+        else if (field_is(key, key_end, "type"))
+        {
+            label = (3 == value_end - value && 0 == memcmp(value, "lab", 3));
+        }
+        else if (field_is(key, key_end, "val"))
+        {
+            /* values are written in hex, with a 0x prefix. */
+            if (value_end - value < 3 || value_end - value > 6
+             || '0' != value[0] || 'x' != tolower((unsigned char)value[1]))
+            {
+                return JEMU_ERROR_SYMBOLS_BAD_FORMAT;
+            }
+
+            for (value += 2; value < value_end; ++value)
+            {
+                if (!isxdigit((unsigned char)*value))
+                {
+                    return JEMU_ERROR_SYMBOLS_BAD_FORMAT;
+                }
+
+                addr =
+                    addr * 16
+                  + (isdigit((unsigned char)*value)
+                        ? (uint32_t)(*value - '0')
+                        : (uint32_t)(tolower((unsigned char)*value) - 'a'
+                                + 10));
+            }
+
+            valued = true;
+        }
+
+        /* skip to the next field. */
+        while (line < end && (',' == *line || isspace((unsigned char)*line)))
+        {
+            ++line;
+        }
+    }
+
+    /* imports and equates don't name a place in this bank. */
+    if (!label || !valued)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    if (NULL == name || name == name_end)
+    {
+        return JEMU_ERROR_SYMBOLS_BAD_FORMAT;
+    }
+
+    return
+        j65c02_symbols_add(
+            symbols, JEMU_SYMBOLS_KEY(bank, addr), name, name_end - name);
+}
+
+/**
+ * \brief Check the key of a field.
+ */
+static bool field_is(
+    const char* key, const char* key_end, const char* expected)
+{
+    size_t length = strlen(expected);
+
+    return
+        (size_t)(key_end - key) == length && 0 == memcmp(key, expected, length);
+}
@@ -0,0 +1,160 @@
+/**
+ * \file j65c02_symbols_load_vice.c
+ *
+ * \brief Load a VICE style label list.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+
+#include "j65c02_symbols_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+JEMU_IMPORT_jemu65c02_symbols_internal;
+
+static status line_load(
+    j65c02_symbols* symbols, uint8_t bank, const char* line,
+    const char* end);
+static const char* space_skip(const char* pos, const char* end);
+
+/**
+ * \brief Load a VICE style label list into a bank.
+ *
+ * \note Each line is either a VICE "al C:e000 .reset" command, or a hex
+ * address and a label, such as "$E000 reset". Labels for other VICE memory
+ * spaces, blank lines, and lines starting with ';' or '#' are skipped. When
+ * two labels share an address, the first one loaded is kept.
+ *
+ * \param symbols           The table for this operation.
+ * \param bank              The bank into which these labels are loaded.
+ * \param text              The contents of the label list.
+ * \param size              The size of these contents, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SYMBOLS_BAD_FORMAT if a line is malformed.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_load_vice)(
+    JEMU_SYM(j65c02_symbols)* symbols, uint8_t bank, const char* text,
+    size_t size)
+{
+    status retval = STATUS_SUCCESS;
+    const char* end = text + size;
+    const char* line_end;
+
+    while (text < end)
+    {
+        for (line_end = text; line_end < end && '\n' != *line_end; ++line_end)
+            ;
+
+        retval = line_load(symbols, bank, text, line_end);
+        if (STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+
+        text = line_end + (line_end < end);
+    }
+
+    /* keep the table sorted, even after a failed load. */
+    j65c02_symbols_sort(symbols);
+
+    return retval;
+}
+
+/**
+ * \brief Load a single line of a label list.
+ */
+static status line_load(
+    j65c02_symbols* symbols, uint8_t bank, const char* line,
+    const char* end)
+{
+    const char* name;
+    uint32_t addr = 0;
+    int digits = 0;
+
+    line = space_skip(line, end);
+    if (line == end || ';' == *line || '#' == *line)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* a VICE add label command names its memory space. */
+    if (end - line > 2 && 'a' == tolower((unsigned char)line[0])
+     && 'l' == tolower((unsigned char)line[1])
+     && isspace((unsigned char)line[2]))
+    {
+        line = space_skip(line + 2, end);
+        if (end - line > 2 && ':' == line[1])
+        {
+            if ('c' != tolower((unsigned char)line[0]))
+            {
+                return STATUS_SUCCESS;
+            }
+
+            line += 2;
+        }
+    }
+
+    /* read the address. */
+    if (line < end && '$' == *line)
+    {
+        ++line;
+    }
+
+    for (; line < end && isxdigit((unsigned char)*line); ++line, ++digits)
+    {
+        addr =
+            addr * 16
+          + (isdigit((unsigned char)*line)
+                ? (uint32_t)(*line - '0')
+                : (uint32_t)(tolower((unsigned char)*line) - 'a' + 10));
+    }
+
+    if (0 == digits || digits > 4 || line == end
+     || !isspace((unsigned char)*line))
+    {
+        return JEMU_ERROR_SYMBOLS_BAD_FORMAT;
+    }
+
+    /* read the label, dropping the dot that VICE puts before it. */
+    line = space_skip(line, end);
+    if (line < end && '.' == *line)
+    {
+        ++line;
+    }
+
+    name = line;
+    while (line < end && !isspace((unsigned char)*line))
+    {
+        ++line;
+    }
+
+    if (name == line)
+    {
+        return JEMU_ERROR_SYMBOLS_BAD_FORMAT;
+    }
+
+    return
+        j65c02_symbols_add(
+            symbols, JEMU_SYMBOLS_KEY(bank, addr), name, line - name);
+}
+
+/**
+ * \brief Skip the white space at the start of some text.
+ */
+static const char* space_skip(const char* pos, const char* end)
+{
+    while (pos < end && isspace((unsigned char)*pos))
+    {
+        ++pos;
+    }
+
+    return pos;
+}
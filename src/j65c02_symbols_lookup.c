@@ -0,0 +1,64 @@
+/**
+ * \file j65c02_symbols_lookup.c
+ *
+ * \brief Find the label at or before an address.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_symbols_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+
+/**
+ * \brief Find the label at or before an address.
+ *
+ * \param symbols           The table to query.
+ * \param bank              The bank of this address.
+ * \param addr              The address to look up.
+ * \param name              Set to the label, which is owned by the table, on
+ *                          success.
+ * \param offset            Set to the distance of the address past the label
+ *                          on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_SYMBOLS_NOT_FOUND if there is no label at or before this
+ *        address in this bank.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_lookup)(
+    const JEMU_SYM(j65c02_symbols)* symbols, uint8_t bank, uint16_t addr,
+    const char** name, uint16_t* offset)
+{
+    uint32_t key = JEMU_SYMBOLS_KEY(bank, addr);
+    size_t low = 0, high = symbols->count;
+
+    /* find the first symbol past this key. */
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+
+        if (symbols->entries[mid].key <= key)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    /* the symbol before it must be in the same bank. */
+    if (0 == low || (symbols->entries[low - 1].key >> 16) != bank)
+    {
+        return JEMU_ERROR_SYMBOLS_NOT_FOUND;
+    }
+
+    *name = symbols->names + symbols->entries[low - 1].name;
+    *offset = (uint16_t)(key - symbols->entries[low - 1].key);
+
+    return STATUS_SUCCESS;
+}
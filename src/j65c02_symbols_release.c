@@ -0,0 +1,37 @@
+/**
+ * \file j65c02_symbols_release.c
+ *
+ * \brief Release a symbol table.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_symbols_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+
+/**
+ * \brief Release a symbol table.
+ *
+ * \param symbols           The table to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_symbols_release)(JEMU_SYM(j65c02_symbols)* symbols)
+{
+    free(symbols->entries);
+    free(symbols->names);
+
+    memset(symbols, 0, sizeof(*symbols));
+    free(symbols);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,65 @@
+/**
+ * \file j65c02_symbols_sort.c
+ *
+ * \brief Sort the symbols of a table.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "j65c02_symbols_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+JEMU_IMPORT_jemu65c02_symbols_internal;
+
+static int symbol_compare(const void* vlhs, const void* vrhs);
+
+/**
+ * \brief Sort the symbols of a table by key, keeping only the first symbol
+ * added for each key.
+ *
+ * \param symbols           The table for this operation.
+ */
+void JEMU_SYM(j65c02_symbols_sort)(JEMU_SYM(j65c02_symbols)* symbols)
+{
+    size_t used = 0;
+
+    if (0 == symbols->count)
+    {
+        return;
+    }
+
+    /* names are appended in order, so they break ties by age. */
+    qsort(
+        symbols->entries, symbols->count, sizeof(*symbols->entries),
+        &symbol_compare);
+
+    for (size_t i = 1; i < symbols->count; ++i)
+    {
+        if (symbols->entries[i].key != symbols->entries[used].key)
+        {
+            symbols->entries[++used] = symbols->entries[i];
+        }
+    }
+
+    symbols->count = used + 1;
+}
+
+/**
+ * \brief Order symbols by key, then by the age of their label.
+ */
+static int symbol_compare(const void* vlhs, const void* vrhs)
+{
+    const j65c02_symbol* lhs = (const j65c02_symbol*)vlhs;
+    const j65c02_symbol* rhs = (const j65c02_symbol*)vrhs;
+
+    if (lhs->key != rhs->key)
+    {
+        return lhs->key < rhs->key ? -1 : 1;
+    }
+
+    return lhs->name < rhs->name ? -1 : (lhs->name > rhs->name);
+}
@@ -0,0 +1,53 @@
+/**
+ * \file j65c02_system_barrier_wait.c
+ *
+ * \brief Wait at the quantum barrier of a system.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_system_internal.h"
+
+#if JEMU_THREADS_ENABLED
+# include <sched.h>
+#endif
+
+JEMU_IMPORT_jemu65c02_system;
+JEMU_IMPORT_jemu65c02_system_internal;
+
+/**
+ * \brief Wait until every CPU in a system has reached the barrier.
+ *
+ * \note This is a sense-reversing barrier; the last CPU to arrive flips the
+ * shared sense, which releases the others.
+ *
+ * \param cpu               The CPU that has reached the barrier.
+ */
+void JEMU_SYM(j65c02_system_barrier_wait)(JEMU_SYM(j65c02_system_cpu)* cpu)
+{
+    j65c02_system* system = cpu->system;
+    bool sense = !cpu->sense;
+
+    cpu->sense = sense;
+
+    if (1 == atomic_fetch_sub_explicit(
+                &system->barrier_count, 1, memory_order_acq_rel))
+    {
+        /* the last CPU resets the count, then releases the others. */
+        atomic_store_explicit(
+            &system->barrier_count, system->cpu_count, memory_order_relaxed);
+        atomic_store_explicit(
+            &system->barrier_sense, sense, memory_order_release);
+    }
+    else
+    {
+        while (atomic_load_explicit(
+                    &system->barrier_sense, memory_order_acquire) != sense)
+        {
+#if JEMU_THREADS_ENABLED
+            sched_yield();
+#endif
+        }
+    }
+}
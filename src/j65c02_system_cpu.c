@@ -0,0 +1,104 @@
+/**
+ * \file j65c02_system_cpu.c
+ *
+ * \brief System CPU loop and thread entry point.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_system_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_system;
+JEMU_IMPORT_jemu65c02_system_internal;
+
+/**
+ * \brief Run a single CPU for the current run, one quantum at a time, waiting
+ * at the barrier after each quantum.
+ *
+ * \param cpu               The CPU to run.
+ */
+void JEMU_SYM(j65c02_system_cpu_run)(JEMU_SYM(j65c02_system_cpu)* cpu)
+{
+    j65c02_system* system = cpu->system;
+    status* result = system->results + cpu->index;
+
+    for (int remaining = system->cycles; remaining > 0;
+         remaining -= system->quantum)
+    {
+        int quantum =
+            remaining < system->quantum ? remaining : system->quantum;
+
+        /* a failed CPU sits out the rest of the run, but keeps time. */
+        if (STATUS_SUCCESS == *result)
+        {
+            *result = j65c02_run(cpu->inst, quantum);
+        }
+
+        /* time the wait for the other CPUs on the timeline. */
+        if (NULL != cpu->inst->timeline)
+        {
+            j65c02_timeline_span(
+                cpu->inst->timeline, JEMU_TIMELINE_LANE_HOST, 'B',
+                "barrier", cpu->inst->cycle_count);
+        }
+
+        JEMU_SYM(j65c02_system_barrier_wait)(cpu);
+
+        if (NULL != cpu->inst->timeline)
+        {
+            j65c02_timeline_span(
+                cpu->inst->timeline, JEMU_TIMELINE_LANE_HOST, 'E', NULL,
+                cpu->inst->cycle_count);
+        }
+    }
+}
+
+#if JEMU_THREADS_ENABLED
+/**
+ * \brief The entry point for a CPU thread.
+ *
+ * \param arg               The CPU for this thread.
+ *
+ * \returns NULL.
+ */
+void* JEMU_SYM(j65c02_system_cpu_thread)(void* arg)
+{
+    j65c02_system_cpu* cpu = (j65c02_system_cpu*)arg;
+    j65c02_system* system = cpu->system;
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&system->lock);
+    for (;;)
+    {
+        /* wait for a new run or shutdown. */
+        while (!system->shutdown && system->generation == seen)
+        {
+            pthread_cond_wait(&system->start, &system->lock);
+        }
+
+        if (system->shutdown)
+        {
+            break;
+        }
+
+        seen = system->generation;
+        pthread_mutex_unlock(&system->lock);
+
+        /* run this CPU in step with the others. */
+        JEMU_SYM(j65c02_system_cpu_run)(cpu);
+
+        /* let the caller know when the last CPU thread finishes. */
+        pthread_mutex_lock(&system->lock);
+        if (0 == --system->running)
+        {
+            pthread_cond_signal(&system->done);
+        }
+    }
+    pthread_mutex_unlock(&system->lock);
+
+    return NULL;
+}
+#endif
@@ -0,0 +1,41 @@
+/**
+ * \file j65c02_system_cpu_attach.c
+ *
+ * \brief Attach an instance to a system as one of its CPUs.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_system_internal.h"
+
+/**
+ * \brief Attach an instance to a system as one of its CPUs.
+ *
+ * \note On success, the system takes ownership of the instance and releases it
+ * when the system is released.
+ *
+ * \param system            The system to which the instance is attached.
+ * \param index             The CPU index for this instance.
+ * \param inst              The instance to attach.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_INVALID_CPU_INDEX if the index is out of range or is
+ *        already attached.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_cpu_attach)(
+    JEMU_SYM(j65c02_system)* system, size_t index, JEMU_SYM(j65c02)* inst)
+{
+    /* verify the index. */
+    if (index >= system->cpu_count || NULL != system->cpus[index].inst)
+    {
+        return JEMU_ERROR_INVALID_CPU_INDEX;
+    }
+
+    system->cpus[index].inst = inst;
+
+    return STATUS_SUCCESS;
+}
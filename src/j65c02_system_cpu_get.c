@@ -0,0 +1,29 @@
+/**
+ * \file j65c02_system_cpu_get.c
+ *
+ * \brief Get a CPU of a system.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_system_internal.h"
+
+/**
+ * \brief Get a CPU of a system.
+ *
+ * \param system            The system to query.
+ * \param index             The CPU index.
+ *
+ * \returns the instance attached at this index, or NULL if there is none.
+ */
+JEMU_SYM(j65c02)* JEMU_SYM(j65c02_system_cpu_get)(
+    const JEMU_SYM(j65c02_system)* system, size_t index)
+{
+    if (index >= system->cpu_count)
+    {
+        return NULL;
+    }
+
+    return system->cpus[index].inst;
+}
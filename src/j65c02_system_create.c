@@ -0,0 +1,153 @@
+/**
+ * \file j65c02_system_create.c
+ *
+ * \brief Create a coupled multi-CPU system.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_system_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_system;
+JEMU_IMPORT_jemu65c02_system_internal;
+
+/**
+ * \brief Start the CPU threads for a system.
+ *
+ * \note CPU 0 always runs on the calling thread, so only the other CPUs get a
+ * thread of their own.
+ *
+ * \param system            The system whose CPU threads are started.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static JEMU_SYM(status) start_cpus(JEMU_SYM(j65c02_system)* system)
+{
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_init(&system->lock, NULL);
+    pthread_cond_init(&system->start, NULL);
+    pthread_cond_init(&system->done, NULL);
+
+    /* a deterministic or single-CPU system runs on the calling thread. */
+    if (system->flags & JEMU_SYSTEM_FLAG_DETERMINISTIC
+     || 1 == system->cpu_count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    for (size_t i = 1; i < system->cpu_count; ++i)
+    {
+        if (0 != pthread_create(
+                    &system->cpus[i].thread, NULL,
+                    &JEMU_SYM(j65c02_system_cpu_thread), system->cpus + i))
+        {
+            return JEMU_ERROR_THREAD_CREATE;
+        }
+
+        ++system->threads_started;
+    }
+#else
+    (void)system;
+#endif
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Create a coupled multi-CPU system.
+ *
+ * \note On success, the caller is given ownership of the system and must
+ * release it by calling \ref j65c02_system_release when it is no longer needed.
+ * Every CPU must be attached with \ref j65c02_system_cpu_attach before the
+ * system is run. When the host does not support threads, the system always
+ * runs deterministically.
+ *
+ * \param system            Pointer to the system pointer to set to the created
+ *                          system on success.
+ * \param cpu_count         The number of CPUs in this system.
+ * \param quantum           The number of cycles each CPU runs between
+ *                          synchronization points.
+ * \param flags             Zero or more JEMU_SYSTEM_FLAG_* values.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_create)(
+    JEMU_SYM(j65c02_system)** system, size_t cpu_count, int quantum,
+    int flags)
+{
+    status retval, release_retval;
+    j65c02_system* tmp;
+
+    /* verify the CPU count. */
+    if (0 == cpu_count
+     || cpu_count > (SIZE_MAX - sizeof(*tmp)) / sizeof(j65c02_system_cpu))
+    {
+        return JEMU_ERROR_INVALID_CPU_COUNT;
+    }
+
+    /* verify the quantum. */
+    if (quantum <= 0)
+    {
+        return JEMU_ERROR_INVALID_QUANTUM;
+    }
+
+#if !JEMU_THREADS_ENABLED
+    /* without threads, the CPUs always run serially. */
+    flags |= JEMU_SYSTEM_FLAG_DETERMINISTIC;
+#endif
+
+    /* the CPUs share the system allocation. */
+    tmp = malloc(sizeof(*tmp) + cpu_count * sizeof(j65c02_system_cpu));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->cpu_count = cpu_count;
+    tmp->quantum = quantum;
+    tmp->flags = flags;
+    atomic_init(&tmp->barrier_count, cpu_count);
+    atomic_init(&tmp->barrier_sense, false);
+
+    /* set up the CPUs. */
+    tmp->cpus = (j65c02_system_cpu*)(tmp + 1);
+    memset(tmp->cpus, 0, cpu_count * sizeof(j65c02_system_cpu));
+    for (size_t i = 0; i < cpu_count; ++i)
+    {
+        tmp->cpus[i].index = i;
+        tmp->cpus[i].system = tmp;
+    }
+
+    /* start the CPU threads. */
+    retval = start_cpus(tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *system = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_tmp:
+    release_retval = j65c02_system_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
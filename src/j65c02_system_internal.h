@@ -0,0 +1,151 @@
+/**
+ * \file j65c02_system_internal.h
+ *
+ * \brief Internal header for coupled multi-CPU systems.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/system.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#if JEMU_THREADS_ENABLED
+# include <pthread.h>
+#endif
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A single CPU in a system.
+ */
+typedef struct JEMU_SYM(j65c02_system_cpu) JEMU_SYM(j65c02_system_cpu);
+
+struct JEMU_SYM(j65c02_system_cpu)
+{
+    JEMU_SYM(j65c02)* inst;
+    JEMU_SYM(j65c02_system)* system;
+    size_t index;
+    bool sense;
+#if JEMU_THREADS_ENABLED
+    pthread_t thread;
+#endif
+};
+
+/**
+ * \brief A shared memory region owned by a system.
+ */
+typedef struct JEMU_SYM(j65c02_system_shared)
+JEMU_SYM(j65c02_system_shared);
+
+struct JEMU_SYM(j65c02_system_shared)
+{
+    JEMU_SYM(j65c02_system_shared)* next;
+    size_t size;
+    uint8_t data[];
+};
+
+/**
+ * \brief A single-producer, single-consumer message ring.
+ *
+ * \note The head is only written by the receiver and the tail is only written
+ * by the sender. Each sits on its own cache line, so that the two CPUs do not
+ * contend for the same line on every message.
+ */
+struct JEMU_SYM(j65c02_mailbox)
+{
+    atomic_size_t head;
+    uint8_t head_pad[JEMU_CACHE_LINE_SIZE];
+    atomic_size_t tail;
+    uint8_t tail_pad[JEMU_CACHE_LINE_SIZE];
+    size_t mask;
+    JEMU_SYM(j65c02_mailbox)* next;
+    uint8_t ring[];
+};
+
+/**
+ * \brief A coupled multi-CPU system.
+ */
+struct JEMU_SYM(j65c02_system)
+{
+    size_t cpu_count;
+    int quantum;
+    int flags;
+    JEMU_SYM(j65c02_system_cpu)* cpus;
+    JEMU_SYM(j65c02_system_shared)* shared;
+    JEMU_SYM(j65c02_mailbox)* mailboxes;
+
+    /* the run currently in progress. */
+    int cycles;
+    JEMU_SYM(status)* results;
+
+    /* the quantum barrier. */
+    atomic_size_t barrier_count;
+    atomic_bool barrier_sense;
+
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    uint64_t generation;
+    size_t running;
+    size_t threads_started;
+    bool shutdown;
+#endif
+};
+
+/**
+ * \brief Run a single CPU for the current run, one quantum at a time, waiting
+ * at the barrier after each quantum.
+ *
+ * \param cpu               The CPU to run.
+ */
+void JEMU_SYM(j65c02_system_cpu_run)(JEMU_SYM(j65c02_system_cpu)* cpu);
+
+/**
+ * \brief Wait until every CPU in a system has reached the barrier.
+ *
+ * \note This is a sense-reversing barrier; the last CPU to arrive flips the
+ * shared sense, which releases the others.
+ *
+ * \param cpu               The CPU that has reached the barrier.
+ */
+void JEMU_SYM(j65c02_system_barrier_wait)(JEMU_SYM(j65c02_system_cpu)* cpu);
+
+#if JEMU_THREADS_ENABLED
+/**
+ * \brief The entry point for a CPU thread.
+ *
+ * \param arg               The CPU for this thread.
+ *
+ * \returns NULL.
+ */
+void* JEMU_SYM(j65c02_system_cpu_thread)(void* arg);
+#endif
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_system_internal_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_system_cpu) sym ## j65c02_system_cpu; \
+    typedef JEMU_SYM(j65c02_system_shared) sym ## j65c02_system_shared; \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_system_internal_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_system_internal_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_system_internal \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_system_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
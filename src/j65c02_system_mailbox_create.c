@@ -0,0 +1,73 @@
+/**
+ * \file j65c02_system_mailbox_create.c
+ *
+ * \brief Create a mailbox owned by a system.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_system_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_system;
+
+/**
+ * \brief Create a mailbox for passing messages from one CPU to another.
+ *
+ * \note The mailbox is owned by the system and remains valid until the system
+ * is released. A mailbox is lock-free, with exactly one sending CPU and one
+ * receiving CPU; a pair of mailboxes gives a two-way channel.
+ *
+ * \param system            The system that owns the mailbox.
+ * \param capacity          The minimum number of messages the mailbox holds;
+ *                          this is rounded up to a power of two.
+ * \param mailbox           Pointer to the mailbox pointer to set to the created
+ *                          mailbox on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_mailbox_create)(
+    JEMU_SYM(j65c02_system)* system, size_t capacity,
+    JEMU_SYM(j65c02_mailbox)** mailbox)
+{
+    j65c02_mailbox* tmp;
+    size_t size = 1;
+
+    /* round the capacity up to a power of two. */
+    while (size < capacity)
+    {
+        if (size > (SIZE_MAX - sizeof(*tmp)) / 2)
+        {
+            return JEMU_ERROR_OUT_OF_MEMORY;
+        }
+
+        size *= 2;
+    }
+
+    tmp = malloc(sizeof(*tmp) + size);
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp) + size);
+    atomic_init(&tmp->head, 0);
+    atomic_init(&tmp->tail, 0);
+    tmp->mask = size - 1;
+
+    /* the system owns the mailbox. */
+    tmp->next = system->mailboxes;
+    system->mailboxes = tmp;
+
+    *mailbox = tmp;
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,94 @@
+/**
+ * \file j65c02_system_release.c
+ *
+ * \brief Release a coupled multi-CPU system.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_system_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_system;
+JEMU_IMPORT_jemu65c02_system_internal;
+
+/**
+ * \brief Release a coupled multi-CPU system.
+ *
+ * \note After this call, the system pointer, its CPUs, its shared memory
+ * regions, and its mailboxes are no longer valid.
+ *
+ * \param system            The system to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_release)(JEMU_SYM(j65c02_system)* system)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+
+#if JEMU_THREADS_ENABLED
+    /* tell the CPU threads to exit. */
+    pthread_mutex_lock(&system->lock);
+    system->shutdown = true;
+    pthread_cond_broadcast(&system->start);
+    pthread_mutex_unlock(&system->lock);
+
+    /* wait for them to do so. */
+    for (size_t i = 0; i < system->threads_started; ++i)
+    {
+        pthread_join(system->cpus[i + 1].thread, NULL);
+    }
+
+    pthread_cond_destroy(&system->done);
+    pthread_cond_destroy(&system->start);
+    pthread_mutex_destroy(&system->lock);
+#endif
+
+    /* release the CPUs. */
+    for (size_t i = 0; i < system->cpu_count; ++i)
+    {
+        if (NULL != system->cpus[i].inst)
+        {
+            release_retval = j65c02_release(system->cpus[i].inst);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    /* free the shared memory regions. */
+    while (NULL != system->shared)
+    {
+        j65c02_system_shared* shared = system->shared;
+
+        system->shared = shared->next;
+        memset(shared, 0, sizeof(*shared) + shared->size);
+        free(shared);
+    }
+
+    /* free the mailboxes. */
+    while (NULL != system->mailboxes)
+    {
+        j65c02_mailbox* mailbox = system->mailboxes;
+
+        system->mailboxes = mailbox->next;
+        memset(mailbox, 0, sizeof(*mailbox) + mailbox->mask + 1);
+        free(mailbox);
+    }
+
+    /* clear the system memory. */
+    memset(system, 0, sizeof(*system));
+
+    /* free memory. */
+    free(system);
+
+    return retval;
+}
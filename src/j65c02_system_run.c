@@ -0,0 +1,98 @@
+/**
+ * \file j65c02_system_run.c
+ *
+ * \brief Run a coupled multi-CPU system.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_system_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_system;
+JEMU_IMPORT_jemu65c02_system_internal;
+
+/**
+ * \brief Run every CPU of a system for the given number of cycles.
+ *
+ * \note The cycles are run in quanta. After each quantum, every CPU waits for
+ * the others to finish it before starting the next one. A CPU whose run fails
+ * is stopped for the rest of this call; the others keep running.
+ *
+ * \param system            The system to run.
+ * \param cycles            The number of cycles to run each CPU.
+ * \param results           Set to the first failing status returned by
+ *                          \ref j65c02_run for each CPU, or STATUS_SUCCESS.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if the system ran, even if individual CPUs failed.
+ *      - JEMU_ERROR_SYSTEM_INCOMPLETE if a CPU is not attached.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_run)(
+    JEMU_SYM(j65c02_system)* system, int cycles, JEMU_SYM(status)* results)
+{
+    /* verify that every CPU is attached. */
+    for (size_t i = 0; i < system->cpu_count; ++i)
+    {
+        if (NULL == system->cpus[i].inst)
+        {
+            return JEMU_ERROR_SYSTEM_INCOMPLETE;
+        }
+
+        results[i] = STATUS_SUCCESS;
+    }
+
+    /* set up the run. */
+    system->cycles = cycles;
+    system->results = results;
+
+#if JEMU_THREADS_ENABLED
+    if (system->threads_started > 0)
+    {
+        /* wake the CPU threads. */
+        pthread_mutex_lock(&system->lock);
+        system->running = system->threads_started;
+        ++system->generation;
+        pthread_cond_broadcast(&system->start);
+        pthread_mutex_unlock(&system->lock);
+
+        /* CPU 0 runs on the calling thread. */
+        JEMU_SYM(j65c02_system_cpu_run)(system->cpus);
+
+        /* wait for the CPU threads to finish. */
+        pthread_mutex_lock(&system->lock);
+        while (system->running > 0)
+        {
+            pthread_cond_wait(&system->done, &system->lock);
+        }
+        pthread_mutex_unlock(&system->lock);
+    }
+    else
+#endif
+    {
+        /* run each CPU for one quantum in turn, in index order. */
+        for (int remaining = cycles; remaining > 0;
+             remaining -= system->quantum)
+        {
+            int quantum =
+                remaining < system->quantum ? remaining : system->quantum;
+
+            for (size_t i = 0; i < system->cpu_count; ++i)
+            {
+                if (STATUS_SUCCESS == results[i])
+                {
+                    results[i] = j65c02_run(system->cpus[i].inst, quantum);
+                }
+            }
+        }
+    }
+
+    /* the run is no longer referenced. */
+    system->cycles = 0;
+    system->results = NULL;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,65 @@
+/**
+ * \file j65c02_system_shared_create.c
+ *
+ * \brief Create a memory region shared between the CPUs of a system.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_system_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_system;
+JEMU_IMPORT_jemu65c02_system_internal;
+
+/**
+ * \brief Create a zero-filled memory region that is shared between the CPUs of
+ * a system.
+ *
+ * \note The region is owned by the system and remains valid until the system
+ * is released. The read and write callbacks of each CPU map it into that CPU's
+ * address space. When the CPUs run on their own threads, accesses to shared
+ * memory within a quantum race just as they would on a real dual-port RAM;
+ * use a mailbox for ordered communication.
+ *
+ * \param system            The system that owns the region.
+ * \param size              The size of the region, in bytes.
+ * \param mem               Pointer to be set to the region on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_system_shared_create)(
+    JEMU_SYM(j65c02_system)* system, size_t size, uint8_t** mem)
+{
+    j65c02_system_shared* tmp;
+
+    if (size > SIZE_MAX - sizeof(*tmp))
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    tmp = malloc(sizeof(*tmp) + size);
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the region. */
+    memset(tmp, 0, sizeof(*tmp) + size);
+    tmp->size = size;
+
+    /* the system owns the region. */
+    tmp->next = system->shared;
+    system->shared = tmp;
+
+    *mem = tmp->data;
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,48 @@
+/**
+ * \file j65c02_timeline_attach.c
+ *
+ * \brief Attach an instance to a track of a timeline.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_timeline;
+
+/**
+ * \brief Attach an instance to a track of a timeline, or detach it.
+ *
+ * \note The timeline must outlive the attachment. Detach every instance
+ * before releasing the timeline.
+ *
+ * \param inst              The instance for this operation.
+ * \param timeline          The timeline to record into, or NULL to detach.
+ * \param track             The track this instance records into.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TIMELINE_BAD_TRACK if this track is not in the timeline.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_attach)(
+    JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_timeline)* timeline,
+    size_t track)
+{
+    if (NULL == timeline)
+    {
+        inst->timeline = NULL;
+        return STATUS_SUCCESS;
+    }
+
+    if (track >= timeline->track_count)
+    {
+        return JEMU_ERROR_TIMELINE_BAD_TRACK;
+    }
+
+    inst->timeline = timeline->tracks + track;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,46 @@
+/**
+ * \file j65c02_timeline_begin.c
+ *
+ * \brief Begin a span on a lane of a track.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_timeline;
+
+/**
+ * \brief Begin a span on a lane of a track.
+ *
+ * \note The name is recorded by reference, and must stay valid until the
+ * timeline is written. Spans on a lane must nest.
+ *
+ * \param timeline          The timeline for this operation.
+ * \param track             The track to record into.
+ * \param lane              The JEMU_TIMELINE_LANE_* lane of this span.
+ * \param name              The name of this span.
+ * \param cycles            The emulated cycle count at which it begins.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, even if the event was dropped.
+ *      - JEMU_ERROR_TIMELINE_BAD_TRACK if this track or lane is not valid.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_begin)(
+    JEMU_SYM(j65c02_timeline)* timeline, size_t track, int lane,
+    const char* name, uint64_t cycles)
+{
+    if (track >= timeline->track_count || lane < 0
+     || lane >= JEMU_TIMELINE_LANES)
+    {
+        return JEMU_ERROR_TIMELINE_BAD_TRACK;
+    }
+
+    j65c02_timeline_span(timeline->tracks + track, lane, 'B', name, cycles);
+
+    return STATUS_SUCCESS;
+}
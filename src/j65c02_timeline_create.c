@@ -0,0 +1,89 @@
+/**
+ * \file j65c02_timeline_create.c
+ *
+ * \brief Create a trace event timeline.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_timeline;
+JEMU_IMPORT_jemu65c02_timeline_internal;
+
+/**
+ * \brief Create a timeline.
+ *
+ * \note On success, the caller is given ownership of the timeline and must
+ * release it by calling \ref j65c02_timeline_release when it is no longer
+ * needed. Once a track is full, the events that would not fit are dropped,
+ * along with the ends of any spans whose beginnings were dropped.
+ *
+ * \param timeline          Pointer to the timeline pointer to set to the
+ *                          created timeline on success.
+ * \param tracks            The number of tracks in this timeline.
+ * \param capacity          The number of events each track can hold.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TIMELINE_BAD_TRACK if there are no tracks.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_create)(
+    JEMU_SYM(j65c02_timeline)** timeline, size_t tracks, size_t capacity)
+{
+    j65c02_timeline* tmp;
+
+    if (0 == tracks)
+    {
+        return JEMU_ERROR_TIMELINE_BAD_TRACK;
+    }
+
+    if (capacity > SIZE_MAX / sizeof(j65c02_timeline_event) / tracks)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->track_count = tracks;
+
+    /* a spare byte keeps an empty event buffer from looking like a failed
+     * allocation. */
+    tmp->tracks = malloc(tracks * sizeof(*tmp->tracks));
+    tmp->events = malloc(tracks * capacity * sizeof(*tmp->events) + 1);
+    if (NULL == tmp->tracks || NULL == tmp->events)
+    {
+        free(tmp->tracks);
+        free(tmp->events);
+        free(tmp);
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* carve the events into one buffer per track. */
+    memset(tmp->tracks, 0, tracks * sizeof(*tmp->tracks));
+    for (size_t i = 0; i < tracks; ++i)
+    {
+        tmp->tracks[i].events = tmp->events + i * capacity;
+        tmp->tracks[i].capacity = capacity;
+    }
+
+    /* host times are written relative to the creation of the timeline. */
+    tmp->origin_ns = j65c02_timeline_now_ns();
+
+    *timeline = tmp;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,34 @@
+/**
+ * \file j65c02_timeline_dropped_get.c
+ *
+ * \brief Get the number of events a timeline has dropped.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_timeline;
+
+/**
+ * \brief Get the number of events a timeline has dropped because a track was
+ * full.
+ *
+ * \param timeline          The timeline to query.
+ *
+ * \returns the number of events dropped across every track.
+ */
+uint64_t JEMU_SYM(j65c02_timeline_dropped_get)(
+    const JEMU_SYM(j65c02_timeline)* timeline)
+{
+    uint64_t dropped = 0;
+
+    for (size_t i = 0; i < timeline->track_count; ++i)
+    {
+        dropped += timeline->tracks[i].dropped;
+    }
+
+    return dropped;
+}
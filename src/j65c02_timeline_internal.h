@@ -0,0 +1,102 @@
+/**
+ * \file j65c02_timeline_internal.h
+ *
+ * \brief Internal header for trace event timelines.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/timeline.h>
+#include <stdbool.h>
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The most nested interrupt handlers recorded on a track. Handlers
+ * entered beyond this are not recorded.
+ */
+#define JEMU_TIMELINE_MAX_HANDLERS                                  8
+
+/**
+ * \brief A timeline event.
+ */
+typedef struct JEMU_SYM(j65c02_timeline_event)
+JEMU_SYM(j65c02_timeline_event);
+
+struct JEMU_SYM(j65c02_timeline_event)
+{
+    const char* name;
+    uint64_t cycles;
+    uint64_t host_ns;
+    uint8_t lane;
+    char phase;
+};
+
+/**
+ * \brief A track of a timeline, written by one thread at a time.
+ *
+ * \note Each span that begins reserves room for its end, so that a full track
+ * never leaves a span open. A span whose beginning was dropped is counted as
+ * skipped on its lane, so that its end is dropped too.
+ */
+struct JEMU_SYM(j65c02_timeline_track)
+{
+    JEMU_SYM(j65c02_timeline_event)* events;
+    size_t count;
+    size_t reserved;
+    size_t capacity;
+    size_t skipped[JEMU_TIMELINE_LANES];
+    uint64_t dropped;
+
+    /* the guest spans open for the attached instance. */
+    bool waiting;
+    size_t handler_depth;
+    uint8_t handler_sp[JEMU_TIMELINE_MAX_HANDLERS];
+};
+
+/**
+ * \brief A trace event timeline.
+ */
+struct JEMU_SYM(j65c02_timeline)
+{
+    size_t track_count;
+    JEMU_SYM(j65c02_timeline_track)* tracks;
+    JEMU_SYM(j65c02_timeline_event)* events;
+    uint64_t origin_ns;
+};
+
+/**
+ * \brief Get the host monotonic time.
+ *
+ * \returns the current time in nanoseconds, or 0 if the host has no clock.
+ */
+uint64_t JEMU_SYM(j65c02_timeline_now_ns)(void);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_timeline_internal_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_timeline_event) sym ## j65c02_timeline_event; \
+    static inline uint64_t \
+    sym ## j65c02_timeline_now_ns(void) { \
+        return JEMU_SYM(j65c02_timeline_now_ns)(); } \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_timeline_internal_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_timeline_internal_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_timeline_internal \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_timeline_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,36 @@
+/**
+ * \file j65c02_timeline_interrupt.c
+ *
+ * \brief Begin an interrupt handler span on the timeline of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Begin an interrupt handler span on the timeline of an instance.
+ *
+ * \note This is called only when the instance has a timeline, once the
+ * interrupt has been taken, so the stack holds its return address.
+ *
+ * \param inst              The instance for this operation.
+ * \param name              The name of this handler span.
+ */
+void JEMU_SYM(j65c02_timeline_interrupt)(
+    JEMU_SYM(j65c02)* inst, const char* name)
+{
+    j65c02_timeline_track* track = inst->timeline;
+
+    if (track->handler_depth < JEMU_TIMELINE_MAX_HANDLERS)
+    {
+        track->handler_sp[track->handler_depth++] =
+            (uint8_t)(inst->reg_sp + 3);
+        j65c02_timeline_span(
+            track, JEMU_TIMELINE_LANE_GUEST, 'B', name, inst->cycle_count);
+    }
+}
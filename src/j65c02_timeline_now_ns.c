@@ -0,0 +1,32 @@
+/**
+ * \file j65c02_timeline_now_ns.c
+ *
+ * \brief Get the host monotonic time.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <time.h>
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Get the host monotonic time.
+ *
+ * \returns the current time in nanoseconds, or 0 if the host has no clock.
+ */
+uint64_t JEMU_SYM(j65c02_timeline_now_ns)(void)
+{
+#if JEMU_THREADS_ENABLED
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,37 @@
+/**
+ * \file j65c02_timeline_release.c
+ *
+ * \brief Release a trace event timeline.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_timeline;
+
+/**
+ * \brief Release a timeline.
+ *
+ * \param timeline          The timeline to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_release)(JEMU_SYM(j65c02_timeline)* timeline)
+{
+    free(timeline->tracks);
+    free(timeline->events);
+
+    memset(timeline, 0, sizeof(*timeline));
+    free(timeline);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file j65c02_timeline_return.c
+ *
+ * \brief End the interrupt handler spans returned from by an RTI.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief End the interrupt handler spans returned from by an RTI on the
+ * timeline of an instance.
+ *
+ * \note This is called only when the instance has a timeline. An RTI that
+ * ends a BRK leaves the stack above the handlers it is nested in, so only
+ * handlers whose stack has been unwound are ended.
+ *
+ * \param inst              The instance for this operation.
+ * \param cycles            The cycles taken by the RTI.
+ */
+void JEMU_SYM(j65c02_timeline_return)(JEMU_SYM(j65c02)* inst, int cycles)
+{
+    j65c02_timeline_track* track = inst->timeline;
+
+    while (track->handler_depth > 0
+        && track->handler_sp[track->handler_depth - 1] <= inst->reg_sp)
+    {
+        --track->handler_depth;
+        j65c02_timeline_span(
+            track, JEMU_TIMELINE_LANE_GUEST, 'E', NULL,
+            inst->cycle_count + cycles);
+    }
+}
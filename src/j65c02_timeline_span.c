@@ -0,0 +1,78 @@
+/**
+ * \file j65c02_timeline_span.c
+ *
+ * \brief Record an event into a timeline track.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_timeline_internal;
+
+/**
+ * \brief Record an event into a timeline track.
+ *
+ * \param track             The track for this operation.
+ * \param lane              The JEMU_TIMELINE_LANE_* lane of this event.
+ * \param phase             'B' to begin a span, 'E' to end one, or 'i' for an
+ *                          instant event.
+ * \param name              The name of this event, or NULL for an end.
+ * \param cycles            The emulated cycle count of this event.
+ */
+void JEMU_SYM(j65c02_timeline_span)(
+    JEMU_SYM(j65c02_timeline_track)* track, int lane, int phase,
+    const char* name, uint64_t cycles)
+{
+    j65c02_timeline_event* event;
+
+    switch (phase)
+    {
+        /* a beginning needs room for itself and its end. */
+        case 'B':
+            if (track->count + track->reserved + 2 > track->capacity)
+            {
+                ++track->skipped[lane];
+                ++track->dropped;
+                return;
+            }
+
+            ++track->reserved;
+            break;
+
+        /* an end uses the room its beginning reserved. */
+        case 'E':
+            if (track->skipped[lane] > 0)
+            {
+                --track->skipped[lane];
+                ++track->dropped;
+                return;
+            }
+
+            if (0 == track->reserved)
+            {
+                ++track->dropped;
+                return;
+            }
+
+            --track->reserved;
+            break;
+
+        default:
+            if (track->count + track->reserved + 1 > track->capacity)
+            {
+                ++track->dropped;
+                return;
+            }
+            break;
+    }
+
+    event = track->events + track->count++;
+    event->name = name;
+    event->cycles = cycles;
+    event->host_ns = j65c02_timeline_now_ns();
+    event->lane = (uint8_t)lane;
+    event->phase = (char)phase;
+}
@@ -0,0 +1,36 @@
+/**
+ * \file j65c02_timeline_unwind.c
+ *
+ * \brief End every guest span open on the timeline of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief End every guest span open on the timeline of an instance, as on a
+ * reset.
+ *
+ * \note This is called only when the instance has a timeline.
+ *
+ * \param inst              The instance for this operation.
+ */
+void JEMU_SYM(j65c02_timeline_unwind)(JEMU_SYM(j65c02)* inst)
+{
+    j65c02_timeline_track* track = inst->timeline;
+
+    /* a wait begun inside a handler ends before it. */
+    j65c02_timeline_wake(inst);
+
+    while (track->handler_depth > 0)
+    {
+        --track->handler_depth;
+        j65c02_timeline_span(
+            track, JEMU_TIMELINE_LANE_GUEST, 'E', NULL, inst->cycle_count);
+    }
+}
@@ -0,0 +1,33 @@
+/**
+ * \file j65c02_timeline_wait.c
+ *
+ * \brief Begin a WAI period on the timeline of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief Begin a WAI period on the timeline of an instance.
+ *
+ * \note This is called only when the instance has a timeline.
+ *
+ * \param inst              The instance for this operation.
+ * \param cycles            The cycle count at which the wait begins.
+ */
+void JEMU_SYM(j65c02_timeline_wait)(JEMU_SYM(j65c02)* inst, uint64_t cycles)
+{
+    j65c02_timeline_track* track = inst->timeline;
+
+    if (!track->waiting)
+    {
+        j65c02_timeline_span(
+            track, JEMU_TIMELINE_LANE_GUEST, 'B', "wai", cycles);
+        track->waiting = true;
+    }
+}
@@ -0,0 +1,32 @@
+/**
+ * \file j65c02_timeline_wake.c
+ *
+ * \brief End a WAI period on the timeline of an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+
+/**
+ * \brief End a WAI period on the timeline of an instance, if one is open.
+ *
+ * \note This is called only when the instance has a timeline.
+ *
+ * \param inst              The instance for this operation.
+ */
+void JEMU_SYM(j65c02_timeline_wake)(JEMU_SYM(j65c02)* inst)
+{
+    j65c02_timeline_track* track = inst->timeline;
+
+    if (track->waiting)
+    {
+        j65c02_timeline_span(
+            track, JEMU_TIMELINE_LANE_GUEST, 'E', NULL, inst->cycle_count);
+        track->waiting = false;
+    }
+}
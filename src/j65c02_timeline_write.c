@@ -0,0 +1,262 @@
+/**
+ * \file j65c02_timeline_write.c
+ *
+ * \brief Write a timeline as Chrome trace event JSON.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "j65c02_timeline_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_timeline;
+JEMU_IMPORT_jemu65c02_timeline_internal;
+
+/* room for the fixed part of an event, without its name. */
+#define EVENT_MAX 128
+
+static status text_write(
+    j65c02_timeline_sink_fn sink, void* context, const char* text,
+    bool escape);
+static size_t decimal_format(char* out, uint64_t value);
+static size_t append(char* out, const char* text);
+
+/**
+ * \brief Write a timeline as Chrome trace event JSON.
+ *
+ * \note Each track is written as a process, and each of its lanes as a
+ * thread. No track may be recorded into while the timeline is written.
+ *
+ * \param timeline          The timeline to write.
+ * \param clock             The JEMU_TIMELINE_CLOCK_* clock to write.
+ * \param sink              The sink to which the JSON is written.
+ * \param context           The user context for this sink.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - the first error returned by the sink.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_timeline_write)(
+    const JEMU_SYM(j65c02_timeline)* timeline, int clock,
+    JEMU_SYM(j65c02_timeline_sink_fn) sink, void* context)
+{
+    static const char* lanes[JEMU_TIMELINE_LANES] = {
+        "host", "guest", "device" };
+    status retval;
+    char line[EVENT_MAX];
+    size_t size;
+    bool first = true;
+
+    retval = text_write(sink, context, "{\"traceEvents\":[\n", false);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < timeline->track_count; ++i)
+    {
+        const j65c02_timeline_track* track = timeline->tracks + i;
+
+        /* name the process and threads of this track. */
+        for (int lane = -1; lane < JEMU_TIMELINE_LANES; ++lane)
+        {
+            size = 0;
+            if (!first)
+            {
+                size += append(line + size, ",\n");
+            }
+
+            first = false;
+            size += append(line + size, "{\"ph\":\"M\",\"pid\":");
+            size += decimal_format(line + size, i);
+            if (lane < 0)
+            {
+                size +=
+                    append(
+                        line + size,
+                        ",\"name\":\"process_name\",\"args\":{\"name\":"
+                        "\"track ");
+                size += decimal_format(line + size, i);
+            }
+            else
+            {
+                size += append(line + size, ",\"tid\":");
+                size += decimal_format(line + size, (uint64_t)lane);
+                size +=
+                    append(
+                        line + size,
+                        ",\"name\":\"thread_name\",\"args\":{\"name\":\"");
+                size += append(line + size, lanes[lane]);
+            }
+
+            size += append(line + size, "\"}}");
+            retval = sink(context, line, size);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        for (size_t j = 0; j < track->count; ++j)
+        {
+            const j65c02_timeline_event* event = track->events + j;
+            uint64_t elapsed;
+
+            /* write the fixed fields. */
+            size = append(line, ",\n{\"ph\":\"");
+            line[size++] = event->phase;
+            size += append(line + size, "\",\"pid\":");
+            size += decimal_format(line + size, i);
+            size += append(line + size, ",\"tid\":");
+            size += decimal_format(line + size, event->lane);
+            size += append(line + size, ",\"ts\":");
+            if (JEMU_TIMELINE_CLOCK_HOST == clock)
+            {
+                elapsed =
+                    event->host_ns > timeline->origin_ns
+                        ? event->host_ns - timeline->origin_ns
+                        : 0;
+
+                /* write microseconds, to the nanosecond. */
+                size += decimal_format(line + size, elapsed / 1000);
+                line[size++] = '.';
+                line[size++] = (char)('0' + elapsed / 100 % 10);
+                line[size++] = (char)('0' + elapsed / 10 % 10);
+                line[size++] = (char)('0' + elapsed % 10);
+            }
+            else
+            {
+                size += decimal_format(line + size, event->cycles);
+            }
+
+            if ('i' == event->phase)
+            {
+                size += append(line + size, ",\"s\":\"t\"");
+            }
+
+            if (NULL == event->name)
+            {
+                line[size++] = '}';
+                retval = sink(context, line, size);
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+
+                continue;
+            }
+
+            /* write the name, escaped. */
+            size += append(line + size, ",\"name\":\"");
+            retval = sink(context, line, size);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            retval = text_write(sink, context, event->name, true);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            retval = text_write(sink, context, "\"}", false);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    return
+        text_write(
+            sink, context, "\n],\"displayTimeUnit\":\"ns\"}\n", false);
+}
+
+/**
+ * \brief Write text to a sink, escaping it as a JSON string if asked.
+ */
+static status text_write(
+    j65c02_timeline_sink_fn sink, void* context, const char* text,
+    bool escape)
+{
+    static const char hex[] = "0123456789abcdef";
+    char chunk[64];
+    size_t size = 0;
+    status retval;
+
+    for (; 0 != *text; ++text)
+    {
+        unsigned char ch = (unsigned char)*text;
+
+        /* leave room for the longest escape. */
+        if (size > sizeof(chunk) - 6)
+        {
+            retval = sink(context, chunk, size);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            size = 0;
+        }
+
+        if (escape && ('"' == ch || '\\' == ch))
+        {
+            chunk[size++] = '\\';
+            chunk[size++] = (char)ch;
+        }
+        else if (escape && ch < 0x20)
+        {
+            size += append(chunk + size, "\\u00");
+            chunk[size++] = hex[ch >> 4];
+            chunk[size++] = hex[ch & 0x0F];
+        }
+        else
+        {
+            chunk[size++] = (char)ch;
+        }
+    }
+
+    return size > 0 ? sink(context, chunk, size) : STATUS_SUCCESS;
+}
+
+/**
+ * \brief Format an unsigned decimal value.
+ */
+static size_t decimal_format(char* out, uint64_t value)
+{
+    char digits[20];
+    size_t size = 0, digit_count = 0;
+
+    do
+    {
+        digits[digit_count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    while (digit_count > 0)
+    {
+        out[size++] = digits[--digit_count];
+    }
+
+    return size;
+}
+
+/**
+ * \brief Append a string, without its terminator.
+ */
+static size_t append(char* out, const char* text)
+{
+    size_t size = strlen(text);
+
+    memcpy(out, text, size);
+
+    return size;
+}
@@ -0,0 +1,58 @@
+/**
+ * \file j65c02_trace_bus.c
+ *
+ * \brief The bus callbacks installed by a bus trace.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief The read callback installed by a bus trace.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_trace_read)(
+    void* context, uint16_t addr, uint8_t* val)
+{
+    j65c02_trace* trace = (j65c02_trace*)context;
+    status retval;
+
+    /* failed reads are not traced, and a control flow trace only traces
+     * device reads. */
+    retval = trace->read(trace->context, addr, val);
+    if (STATUS_SUCCESS == retval
+     && (!(trace->flags & JEMU_TRACE_FLAG_CONTROL_FLOW)
+      || NULL == j65c02_memory_region_find(trace->inst, addr)))
+    {
+        JEMU_SYM(j65c02_trace_bus_record)(trace, JEMU_TRACE_BUS, addr, *val);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief The write callback installed by a bus trace.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_trace_write)(
+    void* context, uint16_t addr, uint8_t val)
+{
+    j65c02_trace* trace = (j65c02_trace*)context;
+    status retval;
+
+    /* failed writes are not traced, and a control flow trace doesn't trace
+     * writes at all. */
+    retval = trace->write(trace->context, addr, val);
+    if (STATUS_SUCCESS == retval
+     && !(trace->flags & JEMU_TRACE_FLAG_CONTROL_FLOW))
+    {
+        JEMU_SYM(j65c02_trace_bus_record)(
+            trace, JEMU_TRACE_BUS | JEMU_TRACE_BUS_WRITE, addr, val);
+    }
+
+    return retval;
+}
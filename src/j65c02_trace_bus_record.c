@@ -0,0 +1,55 @@
+/**
+ * \file j65c02_trace_bus_record.c
+ *
+ * \brief Write a trace record for a bus access.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+/**
+ * \brief Write a trace record for a bus access.
+ *
+ * \param trace             The trace for this operation.
+ * \param header            JEMU_TRACE_BUS, with JEMU_TRACE_BUS_WRITE for a
+ *                          write.
+ * \param addr              The address of this access.
+ * \param val               The value read or written.
+ */
+void JEMU_SYM(j65c02_trace_bus_record)(
+    JEMU_SYM(j65c02_trace)* trace, uint8_t header, uint16_t addr, uint8_t val)
+{
+    uint8_t* out;
+
+    /* make sure that the largest record fits in this chunk. */
+    if (trace->pos > trace->limit)
+    {
+        JEMU_SYM(j65c02_trace_chunk_next)(trace);
+    }
+
+    /* encode the address against the last bus access. */
+    out = trace->pos + 1;
+    if ((uint16_t)(trace->bus_addr + 1) == addr)
+    {
+        header |= JEMU_TRACE_ADDR_NEXT;
+    }
+    else if (addr < 0x100)
+    {
+        header |= JEMU_TRACE_ADDR_ZERO_PAGE;
+        *out++ = (uint8_t)addr;
+    }
+    else
+    {
+        header |= JEMU_TRACE_ADDR_ABS;
+        *out++ = (uint8_t)addr;
+        *out++ = (uint8_t)(addr >> 8);
+    }
+
+    *out++ = val;
+    trace->bus_addr = addr;
+
+    *trace->pos = header;
+    trace->pos = out;
+}
@@ -0,0 +1,34 @@
+/**
+ * \file j65c02_trace_chunk_begin.c
+ *
+ * \brief Start filling the chunk at the tail of a trace ring.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+/**
+ * \brief Start filling the chunk at the tail of the ring of a trace.
+ *
+ * \note Every chunk can be decoded on its own, so the delta state starts over
+ * with each one.
+ *
+ * \param trace             The trace for this operation.
+ */
+void JEMU_SYM(j65c02_trace_chunk_begin)(JEMU_SYM(j65c02_trace)* trace)
+{
+    size_t tail = atomic_load_explicit(&trace->tail, memory_order_relaxed);
+    uint8_t* data = trace->chunks[tail & (JEMU_TRACE_CHUNK_COUNT - 1)].data;
+
+    trace->cycle = trace->inst->cycle_count;
+    trace->record_position = trace->position;
+    trace->start = JEMU_SYM(j65c02_trace_varint_encode)(data, trace->cycle);
+    trace->start =
+        JEMU_SYM(j65c02_trace_varint_encode)(trace->start, trace->position);
+    trace->pos = trace->start;
+    trace->limit = data + JEMU_TRACE_CHUNK_SIZE - JEMU_TRACE_RECORD_MAX;
+    trace->state_valid = false;
+    trace->bus_addr = 0xFFFF;
+}
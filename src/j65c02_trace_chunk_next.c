@@ -0,0 +1,58 @@
+/**
+ * \file j65c02_trace_chunk_next.c
+ *
+ * \brief Publish the chunk being filled and start the next one.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02_trace;
+JEMU_IMPORT_jemu65c02_trace_internal;
+
+/**
+ * \brief Publish the chunk being filled, if it holds any records, then start
+ * filling the next one.
+ *
+ * \note This blocks while every chunk in the ring is waiting to be written.
+ *
+ * \param trace             The trace for this operation.
+ */
+void JEMU_SYM(j65c02_trace_chunk_next)(JEMU_SYM(j65c02_trace)* trace)
+{
+    size_t tail = atomic_load_explicit(&trace->tail, memory_order_relaxed);
+    j65c02_trace_chunk* chunk =
+        trace->chunks + (tail & (JEMU_TRACE_CHUNK_COUNT - 1));
+    j65c02_trace_writer* writer = trace->writer;
+
+    if (trace->pos > trace->start)
+    {
+        /* hand this chunk to the writer. */
+        chunk->size = (size_t)(trace->pos - chunk->data);
+        ++tail;
+        atomic_store_explicit(&trace->tail, tail, memory_order_release);
+
+#if JEMU_THREADS_ENABLED
+        pthread_mutex_lock(&writer->lock);
+        writer->pending = true;
+        pthread_cond_signal(&writer->wake);
+
+        /* wait until the writer has freed a chunk. */
+        while (
+            tail - atomic_load_explicit(&trace->head, memory_order_acquire)
+                >= JEMU_TRACE_CHUNK_COUNT)
+        {
+            pthread_cond_wait(&writer->drained, &writer->lock);
+        }
+
+        pthread_mutex_unlock(&writer->lock);
+#else
+        /* without threads, the chunk is written right away. */
+        JEMU_SYM(j65c02_trace_writer_drain)(writer, trace);
+#endif
+    }
+
+    JEMU_SYM(j65c02_trace_chunk_begin)(trace);
+}
@@ -0,0 +1,136 @@
+/**
+ * \file j65c02_trace_compress.c
+ *
+ * \brief Compress a trace chunk.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+/**
+ * \brief Hash the four bytes at a position.
+ */
+static inline uint32_t hash(const uint8_t* p)
+{
+    uint32_t v =
+        (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16)
+      | ((uint32_t)p[3] << 24);
+
+    return (v * 2654435761U) >> (32 - JEMU_TRACE_HASH_BITS);
+}
+
+/**
+ * \brief Write the extension bytes of a length.
+ */
+static uint8_t* length_write(uint8_t* out, size_t length)
+{
+    while (length >= 255)
+    {
+        *out++ = 255;
+        length -= 255;
+    }
+
+    *out++ = (uint8_t)length;
+
+    return out;
+}
+
+/**
+ * \brief Write a sequence of literals, followed by a match if match is
+ * non-zero.
+ */
+static uint8_t* sequence_write(
+    uint8_t* out, const uint8_t* literals, size_t literal_count, size_t match,
+    size_t offset)
+{
+    uint8_t* token = out++;
+
+    *token = (uint8_t)((literal_count < 15 ? literal_count : 15) << 4);
+    if (literal_count >= 15)
+    {
+        out = length_write(out, literal_count - 15);
+    }
+
+    memcpy(out, literals, literal_count);
+    out += literal_count;
+
+    if (match > 0)
+    {
+        match -= JEMU_TRACE_MIN_MATCH;
+        *token |= (uint8_t)(match < 15 ? match : 15);
+        *out++ = (uint8_t)offset;
+        *out++ = (uint8_t)(offset >> 8);
+        if (match >= 15)
+        {
+            out = length_write(out, match - 15);
+        }
+    }
+
+    return out;
+}
+
+/**
+ * \brief Compress a chunk.
+ *
+ * \note This is a greedy compressor with a single-entry hash table, which is
+ * fast and does well on the repetitive records of a loop.
+ *
+ * \param out               The buffer to which the compressed chunk is
+ *                          written, which must hold JEMU_TRACE_STORED_MAX
+ *                          bytes.
+ * \param in                The chunk to compress.
+ * \param size              The size of the chunk, up to JEMU_TRACE_CHUNK_SIZE.
+ * \param table             The match table.
+ *
+ * \returns the size of the compressed chunk.
+ */
+size_t JEMU_SYM(j65c02_trace_compress)(
+    uint8_t* out, const uint8_t* in, size_t size, uint16_t* table)
+{
+    const uint8_t* ip = in;
+    const uint8_t* anchor = in;
+    const uint8_t* end = in + size;
+    uint8_t* op = out;
+
+    memset(table, 0, sizeof(*table) << JEMU_TRACE_HASH_BITS);
+
+    while (end - ip >= JEMU_TRACE_MIN_MATCH)
+    {
+        uint32_t h = hash(ip);
+        const uint8_t* ref = in + table[h];
+        table[h] = (uint16_t)(ip - in);
+
+        /* the table only holds candidates; verify the match. */
+        if (ref < ip && 0 == memcmp(ref, ip, JEMU_TRACE_MIN_MATCH))
+        {
+            size_t match = JEMU_TRACE_MIN_MATCH;
+            while (ip + match < end && ref[match] == ip[match])
+            {
+                ++match;
+            }
+
+            op =
+                sequence_write(
+                    op, anchor, (size_t)(ip - anchor), match,
+                    (size_t)(ip - ref));
+            ip += match;
+            anchor = ip;
+        }
+        else
+        {
+            ++ip;
+        }
+    }
+
+    /* the trailing literals. */
+    if (anchor < end)
+    {
+        op = sequence_write(op, anchor, (size_t)(end - anchor), 0, 0);
+    }
+
+    return (size_t)(op - out);
+}
@@ -0,0 +1,57 @@
+/**
+ * \file j65c02_trace_control.c
+ *
+ * \brief Write a control record to a trace.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Write a control record to a trace.
+ *
+ * \param trace             The trace for this operation.
+ * \param type              The JEMU_TRACE_RECORD_* type of this record, from
+ *                          JEMU_TRACE_RECORD_JUMP to JEMU_TRACE_RECORD_END.
+ * \param pc                The target of a jump record.
+ */
+void JEMU_SYM(j65c02_trace_control)(
+    JEMU_SYM(j65c02_trace)* trace, int type, uint16_t pc)
+{
+    j65c02* inst = trace->inst;
+    uint8_t* out;
+
+    /* make sure that the largest record fits in this chunk. */
+    if (trace->pos > trace->limit)
+    {
+        JEMU_SYM(j65c02_trace_chunk_next)(trace);
+    }
+
+    out = trace->pos;
+    *out++ =
+        JEMU_TRACE_BUS | JEMU_TRACE_CONTROL
+      | (uint8_t)(type - JEMU_TRACE_RECORD_JUMP);
+    out =
+        JEMU_SYM(j65c02_trace_varint_encode)(
+            out, trace->position - trace->record_position);
+    out =
+        JEMU_SYM(j65c02_trace_varint_encode)(
+            out, inst->cycle_count - trace->cycle);
+    trace->cycle = inst->cycle_count;
+    trace->record_position = trace->position;
+
+    /* a jump also stands for the instruction at its target. */
+    if (JEMU_TRACE_RECORD_JUMP == type)
+    {
+        *out++ = (uint8_t)pc;
+        *out++ = (uint8_t)(pc >> 8);
+        ++trace->record_position;
+    }
+
+    trace->pos = out;
+}
@@ -0,0 +1,100 @@
+/**
+ * \file j65c02_trace_create.c
+ *
+ * \brief Start tracing an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Start tracing an instance.
+ *
+ * \note On success, the caller is given ownership of the trace and must
+ * release it by calling \ref j65c02_trace_release when it is no longer needed.
+ * The instance is traced by \ref j65c02_run and \ref j65c02_step. With
+ * JEMU_TRACE_FLAG_BUS, the trace interposes on the bus of this instance, so any
+ * other bus interposer created after it must be released first. A control
+ * flow trace interposes beneath any DMA controller, so that it records the
+ * device reads of transfers rather than the reads of the controller's
+ * registers.
+ *
+ * \param trace             Pointer to the trace pointer to set to the created
+ *                          trace on success.
+ * \param writer            The writer that writes this trace.
+ * \param inst              The instance to trace.
+ * \param flags             Zero or more JEMU_TRACE_FLAG_* values.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TRACE_ATTACHED if this instance is already traced.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_create)(
+    JEMU_SYM(j65c02_trace)** trace, JEMU_SYM(j65c02_trace_writer)* writer,
+    JEMU_SYM(j65c02)* inst, int flags)
+{
+    j65c02_trace* tmp;
+
+    /* an instance has at most one trace. */
+    if (NULL != inst->trace)
+    {
+        return JEMU_ERROR_TRACE_ATTACHED;
+    }
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->inst = inst;
+    tmp->writer = writer;
+    tmp->flags = flags;
+    tmp->next_pc = inst->reg_pc;
+    atomic_init(&tmp->head, 0);
+    atomic_init(&tmp->tail, 0);
+    JEMU_SYM(j65c02_trace_chunk_begin)(tmp);
+
+    /* add this trace to the writer. */
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_lock(&writer->list_lock);
+#endif
+    tmp->stream = writer->next_stream++;
+    tmp->next = writer->traces;
+    writer->traces = tmp;
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_unlock(&writer->list_lock);
+#endif
+
+    /* interpose on the bus. */
+    if (flags & JEMU_TRACE_FLAG_BUS)
+    {
+        j65c02_bus bus =
+            JEMU_SYM(j65c02_trace_interposed_bus)(inst, flags);
+
+        tmp->read = *bus.read;
+        tmp->write = *bus.write;
+        tmp->context = *bus.context;
+        *bus.read = &JEMU_SYM(j65c02_trace_read);
+        *bus.write = &JEMU_SYM(j65c02_trace_write);
+        *bus.context = tmp;
+    }
+
+    /* success. */
+    inst->trace = tmp;
+    *trace = tmp;
+    return STATUS_SUCCESS;
+}
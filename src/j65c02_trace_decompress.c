@@ -0,0 +1,107 @@
+/**
+ * \file j65c02_trace_decompress.c
+ *
+ * \brief Decompress a trace chunk.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+/**
+ * \brief Add the extension bytes of a length.
+ */
+static bool length_read(
+    const uint8_t* in, size_t in_size, size_t* pos, size_t* length)
+{
+    uint8_t byte;
+
+    do
+    {
+        if (*pos >= in_size)
+        {
+            return false;
+        }
+
+        byte = in[(*pos)++];
+        *length += byte;
+    } while (255 == byte);
+
+    return true;
+}
+
+/**
+ * \brief Decompress a chunk.
+ *
+ * \param out               The buffer to which the chunk is written.
+ * \param size              The size of the chunk.
+ * \param in                The compressed chunk.
+ * \param in_size           The size of the compressed chunk.
+ *
+ * \returns true on success, or false if the compressed chunk is malformed or
+ * does not decompress to exactly size bytes.
+ */
+bool JEMU_SYM(j65c02_trace_decompress)(
+    uint8_t* out, size_t size, const uint8_t* in, size_t in_size)
+{
+    size_t ip = 0, op = 0;
+
+    while (ip < in_size)
+    {
+        uint8_t token = in[ip++];
+        size_t length = token >> 4;
+        size_t offset;
+
+        /* copy the literals. */
+        if (15 == length && !length_read(in, in_size, &ip, &length))
+        {
+            return false;
+        }
+
+        if (length > in_size - ip || length > size - op)
+        {
+            return false;
+        }
+
+        memcpy(out + op, in + ip, length);
+        ip += length;
+        op += length;
+
+        /* the last sequence has no match. */
+        if (ip == in_size)
+        {
+            break;
+        }
+
+        if (in_size - ip < 2)
+        {
+            return false;
+        }
+
+        offset = (size_t)in[ip] | ((size_t)in[ip + 1] << 8);
+        ip += 2;
+
+        length = token & 0x0F;
+        if (15 == length && !length_read(in, in_size, &ip, &length))
+        {
+            return false;
+        }
+
+        length += JEMU_TRACE_MIN_MATCH;
+        if (0 == offset || offset > op || length > size - op)
+        {
+            return false;
+        }
+
+        /* matches may overlap their own output, so copy a byte at a time. */
+        for (size_t i = 0; i < length; ++i, ++op)
+        {
+            out[op] = out[op - offset];
+        }
+    }
+
+    return size == op;
+}
@@ -0,0 +1,20 @@
+/**
+ * \file j65c02_trace_flush.c
+ *
+ * \brief Hand the buffered records of a trace to its writer.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+/**
+ * \brief Hand the records buffered by a trace to its writer.
+ *
+ * \param trace             The trace to flush.
+ */
+void JEMU_SYM(j65c02_trace_flush)(JEMU_SYM(j65c02_trace)* trace)
+{
+    JEMU_SYM(j65c02_trace_chunk_next)(trace);
+}
@@ -0,0 +1,155 @@
+/**
+ * \file j65c02_trace_instruction.c
+ *
+ * \brief Write a trace record for an instruction.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Write a trace record for an instruction.
+ *
+ * \note This is called after the opcode is fetched and before it executes,
+ * only when the instance is traced.
+ *
+ * \param trace             The trace of this instance.
+ * \param opcode            The opcode that is about to execute.
+ */
+void JEMU_SYM(j65c02_trace_instruction)(
+    JEMU_SYM(j65c02_trace)* trace, uint8_t opcode)
+{
+    j65c02* inst = trace->inst;
+    const j65c02_memory_region* region = trace->region;
+    uint8_t length = JEMU_SYM(global_j65c02_instruction_lengths)[opcode];
+    uint16_t pc = inst->reg_pc - 1;
+    uint16_t delta;
+    uint8_t header;
+    uint8_t* out;
+
+    /* a control flow trace only records instructions that don't follow. */
+    if (trace->flags & JEMU_TRACE_FLAG_CONTROL_FLOW)
+    {
+        if (pc != trace->next_pc)
+        {
+            JEMU_SYM(j65c02_trace_control)(trace, JEMU_TRACE_RECORD_JUMP, pc);
+        }
+
+        trace->next_pc = pc + length;
+        ++trace->position;
+        return;
+    }
+
+    /* make sure that the largest record fits in this chunk. */
+    if (trace->pos > trace->limit)
+    {
+        JEMU_SYM(j65c02_trace_chunk_next)(trace);
+    }
+
+    out = JEMU_SYM(j65c02_trace_varint_encode)(
+        trace->pos + 1, inst->cycle_count - trace->cycle);
+    trace->cycle = inst->cycle_count;
+
+    /* code usually runs from one region, so check the last one first. */
+    if (NULL == region
+     || pc < region->base
+     || (size_t)(pc - region->base) + length > region->size)
+    {
+        region = j65c02_memory_region_find(inst, pc);
+        trace->region = region;
+        if (NULL != region
+         && (size_t)(pc - region->base) + length > region->size)
+        {
+            region = NULL;
+        }
+    }
+
+    /* encode the program counter against the end of the last instruction. */
+    delta = pc - trace->next_pc;
+    if (NULL == region)
+    {
+        header = JEMU_TRACE_PC_ABS_NO_OPERANDS;
+        *out++ = (uint8_t)pc;
+        *out++ = (uint8_t)(pc >> 8);
+    }
+    else if (!trace->state_valid || (delta >= 0x80 && delta < 0xFF80))
+    {
+        header = JEMU_TRACE_PC_ABS;
+        *out++ = (uint8_t)pc;
+        *out++ = (uint8_t)(pc >> 8);
+    }
+    else if (0 != delta)
+    {
+        header = JEMU_TRACE_PC_REL;
+        *out++ = (uint8_t)delta;
+    }
+    else
+    {
+        header = JEMU_TRACE_PC_NEXT;
+    }
+
+    /* the opcode and its operands, which can't fault within a region. */
+    *out++ = opcode;
+    if (NULL != region)
+    {
+        const uint8_t* operands = region->mem + (pc - region->base) + 1;
+        for (uint8_t i = 1; i < length; ++i)
+        {
+            *out++ = *operands++;
+        }
+    }
+
+    trace->next_pc = pc + length;
+
+    /* only write the registers that changed. */
+    if (!trace->state_valid)
+    {
+        header |= JEMU_TRACE_REG_ALL;
+        trace->state_valid = true;
+    }
+    else
+    {
+        header |= (inst->reg_a != trace->reg_a) ? JEMU_TRACE_REG_A : 0;
+        header |= (inst->reg_x != trace->reg_x) ? JEMU_TRACE_REG_X : 0;
+        header |= (inst->reg_y != trace->reg_y) ? JEMU_TRACE_REG_Y : 0;
+        header |= (inst->reg_sp != trace->reg_sp) ? JEMU_TRACE_REG_SP : 0;
+        header |=
+            (inst->reg_status != trace->reg_status)
+                ? JEMU_TRACE_REG_STATUS : 0;
+    }
+
+    if (header & JEMU_TRACE_REG_A)
+    {
+        *out++ = trace->reg_a = inst->reg_a;
+    }
+
+    if (header & JEMU_TRACE_REG_X)
+    {
+        *out++ = trace->reg_x = inst->reg_x;
+    }
+
+    if (header & JEMU_TRACE_REG_Y)
+    {
+        *out++ = trace->reg_y = inst->reg_y;
+    }
+
+    if (header & JEMU_TRACE_REG_SP)
+    {
+        *out++ = trace->reg_sp = inst->reg_sp;
+    }
+
+    if (header & JEMU_TRACE_REG_STATUS)
+    {
+        *out++ = trace->reg_status = inst->reg_status;
+    }
+
+    *trace->pos = header;
+    trace->pos = out;
+    trace->record_position = ++trace->position;
+}
@@ -0,0 +1,469 @@
+/**
+ * \file j65c02_trace_internal.h
+ *
+ * \brief Internal header for streaming execution traces.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <jemu65c02/trace.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#if JEMU_THREADS_ENABLED
+# include <pthread.h>
+#endif
+
+#include "jemu65c02_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The trace header: a four byte magic value, then a version byte.
+ */
+#define JEMU_TRACE_MAGIC                                            "J65T"
+#define JEMU_TRACE_MAGIC_SIZE                                       4
+#define JEMU_TRACE_VERSION                                          1
+#define JEMU_TRACE_HEADER_SIZE                                      5
+
+/**
+ * \brief The size of a chunk, and the number of chunks in the ring of each
+ * trace. The chunk count must be a power of two.
+ */
+#define JEMU_TRACE_CHUNK_SIZE                                       65536
+#define JEMU_TRACE_CHUNK_COUNT                                      8
+
+/**
+ * \brief Room for the largest record, plus the base cycle count and position
+ * that start each chunk.
+ */
+#define JEMU_TRACE_RECORD_MAX                                       48
+
+/**
+ * \brief Trace blocks.
+ *
+ * The trace header is followed by one block per chunk. Each block starts with
+ * the stream number, the chunk size, and the stored size, as unsigned LEB128
+ * values. When the stored size equals the chunk size, the chunk follows as is;
+ * otherwise, it follows compressed. The header of a block is at most
+ * JEMU_TRACE_BLOCK_HEADER_MAX bytes. A chunk is only compressed when that makes
+ * it smaller, but the compressor may write up to JEMU_TRACE_STORED_MAX bytes
+ * before that is known.
+ *
+ * A compressed chunk is a series of sequences. Each sequence starts with a
+ * token byte holding a literal count in its high nibble and a match length,
+ * less JEMU_TRACE_MIN_MATCH, in its low nibble. A nibble of 15 is extended by
+ * the bytes that follow, each added to it, up to the first that isn't 255. The
+ * literal count is followed by that many literal bytes. The last sequence ends
+ * here; every other sequence continues with a two byte little endian offset
+ * back to the match in the output, then the match length.
+ */
+#define JEMU_TRACE_BLOCK_HEADER_MAX                                 16
+#define JEMU_TRACE_STORED_MAX \
+    (JEMU_TRACE_CHUNK_SIZE + JEMU_TRACE_CHUNK_SIZE / 255 + 16)
+#define JEMU_TRACE_MIN_MATCH                                        4
+#define JEMU_TRACE_HASH_BITS                                        12
+
+/**
+ * \brief Chunk records.
+ *
+ * Each chunk starts with the cycle count and the number of instructions traced
+ * as it began, as unsigned LEB128 values. Each record then starts with a
+ * header byte.
+ *
+ * An instruction record has JEMU_TRACE_BUS clear. The header is followed by:
+ *      - the cycles since the last instruction record, or since the chunk
+ *        began, as an unsigned LEB128 value.
+ *      - for PC_REL, the signed difference between the program counter and the
+ *        address just past the last instruction; for PC_ABS and
+ *        PC_ABS_NO_OPERANDS, the two byte little endian program counter.
+ *        PC_NEXT has no program counter bytes.
+ *      - the opcode, then its operand bytes, unless PC_ABS_NO_OPERANDS is set.
+ *      - each register that has a REG_* bit set, in bit order. The first
+ *        instruction record of a chunk sets every REG_* bit.
+ *
+ * A bus record has JEMU_TRACE_BUS set, and JEMU_TRACE_BUS_WRITE for writes.
+ * The header is followed by the address, which is omitted for ADDR_NEXT, a
+ * single byte for ADDR_ZERO_PAGE, and two little endian bytes for ADDR_ABS,
+ * then the value. ADDR_NEXT follows the address of the last bus record, which
+ * is taken to be 0xFFFF as the chunk begins.
+ *
+ * A control record has both JEMU_TRACE_BUS and JEMU_TRACE_CONTROL set, and its
+ * kind in the low bits. The header is followed by the number of instructions
+ * left out since the last record, then the cycles since the last instruction
+ * or control record, as unsigned LEB128 values. A JUMP record is then
+ * followed by the two byte little endian program counter, and counts as an
+ * instruction; the others do not.
+ */
+#define JEMU_TRACE_BUS                                              0x80
+#define JEMU_TRACE_BUS_WRITE                                        0x40
+#define JEMU_TRACE_PC_MASK                                          0x03
+#define JEMU_TRACE_PC_NEXT                                          0x00
+#define JEMU_TRACE_PC_REL                                           0x01
+#define JEMU_TRACE_PC_ABS                                           0x02
+#define JEMU_TRACE_PC_ABS_NO_OPERANDS                               0x03
+#define JEMU_TRACE_REG_A                                            0x04
+#define JEMU_TRACE_REG_X                                            0x08
+#define JEMU_TRACE_REG_Y                                            0x10
+#define JEMU_TRACE_REG_SP                                           0x20
+#define JEMU_TRACE_REG_STATUS                                       0x40
+#define JEMU_TRACE_REG_ALL                                          0x7C
+#define JEMU_TRACE_ADDR_MASK                                        0x03
+#define JEMU_TRACE_ADDR_NEXT                                        0x00
+#define JEMU_TRACE_ADDR_ZERO_PAGE                                   0x01
+#define JEMU_TRACE_ADDR_ABS                                         0x02
+#define JEMU_TRACE_CONTROL                                          0x20
+#define JEMU_TRACE_CONTROL_MASK                                     0x07
+
+/**
+ * \brief A chunk of trace records.
+ */
+typedef struct JEMU_SYM(j65c02_trace_chunk) JEMU_SYM(j65c02_trace_chunk);
+
+struct JEMU_SYM(j65c02_trace_chunk)
+{
+    size_t size;
+    uint8_t data[JEMU_TRACE_CHUNK_SIZE];
+};
+
+/**
+ * \brief The trace of a single instance.
+ *
+ * \note The chunks form a single-producer, single-consumer ring. The traced
+ * instance fills the chunk at the tail and publishes it by incrementing the
+ * tail; the writer compresses the chunk at the head and frees it by
+ * incrementing the head. The head and the tail each sit on their own cache
+ * line.
+ */
+struct JEMU_SYM(j65c02_trace)
+{
+    /* the fill state, touched by every record. */
+    uint8_t* pos;
+    uint8_t* limit;
+    uint8_t* start;
+    JEMU_SYM(j65c02)* inst;
+    const JEMU_SYM(j65c02_memory_region)* region;
+    uint64_t cycle;
+    uint64_t position;
+    uint64_t record_position;
+    uint16_t next_pc;
+    uint16_t bus_addr;
+    bool state_valid;
+    uint8_t reg_a;
+    uint8_t reg_x;
+    uint8_t reg_y;
+    uint8_t reg_sp;
+    uint8_t reg_status;
+
+    /* the callbacks of the traced instance. */
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* context;
+    int flags;
+
+    JEMU_SYM(j65c02_trace_writer)* writer;
+    JEMU_SYM(j65c02_trace)* next;
+    uint32_t stream;
+
+    /* the chunk ring. */
+    uint8_t ring_pad[JEMU_CACHE_LINE_SIZE];
+    atomic_size_t head;
+    uint8_t head_pad[JEMU_CACHE_LINE_SIZE];
+    atomic_size_t tail;
+    uint8_t tail_pad[JEMU_CACHE_LINE_SIZE];
+    JEMU_SYM(j65c02_trace_chunk) chunks[JEMU_TRACE_CHUNK_COUNT];
+};
+
+/**
+ * \brief A trace writer.
+ */
+struct JEMU_SYM(j65c02_trace_writer)
+{
+    JEMU_SYM(j65c02_trace_sink_fn) sink;
+    void* context;
+    JEMU_SYM(status) error;
+
+    /* the traces written by this writer. */
+    JEMU_SYM(j65c02_trace)* traces;
+    uint32_t next_stream;
+
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_t lock;
+    pthread_mutex_t list_lock;
+    pthread_cond_t wake;
+    pthread_cond_t drained;
+    pthread_t thread;
+    bool thread_started;
+    bool pending;
+    bool shutdown;
+#endif
+
+    /* the compressor state. */
+    uint16_t table[1 << JEMU_TRACE_HASH_BITS];
+    uint8_t block[JEMU_TRACE_BLOCK_HEADER_MAX + JEMU_TRACE_STORED_MAX];
+};
+
+/**
+ * \brief A trace reader.
+ */
+struct JEMU_SYM(j65c02_trace_reader)
+{
+    JEMU_SYM(j65c02_trace_source_fn) source;
+    void* context;
+
+    /* the decode state of the current chunk. */
+    JEMU_SYM(j65c02_trace_record) last;
+    uint64_t next_position;
+    uint16_t next_pc;
+    uint16_t bus_addr;
+    bool state_valid;
+    size_t pos;
+    size_t size;
+
+    uint8_t chunk[JEMU_TRACE_CHUNK_SIZE];
+    uint8_t stored[JEMU_TRACE_CHUNK_SIZE];
+};
+
+/**
+ * \brief The state of a trace rebuild.
+ */
+typedef struct JEMU_SYM(j65c02_trace_rebuilder)
+JEMU_SYM(j65c02_trace_rebuilder);
+
+struct JEMU_SYM(j65c02_trace_rebuilder)
+{
+    JEMU_SYM(j65c02_trace_reader)* reader;
+    uint32_t stream;
+    JEMU_SYM(j65c02)* inst;
+
+    /* the callbacks of the rebuilt instance. */
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* context;
+
+    /* the next record of the stream, if next_status is STATUS_SUCCESS. */
+    JEMU_SYM(j65c02_trace_record) next;
+    JEMU_SYM(status) next_status;
+
+    /* the instruction being rebuilt. */
+    uint64_t position;
+    uint16_t pc;
+    bool jumped;
+    JEMU_SYM(status) error;
+
+    /* the IRQs taken from the DMA controller whose records are still to be
+     * passed by. */
+    uint64_t dma_irqs;
+};
+
+/**
+ * \brief Encode an unsigned LEB128 value.
+ *
+ * \param out               The buffer to which the value is written, which
+ *                          must have room for ten bytes.
+ * \param val               The value to encode.
+ *
+ * \returns a pointer just past the encoded value.
+ */
+uint8_t* JEMU_SYM(j65c02_trace_varint_encode)(uint8_t* out, uint64_t val);
+
+/**
+ * \brief Start filling the chunk at the tail of the ring of a trace.
+ *
+ * \param trace             The trace for this operation.
+ */
+void JEMU_SYM(j65c02_trace_chunk_begin)(JEMU_SYM(j65c02_trace)* trace);
+
+/**
+ * \brief Publish the chunk being filled, if it holds any records, then start
+ * filling the next one.
+ *
+ * \note This blocks while every chunk in the ring is waiting to be written.
+ *
+ * \param trace             The trace for this operation.
+ */
+void JEMU_SYM(j65c02_trace_chunk_next)(JEMU_SYM(j65c02_trace)* trace);
+
+/**
+ * \brief Write a trace record for a bus access.
+ *
+ * \param trace             The trace for this operation.
+ * \param header            JEMU_TRACE_BUS, with JEMU_TRACE_BUS_WRITE for a
+ *                          write.
+ * \param addr              The address of this access.
+ * \param val               The value read or written.
+ */
+void JEMU_SYM(j65c02_trace_bus_record)(
+    JEMU_SYM(j65c02_trace)* trace, uint8_t header, uint16_t addr, uint8_t val);
+
+/**
+ * \brief The read callback installed by a bus trace.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_trace_read)(
+    void* context, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief The write callback installed by a bus trace.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_trace_write)(
+    void* context, uint16_t addr, uint8_t val);
+
+/**
+ * \brief Get the bus on which a bus trace interposes.
+ *
+ * \note A control flow trace interposes beneath any DMA controller, as the
+ * replay recorder does, so that it records the device reads of transfers,
+ * which a rebuild answers there. Any other trace sees the bus of the
+ * processor.
+ *
+ * \param inst              The traced instance.
+ * \param flags             The JEMU_TRACE_FLAG_* values of the trace.
+ *
+ * \returns the bus callbacks to interpose on.
+ */
+static inline JEMU_SYM(j65c02_bus) JEMU_SYM(j65c02_trace_interposed_bus)(
+    JEMU_SYM(j65c02)* inst, int flags)
+{
+    JEMU_SYM(j65c02_bus) bus;
+
+    if (flags & JEMU_TRACE_FLAG_CONTROL_FLOW)
+    {
+        return JEMU_SYM(j65c02_input_bus)(inst);
+    }
+
+    bus.read = &inst->read;
+    bus.write = &inst->write;
+    bus.context = &inst->user_context;
+
+    return bus;
+}
+
+/**
+ * \brief Compress a chunk.
+ *
+ * \param out               The buffer to which the compressed chunk is
+ *                          written, which must hold JEMU_TRACE_STORED_MAX
+ *                          bytes.
+ * \param in                The chunk to compress.
+ * \param size              The size of the chunk, up to JEMU_TRACE_CHUNK_SIZE.
+ * \param table             The match table.
+ *
+ * \returns the size of the compressed chunk.
+ */
+size_t JEMU_SYM(j65c02_trace_compress)(
+    uint8_t* out, const uint8_t* in, size_t size, uint16_t* table);
+
+/**
+ * \brief Decompress a chunk.
+ *
+ * \param out               The buffer to which the chunk is written.
+ * \param size              The size of the chunk.
+ * \param in                The compressed chunk.
+ * \param in_size           The size of the compressed chunk.
+ *
+ * \returns true on success, or false if the compressed chunk is malformed or
+ * does not decompress to exactly size bytes.
+ */
+bool JEMU_SYM(j65c02_trace_decompress)(
+    uint8_t* out, size_t size, const uint8_t* in, size_t in_size);
+
+/**
+ * \brief Write every published chunk of a trace to the sink of its writer.
+ *
+ * \note This is called by the writer thread, or by the traced instance when
+ * the host does not support threads. After the first sink error, chunks are
+ * dropped.
+ *
+ * \param writer            The writer for this operation.
+ * \param trace             The trace to drain.
+ */
+void JEMU_SYM(j65c02_trace_writer_drain)(
+    JEMU_SYM(j65c02_trace_writer)* writer, JEMU_SYM(j65c02_trace)* trace);
+
+#if JEMU_THREADS_ENABLED
+/**
+ * \brief The entry point for the writer thread.
+ *
+ * \param arg               The writer for this thread.
+ *
+ * \returns NULL.
+ */
+void* JEMU_SYM(j65c02_trace_writer_thread)(void* arg);
+#endif
+
+/**
+ * \brief Read the next block of a trace into a reader.
+ *
+ * \param reader            The reader for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TRACE_END at the end of the trace.
+ *      - JEMU_ERROR_TRACE_BAD_STREAM if the trace is malformed.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_reader_block_read)(
+    JEMU_SYM(j65c02_trace_reader)* reader);
+
+/**
+ * \brief Read the next record of the rebuilt stream.
+ *
+ * \note On failure, next_status is set to JEMU_ERROR_REPLAY_EXHAUSTED at the
+ * end of the trace, or to JEMU_ERROR_TRACE_BAD_STREAM if the trace is
+ * malformed or is not a control flow trace.
+ *
+ * \param rebuilder         The rebuilder for this operation.
+ */
+void JEMU_SYM(j65c02_trace_rebuilder_advance)(
+    JEMU_SYM(j65c02_trace_rebuilder)* rebuilder);
+
+/**
+ * \brief Check and consume the jump record of the instruction being rebuilt,
+ * if it has one.
+ *
+ * \param rebuilder         The rebuilder for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_DIVERGED if the jump went elsewhere.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_rebuilder_jump)(
+    JEMU_SYM(j65c02_trace_rebuilder)* rebuilder);
+
+/**
+ * \brief The read callback installed by a trace rebuild.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_trace_rebuilder_read)(
+    void* context, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief The write callback installed by a trace rebuild.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_trace_rebuilder_write)(
+    void* context, uint16_t addr, uint8_t val);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_JEMU_IMPORT_jemu65c02_trace_internal_sym(sym) \
+    JEMU_BEGIN_EXPORT \
+    typedef JEMU_SYM(j65c02_trace_chunk) sym ## j65c02_trace_chunk; \
+    typedef JEMU_SYM(j65c02_trace_rebuilder) sym ## j65c02_trace_rebuilder; \
+    JEMU_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define JEMU_IMPORT_jemu65c02_trace_internal_as(sym) \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_trace_internal_sym(sym ## _)
+#define JEMU_IMPORT_jemu65c02_trace_internal \
+    __INTERNAL_JEMU_IMPORT_jemu65c02_trace_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,156 @@
+/**
+ * \file j65c02_trace_reader_block_read.c
+ *
+ * \brief Read the next block of a trace.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_replay_internal.h"
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Read exactly size bytes from the source of a reader.
+ *
+ * \returns true on success, or false if the source ended first.
+ */
+static bool source_read(
+    JEMU_SYM(j65c02_trace_reader)* reader, uint8_t* data, size_t size)
+{
+    while (size > 0)
+    {
+        size_t read_size = reader->source(reader->context, data, size);
+        if (0 == read_size)
+        {
+            return false;
+        }
+
+        data += read_size;
+        size -= read_size;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Read an unsigned LEB128 value from the source of a reader.
+ *
+ * \param reader            The reader for this operation.
+ * \param val               Pointer to be set to the value on success.
+ * \param at_end            The status to return if the source ends before the
+ *                          first byte of this value.
+ *
+ * \returns STATUS_SUCCESS, at_end, or JEMU_ERROR_TRACE_BAD_STREAM.
+ */
+static JEMU_SYM(status) varint_read(
+    JEMU_SYM(j65c02_trace_reader)* reader, uint64_t* val,
+    JEMU_SYM(status) at_end)
+{
+    uint8_t byte;
+
+    *val = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        if (!source_read(reader, &byte, 1))
+        {
+            return at_end;
+        }
+
+        *val |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            return STATUS_SUCCESS;
+        }
+
+        /* the source may only end between blocks. */
+        at_end = JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    return JEMU_ERROR_TRACE_BAD_STREAM;
+}
+
+/**
+ * \brief Read the next block of a trace into a reader.
+ *
+ * \param reader            The reader for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TRACE_END at the end of the trace.
+ *      - JEMU_ERROR_TRACE_BAD_STREAM if the trace is malformed.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_reader_block_read)(
+    JEMU_SYM(j65c02_trace_reader)* reader)
+{
+    status retval;
+    uint64_t stream, size, stored;
+
+    /* read the block header. */
+    retval = varint_read(reader, &stream, JEMU_ERROR_TRACE_END);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = varint_read(reader, &size, JEMU_ERROR_TRACE_BAD_STREAM);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = varint_read(reader, &stored, JEMU_ERROR_TRACE_BAD_STREAM);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (stream > UINT32_MAX
+     || 0 == size || size > JEMU_TRACE_CHUNK_SIZE || stored > size)
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    /* read the chunk, decompressing it if needed. */
+    if (!source_read(reader, reader->stored, (size_t)stored))
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    if (stored == size)
+    {
+        memcpy(reader->chunk, reader->stored, (size_t)size);
+    }
+    else if (
+        !JEMU_SYM(j65c02_trace_decompress)(
+            reader->chunk, (size_t)size, reader->stored, (size_t)stored))
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    /* the chunk starts with its base cycle count and position. */
+    reader->size = (size_t)size;
+    reader->pos = 0;
+    if (!JEMU_SYM(j65c02_replay_varint_decode)(
+            reader->chunk, reader->size, &reader->pos,
+            &reader->last.cycle_count)
+     || !JEMU_SYM(j65c02_replay_varint_decode)(
+            reader->chunk, reader->size, &reader->pos,
+            &reader->next_position))
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    /* the delta state starts over with each chunk. */
+    reader->last.stream = (uint32_t)stream;
+    reader->state_valid = false;
+    reader->bus_addr = 0xFFFF;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,88 @@
+/**
+ * \file j65c02_trace_reader_create.c
+ *
+ * \brief Create a trace reader.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Create a trace reader.
+ *
+ * \note On success, the caller is given ownership of the reader and must
+ * release it by calling \ref j65c02_trace_reader_release when it is no longer
+ * needed.
+ *
+ * \param reader            Pointer to the reader pointer to set to the created
+ *                          reader on success.
+ * \param source            The source from which trace output is read.
+ * \param context           The user context to be passed to the source.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TRACE_BAD_STREAM if the source is not a trace.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_reader_create)(
+    JEMU_SYM(j65c02_trace_reader)** reader,
+    JEMU_SYM(j65c02_trace_source_fn) source, void* context)
+{
+    status retval, release_retval;
+    j65c02_trace_reader* tmp;
+    uint8_t header[JEMU_TRACE_HEADER_SIZE];
+    size_t size = 0, read_size;
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->source = source;
+    tmp->context = context;
+
+    /* read and verify the trace header. */
+    while (size < sizeof(header))
+    {
+        read_size = source(context, header + size, sizeof(header) - size);
+        if (0 == read_size)
+        {
+            break;
+        }
+
+        size += read_size;
+    }
+
+    if (size < sizeof(header)
+     || memcmp(header, JEMU_TRACE_MAGIC, JEMU_TRACE_MAGIC_SIZE)
+     || JEMU_TRACE_VERSION != header[JEMU_TRACE_MAGIC_SIZE])
+    {
+        retval = JEMU_ERROR_TRACE_BAD_STREAM;
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *reader = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_tmp:
+    release_retval = j65c02_trace_reader_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
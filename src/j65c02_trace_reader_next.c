@@ -0,0 +1,287 @@
+/**
+ * \file j65c02_trace_reader_next.c
+ *
+ * \brief Read the next record from a trace.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_replay_internal.h"
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Decode a bus record.
+ */
+static JEMU_SYM(status) bus_decode(
+    JEMU_SYM(j65c02_trace_reader)* reader, uint8_t header)
+{
+    const uint8_t* data = reader->chunk + reader->pos;
+    size_t left = reader->size - reader->pos;
+    size_t addr_size;
+    uint16_t addr;
+
+    switch (header & JEMU_TRACE_ADDR_MASK)
+    {
+        case JEMU_TRACE_ADDR_NEXT:
+            addr_size = 0;
+            break;
+
+        case JEMU_TRACE_ADDR_ZERO_PAGE:
+            addr_size = 1;
+            break;
+
+        case JEMU_TRACE_ADDR_ABS:
+            addr_size = 2;
+            break;
+
+        default:
+            return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    if (left < addr_size + 1)
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    if (0 == addr_size)
+    {
+        addr = reader->bus_addr + 1;
+    }
+    else if (1 == addr_size)
+    {
+        addr = data[0];
+    }
+    else
+    {
+        addr = (uint16_t)(data[0] | (data[1] << 8));
+    }
+
+    reader->last.type =
+        (header & JEMU_TRACE_BUS_WRITE)
+            ? JEMU_TRACE_RECORD_WRITE : JEMU_TRACE_RECORD_READ;
+    reader->last.addr = addr;
+    reader->last.value = data[addr_size];
+    reader->bus_addr = addr;
+    reader->pos += addr_size + 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Decode a control record.
+ */
+static JEMU_SYM(status) control_decode(
+    JEMU_SYM(j65c02_trace_reader)* reader, uint8_t header)
+{
+    j65c02_trace_record* last = &reader->last;
+    int type = JEMU_TRACE_RECORD_JUMP + (header & JEMU_TRACE_CONTROL_MASK);
+    uint64_t skipped, cycles;
+
+    if (type > JEMU_TRACE_RECORD_END
+     || !JEMU_SYM(j65c02_replay_varint_decode)(
+            reader->chunk, reader->size, &reader->pos, &skipped)
+     || !JEMU_SYM(j65c02_replay_varint_decode)(
+            reader->chunk, reader->size, &reader->pos, &cycles))
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    last->type = type;
+    last->position = reader->next_position + skipped;
+    last->cycle_count += cycles;
+    reader->next_position = last->position;
+
+    /* a jump also stands for the instruction at its target. */
+    if (JEMU_TRACE_RECORD_JUMP == type)
+    {
+        if (reader->size - reader->pos < 2)
+        {
+            return JEMU_ERROR_TRACE_BAD_STREAM;
+        }
+
+        last->reg_pc =
+            (uint16_t)(
+                reader->chunk[reader->pos]
+              | (reader->chunk[reader->pos + 1] << 8));
+        reader->pos += 2;
+        ++reader->next_position;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Decode an instruction record.
+ */
+static JEMU_SYM(status) instruction_decode(
+    JEMU_SYM(j65c02_trace_reader)* reader, uint8_t header)
+{
+    j65c02_trace_record* last = &reader->last;
+    const uint8_t* data = reader->chunk;
+    size_t pos = reader->pos;
+    size_t size = reader->size;
+    uint8_t mode = header & JEMU_TRACE_PC_MASK;
+    uint64_t cycles;
+    uint8_t length;
+
+    /* without a previous instruction, every register must be present. */
+    if (!reader->state_valid
+     && ((JEMU_TRACE_REG_ALL != (header & JEMU_TRACE_REG_ALL))
+      || JEMU_TRACE_PC_NEXT == mode || JEMU_TRACE_PC_REL == mode))
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    if (!JEMU_SYM(j65c02_replay_varint_decode)(data, size, &pos, &cycles))
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    /* decode the program counter, then the opcode. */
+    switch (mode)
+    {
+        case JEMU_TRACE_PC_NEXT:
+            if (pos >= size)
+            {
+                return JEMU_ERROR_TRACE_BAD_STREAM;
+            }
+            last->reg_pc = reader->next_pc;
+            break;
+
+        case JEMU_TRACE_PC_REL:
+            if (size - pos < 2)
+            {
+                return JEMU_ERROR_TRACE_BAD_STREAM;
+            }
+            last->reg_pc =
+                reader->next_pc
+              + ((data[pos] & 0x80) ? (0xFF00 | data[pos]) : data[pos]);
+            pos += 1;
+            break;
+
+        default:
+            if (size - pos < 3)
+            {
+                return JEMU_ERROR_TRACE_BAD_STREAM;
+            }
+            last->reg_pc = (uint16_t)(data[pos] | (data[pos + 1] << 8));
+            pos += 2;
+            break;
+    }
+
+    last->type = JEMU_TRACE_RECORD_INSTRUCTION;
+    last->position = reader->next_position++;
+    last->cycle_count += cycles;
+    last->opcode = data[pos++];
+    length = JEMU_SYM(global_j65c02_instruction_lengths)[last->opcode];
+
+    /* the operands. */
+    last->operand_count =
+        (JEMU_TRACE_PC_ABS_NO_OPERANDS == mode) ? 0 : length - 1;
+    if (size - pos < last->operand_count)
+    {
+        return JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    for (uint8_t i = 0; i < last->operand_count; ++i)
+    {
+        last->operands[i] = data[pos++];
+    }
+
+    /* the registers that changed. */
+    for (uint8_t bit = JEMU_TRACE_REG_A; bit <= JEMU_TRACE_REG_STATUS;
+         bit <<= 1)
+    {
+        uint8_t* reg;
+
+        if (!(header & bit))
+        {
+            continue;
+        }
+
+        if (pos >= size)
+        {
+            return JEMU_ERROR_TRACE_BAD_STREAM;
+        }
+
+        switch (bit)
+        {
+            case JEMU_TRACE_REG_A:  reg = &last->reg_a;         break;
+            case JEMU_TRACE_REG_X:  reg = &last->reg_x;         break;
+            case JEMU_TRACE_REG_Y:  reg = &last->reg_y;         break;
+            case JEMU_TRACE_REG_SP: reg = &last->reg_sp;        break;
+            default:                reg = &last->reg_status;    break;
+        }
+
+        *reg = data[pos++];
+    }
+
+    reader->next_pc = last->reg_pc + length;
+    reader->state_valid = true;
+    reader->pos = pos;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the next record from a trace.
+ *
+ * \note The records of each stream are in the order they were made. Records
+ * of different streams are interleaved a chunk at a time. With
+ * JEMU_TRACE_FLAG_BUS, the opcode fetch of an instruction is the read just
+ * before its instruction record.
+ *
+ * \param reader            The reader for this operation.
+ * \param record            The record to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_TRACE_END at the end of the trace.
+ *      - JEMU_ERROR_TRACE_BAD_STREAM if the trace is malformed.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_reader_next)(
+    JEMU_SYM(j65c02_trace_reader)* reader,
+    JEMU_SYM(j65c02_trace_record)* record)
+{
+    status retval;
+    uint8_t header;
+
+    /* move on to the next block when this one is used up. */
+    while (reader->pos >= reader->size)
+    {
+        retval = JEMU_SYM(j65c02_trace_reader_block_read)(reader);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    header = reader->chunk[reader->pos++];
+    if ((JEMU_TRACE_BUS | JEMU_TRACE_CONTROL)
+            == (header & (JEMU_TRACE_BUS | JEMU_TRACE_CONTROL)))
+    {
+        retval = control_decode(reader, header);
+    }
+    else if (header & JEMU_TRACE_BUS)
+    {
+        retval = bus_decode(reader, header);
+    }
+    else
+    {
+        retval = instruction_decode(reader, header);
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *record = reader->last;
+
+    return STATUS_SUCCESS;
+}
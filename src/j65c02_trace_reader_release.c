@@ -0,0 +1,36 @@
+/**
+ * \file j65c02_trace_reader_release.c
+ *
+ * \brief Release a trace reader.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+
+/**
+ * \brief Release a trace reader.
+ *
+ * \note After this call, the reader pointer is no longer valid.
+ *
+ * \param reader            The reader to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_reader_release)(JEMU_SYM(j65c02_trace_reader)* reader)
+{
+    /* clear and free the reader. */
+    memset(reader, 0, sizeof(*reader));
+    free(reader);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,246 @@
+/**
+ * \file j65c02_trace_rebuild.c
+ *
+ * \brief Rebuild a full trace from a control flow trace.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_trace;
+JEMU_IMPORT_jemu65c02_trace_internal;
+
+static status deliver(j65c02_trace_rebuilder* rebuilder);
+static status rebuild(j65c02_trace_rebuilder* rebuilder);
+
+/**
+ * \brief Rebuild the full trace of an instance from its control flow trace.
+ *
+ * \note The instance must be in the same state as the traced instance was when
+ * its trace was created, for instance by restoring a snapshot, and must have
+ * the same memory regions. It is run until the end record of the stream, and
+ * is traced while it runs by a new trace with the given writer and flags. Reads
+ * from outside the registered memory regions are answered from the control
+ * flow trace, and writes there are dropped, so the devices of the instance are
+ * never touched. A DMA controller on the instance runs the transfers of the
+ * traced run again, and takes its own IRQs. Other interrupts are delivered
+ * where they were taken.
+ *
+ * \param reader            The reader for the control flow trace.
+ * \param stream            The stream of the traced instance.
+ * \param inst              The instance to run.
+ * \param writer            The writer of the rebuilt trace.
+ * \param flags             Zero or more JEMU_TRACE_FLAG_* values for the
+ *                          rebuilt trace.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_EXHAUSTED if the stream ends early.
+ *      - JEMU_ERROR_REPLAY_DIVERGED if the instance no longer follows the
+ *        control flow trace.
+ *      - the error returned by the last instruction, if it failed when
+ *        traced.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_rebuild)(
+    JEMU_SYM(j65c02_trace_reader)* reader, uint32_t stream,
+    JEMU_SYM(j65c02)* inst, JEMU_SYM(j65c02_trace_writer)* writer, int flags)
+{
+    status retval, release_retval;
+    j65c02_trace_rebuilder rebuilder;
+    j65c02_trace* trace;
+    j65c02_bus bus = j65c02_input_bus(inst);
+
+    memset(&rebuilder, 0, sizeof(rebuilder));
+    rebuilder.reader = reader;
+    rebuilder.stream = stream;
+    rebuilder.inst = inst;
+    JEMU_SYM(j65c02_trace_rebuilder_advance)(&rebuilder);
+
+    /* interpose on the bus beneath the rebuilt trace, so it sees the reads
+     * supplied by the control flow trace, and beneath any DMA controller, so
+     * that the controller still runs the transfers of the traced run. */
+    rebuilder.read = *bus.read;
+    rebuilder.write = *bus.write;
+    rebuilder.context = *bus.context;
+    *bus.read = &JEMU_SYM(j65c02_trace_rebuilder_read);
+    *bus.write = &JEMU_SYM(j65c02_trace_rebuilder_write);
+    *bus.context = &rebuilder;
+
+    retval = j65c02_trace_create(&trace, writer, inst, flags);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto restore_bus;
+    }
+
+    retval = rebuild(&rebuilder);
+
+    release_retval = j65c02_trace_release(trace);
+    if (STATUS_SUCCESS != release_retval && STATUS_SUCCESS == retval)
+    {
+        retval = release_retval;
+    }
+
+restore_bus:
+    *bus.read = rebuilder.read;
+    *bus.write = rebuilder.write;
+    *bus.context = rebuilder.context;
+
+    return retval;
+}
+
+/**
+ * \brief Run the instance until the end record of the stream.
+ */
+static status rebuild(j65c02_trace_rebuilder* rebuilder)
+{
+    status retval, jump_retval;
+    j65c02* inst = rebuilder->inst;
+    const j65c02_memory_region* region;
+    uint16_t expected = inst->reg_pc;
+    bool expected_valid = true;
+    uint64_t dma_irqs;
+
+    for (;;)
+    {
+        /* deliver the events signalled before this instruction. */
+        retval = deliver(rebuilder);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = rebuilder->next_status;
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* the trace ends here. */
+        if (JEMU_TRACE_RECORD_END == rebuilder->next.type
+         && rebuilder->position == rebuilder->next.position)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        /* a control record was passed by, or only an event could wake the
+         * processor. */
+        if ((JEMU_TRACE_RECORD_READ != rebuilder->next.type
+          && rebuilder->next.position < rebuilder->position)
+         || inst->stopped || inst->wait)
+        {
+            return JEMU_ERROR_REPLAY_DIVERGED;
+        }
+
+        /* find where this instruction ends, if it is in memory. */
+        rebuilder->pc = inst->reg_pc;
+        rebuilder->jumped = false;
+        region = j65c02_memory_region_find(inst, rebuilder->pc);
+
+        dma_irqs = NULL != inst->dma ? inst->dma->irq_count : 0;
+        retval = j65c02_step(inst);
+        if (STATUS_SUCCESS != rebuilder->error)
+        {
+            return rebuilder->error;
+        }
+
+        /* the DMA controller takes its IRQ again as it did in the traced run,
+         * so the records of those IRQs are not delivered. */
+        if (NULL != inst->dma)
+        {
+            rebuilder->dma_irqs += inst->dma->irq_count - dma_irqs;
+        }
+
+        /* an instruction that does not follow the one before must say so. */
+        jump_retval = JEMU_SYM(j65c02_trace_rebuilder_jump)(rebuilder);
+        if (STATUS_SUCCESS != jump_retval)
+        {
+            return jump_retval;
+        }
+
+        if (!rebuilder->jumped && expected_valid
+         && rebuilder->pc != expected)
+        {
+            return JEMU_ERROR_REPLAY_DIVERGED;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        ++rebuilder->position;
+
+        /* an instruction fetched from memory is followed by the next one. */
+        expected_valid = (NULL != region);
+        if (expected_valid)
+        {
+            expected =
+                rebuilder->pc
+              + JEMU_SYM(global_j65c02_instruction_lengths)[
+                    region->mem[(uint16_t)(rebuilder->pc - region->base)]];
+        }
+    }
+}
+
+/**
+ * \brief Deliver the events signalled at the current position.
+ */
+static status deliver(j65c02_trace_rebuilder* rebuilder)
+{
+    status retval;
+    int type;
+
+    while (
+        STATUS_SUCCESS == rebuilder->next_status
+     && rebuilder->position == rebuilder->next.position
+     && JEMU_TRACE_RECORD_IRQ <= rebuilder->next.type
+     && JEMU_TRACE_RECORD_RESET >= rebuilder->next.type)
+    {
+        type = rebuilder->next.type;
+        JEMU_SYM(j65c02_trace_rebuilder_advance)(rebuilder);
+
+        switch (type)
+        {
+            case JEMU_TRACE_RECORD_IRQ:
+                if (rebuilder->dma_irqs > 0)
+                {
+                    /* the DMA controller already took this IRQ. */
+                    --rebuilder->dma_irqs;
+                    retval = STATUS_SUCCESS;
+                }
+                else
+                {
+                    retval = j65c02_interrupt(rebuilder->inst);
+                }
+                break;
+
+            case JEMU_TRACE_RECORD_NMI:
+                retval = j65c02_nmi(rebuilder->inst);
+                break;
+
+            default:
+                retval = j65c02_reset(rebuilder->inst);
+                break;
+        }
+
+        if (STATUS_SUCCESS != rebuilder->error)
+        {
+            return rebuilder->error;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
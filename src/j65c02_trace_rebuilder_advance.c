@@ -0,0 +1,50 @@
+/**
+ * \file j65c02_trace_rebuilder_advance.c
+ *
+ * \brief Read the next record of a rebuilt stream.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Read the next record of the rebuilt stream.
+ *
+ * \note On failure, next_status is set to JEMU_ERROR_REPLAY_EXHAUSTED at the
+ * end of the trace, or to JEMU_ERROR_TRACE_BAD_STREAM if the trace is
+ * malformed or is not a control flow trace.
+ *
+ * \param rebuilder         The rebuilder for this operation.
+ */
+void JEMU_SYM(j65c02_trace_rebuilder_advance)(
+    JEMU_SYM(j65c02_trace_rebuilder)* rebuilder)
+{
+    status retval;
+
+    /* skip the records of other streams. */
+    do
+    {
+        retval = j65c02_trace_reader_next(rebuilder->reader, &rebuilder->next);
+    } while (
+        STATUS_SUCCESS == retval
+     && rebuilder->next.stream != rebuilder->stream);
+
+    if (JEMU_ERROR_TRACE_END == retval)
+    {
+        retval = JEMU_ERROR_REPLAY_EXHAUSTED;
+    }
+    else if (
+        STATUS_SUCCESS == retval
+     && (JEMU_TRACE_RECORD_INSTRUCTION == rebuilder->next.type
+      || JEMU_TRACE_RECORD_WRITE == rebuilder->next.type))
+    {
+        retval = JEMU_ERROR_TRACE_BAD_STREAM;
+    }
+
+    rebuilder->next_status = retval;
+}
@@ -0,0 +1,78 @@
+/**
+ * \file j65c02_trace_rebuilder_bus.c
+ *
+ * \brief The bus callbacks installed by a trace rebuild.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_trace;
+JEMU_IMPORT_jemu65c02_trace_internal;
+
+/**
+ * \brief The read callback installed by a trace rebuild.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_trace_rebuilder_read)(
+    void* context, uint16_t addr, uint8_t* val)
+{
+    j65c02_trace_rebuilder* rebuilder = (j65c02_trace_rebuilder*)context;
+    status retval;
+
+    /* memory reads rebuild themselves. */
+    if (NULL != j65c02_memory_region_find(rebuilder->inst, addr))
+    {
+        return rebuilder->read(rebuilder->context, addr, val);
+    }
+
+    /* an opcode fetched from a device is read before its jump record. */
+    retval = JEMU_SYM(j65c02_trace_rebuilder_jump)(rebuilder);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto fail;
+    }
+
+    /* device reads are answered from the trace. */
+    retval = rebuilder->next_status;
+    if (STATUS_SUCCESS != retval)
+    {
+        goto fail;
+    }
+
+    if (JEMU_TRACE_RECORD_READ != rebuilder->next.type
+     || addr != rebuilder->next.addr)
+    {
+        retval = JEMU_ERROR_REPLAY_DIVERGED;
+        goto fail;
+    }
+
+    *val = rebuilder->next.value;
+    JEMU_SYM(j65c02_trace_rebuilder_advance)(rebuilder);
+
+    return STATUS_SUCCESS;
+
+fail:
+    rebuilder->error = retval;
+    return retval;
+}
+
+/**
+ * \brief The write callback installed by a trace rebuild.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_trace_rebuilder_write)(
+    void* context, uint16_t addr, uint8_t val)
+{
+    j65c02_trace_rebuilder* rebuilder = (j65c02_trace_rebuilder*)context;
+
+    /* device writes are dropped. */
+    if (NULL == j65c02_memory_region_find(rebuilder->inst, addr))
+    {
+        return STATUS_SUCCESS;
+    }
+
+    return rebuilder->write(rebuilder->context, addr, val);
+}
@@ -0,0 +1,45 @@
+/**
+ * \file j65c02_trace_rebuilder_jump.c
+ *
+ * \brief Check the jump record of a rebuilt instruction.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Check and consume the jump record of the instruction being rebuilt,
+ * if it has one.
+ *
+ * \param rebuilder         The rebuilder for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_REPLAY_DIVERGED if the jump went elsewhere.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_rebuilder_jump)(
+    JEMU_SYM(j65c02_trace_rebuilder)* rebuilder)
+{
+    if (STATUS_SUCCESS != rebuilder->next_status
+     || JEMU_TRACE_RECORD_JUMP != rebuilder->next.type
+     || rebuilder->next.position != rebuilder->position)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    if (rebuilder->next.reg_pc != rebuilder->pc)
+    {
+        return JEMU_ERROR_REPLAY_DIVERGED;
+    }
+
+    rebuilder->jumped = true;
+    JEMU_SYM(j65c02_trace_rebuilder_advance)(rebuilder);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,91 @@
+/**
+ * \file j65c02_trace_release.c
+ *
+ * \brief Stop tracing an instance.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_internal;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Stop tracing an instance.
+ *
+ * \note This call waits until every record of this trace has been passed to
+ * the sink. After this call, the trace pointer is no longer valid.
+ *
+ * \param trace             The trace to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_release)(JEMU_SYM(j65c02_trace)* trace)
+{
+    j65c02_trace_writer* writer = trace->writer;
+    j65c02* inst = trace->inst;
+
+    /* mark the end of this trace, and hand the remaining records to the
+     * writer. */
+    JEMU_SYM(j65c02_trace_control)(trace, JEMU_TRACE_RECORD_END, 0);
+    JEMU_SYM(j65c02_trace_chunk_next)(trace);
+
+#if JEMU_THREADS_ENABLED
+    /* wait for the writer to write them. */
+    pthread_mutex_lock(&writer->lock);
+    writer->pending = true;
+    pthread_cond_signal(&writer->wake);
+    while (
+        atomic_load_explicit(&trace->head, memory_order_acquire)
+            != atomic_load_explicit(&trace->tail, memory_order_relaxed))
+    {
+        pthread_cond_wait(&writer->drained, &writer->lock);
+    }
+    pthread_mutex_unlock(&writer->lock);
+
+    pthread_mutex_lock(&writer->list_lock);
+#endif
+
+    /* remove this trace from the writer. */
+    for (j65c02_trace** link = &writer->traces; NULL != *link;
+         link = &(*link)->next)
+    {
+        if (*link == trace)
+        {
+            *link = trace->next;
+            break;
+        }
+    }
+
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_unlock(&writer->list_lock);
+#endif
+
+    /* restore the bus of the traced instance. */
+    if (trace->flags & JEMU_TRACE_FLAG_BUS)
+    {
+        j65c02_bus bus =
+            JEMU_SYM(j65c02_trace_interposed_bus)(inst, trace->flags);
+
+        *bus.read = trace->read;
+        *bus.write = trace->write;
+        *bus.context = trace->context;
+    }
+
+    inst->trace = NULL;
+
+    /* clear and free the trace. */
+    memset(trace, 0, sizeof(*trace));
+    free(trace);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,32 @@
+/**
+ * \file j65c02_trace_varint_encode.c
+ *
+ * \brief Encode an unsigned LEB128 value.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "j65c02_trace_internal.h"
+
+/**
+ * \brief Encode an unsigned LEB128 value.
+ *
+ * \param out               The buffer to which the value is written, which
+ *                          must have room for ten bytes.
+ * \param val               The value to encode.
+ *
+ * \returns a pointer just past the encoded value.
+ */
+uint8_t* JEMU_SYM(j65c02_trace_varint_encode)(uint8_t* out, uint64_t val)
+{
+    while (val >= 0x80)
+    {
+        *out++ = (uint8_t)(val | 0x80);
+        val >>= 7;
+    }
+
+    *out++ = (uint8_t)val;
+
+    return out;
+}
@@ -0,0 +1,95 @@
+/**
+ * \file j65c02_trace_writer_create.c
+ *
+ * \brief Create a trace writer.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Create a trace writer.
+ *
+ * \note On success, the caller is given ownership of the writer and must
+ * release it by calling \ref j65c02_trace_writer_release when it is no longer
+ * needed. The sink is called from the background thread, or from the traced
+ * instance's thread when the host does not support threads.
+ *
+ * \param writer            Pointer to the writer pointer to set to the created
+ *                          writer on success.
+ * \param sink              The sink to which trace output is written.
+ * \param context           The user context to be passed to the sink.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_writer_create)(
+    JEMU_SYM(j65c02_trace_writer)** writer,
+    JEMU_SYM(j65c02_trace_sink_fn) sink, void* context)
+{
+    status retval, release_retval;
+    j65c02_trace_writer* tmp;
+    const uint8_t header[JEMU_TRACE_HEADER_SIZE] = {
+        'J', '6', '5', 'T', JEMU_TRACE_VERSION };
+
+    tmp = malloc(sizeof(*tmp));
+    if (NULL == tmp)
+    {
+        return JEMU_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* clear out the structure. */
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->sink = sink;
+    tmp->context = context;
+
+#if JEMU_THREADS_ENABLED
+    pthread_mutex_init(&tmp->lock, NULL);
+    pthread_mutex_init(&tmp->list_lock, NULL);
+    pthread_cond_init(&tmp->wake, NULL);
+    pthread_cond_init(&tmp->drained, NULL);
+#endif
+
+    /* write the trace header. */
+    retval = sink(context, header, sizeof(header));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+#if JEMU_THREADS_ENABLED
+    /* start the writer thread. */
+    if (0 != pthread_create(
+                &tmp->thread, NULL, &JEMU_SYM(j65c02_trace_writer_thread),
+                tmp))
+    {
+        retval = JEMU_ERROR_THREAD_CREATE;
+        goto cleanup_tmp;
+    }
+
+    tmp->thread_started = true;
+#endif
+
+    /* success. */
+    *writer = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_tmp:
+    release_retval = j65c02_trace_writer_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,138 @@
+/**
+ * \file j65c02_trace_writer_drain.c
+ *
+ * \brief Write the published chunks of a trace, and the writer thread that
+ * does so.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+JEMU_IMPORT_jemu65c02_trace_internal;
+
+/**
+ * \brief Compress a chunk into a block and pass it to the sink.
+ *
+ * \param writer            The writer for this operation.
+ * \param stream            The stream of the trace that filled this chunk.
+ * \param chunk             The chunk to write.
+ *
+ * \returns the status returned by the sink.
+ */
+static JEMU_SYM(status) block_write(
+    JEMU_SYM(j65c02_trace_writer)* writer, uint32_t stream,
+    const JEMU_SYM(j65c02_trace_chunk)* chunk)
+{
+    uint8_t header[JEMU_TRACE_BLOCK_HEADER_MAX];
+    uint8_t* data = writer->block + JEMU_TRACE_BLOCK_HEADER_MAX;
+    uint8_t* end;
+    size_t stored, header_size;
+
+    /* store the chunk as is if it doesn't compress. */
+    stored =
+        JEMU_SYM(j65c02_trace_compress)(
+            data, chunk->data, chunk->size, writer->table);
+    if (stored >= chunk->size)
+    {
+        memcpy(data, chunk->data, chunk->size);
+        stored = chunk->size;
+    }
+
+    /* the header goes just before the stored chunk. */
+    end = JEMU_SYM(j65c02_trace_varint_encode)(header, stream);
+    end = JEMU_SYM(j65c02_trace_varint_encode)(end, chunk->size);
+    end = JEMU_SYM(j65c02_trace_varint_encode)(end, stored);
+    header_size = (size_t)(end - header);
+    memcpy(data - header_size, header, header_size);
+
+    return
+        writer->sink(writer->context, data - header_size, header_size + stored);
+}
+
+/**
+ * \brief Write every published chunk of a trace to the sink of its writer.
+ *
+ * \note This is called by the writer thread, or by the traced instance when
+ * the host does not support threads. After the first sink error, chunks are
+ * dropped.
+ *
+ * \param writer            The writer for this operation.
+ * \param trace             The trace to drain.
+ */
+void JEMU_SYM(j65c02_trace_writer_drain)(
+    JEMU_SYM(j65c02_trace_writer)* writer, JEMU_SYM(j65c02_trace)* trace)
+{
+    size_t head = atomic_load_explicit(&trace->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&trace->tail, memory_order_acquire);
+
+    while (head != tail)
+    {
+        const j65c02_trace_chunk* chunk =
+            trace->chunks + (head & (JEMU_TRACE_CHUNK_COUNT - 1));
+
+        if (STATUS_SUCCESS == writer->error)
+        {
+            writer->error = block_write(writer, trace->stream, chunk);
+        }
+
+        /* free this chunk for the traced instance. */
+        ++head;
+        atomic_store_explicit(&trace->head, head, memory_order_release);
+    }
+}
+
+#if JEMU_THREADS_ENABLED
+/**
+ * \brief The entry point for the writer thread.
+ *
+ * \note The writer sleeps until a trace publishes a chunk, then drains every
+ * trace and wakes any trace waiting for a free chunk.
+ *
+ * \param arg               The writer for this thread.
+ *
+ * \returns NULL.
+ */
+void* JEMU_SYM(j65c02_trace_writer_thread)(void* arg)
+{
+    j65c02_trace_writer* writer = (j65c02_trace_writer*)arg;
+
+    pthread_mutex_lock(&writer->lock);
+    for (;;)
+    {
+        while (!writer->pending && !writer->shutdown)
+        {
+            pthread_cond_wait(&writer->wake, &writer->lock);
+        }
+
+        /* pending chunks are written before shutting down. */
+        if (!writer->pending)
+        {
+            break;
+        }
+
+        writer->pending = false;
+        pthread_mutex_unlock(&writer->lock);
+
+        /* the list lock keeps traces from being released while drained. */
+        pthread_mutex_lock(&writer->list_lock);
+        for (j65c02_trace* trace = writer->traces; NULL != trace;
+             trace = trace->next)
+        {
+            JEMU_SYM(j65c02_trace_writer_drain)(writer, trace);
+        }
+        pthread_mutex_unlock(&writer->list_lock);
+
+        pthread_mutex_lock(&writer->lock);
+        pthread_cond_broadcast(&writer->drained);
+    }
+    pthread_mutex_unlock(&writer->lock);
+
+    return NULL;
+}
+#endif
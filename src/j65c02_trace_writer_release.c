@@ -0,0 +1,60 @@
+/**
+ * \file j65c02_trace_writer_release.c
+ *
+ * \brief Release a trace writer.
+ *
+ * \copyright 2026 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j65c02_trace_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_trace;
+
+/**
+ * \brief Release a trace writer, stopping its background thread.
+ *
+ * \note Every trace created with this writer must be released first. After
+ * this call, the writer pointer is no longer valid.
+ *
+ * \param writer            The writer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - the first error returned by the sink, if any.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_trace_writer_release)(JEMU_SYM(j65c02_trace_writer)* writer)
+{
+    status retval;
+
+#if JEMU_THREADS_ENABLED
+    /* tell the writer thread to exit, and wait for it to do so. */
+    if (writer->thread_started)
+    {
+        pthread_mutex_lock(&writer->lock);
+        writer->shutdown = true;
+        pthread_cond_signal(&writer->wake);
+        pthread_mutex_unlock(&writer->lock);
+
+        pthread_join(writer->thread, NULL);
+    }
+
+    pthread_cond_destroy(&writer->drained);
+    pthread_cond_destroy(&writer->wake);
+    pthread_mutex_destroy(&writer->list_lock);
+    pthread_mutex_destroy(&writer->lock);
+#endif
+
+    retval = writer->error;
+
+    /* clear and free the writer. */
+    memset(writer, 0, sizeof(*writer));
+    free(writer);
+
+    return retval;
+}
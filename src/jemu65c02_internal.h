@@ -9,7 +9,20 @@
 
 #pragma once
 
+#include <jemu65c02/coverage.h>
+#include <jemu65c02/debug.h>
+#include <jemu65c02/dma.h>
+#include <jemu65c02/flight_recorder.h>
+#include <jemu65c02/hle.h>
+#include <jemu65c02/hooks.h>
+#include <jemu65c02/idiom.h>
 #include <jemu65c02/jemu65c02.h>
+#include <jemu65c02/opcode.h>
+#include <jemu65c02/pool.h>
+#include <jemu65c02/profile.h>
+#include <jemu65c02/sanitizer.h>
+#include <jemu65c02/timeline.h>
+#include <jemu65c02/trace.h>
 #include <stdbool.h>
 
 /* C++ compatibility. */
@@ -33,28 +46,1077 @@ struct JEMU_SYM(j65c02_instruction)
  */
 extern JEMU_SYM(j65c02_instruction) JEMU_SYM(global_j65c02_instructions)[256];
 
+/**
+ * \brief The instrumented instruction handlers, which call the hooks of an
+ * instance around the handlers in its custom or global table.
+ */
+extern JEMU_SYM(status) (* const JEMU_SYM(global_j65c02_hooked_execs)[256])(
+    JEMU_SYM(j65c02)* inst, int* cycles);
+
+/**
+ * \brief The custom opcode handlers, which fetch the operand of a custom
+ * opcode of an instance and call its handler.
+ */
+extern JEMU_SYM(status) (* const JEMU_SYM(global_j65c02_custom_execs)[256])(
+    JEMU_SYM(j65c02)* inst, int* cycles);
+
+/**
+ * \brief The sanitized instruction handlers, which check the opcode address
+ * and the stack pointer of an instance around the handlers it would otherwise
+ * run.
+ */
+extern JEMU_SYM(status) (* const JEMU_SYM(global_j65c02_sanitized_execs)[256])(
+    JEMU_SYM(j65c02)* inst, int* cycles);
+
+/**
+ * \brief The size of a host cache line, used to align instance storage.
+ */
+#define JEMU_CACHE_LINE_SIZE                                        64
+
+/**
+ * \brief The storage backing an emulator instance.
+ */
+#define JEMU_J65C02_STORAGE_HEAP                                    0
+#define JEMU_J65C02_STORAGE_PLACEMENT                               1
+#define JEMU_J65C02_STORAGE_POOL                                    2
+
+/**
+ * \brief A region of host memory backing part of the guest address space.
+ */
+typedef struct JEMU_SYM(j65c02_memory_region) JEMU_SYM(j65c02_memory_region);
+
+struct JEMU_SYM(j65c02_memory_region)
+{
+    uint8_t* mem;
+    size_t size;
+    uint16_t base;
+};
+
+#if JEMU_PROFILE_ENABLED
+/**
+ * \brief The deepest shadow call stack kept by the profiler.
+ */
+#define JEMU_PROFILE_MAX_DEPTH                                      256
+
+/**
+ * \brief The most call paths kept by the profiler. Calls beyond this are
+ * counted against their caller.
+ */
+#define JEMU_PROFILE_MAX_CALL_PATHS                                 65536
+
+/**
+ * \brief A call path in the call graph of a profile.
+ */
+typedef struct JEMU_SYM(j65c02_profile_node) JEMU_SYM(j65c02_profile_node);
+
+struct JEMU_SYM(j65c02_profile_node)
+{
+    uint32_t parent;
+    uint32_t first_child;
+    uint32_t next_sibling;
+    uint16_t addr;
+    uint8_t kind;
+    uint64_t calls;
+    uint64_t cycles;
+};
+
+/**
+ * \brief A shadow call stack frame, holding the stack pointer as it was
+ * before the call pushed its return address.
+ */
+typedef struct JEMU_SYM(j65c02_profile_frame) JEMU_SYM(j65c02_profile_frame);
+
+struct JEMU_SYM(j65c02_profile_frame)
+{
+    uint32_t node;
+    uint8_t sp;
+};
+
+/**
+ * \brief The most nested interrupt handlers timed by the profiler. Handlers
+ * entered beyond this are counted but not timed.
+ */
+#define JEMU_PROFILE_MAX_HANDLERS                                   8
+
+/**
+ * \brief A running interrupt handler, holding the stack pointer as it was
+ * before the interrupt pushed its return address.
+ */
+typedef struct JEMU_SYM(j65c02_profile_handler)
+JEMU_SYM(j65c02_profile_handler);
+
+struct JEMU_SYM(j65c02_profile_handler)
+{
+    int source;
+    uint8_t sp;
+    uint64_t entered;
+};
+
+/**
+ * \brief The execution profile of an instance.
+ */
+typedef struct JEMU_SYM(j65c02_profile) JEMU_SYM(j65c02_profile);
+
+struct JEMU_SYM(j65c02_profile)
+{
+    uint64_t pc_instructions[65536];
+    uint64_t pc_cycles[65536];
+    uint64_t opcode_instructions[256];
+    uint64_t opcode_cycles[256];
+
+    /* the call graph; node 0 is the root, and a child always follows its
+     * parent. */
+    JEMU_SYM(j65c02_profile_node)* nodes;
+    size_t node_count;
+    size_t node_capacity;
+
+    /* the shadow call stack, and the node that cycles are counted against. */
+    size_t depth;
+    uint32_t node;
+    JEMU_SYM(j65c02_profile_frame) frames[JEMU_PROFILE_MAX_DEPTH];
+
+    /* the interrupt counters, and the handlers being timed. */
+    JEMU_SYM(j65c02_profile_interrupts)
+        interrupts[JEMU_PROFILE_INTERRUPT_SOURCES];
+    size_t handler_depth;
+    JEMU_SYM(j65c02_profile_handler) handlers[JEMU_PROFILE_MAX_HANDLERS];
+};
+#endif /* JEMU_PROFILE_ENABLED */
+
+/**
+ * \brief The kinds of breakpoint, as indexes into the debug bitmaps.
+ */
+#define JEMU_DEBUG_INDEX_EXEC                                       0
+#define JEMU_DEBUG_INDEX_READ                                       1
+#define JEMU_DEBUG_INDEX_WRITE                                      2
+#define JEMU_DEBUG_INDEXES                                          3
+
+/**
+ * \brief The limits of a compiled breakpoint condition.
+ */
+#define JEMU_DEBUG_CONDITION_MAX_OPS                                128
+#define JEMU_DEBUG_CONDITION_MAX_DEPTH                              16
+
+/**
+ * \brief The operations of a compiled breakpoint condition, which run on a
+ * stack of 64-bit values. Arithmetic wraps around, and a division or
+ * remainder by zero, or a shift by a negative count or one of 64 or more,
+ * gives zero, or -1 for a right shift of a negative value.
+ */
+#define JEMU_DEBUG_OP_PUSH                                          0x00
+#define JEMU_DEBUG_OP_A                                             0x01
+#define JEMU_DEBUG_OP_X                                             0x02
+#define JEMU_DEBUG_OP_Y                                             0x03
+#define JEMU_DEBUG_OP_SP                                            0x04
+#define JEMU_DEBUG_OP_P                                             0x05
+#define JEMU_DEBUG_OP_PC                                            0x06
+#define JEMU_DEBUG_OP_CYCLES                                        0x07
+#define JEMU_DEBUG_OP_MEM                                           0x08
+#define JEMU_DEBUG_OP_NOT                                           0x09
+#define JEMU_DEBUG_OP_NEG                                           0x0A
+#define JEMU_DEBUG_OP_INV                                           0x0B
+#define JEMU_DEBUG_OP_BOOL                                          0x0C
+#define JEMU_DEBUG_OP_ADD                                           0x0D
+#define JEMU_DEBUG_OP_SUB                                           0x0E
+#define JEMU_DEBUG_OP_AND                                           0x0F
+#define JEMU_DEBUG_OP_OR                                            0x10
+#define JEMU_DEBUG_OP_XOR                                           0x11
+#define JEMU_DEBUG_OP_EQ                                            0x12
+#define JEMU_DEBUG_OP_NE                                            0x13
+#define JEMU_DEBUG_OP_LT                                            0x14
+#define JEMU_DEBUG_OP_LE                                            0x15
+#define JEMU_DEBUG_OP_GT                                            0x16
+#define JEMU_DEBUG_OP_GE                                            0x17
+#define JEMU_DEBUG_OP_JUMP_FALSE                                    0x18
+#define JEMU_DEBUG_OP_JUMP_TRUE                                     0x19
+#define JEMU_DEBUG_OP_MUL                                           0x1A
+#define JEMU_DEBUG_OP_DIV                                           0x1B
+#define JEMU_DEBUG_OP_MOD                                           0x1C
+#define JEMU_DEBUG_OP_SHL                                           0x1D
+#define JEMU_DEBUG_OP_SHR                                           0x1E
+
+/**
+ * \brief An operation of a compiled breakpoint condition.
+ *
+ * \note The jumps leave the tested value on the stack when they are taken, and
+ * pop it otherwise, so that && and || short circuit.
+ */
+typedef struct JEMU_SYM(j65c02_debug_op) JEMU_SYM(j65c02_debug_op);
+
+struct JEMU_SYM(j65c02_debug_op)
+{
+    uint8_t op;
+    int64_t imm;
+};
+
+/**
+ * \brief A compiled condition on the breakpoints at an address.
+ *
+ * \note The operations follow the condition in the same allocation.
+ */
+typedef struct JEMU_SYM(j65c02_debug_condition)
+JEMU_SYM(j65c02_debug_condition);
+
+struct JEMU_SYM(j65c02_debug_condition)
+{
+    JEMU_SYM(j65c02_debug_condition)* next;
+    uint16_t addr;
+    size_t count;
+    JEMU_SYM(j65c02_debug_op)* ops;
+};
+
+/**
+ * \brief The breakpoints of an instance.
+ *
+ * \note Each kind of breakpoint has a bitmap with one bit per address, and a
+ * count of the bits set in each page, so that a page without breakpoints is
+ * skipped with a single load.
+ */
+typedef struct JEMU_SYM(j65c02_debug) JEMU_SYM(j65c02_debug);
+
+struct JEMU_SYM(j65c02_debug)
+{
+    uint16_t page_counts[JEMU_DEBUG_INDEXES][256];
+    uint8_t bits[JEMU_DEBUG_INDEXES][65536 / 8];
+
+    /* the instance, and the start of the instruction it is running. */
+    JEMU_SYM(j65c02)* inst;
+    uint16_t pc;
+
+    /* the conditions on breakpoints, checked only when one fires. */
+    JEMU_SYM(j65c02_debug_condition)* conditions;
+
+    /* the last hit, and whether a watchpoint fired in this instruction. */
+    JEMU_SYM(j65c02_breakpoint_hit) hit;
+    bool has_hit;
+    bool triggered;
+
+    /* the execution breakpoint that last stopped a run, which the next run
+     * steps over if nothing has run since. */
+    uint16_t resume_pc;
+    uint64_t resume_cycles;
+
+    /* the bus callbacks wrapped by the watchpoints. */
+    bool interposed;
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* context;
+};
+
+/**
+ * \brief A custom opcode.
+ */
+typedef struct JEMU_SYM(j65c02_custom_opcode) JEMU_SYM(j65c02_custom_opcode);
+
+struct JEMU_SYM(j65c02_custom_opcode)
+{
+    JEMU_SYM(j65c02_opcode_fn) fn;
+    void* context;
+    int operand_length;
+    int cycles;
+};
+
+/**
+ * \brief The custom opcodes of an instance, and the dispatch table that holds
+ * them in place of the global table.
+ */
+typedef struct JEMU_SYM(j65c02_custom) JEMU_SYM(j65c02_custom);
+
+struct JEMU_SYM(j65c02_custom)
+{
+    JEMU_SYM(j65c02_instruction) instructions[256];
+    JEMU_SYM(j65c02_custom_opcode) opcodes[256];
+};
+
+/**
+ * \brief A native routine registered at a guest address.
+ */
+typedef struct JEMU_SYM(j65c02_hle_entry) JEMU_SYM(j65c02_hle_entry);
+
+struct JEMU_SYM(j65c02_hle_entry)
+{
+    JEMU_SYM(j65c02_hle_fn) fn;
+    void* context;
+    int cycles;
+};
+
+/**
+ * \brief The native routines of an instance.
+ *
+ * \note The bitmap has one bit per guest address, so that an address without
+ * a routine is skipped with a single test. The routines themselves are kept
+ * in a table per page, allocated when the first routine in that page is set.
+ */
+typedef struct JEMU_SYM(j65c02_hle) JEMU_SYM(j65c02_hle);
+
+struct JEMU_SYM(j65c02_hle)
+{
+    uint8_t bits[65536 / 8];
+    JEMU_SYM(j65c02_hle_entry)* pages[256];
+};
+
+/**
+ * \brief A DMA controller.
+ */
+struct JEMU_SYM(j65c02_dma)
+{
+    JEMU_SYM(j65c02)* inst;
+    uint16_t base;
+    int cycles_per_byte;
+
+    /* the transfers run, and the IRQs taken from the controller. */
+    uint64_t transfer_count;
+    uint64_t irq_count;
+
+    /* the registers, whether a transfer waits for its instruction to
+     * finish, and whether the IRQ line is held until the status register is
+     * written. */
+    uint8_t registers[JEMU_DMA_REGISTER_COUNT];
+    bool pending;
+    bool irq;
+
+    /* the bus callbacks wrapped by the controller. */
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* context;
+};
+
+/**
+ * \brief The sanitizer of an instance.
+ *
+ * \note The sanitized dispatch table lives in the same allocation as the
+ * shadow memory.
+ */
+typedef struct JEMU_SYM(j65c02_sanitizer) JEMU_SYM(j65c02_sanitizer);
+
+struct JEMU_SYM(j65c02_sanitizer)
+{
+    uint8_t shadow[65536];
+    JEMU_SYM(j65c02_instruction) instructions[256];
+
+    /* the instance, and the instruction it is running, if any. */
+    JEMU_SYM(j65c02)* inst;
+    uint16_t pc;
+    bool running;
+
+    /* the last violation. */
+    JEMU_SYM(j65c02_sanitizer_report) report;
+    bool has_report;
+
+    /* the bus callbacks wrapped by the sanitizer. */
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* context;
+};
+
+/**
+ * \brief A track of a timeline, defined in j65c02_timeline_internal.h.
+ */
+typedef struct JEMU_SYM(j65c02_timeline_track) JEMU_SYM(j65c02_timeline_track);
+
 /**
  * \brief The emulator instance.
+ *
+ * \note Fields touched by every instruction are grouped at the start of this
+ * structure so that they share the first cache line of the instance; this is
+ * checked when j65c02_run.c is built.
  */
 struct JEMU_SYM(j65c02)
 {
-    int personality;
-    int emulation_mode;
+    /* hot fields. */
+    JEMU_SYM(j65c02_read_fn) read;
+    JEMU_SYM(j65c02_write_fn) write;
+    void* user_context;
+    const JEMU_SYM(j65c02_instruction)* instructions;
+    uint64_t cycle_count;
+    int cycle_delta;
+    uint16_t reg_pc;
     uint8_t reg_a;
     uint8_t reg_x;
     uint8_t reg_y;
     uint8_t reg_sp;
     uint8_t reg_status;
-    uint16_t reg_pc;
-    int cycle_delta;
-    JEMU_SYM(j65c02_read_fn) read;
-    JEMU_SYM(j65c02_write_fn) write;
-    void* user_context;
     bool stopped;
     bool wait;
     bool crash;
+    bool idioms;
+    bool opcode_pending;
+    uint8_t pending_opcode;
+
+    /* cold fields. */
+
+    /* the optional features, checked once per run by the plain run loop. */
+    JEMU_SYM(j65c02_flight_entry)* flight;
+    JEMU_SYM(j65c02_trace)* trace;
+    JEMU_SYM(j65c02_debug)* debug;
+    JEMU_SYM(j65c02_hle)* hle;
+    JEMU_SYM(j65c02_dma)* dma;
+    uint8_t* coverage;
+#if JEMU_PROFILE_ENABLED
+    JEMU_SYM(j65c02_profile)* profile;
+#endif /* JEMU_PROFILE_ENABLED */
+
+    int personality;
+    int emulation_mode;
+    int storage;
+    JEMU_SYM(j65c02_pool)* pool;
+    size_t region_count;
+    JEMU_SYM(j65c02_memory_region) regions[JEMU_MAX_MEMORY_REGIONS];
+
+    /* the flight recorder ring, and the region of the last opcode. */
+    size_t flight_mask;
+    uint64_t flight_count;
+    const JEMU_SYM(j65c02_memory_region)* flight_region;
+
+    /* the timeline track this instance records into. */
+    JEMU_SYM(j65c02_timeline_track)* timeline;
+
+    /* the instruction hooks, and the instrumented table that calls them. */
+    JEMU_SYM(j65c02_hook_fn) hook_pre;
+    JEMU_SYM(j65c02_hook_fn) hook_post;
+    void* hook_context;
+    JEMU_SYM(j65c02_instruction)* hooked;
+
+    /* the shadow memory and sanitized table of the sanitizer. */
+    JEMU_SYM(j65c02_sanitizer)* sanitizer;
+
+    /* the custom opcodes, and the table that holds them. */
+    JEMU_SYM(j65c02_custom)* custom;
+
+    /* the number of loops run natively. */
+    uint64_t idiom_count;
+};
+
+/**
+ * \brief An instance pool.
+ *
+ * \note The slots are carved out of the same allocation as the pool, starting
+ * on a cache line boundary, and each slot is padded to a whole number of cache
+ * lines.
+ */
+struct JEMU_SYM(j65c02_pool)
+{
+    size_t capacity;
+    size_t available;
+    size_t stride;
+    uint8_t* slots;
+    size_t* free_list;
+    bool* in_use;
+};
+
+/**
+ * \brief Return the slot backing a pool instance to its pool.
+ *
+ * \param pool              The pool that owns this instance.
+ * \param inst              The instance whose slot is returned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - JEMU_ERROR_POOL_BAD_INSTANCE if this instance is not from this pool,
+ *        or its slot is already free.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_pool_slot_free)(
+    JEMU_SYM(j65c02_pool)* pool, JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Free the allocations owned by an instance, leaving its storage.
+ *
+ * \param inst              The instance whose allocations are freed.
+ */
+void JEMU_SYM(j65c02_release_owned)(JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Find the registered memory region that holds a guest address.
+ *
+ * \param inst              The instance to search.
+ * \param addr              The guest address to find.
+ *
+ * \returns the region holding this address, or NULL if there is none.
+ */
+JEMU_SYM(j65c02_memory_region)* JEMU_SYM(j65c02_memory_region_find)(
+    JEMU_SYM(j65c02)* inst, uint16_t addr);
+
+/**
+ * \brief The length, in bytes, of each instruction.
+ */
+extern const uint8_t JEMU_SYM(global_j65c02_instruction_lengths)[256];
+
+/**
+ * \brief Whether each instruction transfers control.
+ */
+extern const uint8_t JEMU_SYM(global_j65c02_control_transfers)[256];
+
+/**
+ * \brief Count an edge in a coverage map.
+ *
+ * \param map               The coverage map of this instance.
+ * \param from              The address of the instruction transferring
+ *                          control.
+ * \param to                The address it transfers to.
+ */
+static inline void JEMU_SYM(j65c02_coverage_edge)(
+    uint8_t* map, uint16_t from, uint16_t to)
+{
+    ++map[JEMU_SYM(j65c02_coverage_index)(from, to)];
+}
+
+/**
+ * \brief Record an instruction in the flight recorder of an instance.
+ *
+ * \note This is called after the opcode is fetched and before it executes,
+ * only when the flight recorder is enabled.
+ *
+ * \param inst              The instance for this operation.
+ * \param opcode            The opcode that is about to execute.
+ */
+void JEMU_SYM(j65c02_flight_record)(JEMU_SYM(j65c02)* inst, uint8_t opcode);
+
+/**
+ * \brief Write a trace record for an instruction.
+ *
+ * \note This is called after the opcode is fetched and before it executes,
+ * only when the instance is traced.
+ *
+ * \param trace             The trace of this instance.
+ * \param opcode            The opcode that is about to execute.
+ */
+void JEMU_SYM(j65c02_trace_instruction)(
+    JEMU_SYM(j65c02_trace)* trace, uint8_t opcode);
+
+/**
+ * \brief Write a control record to a trace.
+ *
+ * \param trace             The trace for this operation.
+ * \param type              The JEMU_TRACE_RECORD_* type of this record, from
+ *                          JEMU_TRACE_RECORD_JUMP to JEMU_TRACE_RECORD_END.
+ * \param pc                The target of a jump record.
+ */
+void JEMU_SYM(j65c02_trace_control)(
+    JEMU_SYM(j65c02_trace)* trace, int type, uint16_t pc);
+
+/**
+ * \brief Record an event into a timeline track.
+ *
+ * \param track             The track for this operation.
+ * \param lane              The JEMU_TIMELINE_LANE_* lane of this event.
+ * \param phase             'B' to begin a span, 'E' to end one, or 'i' for an
+ *                          instant event.
+ * \param name              The name of this event, or NULL for an end.
+ * \param cycles            The emulated cycle count of this event.
+ */
+void JEMU_SYM(j65c02_timeline_span)(
+    JEMU_SYM(j65c02_timeline_track)* track, int lane, int phase,
+    const char* name, uint64_t cycles);
+
+/**
+ * \brief Begin a WAI period on the timeline of an instance.
+ *
+ * \note This is called only when the instance has a timeline.
+ *
+ * \param inst              The instance for this operation.
+ * \param cycles            The cycle count at which the wait begins.
+ */
+void JEMU_SYM(j65c02_timeline_wait)(JEMU_SYM(j65c02)* inst, uint64_t cycles);
+
+/**
+ * \brief End a WAI period on the timeline of an instance, if one is open.
+ *
+ * \note This is called only when the instance has a timeline.
+ *
+ * \param inst              The instance for this operation.
+ */
+void JEMU_SYM(j65c02_timeline_wake)(JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Begin an interrupt handler span on the timeline of an instance.
+ *
+ * \note This is called only when the instance has a timeline, once the
+ * interrupt has been taken, so the stack holds its return address.
+ *
+ * \param inst              The instance for this operation.
+ * \param name              The name of this handler span.
+ */
+void JEMU_SYM(j65c02_timeline_interrupt)(
+    JEMU_SYM(j65c02)* inst, const char* name);
+
+/**
+ * \brief End the interrupt handler spans returned from by an RTI on the
+ * timeline of an instance.
+ *
+ * \note This is called only when the instance has a timeline.
+ *
+ * \param inst              The instance for this operation.
+ * \param cycles            The cycles taken by the RTI.
+ */
+void JEMU_SYM(j65c02_timeline_return)(JEMU_SYM(j65c02)* inst, int cycles);
+
+/**
+ * \brief End every guest span open on the timeline of an instance, as on a
+ * reset.
+ *
+ * \note This is called only when the instance has a timeline.
+ *
+ * \param inst              The instance for this operation.
+ */
+void JEMU_SYM(j65c02_timeline_unwind)(JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Check for a breakpoint at an address.
+ *
+ * \param debug             The breakpoints of this instance.
+ * \param index             The JEMU_DEBUG_INDEX_* kind of breakpoint.
+ * \param addr              The address to check.
+ *
+ * \returns true if a breakpoint of this kind is set at this address.
+ */
+static inline bool JEMU_SYM(j65c02_debug_check)(
+    const JEMU_SYM(j65c02_debug)* debug, int index, uint16_t addr)
+{
+    return
+        0 != debug->page_counts[index][addr >> 8]
+     && 0 != (debug->bits[index][addr >> 3] & (1 << (addr & 7)));
+}
+
+/**
+ * \brief Check for an execution breakpoint at the program counter of an
+ * instance, recording the hit if there is one.
+ *
+ * \note This is called only when the page of the program counter has an
+ * execution breakpoint. The breakpoint that stopped the last run does not
+ * fire again unless the instance has run since, and a breakpoint with a
+ * condition does not fire unless it holds.
+ *
+ * \param inst              The instance for this operation.
+ *
+ * \returns true if the instance should stop before this instruction.
+ */
+bool JEMU_SYM(j65c02_debug_exec)(JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Evaluate the condition on the breakpoints at an address.
+ *
+ * \note Memory in a condition is read through the bus of the instance, beneath
+ * its watchpoints.
+ *
+ * \param debug             The breakpoints of this instance.
+ * \param addr              The address of the breakpoint that fired.
+ *
+ * \returns true if there is no condition at this address, or if it holds.
+ */
+bool JEMU_SYM(j65c02_debug_condition_eval)(
+    JEMU_SYM(j65c02_debug)* debug, uint16_t addr);
+
+/**
+ * \brief Record a watchpoint hit, unless one already fired in this instruction
+ * or its condition does not hold.
+ *
+ * \param debug             The breakpoints of this instance.
+ * \param kind              The JEMU_BREAKPOINT_* kind of watchpoint.
+ * \param addr              The address accessed.
+ * \param val               The value read or written.
+ */
+void JEMU_SYM(j65c02_debug_watch_hit)(
+    JEMU_SYM(j65c02_debug)* debug, int kind, uint16_t addr, uint8_t val);
+
+/**
+ * \brief Free the breakpoints of an instance, and their conditions.
+ *
+ * \param debug             The breakpoints to free.
+ */
+void JEMU_SYM(j65c02_debug_release)(JEMU_SYM(j65c02_debug)* debug);
+
+/**
+ * \brief The read callback installed by watchpoints.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_debug_read)(
+    void* context, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief The write callback installed by watchpoints.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_debug_write)(
+    void* context, uint16_t addr, uint8_t val);
+
+/**
+ * \brief Get the dispatch table that the hooked and sanitized tables of an
+ * instance forward to.
+ *
+ * \param inst              The instance for this operation.
+ *
+ * \returns the custom table of this instance, if it has one, or the global
+ * table.
+ */
+static inline const JEMU_SYM(j65c02_instruction)*
+JEMU_SYM(j65c02_instructions_base)(const JEMU_SYM(j65c02)* inst)
+{
+    return
+        NULL != inst->custom
+            ? inst->custom->instructions
+            : JEMU_SYM(global_j65c02_instructions);
+}
+
+/**
+ * \brief Select the dispatch table of an instance after its custom opcodes,
+ * hooks, or sanitizer change.
+ *
+ * \note The sanitized table calls the hooked table, which calls the custom
+ * or global table, and the instance dispatches through the outermost of them.
+ * The cycle budget of each wrapping table is copied from the table beneath.
+ *
+ * \param inst              The instance for this operation.
+ */
+void JEMU_SYM(j65c02_instructions_update)(JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Check for a native routine at an address.
+ *
+ * \param hle               The native routines of this instance.
+ * \param addr              The address to check.
+ *
+ * \returns true if a native routine is set at this address.
+ */
+static inline bool JEMU_SYM(j65c02_hle_check)(
+    const JEMU_SYM(j65c02_hle)* hle, uint16_t addr)
+{
+    return 0 != (hle->bits[addr >> 3] & (1 << (addr & 7)));
+}
+
+/**
+ * \brief Get the native routine at an address.
+ *
+ * \note This is called only when \ref j65c02_hle_check finds a routine.
+ *
+ * \param hle               The native routines of this instance.
+ * \param addr              The address of the routine.
+ *
+ * \returns the routine at this address.
+ */
+static inline const JEMU_SYM(j65c02_hle_entry)* JEMU_SYM(j65c02_hle_get)(
+    const JEMU_SYM(j65c02_hle)* hle, uint16_t addr)
+{
+    return hle->pages[addr >> 8] + (addr & 0xFF);
+}
+
+/**
+ * \brief Run a native routine, then return from it as an RTS would.
+ *
+ * \note The routine returns to the instruction after the JSR that called it.
+ * The cycles of the routine are charged by the caller.
+ *
+ * \param inst              The instance for this operation.
+ * \param entry             The routine to run.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure, with the program counter left at
+ *        the entry of the routine.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_hle_exec)(
+    JEMU_SYM(j65c02)* inst, const JEMU_SYM(j65c02_hle_entry)* entry);
+
+/**
+ * \brief Free the native routines of an instance.
+ *
+ * \param hle               The native routines to free.
+ */
+void JEMU_SYM(j65c02_hle_release)(JEMU_SYM(j65c02_hle)* hle);
+
+/**
+ * \brief The read callback installed by a DMA controller.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_dma_read)(
+    void* context, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief The write callback installed by a DMA controller.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_dma_write)(
+    void* context, uint16_t addr, uint8_t val);
+
+/**
+ * \brief Run the transfer started on the DMA controller of an instance, and
+ * take its IRQ if the processor accepts it.
+ *
+ * \note This is called after an instruction, only when
+ * \ref j65c02_dma_due holds. The stolen cycles are charged by the caller.
+ *
+ * \param inst              The instance for this operation.
+ * \param cycles            Set to the cycles stolen by a transfer, or zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_dma_finish)(JEMU_SYM(j65c02)* inst, int* cycles);
+
+/**
+ * \brief Check whether the DMA controller of an instance has a transfer to
+ * run or holds its IRQ line after an instruction.
+ *
+ * \param inst              The instance to check.
+ *
+ * \returns true if \ref j65c02_dma_finish must be called.
+ */
+static inline bool JEMU_SYM(j65c02_dma_due)(const JEMU_SYM(j65c02)* inst)
+{
+    return NULL != inst->dma && (inst->dma->pending || inst->dma->irq);
+}
+
+/**
+ * \brief The bus callbacks on which the input of an instance is recorded or
+ * replayed.
+ */
+typedef struct JEMU_SYM(j65c02_bus) JEMU_SYM(j65c02_bus);
+
+struct JEMU_SYM(j65c02_bus)
+{
+    JEMU_SYM(j65c02_read_fn)* read;
+    JEMU_SYM(j65c02_write_fn)* write;
+    void** context;
 };
 
+/**
+ * \brief Get the bus on which the input of an instance is recorded or
+ * replayed.
+ *
+ * \note This is the bus beneath the DMA controller of the instance, if it has
+ * one, so that the controller still answers its registers during a replay, and
+ * the device reads of its transfers are recorded.
+ *
+ * \param inst              The instance for this operation.
+ *
+ * \returns the bus callbacks to interpose on.
+ */
+static inline JEMU_SYM(j65c02_bus) JEMU_SYM(j65c02_input_bus)(
+    JEMU_SYM(j65c02)* inst)
+{
+    JEMU_SYM(j65c02_bus) bus;
+
+    if (NULL != inst->dma)
+    {
+        bus.read = &inst->dma->read;
+        bus.write = &inst->dma->write;
+        bus.context = &inst->dma->context;
+    }
+    else
+    {
+        bus.read = &inst->read;
+        bus.write = &inst->write;
+        bus.context = &inst->user_context;
+    }
+
+    return bus;
+}
+
+/**
+ * \brief Run the rest of a copy or fill loop natively.
+ *
+ * \note This is called after a BNE branches back to the head of its loop. If
+ * the loop is a recognized idiom, the iterations that fit in the cycles left
+ * are run natively, and the instance is left at the head of the loop, or
+ * after the BNE once the loop is done.
+ *
+ * \param inst              The instance for this operation.
+ * \param bne_pc            The address of the BNE.
+ * \param cycles            The cycles left in this run.
+ *
+ * \returns the cycles consumed by the iterations run natively, or zero if
+ * the loop was not run natively.
+ */
+int JEMU_SYM(j65c02_idiom_loop)(
+    JEMU_SYM(j65c02)* inst, uint16_t bne_pc, int cycles);
+
+/**
+ * \brief A function called by \ref j65c02_run_loop after each instruction or
+ * native routine that it runs.
+ *
+ * \param context           The context passed to the run loop.
+ * \param inst              The instance being run.
+ * \param exec_status       The status of the instruction, which has been
+ *                          charged its cycles if it succeeded.
+ *
+ * \returns the status with which the loop goes on; a failure ends the run.
+ */
+typedef JEMU_SYM(status) (*JEMU_SYM(j65c02_run_fn))(
+    void* context, JEMU_SYM(j65c02)* inst, JEMU_SYM(status) exec_status);
+
+/**
+ * \brief Check whether an instance has anything to do between instructions,
+ * so that \ref j65c02_run must use \ref j65c02_run_loop.
+ *
+ * \param inst              The instance to check.
+ *
+ * \returns true if the instance has debugging, instrumentation, native
+ * routines, a peripheral, or copy and fill loops enabled.
+ */
+static inline bool
+JEMU_SYM(j65c02_run_instrumented)(const JEMU_SYM(j65c02)* inst)
+{
+#if JEMU_PROFILE_ENABLED
+    if (NULL != inst->profile)
+    {
+        return true;
+    }
+#endif /* JEMU_PROFILE_ENABLED */
+
+    return
+        NULL != inst->debug || NULL != inst->hle || NULL != inst->dma
+     || NULL != inst->coverage || NULL != inst->flight || NULL != inst->trace
+     || inst->idioms;
+}
+
+/**
+ * \brief Run an instance for the given number of cycles.
+ *
+ * \note This is the instrumented loop behind \ref j65c02_run, and the loop
+ * behind history runs. With a
+ * callback, each instruction is run on its own, so copy and fill loops are not
+ * run natively.
+ *
+ * \param inst              The instance to run.
+ * \param cycles            The number of cycles to run the instance.
+ * \param executed          Optional function called after each instruction or
+ *                          native routine; may be NULL.
+ * \param context           The context passed to the callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_run_loop)(
+    JEMU_SYM(j65c02)* inst, int cycles, JEMU_SYM(j65c02_run_fn) executed,
+    void* context);
+
+/**
+ * \brief Record a sanitizer violation.
+ *
+ * \param sanitizer         The sanitizer of this instance.
+ * \param kind              The JEMU_SANITIZER_VIOLATION_* kind of violation.
+ * \param addr              The address of the violation.
+ * \param value             The value that was to be written, or zero.
+ *
+ * \returns JEMU_ERROR_SANITIZER_VIOLATION.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_sanitizer_violation)(
+    JEMU_SYM(j65c02_sanitizer)* sanitizer, int kind, uint16_t addr,
+    uint8_t value);
+
+/**
+ * \brief The read callback installed by the sanitizer.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_sanitizer_read)(
+    void* context, uint16_t addr, uint8_t* val);
+
+/**
+ * \brief The write callback installed by the sanitizer.
+ */
+JEMU_SYM(status) JEMU_SYM(j65c02_sanitizer_write)(
+    void* context, uint16_t addr, uint8_t val);
+
+#if JEMU_PROFILE_ENABLED
+/**
+ * \brief Count an executed instruction in a profile.
+ *
+ * \note The cycles are counted against the call path the instruction started
+ * in, so those of a JSR go to its caller, and those of an RTS or RTI to the
+ * routine it returns from.
+ *
+ * \param profile           The profile of this instance.
+ * \param node              The call path when the instruction started.
+ * \param pc                The address of the opcode.
+ * \param opcode            The opcode that executed.
+ * \param cycles            The cycles it took.
+ */
+static inline void JEMU_SYM(j65c02_profile_record)(
+    JEMU_SYM(j65c02_profile)* profile, uint32_t node, uint16_t pc,
+    uint8_t opcode, int cycles)
+{
+    ++profile->pc_instructions[pc];
+    profile->pc_cycles[pc] += cycles;
+    ++profile->opcode_instructions[opcode];
+    profile->opcode_cycles[opcode] += cycles;
+    profile->nodes[node].cycles += cycles;
+}
+
+/**
+ * \brief Check whether the stack has been unwound back to a frame.
+ *
+ * \note The stack pointer is compared as a signed distance from the frame, so
+ * a stack that wraps around its page still unwinds in order, as long as it
+ * holds less than 128 bytes beyond the frame.
+ *
+ * \param frame_sp          The stack pointer saved in the frame.
+ * \param sp                The current stack pointer.
+ *
+ * \returns true if the stack pointer is at or above the frame.
+ */
+static inline bool JEMU_SYM(j65c02_profile_unwound)(
+    uint8_t frame_sp, uint8_t sp)
+{
+    return (int8_t)(uint8_t)(frame_sp - sp) <= 0;
+}
+#endif /* JEMU_PROFILE_ENABLED */
+
+/**
+ * \brief Push a call onto the shadow call stack of a profiled instance.
+ *
+ * \note This is called once the call has been taken, so the program counter
+ * holds its target. It does nothing unless the instance is profiled.
+ *
+ * \param inst              The instance for this operation.
+ * \param kind              The JEMU_PROFILE_CALL_* kind of this call.
+ * \param sp                The stack pointer before the call pushed its
+ *                          return address.
+ */
+void JEMU_SYM(j65c02_profile_call)(
+    JEMU_SYM(j65c02)* inst, int kind, uint8_t sp);
+
+/**
+ * \brief Pop the calls returned from by an RTS or RTI off of the shadow call
+ * stack of a profiled instance.
+ *
+ * \note A call has returned once the stack pointer is back where it was
+ * before the call, so an RTS that only jumps through an address pushed by hand
+ * pops nothing. This does nothing unless the instance is profiled.
+ *
+ * \param inst              The instance for this operation.
+ */
+void JEMU_SYM(j65c02_profile_return)(JEMU_SYM(j65c02)* inst);
+
+/**
+ * \brief Count an interrupt raised on a profiled instance, and start timing
+ * its handler if it was taken.
+ *
+ * \note This is called once the interrupt has been taken, so the stack holds
+ * its return address, or once it has been masked. It does nothing unless the
+ * instance is profiled.
+ *
+ * \param inst              The instance for this operation.
+ * \param source            The JEMU_PROFILE_INTERRUPT_* source of this
+ *                          interrupt.
+ * \param taken             true if the handler was entered, or false if the
+ *                          interrupt was masked.
+ */
+void JEMU_SYM(j65c02_profile_interrupt)(
+    JEMU_SYM(j65c02)* inst, int source, bool taken);
+
+/**
+ * \brief Stop timing the interrupt handlers returned from by an RTI on a
+ * profiled instance.
+ *
+ * \note This does nothing unless the instance is profiled.
+ *
+ * \param inst              The instance for this operation.
+ * \param cycles            The cycles taken by the RTI, which are counted in
+ *                          the handler.
+ */
+void JEMU_SYM(j65c02_profile_interrupt_return)(
+    JEMU_SYM(j65c02)* inst, int cycles);
+
 /**
  * \brief Fetch a byte from the program counter, then increment the program
  * counter.
@@ -72,6 +1134,52 @@ JEMU_SYM(status) FN_DECL_MUST_CHECK
 JEMU_SYM(j65c02_fetch)(
     uint8_t* val, JEMU_SYM(j65c02)* inst);
 
+/**
+ * \brief Fetch an opcode, using the opcode fetched by a run that ran out of
+ * cycles before it could execute it, if there is one.
+ *
+ * \note A run that can't afford an instruction leaves the program counter at
+ * its opcode and keeps the opcode pending, so that the bus sees each opcode
+ * read once.
+ *
+ * \param ins               Pointer to hold the opcode.
+ * \param inst              The emulator instance on which this operation is
+ *                          performed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static inline JEMU_SYM(status) FN_DECL_MUST_CHECK
+JEMU_SYM(j65c02_opcode_fetch)(uint8_t* ins, JEMU_SYM(j65c02)* inst)
+{
+    if (inst->opcode_pending)
+    {
+        inst->opcode_pending = false;
+        *ins = inst->pending_opcode;
+        inst->reg_pc += 1;
+
+        return STATUS_SUCCESS;
+    }
+
+    return JEMU_SYM(j65c02_fetch)(ins, inst);
+}
+
+/**
+ * \brief Keep an opcode that a run fetched but can't afford to execute.
+ *
+ * \param inst              The emulator instance on which this operation is
+ *                          performed.
+ * \param ins               The opcode fetched.
+ */
+static inline void
+JEMU_SYM(j65c02_opcode_keep)(JEMU_SYM(j65c02)* inst, uint8_t ins)
+{
+    inst->reg_pc -= 1;
+    inst->pending_opcode = ins;
+    inst->opcode_pending = true;
+}
+
 /**
  * \brief Push a value onto the stack, decrementing the stack pointer after.
  *
@@ -2965,10 +4073,136 @@ JEMU_SYM(status) JEMU_SYM(j65c02_inst_WAI)(
 #define __INTERNAL_JEMU_IMPORT_jemu65c02_internal_sym(sym) \
     JEMU_BEGIN_EXPORT \
     typedef JEMU_SYM(j65c02_instruction) sym ## j65c02_instruction; \
+    typedef JEMU_SYM(j65c02_memory_region) sym ## j65c02_memory_region; \
+    typedef JEMU_SYM(j65c02_timeline_track) sym ## j65c02_timeline_track; \
+    typedef JEMU_SYM(j65c02_debug) sym ## j65c02_debug; \
+    typedef JEMU_SYM(j65c02_debug_op) sym ## j65c02_debug_op; \
+    typedef JEMU_SYM(j65c02_debug_condition) sym ## j65c02_debug_condition; \
+    typedef JEMU_SYM(j65c02_sanitizer) sym ## j65c02_sanitizer; \
+    typedef JEMU_SYM(j65c02_hle_entry) sym ## j65c02_hle_entry; \
+    typedef JEMU_SYM(j65c02_custom_opcode) sym ## j65c02_custom_opcode; \
+    typedef JEMU_SYM(j65c02_custom) sym ## j65c02_custom; \
+    typedef JEMU_SYM(j65c02_hle) sym ## j65c02_hle; \
+    typedef JEMU_SYM(j65c02_run_fn) sym ## j65c02_run_fn; \
+    typedef JEMU_SYM(j65c02_bus) sym ## j65c02_bus; \
     static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
     sym ## j65c02_fetch(uint8_t* x, JEMU_SYM(j65c02)* y) { \
         return JEMU_SYM(j65c02_fetch)(x,y); } \
     static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_opcode_fetch(uint8_t* x, JEMU_SYM(j65c02)* y) { \
+        return JEMU_SYM(j65c02_opcode_fetch)(x,y); } \
+    static inline void \
+    sym ## j65c02_opcode_keep(JEMU_SYM(j65c02)* x, uint8_t y) { \
+        JEMU_SYM(j65c02_opcode_keep)(x,y); } \
+    static inline void \
+    sym ## j65c02_flight_record(JEMU_SYM(j65c02)* x, uint8_t y) { \
+        JEMU_SYM(j65c02_flight_record)(x,y); } \
+    static inline void \
+    sym ## j65c02_trace_instruction(JEMU_SYM(j65c02_trace)* x, uint8_t y) { \
+        JEMU_SYM(j65c02_trace_instruction)(x,y); } \
+    static inline void \
+    sym ## j65c02_timeline_span( \
+        JEMU_SYM(j65c02_timeline_track)* v, int w, int x, const char* y, \
+        uint64_t z) { \
+        JEMU_SYM(j65c02_timeline_span)(v,w,x,y,z); } \
+    static inline void \
+    sym ## j65c02_timeline_wait(JEMU_SYM(j65c02)* x, uint64_t y) { \
+        JEMU_SYM(j65c02_timeline_wait)(x,y); } \
+    static inline void \
+    sym ## j65c02_timeline_wake(JEMU_SYM(j65c02)* x) { \
+        JEMU_SYM(j65c02_timeline_wake)(x); } \
+    static inline void \
+    sym ## j65c02_timeline_interrupt(JEMU_SYM(j65c02)* x, const char* y) { \
+        JEMU_SYM(j65c02_timeline_interrupt)(x,y); } \
+    static inline void \
+    sym ## j65c02_timeline_return(JEMU_SYM(j65c02)* x, int y) { \
+        JEMU_SYM(j65c02_timeline_return)(x,y); } \
+    static inline void \
+    sym ## j65c02_timeline_unwind(JEMU_SYM(j65c02)* x) { \
+        JEMU_SYM(j65c02_timeline_unwind)(x); } \
+    static inline void \
+    sym ## j65c02_coverage_edge(uint8_t* x, uint16_t y, uint16_t z) { \
+        JEMU_SYM(j65c02_coverage_edge)(x,y,z); } \
+    static inline bool \
+    sym ## j65c02_debug_check( \
+        const JEMU_SYM(j65c02_debug)* x, int y, uint16_t z) { \
+        return JEMU_SYM(j65c02_debug_check)(x,y,z); } \
+    static inline bool \
+    sym ## j65c02_debug_exec(JEMU_SYM(j65c02)* x) { \
+        return JEMU_SYM(j65c02_debug_exec)(x); } \
+    static inline bool \
+    sym ## j65c02_debug_condition_eval( \
+        JEMU_SYM(j65c02_debug)* x, uint16_t y) { \
+        return JEMU_SYM(j65c02_debug_condition_eval)(x,y); } \
+    static inline void \
+    sym ## j65c02_debug_watch_hit( \
+        JEMU_SYM(j65c02_debug)* w, int x, uint16_t y, uint8_t z) { \
+        JEMU_SYM(j65c02_debug_watch_hit)(w,x,y,z); } \
+    static inline void \
+    sym ## j65c02_debug_release(JEMU_SYM(j65c02_debug)* x) { \
+        JEMU_SYM(j65c02_debug_release)(x); } \
+    static inline const JEMU_SYM(j65c02_instruction)* \
+    sym ## j65c02_instructions_base(const JEMU_SYM(j65c02)* x) { \
+        return JEMU_SYM(j65c02_instructions_base)(x); } \
+    static inline void \
+    sym ## j65c02_instructions_update(JEMU_SYM(j65c02)* x) { \
+        JEMU_SYM(j65c02_instructions_update)(x); } \
+    static inline bool \
+    sym ## j65c02_hle_check(const JEMU_SYM(j65c02_hle)* x, uint16_t y) { \
+        return JEMU_SYM(j65c02_hle_check)(x,y); } \
+    static inline const JEMU_SYM(j65c02_hle_entry)* \
+    sym ## j65c02_hle_get(const JEMU_SYM(j65c02_hle)* x, uint16_t y) { \
+        return JEMU_SYM(j65c02_hle_get)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_hle_exec( \
+        JEMU_SYM(j65c02)* x, const JEMU_SYM(j65c02_hle_entry)* y) { \
+        return JEMU_SYM(j65c02_hle_exec)(x,y); } \
+    static inline void \
+    sym ## j65c02_hle_release(JEMU_SYM(j65c02_hle)* x) { \
+        JEMU_SYM(j65c02_hle_release)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_dma_finish(JEMU_SYM(j65c02)* x, int* y) { \
+        return JEMU_SYM(j65c02_dma_finish)(x,y); } \
+    static inline bool \
+    sym ## j65c02_dma_due(const JEMU_SYM(j65c02)* x) { \
+        return JEMU_SYM(j65c02_dma_due)(x); } \
+    static inline JEMU_SYM(j65c02_bus) \
+    sym ## j65c02_input_bus(JEMU_SYM(j65c02)* x) { \
+        return JEMU_SYM(j65c02_input_bus)(x); } \
+    static inline int \
+    sym ## j65c02_idiom_loop(JEMU_SYM(j65c02)* x, uint16_t y, int z) { \
+        return JEMU_SYM(j65c02_idiom_loop)(x,y,z); } \
+    static inline bool \
+    sym ## j65c02_run_instrumented(const JEMU_SYM(j65c02)* x) { \
+        return JEMU_SYM(j65c02_run_instrumented)(x); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
+    sym ## j65c02_run_loop( \
+        JEMU_SYM(j65c02)* w, int x, JEMU_SYM(j65c02_run_fn) y, void* z) { \
+        return JEMU_SYM(j65c02_run_loop)(w,x,y,z); } \
+    static inline JEMU_SYM(status) \
+    sym ## j65c02_sanitizer_violation( \
+        JEMU_SYM(j65c02_sanitizer)* w, int x, uint16_t y, uint8_t z) { \
+        return JEMU_SYM(j65c02_sanitizer_violation)(w,x,y,z); } \
+    static inline void \
+    sym ## j65c02_trace_control( \
+        JEMU_SYM(j65c02_trace)* x, int y, uint16_t z) { \
+        JEMU_SYM(j65c02_trace_control)(x,y,z); } \
+    static inline void \
+    sym ## j65c02_profile_call(JEMU_SYM(j65c02)* x, int y, uint8_t z) { \
+        JEMU_SYM(j65c02_profile_call)(x,y,z); } \
+    static inline void \
+    sym ## j65c02_profile_return(JEMU_SYM(j65c02)* x) { \
+        JEMU_SYM(j65c02_profile_return)(x); } \
+    static inline void \
+    sym ## j65c02_profile_interrupt(JEMU_SYM(j65c02)* x, int y, bool z) { \
+        JEMU_SYM(j65c02_profile_interrupt)(x,y,z); } \
+    static inline void \
+    sym ## j65c02_profile_interrupt_return(JEMU_SYM(j65c02)* x, int y) { \
+        JEMU_SYM(j65c02_profile_interrupt_return)(x,y); } \
+    static inline JEMU_SYM(j65c02_memory_region)* \
+    sym ## j65c02_memory_region_find(JEMU_SYM(j65c02)* x, uint16_t y) { \
+        return JEMU_SYM(j65c02_memory_region_find)(x,y); } \
+    static inline JEMU_SYM(status) FN_DECL_MUST_CHECK \
     sym ## j65c02_addr_abs(JEMU_SYM(j65c02)* inst, uint16_t* addr) { \
         JEMU_SYM(status) retval; \
         uint8_t addr_low, addr_high; \
@@ -0,0 +1,135 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/profile.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+
+TEST_SUITE(j65c02_profile_disabled);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    uint8_t* mem = (uint8_t*)vmem;
+
+    *val = mem[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    uint8_t* mem = (uint8_t*)vmem;
+
+    mem[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that this runner was built without the profiler.
+ */
+TEST(build)
+{
+    TEST_EXPECT(0 == JEMU_PROFILE_ENABLED);
+}
+
+/**
+ * Verify that a core built without the profiler cannot profile an instance.
+ */
+TEST(enable)
+{
+    j65c02* inst = nullptr;
+    std::vector<uint8_t> mem(65536);
+    j65c02_profile_interrupts interrupts;
+    uint64_t instructions, cycles;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem.data(),
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_EXPECT(
+        JEMU_ERROR_PROFILE_DISABLED == j65c02_profile_enable(inst, true));
+    TEST_EXPECT(
+        JEMU_ERROR_PROFILE_DISABLED == j65c02_profile_enable(inst, false));
+    TEST_EXPECT(JEMU_ERROR_PROFILE_DISABLED == j65c02_profile_reset(inst));
+    TEST_EXPECT(
+        JEMU_ERROR_PROFILE_DISABLED
+            == j65c02_profile_pc_get(inst, 0x1000, &instructions, &cycles));
+    TEST_EXPECT(
+        JEMU_ERROR_PROFILE_DISABLED
+            == j65c02_profile_interrupts_get(
+                    inst, JEMU_PROFILE_INTERRUPT_IRQ, &interrupts));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that calls, returns, and interrupts, which the profiler would follow,
+ * still run through steps and runs.
+ */
+TEST(calls_and_interrupts)
+{
+    j65c02* inst = nullptr;
+    std::vector<uint8_t> mem(65536);
+
+    static const uint8_t main[] = {
+        0x58,                       /* 1000: CLI */
+        0x20, 0x00, 0x11,           /* 1001: JSR $1100 */
+        0x00,                       /* 1004: BRK */
+        0xEA,                       /* 1005: NOP */
+        0xDB };                     /* 1006: STP */
+
+    for (size_t i = 0; i < sizeof(main); ++i)
+    {
+        mem[0x1000 + i] = main[i];
+    }
+
+    mem[0x1100] = 0xE6;             /* INC $10 */
+    mem[0x1101] = 0x10;
+    mem[0x1102] = 0x60;             /* RTS */
+
+    /* an RTS returns to the address its JSR pushed, as this core lays it out
+     * on the stack. */
+    mem[0x0310] = 0x4C;             /* from $1001: JMP $1004 */
+    mem[0x0311] = 0x04;
+    mem[0x0312] = 0x10;
+
+    mem[0x1400] = 0xE6;             /* irq: INC $11 */
+    mem[0x1401] = 0x11;
+    mem[0x1402] = 0x40;             /* RTI */
+    mem[0x1500] = 0xE6;             /* nmi: INC $12 */
+    mem[0x1501] = 0x12;
+    mem[0x1502] = 0x40;             /* RTI */
+
+    mem[0xFFFA] = 0x00;
+    mem[0xFFFB] = 0x15;
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+    mem[0xFFFE] = 0x00;
+    mem[0xFFFF] = 0x14;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem.data(),
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+
+    /* interrupt the call, then nest an NMI in the handler. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(0x1100 == j65c02_reg_pc_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_interrupt(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_nmi(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 1000));
+
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(1 == mem[0x10]);
+    TEST_EXPECT(2 == mem[0x11]);
+    TEST_EXPECT(1 == mem[0x12]);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
@@ -0,0 +1,326 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/batch.h>
+#include <string.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_batch;
+
+TEST_SUITE(j65c02_batch);
+
+namespace {
+
+struct board
+{
+    uint8_t mem[65536];
+    unsigned reads[65536];
+};
+
+}
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Create a board that runs the same program on a different input byte.
+ *
+ * The program mixes register-only instructions, which run in lockstep, with
+ * memory instructions, decimal mode arithmetic, and a branch that depends on
+ * the input, all of which split the lanes.
+ */
+static status board_create(j65c02** inst, board* b, uint8_t input)
+{
+    static const uint8_t program[] = {
+        0xA2, 0x00,             /* 1000: LDX #$00    */
+        0xAD, 0x00, 0x02,       /* 1002: LDA $0200   */
+        0x18,                   /* 1005: CLC         */
+        0x69, 0x05,             /* 1006: ADC #$05    */
+        0x29, 0x0F,             /* 1008: AND #$0F    */
+        0xF0, 0x03,             /* 100A: BEQ $100F   */
+        0xE8,                   /* 100C: INX         */
+        0x80, 0x02,             /* 100D: BRA $1011   */
+        0xCA,                   /* 100F: DEX         */
+        0x88,                   /* 1010: DEY         */
+        0xC8,                   /* 1011: INY         */
+        0xF8,                   /* 1012: SED         */
+        0x69, 0x19,             /* 1013: ADC #$19    */
+        0xD8,                   /* 1015: CLD         */
+        0x0A,                   /* 1016: ASL A       */
+        0x8D, 0x01, 0x02,       /* 1017: STA $0201   */
+        0xEE, 0x00, 0x02,       /* 101A: INC $0200   */
+        0x4C, 0x00, 0x10,       /* 101D: JMP $1000   */
+    };
+    status retval;
+
+    memset(b->mem, 0, sizeof(b->mem));
+    memcpy(b->mem + 0x1000, program, sizeof(program));
+    b->mem[0xFFFC] = 0x00;
+    b->mem[0xFFFD] = 0x10;
+    b->mem[0x0200] = input;
+
+    retval =
+        j65c02_create(
+            inst, &mem_read, &mem_write, b->mem, JEMU_65c02_PERSONALITY_WDC,
+            JEMU_65c02_EMULATION_MODE_STRICT);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return j65c02_reset(*inst);
+}
+
+/**
+ * Verify that each lane of a batch matches an instance run on its own.
+ */
+static void run_batch(bool& mu_fail, size_t count, int cycles, int runs)
+{
+    j65c02_batch* batch = nullptr;
+    std::vector<board> boards(count), ref_boards(count);
+    std::vector<j65c02*> insts(count), refs(count);
+    std::vector<status> results(count, -1);
+    j65c02_batch_stats stats;
+    uint64_t lockstep = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t input = (uint8_t)(i * 7);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS == board_create(&insts[i], &boards[i], input));
+        TEST_ASSERT(
+            STATUS_SUCCESS == board_create(&refs[i], &ref_boards[i], input));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_batch_create(&batch, insts.data(), count));
+
+    for (int run = 0; run < runs; ++run)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == j65c02_batch_run(batch, cycles, results.data(), &stats));
+        lockstep += stats.lockstep_instructions;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            TEST_EXPECT(STATUS_SUCCESS == results[i]);
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_run(refs[i], cycles));
+
+            TEST_EXPECT(j65c02_reg_a_get(refs[i]) == j65c02_reg_a_get(insts[i]));
+            TEST_EXPECT(j65c02_reg_x_get(refs[i]) == j65c02_reg_x_get(insts[i]));
+            TEST_EXPECT(j65c02_reg_y_get(refs[i]) == j65c02_reg_y_get(insts[i]));
+            TEST_EXPECT(
+                j65c02_reg_sp_get(refs[i]) == j65c02_reg_sp_get(insts[i]));
+            TEST_EXPECT(
+                j65c02_reg_status_get(refs[i])
+                    == j65c02_reg_status_get(insts[i]));
+            TEST_EXPECT(
+                j65c02_reg_pc_get(refs[i]) == j65c02_reg_pc_get(insts[i]));
+            TEST_EXPECT(
+                j65c02_cycle_delta_get(refs[i])
+                    == j65c02_cycle_delta_get(insts[i]));
+            TEST_EXPECT(
+                j65c02_cycle_count_get(refs[i])
+                    == j65c02_cycle_count_get(insts[i]));
+            TEST_EXPECT(
+                0 == memcmp(boards[i].mem, ref_boards[i].mem, 65536));
+        }
+    }
+
+    /* register-only instructions ran in lockstep. */
+    TEST_EXPECT(lockstep > 0);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_batch_release(batch));
+    for (size_t i = 0; i < count; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[i]));
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_release(refs[i]));
+    }
+}
+
+TEST(run_single_lane)
+{
+    run_batch(mu_fail, 1, 100, 3);
+}
+
+TEST(run_full_batch)
+{
+    run_batch(mu_fail, JEMU_BATCH_MAX_LANES, 1000, 5);
+}
+
+TEST(run_short_budgets)
+{
+    run_batch(mu_fail, 11, 7, 50);
+}
+
+/**
+ * Verify that per-lane errors are reported without failing the batch.
+ */
+TEST(run_reports_errors)
+{
+    j65c02_batch* batch = nullptr;
+    board boards[2];
+    j65c02* insts[2];
+    status results[2];
+
+    TEST_ASSERT(STATUS_SUCCESS == board_create(&insts[0], &boards[0], 1));
+    TEST_ASSERT(STATUS_SUCCESS == board_create(&insts[1], &boards[1], 0x0B));
+
+    /* only the second board takes the branch, into an invalid opcode. */
+    boards[1].mem[0x100F] = 0x02;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_batch_create(&batch, insts, 2));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_batch_run(batch, 100, results, nullptr));
+
+    TEST_EXPECT(STATUS_SUCCESS == results[0]);
+    TEST_EXPECT(JEMU_ERROR_INVALID_OPCODE == results[1]);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_batch_release(batch));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[0]));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[1]));
+}
+
+static status counting_read(void* vb, uint16_t addr, uint8_t* val)
+{
+    board* b = (board*)vb;
+
+    ++b->reads[addr];
+    *val = b->mem[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status counting_write(void* vb, uint16_t addr, uint8_t val)
+{
+    board* b = (board*)vb;
+
+    b->mem[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Create a board that counts reads while running INC $00 / JMP $8000.
+ */
+static status counting_board_create(j65c02** inst, board* b)
+{
+    static const uint8_t program[] = {
+        0xE6, 0x00,             /* 8000: INC $00     */
+        0x4C, 0x00, 0x80,       /* 8002: JMP $8000   */
+    };
+    status retval;
+
+    memset(b, 0, sizeof(*b));
+    memcpy(b->mem + 0x8000, program, sizeof(program));
+    b->mem[0xFFFC] = 0x00;
+    b->mem[0xFFFD] = 0x80;
+
+    retval =
+        j65c02_create(
+            inst, &counting_read, &counting_write, b,
+            JEMU_65c02_PERSONALITY_WDC, JEMU_65c02_EMULATION_MODE_STRICT);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return j65c02_reset(*inst);
+}
+
+/**
+ * Verify that an opcode fetched by a run or batch without the budget for it
+ * is executed by the next one without being read again.
+ */
+TEST(split_runs_fetch_once)
+{
+    j65c02_batch* batch = nullptr;
+    board boards[3];
+    j65c02* insts[3];
+    status result;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == counting_board_create(&insts[i], &boards[i]));
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_batch_create(&batch, insts + 2, 1));
+
+    /* run the same cycles in one slice, in short slices, and batched. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(insts[0], 140));
+    for (int i = 0; i < 20; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_run(insts[1], 7));
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_batch_run(batch, 7, &result, nullptr));
+        TEST_ASSERT(STATUS_SUCCESS == result);
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_EXPECT(17 == boards[i].mem[0x00]);
+        TEST_EXPECT(
+            j65c02_cycle_count_get(insts[0])
+                == j65c02_cycle_count_get(insts[i]));
+        TEST_EXPECT(
+            j65c02_reg_pc_get(insts[0]) == j65c02_reg_pc_get(insts[i]));
+
+        /* each INC was read once, as was any INC still pending. */
+        TEST_EXPECT(boards[i].reads[0x8000] <= 18U);
+        TEST_EXPECT(boards[i].reads[0x8000] == boards[0].reads[0x8000]);
+        TEST_EXPECT(boards[i].reads[0x8002] == boards[0].reads[0x8002]);
+    }
+
+    /* a step executes the opcode left pending by a run without reading it
+     * again. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(insts[1]));
+    unsigned reads = boards[1].reads[0x8000];
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(insts[1], 1));
+    TEST_EXPECT(reads + 1 == boards[1].reads[0x8000]);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(insts[1]));
+    TEST_EXPECT(reads + 1 == boards[1].reads[0x8000]);
+    TEST_EXPECT(18 == boards[1].mem[0x00]);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_batch_release(batch));
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[i]));
+    }
+}
+
+/**
+ * Verify that a batch needs between one and JEMU_BATCH_MAX_LANES lanes.
+ */
+TEST(create_bad_lane_count)
+{
+    j65c02_batch* batch = nullptr;
+    j65c02* insts[JEMU_BATCH_MAX_LANES + 1] = { };
+
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_LANE_COUNT
+            == j65c02_batch_create(&batch, insts, 0));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_LANE_COUNT
+            == j65c02_batch_create(
+                    &batch, insts, JEMU_BATCH_MAX_LANES + 1));
+}
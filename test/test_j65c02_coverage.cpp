@@ -0,0 +1,104 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/coverage.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_coverage;
+
+TEST_SUITE(j65c02_coverage);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Sum the counts in a coverage map.
+ */
+static unsigned map_sum(const std::vector<uint8_t>& map)
+{
+    unsigned sum = 0;
+
+    for (uint8_t count : map)
+    {
+        sum += count;
+    }
+
+    return sum;
+}
+
+/**
+ * Verify that branches, jumps, and interrupts are counted as edges, and that a
+ * detached map is left alone.
+ */
+TEST(edges)
+{
+    std::vector<uint8_t> mem(65536);
+    std::vector<uint8_t> map(JEMU_COVERAGE_MAP_SIZE);
+    j65c02* inst = nullptr;
+
+    mem[0x1000] = 0x58;             /* CLI */
+    mem[0x1001] = 0xA2;             /* LDX #$03 */
+    mem[0x1002] = 0x03;
+    mem[0x1003] = 0xCA;             /* DEX */
+    mem[0x1004] = 0xD0;             /* BNE $1003 */
+    mem[0x1005] = 0xFD;
+    mem[0x1006] = 0x4C;             /* JMP $1010 */
+    mem[0x1007] = 0x10;
+    mem[0x1008] = 0x10;
+    mem[0x1010] = 0xCB;             /* WAI */
+    mem[0x1011] = 0xDB;             /* STP */
+    mem[0x1400] = 0xDB;             /* STP */
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+    mem[0xFFFE] = 0x00;
+    mem[0xFFFF] = 0x14;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_coverage_attach(inst, map.data()));
+
+    /* the loop branches back twice and falls through once. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_ASSERT(j65c02_wait_flag_get(inst));
+    TEST_EXPECT(2 == map[j65c02_coverage_index(0x1004, 0x1003)]);
+    TEST_EXPECT(1 == map[j65c02_coverage_index(0x1004, 0x1006)]);
+    TEST_EXPECT(1 == map[j65c02_coverage_index(0x1006, 0x1010)]);
+    TEST_EXPECT(4 == map_sum(map));
+
+    /* the interrupt leaves from the instruction after the WAI. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_interrupt(inst));
+    TEST_EXPECT(1 == map[j65c02_coverage_index(0x1011, 0x1400)]);
+    TEST_EXPECT(5 == map_sum(map));
+
+    /* the edges differ by direction. */
+    TEST_EXPECT(
+        j65c02_coverage_index(0x1004, 0x1003)
+            != j65c02_coverage_index(0x1003, 0x1004));
+
+    /* a detached map is not counted. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_coverage_attach(inst, nullptr));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(5 == map_sum(map));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
@@ -0,0 +1,78 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/jemu65c02.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+
+TEST_SUITE(j65c02_cycle_count_get);
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that the cycle count accumulates the cycles of each instruction run
+ * by step and run.
+ */
+TEST(cycle_count_accumulates)
+{
+    j65c02* inst = nullptr;
+    uint8_t mem[65536];
+
+    /* clear memory. */
+    memset(mem, 0, sizeof(mem));
+
+    /* set the reset vector. */
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    /* at 0x1000, loop over an INX (2 cycles) and a JMP (3 cycles). */
+    mem[0x1000] = 0xE8;
+    mem[0x1001] = 0x4C;
+    mem[0x1002] = 0x00;
+    mem[0x1003] = 0x10;
+
+    /* create an instance. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+
+    /* reset the processor. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+
+    /* PRECONDITION: no cycles have been executed. */
+    TEST_EXPECT(0 == j65c02_cycle_count_get(inst));
+
+    /* a single step executes INX. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_EXPECT(2 == j65c02_cycle_count_get(inst));
+
+    /* a single step executes JMP. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_EXPECT(5 == j65c02_cycle_count_get(inst));
+
+    /* run ten more loops. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 51));
+    TEST_EXPECT(55 == j65c02_cycle_count_get(inst));
+    TEST_EXPECT(11 == j65c02_reg_x_get(inst));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
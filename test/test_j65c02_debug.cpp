@@ -0,0 +1,264 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/debug.h>
+#include <string>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+
+TEST_SUITE(j65c02_debug);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Create an instance running a short program.
+ */
+static j65c02* program_create(std::vector<uint8_t>& mem)
+{
+    j65c02* inst = nullptr;
+
+    mem.resize(65536);
+    mem[0x1000] = 0xA9;             /* LDA #$01 */
+    mem[0x1001] = 0x01;
+    mem[0x1002] = 0x85;             /* STA $20 */
+    mem[0x1003] = 0x20;
+    mem[0x1004] = 0xA5;             /* LDA $21 */
+    mem[0x1005] = 0x21;
+    mem[0x1006] = 0xDB;             /* STP */
+    mem[0x0021] = 0x42;
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    if (STATUS_SUCCESS
+            != j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT)
+     || STATUS_SUCCESS != j65c02_reset(inst))
+    {
+        return nullptr;
+    }
+
+    return inst;
+}
+
+/**
+ * Verify that a run stops before an execution breakpoint with the cycles it
+ * did not spend, and resumes past it.
+ */
+TEST(exec)
+{
+    std::vector<uint8_t> mem;
+    j65c02* inst = program_create(mem);
+    j65c02_breakpoint_hit hit;
+
+    TEST_ASSERT(nullptr != inst);
+    TEST_EXPECT(
+        JEMU_ERROR_DEBUG_DISABLED
+            == j65c02_breakpoint_set(inst, 0x1004, JEMU_BREAKPOINT_EXEC));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_debug_enable(inst, true));
+    TEST_EXPECT(
+        JEMU_ERROR_BREAKPOINT_NO_HIT == j65c02_breakpoint_hit_get(inst, &hit));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_set(inst, 0x1004, JEMU_BREAKPOINT_EXEC));
+
+    /* LDA # and STA zp take 5 cycles before the breakpoint. */
+    uint64_t start = j65c02_cycle_count_get(inst);
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_run(inst, 100));
+    TEST_EXPECT(0x1004 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(start + 5 == j65c02_cycle_count_get(inst));
+    TEST_EXPECT(95 == j65c02_cycle_delta_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_breakpoint_hit_get(inst, &hit));
+    TEST_EXPECT(JEMU_BREAKPOINT_EXEC == hit.kind);
+    TEST_EXPECT(0x1004 == hit.addr);
+    TEST_EXPECT(0x1004 == hit.pc);
+    TEST_EXPECT(start + 5 == hit.cycle_count);
+
+    /* the next run steps over the breakpoint. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 0));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0x42 == j65c02_reg_a_get(inst));
+
+    /* a cleared breakpoint does not fire. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_clear(inst, 0x1004, JEMU_BREAKPOINT_EXEC));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a run or step stops after an instruction that touches a watched
+ * address, and that disabling debugging restores the bus.
+ */
+TEST(watch)
+{
+    std::vector<uint8_t> mem;
+    j65c02* inst = program_create(mem);
+    j65c02_breakpoint_hit hit;
+
+    TEST_ASSERT(nullptr != inst);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_debug_enable(inst, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_set(inst, 0x0020, JEMU_BREAKPOINT_WRITE));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_set(inst, 0x0021, JEMU_BREAKPOINT_READ));
+
+    /* the write completes, and the run stops after it. */
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_run(inst, 100));
+    TEST_EXPECT(0x1004 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(0x01 == mem[0x0020]);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_breakpoint_hit_get(inst, &hit));
+    TEST_EXPECT(JEMU_BREAKPOINT_WRITE == hit.kind);
+    TEST_EXPECT(0x0020 == hit.addr);
+    TEST_EXPECT(0x1002 == hit.pc);
+    TEST_EXPECT(0x01 == hit.value);
+
+    /* a step stops the same way. */
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_step(inst));
+    TEST_EXPECT(0x1006 == j65c02_reg_pc_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_breakpoint_hit_get(inst, &hit));
+    TEST_EXPECT(JEMU_BREAKPOINT_READ == hit.kind);
+    TEST_EXPECT(0x0021 == hit.addr);
+    TEST_EXPECT(0x1004 == hit.pc);
+    TEST_EXPECT(0x42 == hit.value);
+
+    /* with debugging disabled, the program runs through. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_debug_enable(inst, false));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(
+        JEMU_ERROR_DEBUG_DISABLED == j65c02_breakpoint_hit_get(inst, &hit));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a breakpoint with a condition only fires when it holds, and that
+ * a malformed condition is rejected.
+ */
+TEST(condition)
+{
+    std::vector<uint8_t> mem;
+    j65c02* inst = program_create(mem);
+    j65c02_breakpoint_hit hit;
+
+    TEST_ASSERT(nullptr != inst);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_debug_enable(inst, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_set(inst, 0x1004, JEMU_BREAKPOINT_EXEC));
+
+    /* malformed conditions. */
+    TEST_EXPECT(
+        JEMU_ERROR_BREAKPOINT_BAD_CONDITION
+            == j65c02_breakpoint_condition_set(inst, 0x1004, ""));
+    TEST_EXPECT(
+        JEMU_ERROR_BREAKPOINT_BAD_CONDITION
+            == j65c02_breakpoint_condition_set(inst, 0x1004, "A == "));
+    TEST_EXPECT(
+        JEMU_ERROR_BREAKPOINT_BAD_CONDITION
+            == j65c02_breakpoint_condition_set(inst, 0x1004, "Q > 1"));
+    TEST_EXPECT(
+        JEMU_ERROR_BREAKPOINT_BAD_CONDITION
+            == j65c02_breakpoint_condition_set(inst, 0x1004, "(A"));
+    TEST_EXPECT(
+        JEMU_ERROR_BREAKPOINT_BAD_CONDITION
+            == j65c02_breakpoint_condition_set(inst, 0x1004, "mem[$20"));
+
+    /* unary operators nest, so a long run of them is rejected, not
+     * recursed through. */
+    std::string deep(1 << 20, '!');
+    deep += "1";
+    TEST_EXPECT(
+        JEMU_ERROR_BREAKPOINT_BAD_CONDITION
+            == j65c02_breakpoint_condition_set(inst, 0x1004, deep.c_str()));
+    TEST_EXPECT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_condition_set(inst, 0x1004, "!!-~-A"));
+
+    /* a condition that does not hold lets the run through. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_condition_set(
+                    inst, 0x1004, "A == $FF && mem[$20] > 3"));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(
+        JEMU_ERROR_BREAKPOINT_NO_HIT == j65c02_breakpoint_hit_get(inst, &hit));
+
+    /* one that does stops it. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_condition_set(
+                    inst, 0x1004,
+                    "(A == 1 && mem[0x20] >= %1 && !Z) || cycles < 0"));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_run(inst, 100));
+    TEST_EXPECT(0x1004 == j65c02_reg_pc_get(inst));
+
+    /* precedence and arithmetic follow C. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_condition_set(
+                    inst, 0x1004, "(P & $02) == 0 && PC - 4 == $1000"));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_run(inst, 100));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_condition_set(
+                    inst, 0x1004,
+                    "1 + 2 * 3 == 7 && 17 % 5 * 2 == 4 && 1 << 2 + 1 == 8"
+                    " && -17 / 4 >> 1 == -2 && A / 0 == 0 && -A % 0 == 0"));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_run(inst, 100));
+
+    /* arithmetic wraps around at 64 bits. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_condition_set(
+                    inst, 0x1004,
+                    "$7FFFFFFFFFFFFFFF + 1 < 0"
+                    " && -($7FFFFFFFFFFFFFFF + 1) / -1 < 0"
+                    " && CYCLES - $7FFFFFFFFFFFFFFF * 2 > CYCLES"
+                    " && 1 << 64 == 0 && -8 >> 70 == -1"));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_run(inst, 100));
+
+    /* removing the condition leaves the breakpoint. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_condition_set(inst, 0x1004, "0"));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_condition_set(inst, 0x1004, nullptr));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_run(inst, 100));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
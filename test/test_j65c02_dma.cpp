@@ -0,0 +1,531 @@
+#include <minunit/minunit.h>
+#include <algorithm>
+#include <jemu65c02/debug.h>
+#include <jemu65c02/dma.h>
+#include <jemu65c02/sanitizer.h>
+#include <jemu65c02/snapshot.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_dma;
+JEMU_IMPORT_jemu65c02_sanitizer;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+TEST_SUITE(j65c02_dma);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Assemble an LDA #val / STA addr pair.
+ */
+static uint16_t store(
+    std::vector<uint8_t>& mem, uint16_t pc, uint16_t addr, uint8_t val)
+{
+    mem[pc++] = 0xA9;
+    mem[pc++] = val;
+    mem[pc++] = 0x8D;
+    mem[pc++] = addr & 0xFF;
+    mem[pc++] = addr >> 8;
+
+    return pc;
+}
+
+/**
+ * \brief Assemble a program that programs a transfer on a controller at $D000.
+ */
+static uint16_t program_transfer(
+    std::vector<uint8_t>& mem, uint16_t pc, uint16_t source,
+    uint16_t destination, uint16_t length, uint8_t control)
+{
+    pc = store(mem, pc, 0xD000, source & 0xFF);
+    pc = store(mem, pc, 0xD001, source >> 8);
+    pc = store(mem, pc, 0xD002, destination & 0xFF);
+    pc = store(mem, pc, 0xD003, destination >> 8);
+    pc = store(mem, pc, 0xD004, length & 0xFF);
+    pc = store(mem, pc, 0xD005, length >> 8);
+
+    return store(mem, pc, 0xD006, control);
+}
+
+/**
+ * \brief Run an instance with a controller until it stops.
+ */
+static status run_with_dma(
+    std::vector<uint8_t>& mem, int cycles_per_byte, uint64_t* cycle_count,
+    uint64_t* transfer_count)
+{
+    j65c02* inst = nullptr;
+    j65c02_dma* dma = nullptr;
+    status retval;
+
+    retval =
+        j65c02_create(
+            &inst, &mem_read, &mem_write, &mem, JEMU_65c02_PERSONALITY_WDC,
+            JEMU_65c02_EMULATION_MODE_STRICT);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = j65c02_memory_region_add(inst, 0x0000, mem.data(), 0xD000);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = j65c02_dma_create(&dma, inst, 0xD000, cycles_per_byte);
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = j65c02_reset(inst);
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = j65c02_run(inst, 100000);
+    }
+
+    if (STATUS_SUCCESS == retval && !j65c02_stopped_flag_get(inst))
+    {
+        retval = JEMU_ERROR_INVALID_PROCESSOR_STATE;
+    }
+
+    *cycle_count = j65c02_cycle_count_get(inst);
+    if (NULL != dma)
+    {
+        *transfer_count = j65c02_dma_transfer_count_get(dma);
+        if (STATUS_SUCCESS != j65c02_dma_release(dma))
+        {
+            retval = JEMU_ERROR_INVALID_PROCESSOR_STATE;
+        }
+    }
+
+    if (STATUS_SUCCESS != j65c02_release(inst))
+    {
+        retval = JEMU_ERROR_INVALID_PROCESSOR_STATE;
+    }
+
+    return retval;
+}
+
+/**
+ * Verify that a copy moves its block, steals its cycles, and raises an IRQ
+ * once the instruction that started it finishes.
+ */
+TEST(copy_with_irq)
+{
+    std::vector<uint8_t> mem(65536);
+    uint64_t free_cycles, stolen_cycles, transfer_count;
+
+    mem[0x1000] = 0x58;             /* CLI */
+    uint16_t pc = program_transfer(mem, 0x1001, 0x2000, 0x4000, 0x0300, 0x03);
+    mem[pc++] = 0xA5;               /* LDA $30 */
+    mem[pc++] = 0x30;
+    mem[pc++] = 0x85;               /* STA $31 */
+    mem[pc++] = 0x31;
+    mem[pc++] = 0xAD;               /* LDA $D007 */
+    mem[pc++] = 0x07;
+    mem[pc++] = 0xD0;
+    mem[pc++] = 0x85;               /* STA $33 */
+    mem[pc++] = 0x33;
+    mem[pc++] = 0xDB;               /* STP */
+
+    /* the handler saves and acknowledges the status. */
+    pc = 0xE000;
+    mem[pc++] = 0xAD;               /* LDA $D007 */
+    mem[pc++] = 0x07;
+    mem[pc++] = 0xD0;
+    mem[pc++] = 0x85;               /* STA $32 */
+    mem[pc++] = 0x32;
+    mem[pc++] = 0x8D;               /* STA $D007 */
+    mem[pc++] = 0x07;
+    mem[pc++] = 0xD0;
+    pc = store(mem, pc, 0x0030, 0xA5);
+    mem[pc++] = 0x40;               /* RTI */
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+    mem[0xFFFE] = 0x00;
+    mem[0xFFFF] = 0xE0;
+
+    for (int i = 0; i < 0x300; ++i)
+    {
+        mem[0x2000 + i] = (uint8_t)(i * 13 + 5);
+    }
+
+    std::vector<uint8_t> copy = mem;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == run_with_dma(mem, 0, &free_cycles, &transfer_count));
+    TEST_EXPECT(1 == transfer_count);
+    TEST_EXPECT(
+        std::equal(
+            mem.begin() + 0x2000, mem.begin() + 0x2300,
+            mem.begin() + 0x4000));
+    TEST_EXPECT(0xA5 == mem[0x31]);
+    TEST_EXPECT(JEMU_DMA_STATUS_DONE == mem[0x32]);
+    TEST_EXPECT(0x00 == mem[0x33]);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == run_with_dma(copy, 2, &stolen_cycles, &transfer_count));
+    TEST_EXPECT(free_cycles + 2 * 0x300 == stolen_cycles);
+    TEST_EXPECT(mem == copy);
+}
+
+/**
+ * Verify that a fill and an overlapping copy reach bytes both inside and
+ * outside the registered regions.
+ */
+TEST(fill_and_overlap)
+{
+    std::vector<uint8_t> mem(65536);
+    uint64_t cycle_count, transfer_count;
+
+    mem[0x2000] = 0x7E;
+    for (int i = 0; i < 0x10; ++i)
+    {
+        mem[0x3000 + i] = (uint8_t)(i + 1);
+    }
+
+    /* fill across the end of the region, then smear a byte upward. */
+    uint16_t pc =
+        program_transfer(
+            mem, 0x1000, 0x2000, 0xCF00, 0x0200,
+            JEMU_DMA_CONTROL_START | JEMU_DMA_CONTROL_FILL);
+    pc = program_transfer(mem, pc, 0x3000, 0x3001, 0x000F, 0x01);
+    mem[pc++] = 0xDB;               /* STP */
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == run_with_dma(mem, 1, &cycle_count, &transfer_count));
+    TEST_EXPECT(2 == transfer_count);
+
+    for (int i = 0; i < 0x200; ++i)
+    {
+        /* bytes past the region reach the bus below the controller, even
+         * where its registers sit. */
+        TEST_EXPECT(0x7E == mem[0xCF00 + i]);
+    }
+
+    TEST_EXPECT(0x00 == mem[0xD100]);
+
+    for (int i = 0; i < 0x10; ++i)
+    {
+        TEST_EXPECT(0x01 == mem[0x3000 + i]);
+    }
+}
+
+/**
+ * Verify that stolen cycles that overrun a run are taken from the runs after
+ * it.
+ */
+TEST(overrun_carried)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02* inst = nullptr;
+    j65c02_dma* dma = nullptr;
+
+    /* start a long transfer, then spin. */
+    uint16_t pc = program_transfer(mem, 0x1000, 0x2000, 0x4000, 0x0100, 0x01);
+    mem[pc++] = 0x4C;               /* JMP pc */
+    mem[pc] = pc - 1;
+    mem[pc + 1] = (pc - 1) >> 8;
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_create(&dma, inst, 0xD000, 2));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+
+    int64_t start =
+        j65c02_cycle_count_get(inst) + j65c02_cycle_delta_get(inst);
+    bool overran = false;
+
+    /* every cycle given to a run is either spent or carried. */
+    for (int i = 1; i <= 40; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 50));
+        TEST_EXPECT(
+            start + 50 * i
+                == (int64_t)j65c02_cycle_count_get(inst)
+                    + j65c02_cycle_delta_get(inst));
+        overran = overran || j65c02_cycle_delta_get(inst) < 0;
+    }
+
+    TEST_EXPECT(overran);
+    TEST_EXPECT(1 == j65c02_dma_transfer_count_get(dma));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_release(dma));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a transfer into a registered region is checked by watchpoints
+ * and the sanitizer set up after the controller.
+ */
+TEST(checked_transfers)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02* inst = nullptr;
+    j65c02_dma* dma = nullptr;
+    j65c02_breakpoint_hit hit;
+    j65c02_sanitizer_report report;
+
+    uint16_t pc = program_transfer(mem, 0x1000, 0x2000, 0x4000, 0x0100, 0x01);
+    mem[pc++] = 0xDB;               /* STP */
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    for (int i = 0; i < 0x100; ++i)
+    {
+        mem[0x2000 + i] = (uint8_t)(i + 1);
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(inst, 0x0000, mem.data(), 0xD000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_create(&dma, inst, 0xD000, 1));
+
+    /* a watchpoint on the destination stops the run after the transfer. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_debug_enable(inst, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_set(inst, 0x4080, JEMU_BREAKPOINT_WRITE));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == j65c02_run(inst, 100000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_breakpoint_hit_get(inst, &hit));
+    TEST_EXPECT(JEMU_BREAKPOINT_WRITE == hit.kind);
+    TEST_EXPECT(0x4080 == hit.addr);
+    TEST_EXPECT(0x81 == hit.value);
+    TEST_EXPECT(0x01 == mem[0x4000]);
+    TEST_EXPECT(0x00 == mem[0x4100]);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_clear(inst, 0x4080, JEMU_BREAKPOINT_WRITE));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100000));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_debug_enable(inst, false));
+
+    /* a write to a read-only destination is a violation. */
+    std::fill(mem.begin() + 0x4000, mem.begin() + 0x4100, 0);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_sanitizer_enable(inst, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_sanitizer_permissions_set(
+                    inst, 0x4040, 0x10,
+                    JEMU_SANITIZER_READ | JEMU_SANITIZER_INIT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(JEMU_ERROR_SANITIZER_VIOLATION == j65c02_run(inst, 100000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(JEMU_SANITIZER_VIOLATION_WRITE == report.kind);
+    TEST_EXPECT(0x4040 == report.addr);
+    TEST_EXPECT(0x41 == report.value);
+    TEST_EXPECT(0x40 == mem[0x403F]);
+    TEST_EXPECT(0x00 == mem[0x4040]);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_sanitizer_enable(inst, false));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_release(dma));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that an IRQ raised while interrupts are disabled is held until they
+ * are enabled, and that it ends a wait.
+ */
+TEST(irq_held)
+{
+    std::vector<uint8_t> mem(65536);
+    uint64_t cycle_count, transfer_count;
+
+    mem[0x1000] = 0x78;             /* SEI */
+    uint16_t pc =
+        program_transfer(
+            mem, 0x1001, 0x2000, 0x4000, 0x0010,
+            JEMU_DMA_CONTROL_START | JEMU_DMA_CONTROL_IRQ);
+    pc = store(mem, pc, 0x0030, 0x11);
+    mem[pc++] = 0xCB;               /* WAI */
+    pc = store(mem, pc, 0x0030, 0x22);
+    mem[pc++] = 0x58;               /* CLI */
+    pc = store(mem, pc, 0x0030, 0x33);
+    mem[pc++] = 0xDB;               /* STP */
+
+    /* the handler notes where it interrupted, and acknowledges the status. */
+    pc = 0xE000;
+    mem[pc++] = 0xA5;               /* LDA $30 */
+    mem[pc++] = 0x30;
+    mem[pc++] = 0x85;               /* STA $31 */
+    mem[pc++] = 0x31;
+    mem[pc++] = 0x8D;               /* STA $D007 */
+    mem[pc++] = 0x07;
+    mem[pc++] = 0xD0;
+    mem[pc++] = 0xE6;               /* INC $40 */
+    mem[pc++] = 0x40;
+    mem[pc++] = 0x40;               /* RTI */
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+    mem[0xFFFE] = 0x00;
+    mem[0xFFFF] = 0xE0;
+
+    /* the wait ends at once, and the IRQ is taken once, after the CLI. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == run_with_dma(mem, 1, &cycle_count, &transfer_count));
+    TEST_EXPECT(1 == transfer_count);
+    TEST_EXPECT(0x33 == mem[0x30]);
+    TEST_EXPECT(0x22 == mem[0x31]);
+    TEST_EXPECT(1 == mem[0x40]);
+}
+
+/**
+ * Verify that a snapshot restores the registers and IRQ line of a controller.
+ */
+TEST(snapshot)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02* inst = nullptr;
+    j65c02_dma* dma = nullptr;
+    j65c02_snapshot* snapshot = nullptr;
+
+    mem[0x1000] = 0x78;             /* SEI */
+    uint16_t pc =
+        program_transfer(
+            mem, 0x1001, 0x2000, 0x4000, 0x0010,
+            JEMU_DMA_CONTROL_START | JEMU_DMA_CONTROL_IRQ);
+    mem[pc] = 0x4C;                 /* JMP * */
+    mem[pc + 1] = pc & 0xFF;
+    mem[pc + 2] = pc >> 8;
+
+    /* a second program enables interrupts and reads the status. */
+    pc = 0x1100;
+    mem[pc++] = 0x58;               /* CLI */
+    mem[pc++] = 0xAD;               /* LDA $D007 */
+    mem[pc++] = 0x07;
+    mem[pc++] = 0xD0;
+    mem[pc++] = 0x85;               /* STA $34 */
+    mem[pc++] = 0x34;
+    mem[pc++] = 0xDB;               /* STP */
+
+    /* the handler counts the IRQs it takes, and acknowledges them. */
+    pc = 0xE000;
+    mem[pc++] = 0xE6;               /* INC $40 */
+    mem[pc++] = 0x40;
+    mem[pc++] = 0x8D;               /* STA $D007 */
+    mem[pc++] = 0x07;
+    mem[pc++] = 0xD0;
+    mem[pc++] = 0x40;               /* RTI */
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+    mem[0xFFFE] = 0x00;
+    mem[0xFFFF] = 0xE0;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(inst, 0x0000, mem.data(), 0xD000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_create(&dma, inst, 0xD000, 1));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_create(&snapshot, inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_save(snapshot, inst));
+
+    /* the transfer leaves the status done, and the IRQ line held. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 1000));
+    TEST_EXPECT(1 == j65c02_dma_transfer_count_get(dma));
+
+    /* rolled back, the controller is idle again. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_restore(snapshot, inst));
+    TEST_EXPECT(0 == j65c02_dma_transfer_count_get(dma));
+    j65c02_reg_pc_set(inst, 0x1100);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100000));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0x00 == mem[0x34]);
+    TEST_EXPECT(0 == mem[0x40]);
+
+    /* a snapshot saved after the transfer brings the held IRQ back. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_restore(snapshot, inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 1000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_save(snapshot, inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_restore(snapshot, inst));
+    TEST_EXPECT(1 == j65c02_dma_transfer_count_get(dma));
+    j65c02_reg_pc_set(inst, 0x1100);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100000));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0x00 == mem[0x34]);
+    TEST_EXPECT(1 == mem[0x40]);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_release(snapshot));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_release(dma));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a controller must fit in the address space, and that an
+ * instance has at most one.
+ */
+TEST(bad_options)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02* inst = nullptr;
+    j65c02_dma* dma = nullptr;
+    j65c02_dma* other = nullptr;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_EXPECT(
+        JEMU_ERROR_DMA_BAD_OPTIONS
+            == j65c02_dma_create(&dma, inst, 0xFFF9, 1));
+    TEST_EXPECT(
+        JEMU_ERROR_DMA_BAD_OPTIONS
+            == j65c02_dma_create(&dma, inst, 0xD000, -1));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_dma_create(&dma, inst, 0xFFF8, 1));
+    TEST_EXPECT(
+        JEMU_ERROR_DMA_IN_USE
+            == j65c02_dma_create(&other, inst, 0xD000, 1));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_release(dma));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
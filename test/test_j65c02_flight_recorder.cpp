@@ -0,0 +1,166 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/flight_recorder.h>
+#include <string.h>
+
+#include "../src/jemu65c02_internal.h"
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_flight_recorder;
+
+TEST_SUITE(j65c02_flight_recorder);
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Load a program that counts X up to 3, then jumps through a vector to
+ * an invalid opcode.
+ */
+static void program_load(uint8_t* mem)
+{
+    static const uint8_t code[] = {
+        0xA2, 0x00,                 /* LDX #$00 */
+        0xE8,                       /* loop: INX */
+        0xE0, 0x03,                 /* CPX #$03 */
+        0xD0, 0xFB,                 /* BNE loop */
+        0x6C, 0x00, 0x02 };         /* JMP ($0200) */
+
+    memset(mem, 0, 65536);
+    memcpy(mem + 0x1000, code, sizeof(code));
+    mem[0x0200] = 0x00;
+    mem[0x0201] = 0x30;
+    mem[0x3000] = 0x02;
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+}
+
+/**
+ * Verify that the flight recorder holds the path to a crash.
+ */
+TEST(path_to_crash)
+{
+    j65c02* inst = nullptr;
+    uint8_t mem[65536];
+    j65c02_flight_entry entries[8];
+
+    program_load(mem);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_memory_region_add(inst, 0x0000, mem, 65536));
+
+    /* nothing is recorded until the recorder is enabled. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_EXPECT(0 == j65c02_flight_recorder_dump(inst, entries, 8));
+
+    /* a ring of three entries is rounded up to four. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_flight_recorder_enable(inst, 3));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_OPCODE == j65c02_run(inst, 1000));
+
+    TEST_ASSERT(4 == j65c02_flight_recorder_dump(inst, entries, 8));
+
+    /* the last pass through the loop. */
+    TEST_EXPECT(0x1003 == entries[0].reg_pc);
+    TEST_EXPECT(0xE0 == entries[0].opcode);
+    TEST_EXPECT(1 == entries[0].operand_count);
+    TEST_EXPECT(0x03 == entries[0].operands[0]);
+    TEST_EXPECT(0x03 == entries[0].reg_x);
+
+    TEST_EXPECT(0x1005 == entries[1].reg_pc);
+    TEST_EXPECT(0xD0 == entries[1].opcode);
+    TEST_EXPECT(0xFB == entries[1].operands[0]);
+
+    /* the jump through the vector. */
+    TEST_EXPECT(0x1007 == entries[2].reg_pc);
+    TEST_EXPECT(0x6C == entries[2].opcode);
+    TEST_EXPECT(2 == entries[2].operand_count);
+    TEST_EXPECT(0x00 == entries[2].operands[0]);
+    TEST_EXPECT(0x02 == entries[2].operands[1]);
+    TEST_EXPECT(entries[1].cycle_count < entries[2].cycle_count);
+
+    /* the invalid opcode. */
+    TEST_EXPECT(0x3000 == entries[3].reg_pc);
+    TEST_EXPECT(0x02 == entries[3].opcode);
+    TEST_EXPECT(0 == entries[3].operand_count);
+
+    /* a smaller dump returns the most recent entries. */
+    TEST_ASSERT(2 == j65c02_flight_recorder_dump(inst, entries, 2));
+    TEST_EXPECT(0x1007 == entries[0].reg_pc);
+    TEST_EXPECT(0x3000 == entries[1].reg_pc);
+
+    /* disabling the recorder drops it. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_flight_recorder_enable(inst, 0));
+    TEST_EXPECT(0 == j65c02_flight_recorder_dump(inst, entries, 8));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that operands are not read outside registered memory regions.
+ */
+TEST(no_operands_outside_regions)
+{
+    j65c02* inst = nullptr;
+    uint8_t mem[65536];
+    j65c02_flight_entry entries[2];
+
+    program_load(mem);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_flight_recorder_enable(inst, 16));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(1 == j65c02_flight_recorder_dump(inst, entries, 2));
+    TEST_EXPECT(0x1000 == entries[0].reg_pc);
+    TEST_EXPECT(0xA2 == entries[0].opcode);
+    TEST_EXPECT(0 == entries[0].operand_count);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that every opcode not implemented on the 65C02 is recorded as one
+ * byte long, so that the operands of the next instruction are not swallowed.
+ */
+TEST(invalid_opcode_lengths)
+{
+    for (int i = 0; i < 256; ++i)
+    {
+        if (&JEMU_SYM(j65c02_inst_invalid_opcode)
+                == JEMU_SYM(global_j65c02_instructions)[i].exec)
+        {
+            TEST_EXPECT(1 == JEMU_SYM(global_j65c02_instruction_lengths)[i]);
+        }
+    }
+
+    /* the unimplemented opcodes of the 0x?2 column are one byte long. */
+    TEST_EXPECT(1 == JEMU_SYM(global_j65c02_instruction_lengths)[0x02]);
+    TEST_EXPECT(1 == JEMU_SYM(global_j65c02_instruction_lengths)[0x22]);
+    TEST_EXPECT(1 == JEMU_SYM(global_j65c02_instruction_lengths)[0xE2]);
+}
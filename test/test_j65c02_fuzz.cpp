@@ -0,0 +1,239 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/debug.h>
+#include <jemu65c02/fuzz.h>
+#include <jemu65c02/sanitizer.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_fuzz;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+TEST_SUITE(j65c02_fuzz);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Create an instance whose firmware dispatches on its first input byte: 0
+ * stops, 1 loops forever, 2 runs an invalid opcode, and anything else writes a
+ * watched byte. The instance is snapshotted as it comes out of reset.
+ */
+static j65c02* firmware_create(std::vector<uint8_t>& mem, uint8_t input_page)
+{
+    j65c02* inst = nullptr;
+    const uint8_t firmware[] = {
+        0xEA,                       /* $1000: NOP */
+        0xAD, 0x00, input_page,     /* $1001: LDA input */
+        0xF0, 0x0C,                 /* $1004: BEQ $1012 */
+        0xC9, 0x01,                 /* $1006: CMP #$01 */
+        0xF0, 0x09,                 /* $1008: BEQ $1013 */
+        0xC9, 0x02,                 /* $100A: CMP #$02 */
+        0xF0, 0x07,                 /* $100C: BEQ $1015 */
+        0x8D, 0x00, 0x30,           /* $100E: STA $3000 */
+        0xDB,                       /* $1011: STP */
+        0xDB,                       /* $1012: STP */
+        0x80, 0xFE,                 /* $1013: BRA $1013 */
+        0x02 };                     /* $1015: invalid in strict mode. */
+
+    mem.assign(65536, 0);
+    for (size_t i = 0; i < sizeof(firmware); ++i)
+    {
+        mem[0x1000 + i] = firmware[i];
+    }
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    if (STATUS_SUCCESS
+            != j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT)
+     || STATUS_SUCCESS != j65c02_reset(inst)
+     || STATUS_SUCCESS != j65c02_memory_region_add(
+                            inst, 0x0000, mem.data(), mem.size()))
+    {
+        return nullptr;
+    }
+
+    return inst;
+}
+
+/**
+ * Verify that each input runs from the snapshot, and that each outcome is
+ * reported.
+ */
+TEST(memory_input)
+{
+    std::vector<uint8_t> mem;
+    j65c02_fuzz* fuzz = nullptr;
+    j65c02_fuzz_options options = {
+        JEMU_FUZZ_INPUT_MEMORY, 0x2000, 16, true, 0x2100, 1000 };
+    int result = -1;
+
+    j65c02* inst = firmware_create(mem, 0x20);
+    TEST_ASSERT(nullptr != inst);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_debug_enable(inst, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_set(inst, 0x3000, JEMU_BREAKPOINT_WRITE));
+
+    options.cycle_cap = 0;
+    TEST_EXPECT(
+        JEMU_ERROR_FUZZ_BAD_OPTIONS
+            == j65c02_fuzz_create(&fuzz, inst, &options));
+    options.cycle_cap = 1000;
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_create(&fuzz, inst, &options));
+
+    const uint8_t stop[] = { 0x00 };
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_run(fuzz, stop, 1, &result));
+    TEST_EXPECT(JEMU_FUZZ_RESULT_OK == result);
+    TEST_EXPECT(0x01 == mem[0x2100]);
+    TEST_EXPECT(0x00 == mem[0x2101]);
+
+    const uint8_t loop[] = { 0x01, 0xAA };
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_run(fuzz, loop, 2, &result));
+    TEST_EXPECT(JEMU_FUZZ_RESULT_TIMEOUT == result);
+    TEST_EXPECT(0x02 == mem[0x2100]);
+
+    const uint8_t invalid[] = { 0x02 };
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_run(fuzz, invalid, 1, &result));
+    TEST_EXPECT(JEMU_FUZZ_RESULT_INVALID_OPCODE == result);
+
+    /* the watchpoint fires on every input that writes it. */
+    const uint8_t watched[] = { 0x03 };
+    for (int i = 0; i < 2; ++i)
+    {
+        mem[0x3000] = 0;
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_fuzz_run(fuzz, watched, 1, &result));
+        TEST_EXPECT(JEMU_FUZZ_RESULT_BREAKPOINT == result);
+        TEST_EXPECT(0x03 == mem[0x3000]);
+    }
+
+    /* a stop after all of that still starts from the snapshot. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_run(fuzz, stop, 1, &result));
+    TEST_EXPECT(JEMU_FUZZ_RESULT_OK == result);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_release(fuzz));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that an input device delivers an input a byte at a time.
+ */
+TEST(device_input)
+{
+    std::vector<uint8_t> mem;
+    j65c02_fuzz* fuzz = nullptr;
+    j65c02_fuzz_options options = {
+        JEMU_FUZZ_INPUT_DEVICE, 0xD000, 16, false, 0, 1000 };
+    int result = -1;
+
+    j65c02* inst = firmware_create(mem, 0xD0);
+    TEST_ASSERT(nullptr != inst);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_create(&fuzz, inst, &options));
+
+    const uint8_t loop[] = { 0x01 };
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_run(fuzz, loop, 1, &result));
+    TEST_EXPECT(JEMU_FUZZ_RESULT_TIMEOUT == result);
+
+    /* an empty input reads as zero. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_run(fuzz, loop, 0, &result));
+    TEST_EXPECT(JEMU_FUZZ_RESULT_OK == result);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_release(fuzz));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that each input starts from the shadow memory of the snapshot, and
+ * that an input copied into memory is initialized.
+ */
+TEST(sanitizer_shadow)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02* inst = nullptr;
+    j65c02_fuzz* fuzz = nullptr;
+    j65c02_fuzz_options options = {
+        JEMU_FUZZ_INPUT_MEMORY, 0x2000, 16, false, 0, 1000 };
+    j65c02_sanitizer_report report;
+    int result = -1;
+
+    /* a zero input reads a byte that only a non-zero input writes. */
+    const uint8_t firmware[] = {
+        0xAD, 0x00, 0x20,           /* $1000: LDA $2000 */
+        0xF0, 0x03,                 /* $1003: BEQ $1008 */
+        0x8D, 0x01, 0x30,           /* $1005: STA $3001 */
+        0xAD, 0x01, 0x30,           /* $1008: LDA $3001 */
+        0xDB };                     /* $100B: STP */
+
+    for (size_t i = 0; i < sizeof(firmware); ++i)
+    {
+        mem[0x1000 + i] = firmware[i];
+    }
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(inst, 0x0000, mem.data(), mem.size()));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_sanitizer_enable(inst, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_sanitizer_permissions_set(
+                    inst, 0x2000, 0x10,
+                    JEMU_SANITIZER_READ | JEMU_SANITIZER_WRITE));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_sanitizer_permissions_set(
+                    inst, 0x3000, 0x100,
+                    JEMU_SANITIZER_READ | JEMU_SANITIZER_WRITE));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_create(&fuzz, inst, &options));
+
+    const uint8_t store[] = { 0x01 };
+    const uint8_t skip[] = { 0x00 };
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_fuzz_run(fuzz, store, 1, &result));
+        TEST_EXPECT(JEMU_FUZZ_RESULT_OK == result);
+
+        /* the byte the last input wrote is uninitialized again. */
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_fuzz_run(fuzz, skip, 1, &result));
+        TEST_EXPECT(JEMU_FUZZ_RESULT_SANITIZER == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_sanitizer_report_get(inst, &report));
+        TEST_EXPECT(JEMU_SANITIZER_VIOLATION_UNINITIALIZED == report.kind);
+        TEST_EXPECT(0x3001 == report.addr);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_fuzz_release(fuzz));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_sanitizer_enable(inst, false));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
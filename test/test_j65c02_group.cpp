@@ -0,0 +1,168 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/group.h>
+#include <string.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_group;
+
+TEST_SUITE(j65c02_group);
+
+namespace {
+
+struct board
+{
+    uint8_t mem[65536];
+};
+
+}
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Create a board that loops over INX (2 cycles) and JMP (3 cycles).
+ */
+static status board_create(j65c02** inst, board* b)
+{
+    status retval;
+
+    memset(b->mem, 0, sizeof(b->mem));
+    b->mem[0xFFFC] = 0x00;
+    b->mem[0xFFFD] = 0x10;
+    b->mem[0x1000] = 0xE8;
+    b->mem[0x1001] = 0x4C;
+    b->mem[0x1002] = 0x00;
+    b->mem[0x1003] = 0x10;
+
+    retval =
+        j65c02_create(
+            inst, &mem_read, &mem_write, b->mem, JEMU_65c02_PERSONALITY_WDC,
+            JEMU_65c02_EMULATION_MODE_STRICT);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return j65c02_reset(*inst);
+}
+
+/**
+ * Verify that a group runs every instance for its own budget.
+ */
+static void run_group(bool& mu_fail, size_t workers, int flags)
+{
+    const size_t COUNT = 37;
+    j65c02_group* group = nullptr;
+    std::vector<board> boards(COUNT);
+    std::vector<j65c02*> insts(COUNT);
+    std::vector<int> budgets(COUNT);
+    std::vector<status> results(COUNT, -1);
+    j65c02_group_stats stats;
+    uint64_t expected_cycles = 0;
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == board_create(&insts[i], &boards[i]));
+
+        /* each instance runs (i + 1) loops. */
+        budgets[i] = 5 * (int)(i + 1) + 1;
+        expected_cycles += 5 * (i + 1);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_group_create(&group, workers, flags));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_group_run(
+                    group, insts.data(), budgets.data(), results.data(),
+                    COUNT, &stats));
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        TEST_EXPECT(STATUS_SUCCESS == results[i]);
+        TEST_EXPECT(i + 1 == j65c02_reg_x_get(insts[i]));
+        TEST_EXPECT(5 * (i + 1) == j65c02_cycle_count_get(insts[i]));
+    }
+
+    TEST_EXPECT(expected_cycles == stats.cycles);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_group_release(group));
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[i]));
+    }
+}
+
+TEST(run_single_worker)
+{
+    run_group(mu_fail, 1, 0);
+}
+
+TEST(run_many_workers)
+{
+    run_group(mu_fail, 4, 0);
+}
+
+TEST(run_many_workers_pinned)
+{
+    run_group(mu_fail, 3, JEMU_GROUP_FLAG_PIN_CPUS);
+}
+
+/**
+ * Verify that per-instance errors are reported without failing the batch.
+ */
+TEST(run_reports_errors)
+{
+    j65c02_group* group = nullptr;
+    board boards[2];
+    j65c02* insts[2];
+    int budgets[2] = { 100, 100 };
+    status results[2];
+
+    TEST_ASSERT(STATUS_SUCCESS == board_create(&insts[0], &boards[0]));
+    TEST_ASSERT(STATUS_SUCCESS == board_create(&insts[1], &boards[1]));
+
+    /* the second board executes an invalid opcode. */
+    boards[1].mem[0x1000] = 0x02;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_group_create(&group, 2, 0));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_group_run(group, insts, budgets, results, 2, nullptr));
+
+    TEST_EXPECT(STATUS_SUCCESS == results[0]);
+    TEST_EXPECT(JEMU_ERROR_INVALID_OPCODE == results[1]);
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_group_release(group));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[0]));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[1]));
+}
+
+/**
+ * Verify that a group needs at least one worker.
+ */
+TEST(create_bad_worker_count)
+{
+    j65c02_group* group = nullptr;
+
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_WORKER_COUNT
+            == j65c02_group_create(&group, 0, 0));
+}
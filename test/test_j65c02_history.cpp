@@ -0,0 +1,538 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/debug.h>
+#include <jemu65c02/dma.h>
+#include <jemu65c02/history.h>
+#include <jemu65c02/sanitizer.h>
+#include <stdlib.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_debug;
+JEMU_IMPORT_jemu65c02_dma;
+JEMU_IMPORT_jemu65c02_history;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+TEST_SUITE(j65c02_history);
+
+/* A machine with RAM everywhere but page $D0, where a read of $D000 returns
+ * the next value from a pseudo random generator. */
+struct machine
+{
+    uint8_t mem[65536];
+    uint32_t seed;
+    int device_reads;
+};
+
+static status machine_read(void* vm, uint16_t addr, uint8_t* val)
+{
+    machine* m = (machine*)vm;
+
+    if (0xD0 == addr >> 8)
+    {
+        m->seed = m->seed * 1103515245 + 12345;
+        *val = (uint8_t)(m->seed >> 16);
+        ++m->device_reads;
+    }
+    else
+    {
+        *val = m->mem[addr];
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static status machine_write(void* vm, uint16_t addr, uint8_t val)
+{
+    machine* m = (machine*)vm;
+
+    if (0xD0 != addr >> 8)
+    {
+        m->mem[addr] = val;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Load a program that counts X up, summing device reads, and then
+ * jumps to an invalid opcode once X reaches 0x40.
+ */
+static void machine_create(bool& mu_fail, machine** m, j65c02** inst)
+{
+    static const uint8_t main_code[] = {
+        0x58,                       /* CLI */
+        0xE8,                       /* loop: INX */
+        0xAD, 0x00, 0xD0,           /* LDA $D000 */
+        0x18,                       /* CLC */
+        0x6D, 0x00, 0x02,           /* ADC $0200 */
+        0x8D, 0x00, 0x02,           /* STA $0200 */
+        0xE0, 0x40,                 /* CPX #$40 */
+        0xD0, 0xF1,                 /* BNE loop */
+        0x6C, 0x10, 0x02 };         /* JMP ($0210) */
+    static const uint8_t irq_code[] = {
+        0xEE, 0x01, 0x02,           /* INC $0201 */
+        0x40 };                     /* RTI */
+
+    *m = (machine*)malloc(sizeof(machine));
+    TEST_ASSERT(nullptr != *m);
+    memset(*m, 0, sizeof(machine));
+    (*m)->seed = 7;
+    memcpy((*m)->mem + 0x1000, main_code, sizeof(main_code));
+    memcpy((*m)->mem + 0x2000, irq_code, sizeof(irq_code));
+    (*m)->mem[0x0210] = 0x00;
+    (*m)->mem[0x0211] = 0x30;
+    (*m)->mem[0x3000] = 0x02;
+    (*m)->mem[0xFFFC] = 0x00;
+    (*m)->mem[0xFFFD] = 0x10;
+    (*m)->mem[0xFFFE] = 0x00;
+    (*m)->mem[0xFFFF] = 0x20;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    inst, &machine_read, &machine_write, *m,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(*inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(*inst, 0x0000, (*m)->mem, 0xD000));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(
+                    *inst, 0xD100, (*m)->mem + 0xD100, 0x10000 - 0xD100));
+}
+
+struct saved_state
+{
+    uint16_t pc;
+    uint8_t a, x, sp, status;
+    uint64_t cycle_count;
+    uint8_t page2[256];
+};
+
+static void state_save(saved_state* s, const j65c02* inst, const machine* m)
+{
+    s->pc = j65c02_reg_pc_get(inst);
+    s->a = j65c02_reg_a_get(inst);
+    s->x = j65c02_reg_x_get(inst);
+    s->sp = j65c02_reg_sp_get(inst);
+    s->status = j65c02_reg_status_get(inst);
+    s->cycle_count = j65c02_cycle_count_get(inst);
+    memcpy(s->page2, m->mem + 0x200, sizeof(s->page2));
+}
+
+static bool state_matches(
+    const saved_state* s, const j65c02* inst, const machine* m)
+{
+    saved_state now;
+
+    state_save(&now, inst, m);
+
+    return
+        s->pc == now.pc && s->a == now.a && s->x == now.x && s->sp == now.sp
+     && s->status == now.status && s->cycle_count == now.cycle_count
+     && 0 == memcmp(s->page2, now.page2, sizeof(now.page2));
+}
+
+static bool x_is_0x20(void*, const j65c02* inst)
+{
+    return 0x20 == j65c02_reg_x_get(inst);
+}
+
+static bool never(void*, const j65c02*)
+{
+    return false;
+}
+
+/**
+ * Verify that stepping back reconstructs every earlier instruction boundary,
+ * and that seeking to the present resumes live execution.
+ */
+TEST(step_back_and_return)
+{
+    machine* m = nullptr;
+    j65c02* inst = nullptr;
+    j65c02_history* history = nullptr;
+    saved_state states[40];
+    uint64_t positions[40];
+
+    machine_create(mu_fail, &m, &inst);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_history_create(&history, inst, 100, 16));
+
+    /* save the state at a run of nearby positions. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_run(history, 300));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_interrupt(history));
+    for (int i = 0; i < 40; ++i)
+    {
+        positions[i] = j65c02_history_position_get(history);
+        state_save(states + i, inst, m);
+        while (positions[i] == j65c02_history_position_get(history))
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_history_run(history, 1));
+        }
+    }
+
+    /* then run a while longer. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_run(history, 200));
+    uint64_t present = j65c02_history_present_get(history);
+    saved_state present_state;
+    state_save(&present_state, inst, m);
+    int device_reads = m->device_reads;
+
+    /* seek back to the last saved position, then step back through them. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_seek(history, positions[39]));
+    for (int i = 39; i >= 0; --i)
+    {
+        while (positions[i] < j65c02_history_position_get(history))
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_history_step_back(history));
+        }
+
+        TEST_ASSERT(positions[i] == j65c02_history_position_get(history));
+        TEST_EXPECT(state_matches(states + i, inst, m));
+    }
+
+    /* the past can't be changed. */
+    TEST_EXPECT(
+        JEMU_ERROR_HISTORY_REWOUND == j65c02_history_run(history, 100));
+    TEST_EXPECT(
+        JEMU_ERROR_HISTORY_REWOUND == j65c02_history_interrupt(history));
+    TEST_EXPECT(
+        JEMU_ERROR_HISTORY_UNAVAILABLE
+            == j65c02_history_seek(history, present + 1));
+
+    /* moving through history doesn't touch the device. */
+    TEST_EXPECT(device_reads == m->device_reads);
+
+    /* return to the present, and run on. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_seek(history, present));
+    TEST_EXPECT(state_matches(&present_state, inst, m));
+    TEST_EXPECT(STATUS_SUCCESS == j65c02_history_run(history, 100));
+    TEST_EXPECT(device_reads < m->device_reads);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_release(history));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    free(m);
+}
+
+/**
+ * Verify that a crash can be stepped back from, and that reverse-continue
+ * finds the most recent point where a condition held.
+ */
+TEST(crash_and_run_back)
+{
+    machine* m = nullptr;
+    j65c02* inst = nullptr;
+    j65c02_history* history = nullptr;
+
+    machine_create(mu_fail, &m, &inst);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_history_create(&history, inst, 64, 64));
+
+    /* run until the invalid opcode crashes the processor. */
+    status retval;
+    int runs = 0;
+    do
+    {
+        retval = j65c02_history_run(history, 50);
+    } while (STATUS_SUCCESS == retval && ++runs < 1000);
+    TEST_ASSERT(JEMU_ERROR_INVALID_OPCODE == retval);
+    TEST_ASSERT(j65c02_crash_flag_get(inst));
+
+    /* step back to just before the bad instruction. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_step_back(history));
+    TEST_EXPECT(!j65c02_crash_flag_get(inst));
+    TEST_EXPECT(0x3000 == j65c02_reg_pc_get(inst));
+
+    /* and once more, to the indirect jump. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_step_back(history));
+    TEST_EXPECT(0x1010 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(0x40 == j65c02_reg_x_get(inst));
+
+    /* reverse-continue to the last point where X was 0x20, which is just
+     * before the INX that took it to 0x21. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_history_run_back(history, &x_is_0x20, nullptr));
+    TEST_EXPECT(0x20 == j65c02_reg_x_get(inst));
+    TEST_EXPECT(0x1001 == j65c02_reg_pc_get(inst));
+
+    /* a condition that never held leaves the instance at the oldest point. */
+    TEST_EXPECT(
+        JEMU_ERROR_HISTORY_UNAVAILABLE
+            == j65c02_history_run_back(history, &never, nullptr));
+    TEST_EXPECT(
+        j65c02_history_oldest_get(history)
+            == j65c02_history_position_get(history));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_release(history));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    free(m);
+}
+
+/**
+ * Verify that a history run stops at an execution breakpoint as j65c02_run
+ * does, and that it can step back from there.
+ */
+TEST(breakpoint)
+{
+    machine* m = nullptr;
+    j65c02* inst = nullptr;
+    j65c02_history* history = nullptr;
+
+    machine_create(mu_fail, &m, &inst);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_debug_enable(inst, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_set(inst, 0x1010, JEMU_BREAKPOINT_EXEC));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_history_create(&history, inst, 64, 64));
+
+    /* run until the breakpoint before the indirect jump. */
+    status retval;
+    int runs = 0;
+    do
+    {
+        retval = j65c02_history_run(history, 50);
+    } while (STATUS_SUCCESS == retval && ++runs < 1000);
+    TEST_ASSERT(JEMU_ERROR_BREAKPOINT == retval);
+    TEST_EXPECT(0x1010 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(0x40 == j65c02_reg_x_get(inst));
+
+    /* the branch before it is one position back. */
+    uint64_t present = j65c02_history_present_get(history);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_step_back(history));
+    TEST_EXPECT(0x100E == j65c02_reg_pc_get(inst));
+
+    /* return to the present, and run on into the crash. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_seek(history, present));
+    TEST_EXPECT(0x1010 == j65c02_reg_pc_get(inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_breakpoint_clear(inst, 0x1010, JEMU_BREAKPOINT_EXEC));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_OPCODE == j65c02_history_run(history, 50));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_release(history));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    free(m);
+}
+
+/**
+ * Verify that an instruction stopped by the sanitizer is stopped again when
+ * it is replayed.
+ */
+TEST(sanitizer)
+{
+    machine* m = nullptr;
+    j65c02* inst = nullptr;
+    j65c02_history* history = nullptr;
+    j65c02_sanitizer_report report;
+
+    machine_create(mu_fail, &m, &inst);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_sanitizer_enable(inst, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_sanitizer_permissions_set(
+                    inst, 0x3000, 0x100,
+                    JEMU_SANITIZER_READ | JEMU_SANITIZER_WRITE
+                  | JEMU_SANITIZER_INIT));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_history_create(&history, inst, 64, 64));
+
+    /* run until the jump into the page that can't be executed. */
+    status retval;
+    int runs = 0;
+    do
+    {
+        retval = j65c02_history_run(history, 50);
+    } while (STATUS_SUCCESS == retval && ++runs < 1000);
+    TEST_ASSERT(JEMU_ERROR_SANITIZER_VIOLATION == retval);
+    TEST_EXPECT(0x3000 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(!j65c02_crash_flag_get(inst));
+
+    uint64_t present = j65c02_history_present_get(history);
+    saved_state present_state;
+    state_save(&present_state, inst, m);
+
+    /* the failed instruction took a position, but left the PC in place. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_step_back(history));
+    TEST_EXPECT(0x3000 == j65c02_reg_pc_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_step_back(history));
+    TEST_EXPECT(0x1010 == j65c02_reg_pc_get(inst));
+
+    /* returning to the present stops the instruction again. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_seek(history, present));
+    TEST_EXPECT(state_matches(&present_state, inst, m));
+    TEST_EXPECT(!j65c02_crash_flag_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(JEMU_SANITIZER_VIOLATION_EXEC == report.kind);
+    TEST_EXPECT(0x3000 == report.addr);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_release(history));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    free(m);
+}
+
+/**
+ * Verify that DMA transfers and their IRQs are replayed with their stolen
+ * cycles, and that the device reads of the transfers come from the history.
+ */
+TEST(dma)
+{
+    machine* m = nullptr;
+    j65c02* inst = nullptr;
+    j65c02_dma* dma = nullptr;
+    j65c02_history* history = nullptr;
+    saved_state states[40];
+    uint8_t page3[40][256];
+    uint64_t transfers[40];
+    uint64_t positions[40];
+
+    /* for X from 1 to 15, copy 16 device bytes to $0300 + X * 16, and count
+     * the IRQs, which are acknowledged by writing the status register. */
+    static const uint8_t main_code[] = {
+        0x58,                       /* CLI */
+        0xE8,                       /* loop: INX */
+        0x8A,                       /* TXA */
+        0x0A, 0x0A, 0x0A, 0x0A,     /* ASL ASL ASL ASL */
+        0x8D, 0x0A, 0xD0,           /* STA $D00A */
+        0xA9, 0x00,                 /* LDA #$00 */
+        0x8D, 0x08, 0xD0,           /* STA $D008 */
+        0xA9, 0xD0,                 /* LDA #$D0 */
+        0x8D, 0x09, 0xD0,           /* STA $D009 */
+        0xA9, 0x03,                 /* LDA #$03 */
+        0x8D, 0x0B, 0xD0,           /* STA $D00B */
+        0xA9, 0x10,                 /* LDA #$10 */
+        0x8D, 0x0C, 0xD0,           /* STA $D00C */
+        0x9C, 0x0D, 0xD0,           /* STZ $D00D */
+        0xA9, 0x03,                 /* LDA #$03 */
+        0x8D, 0x0E, 0xD0,           /* STA $D00E */
+        0xAD, 0x0F, 0xD0,           /* LDA $D00F */
+        0x8D, 0x02, 0x02,           /* STA $0202 */
+        0xE0, 0x0F,                 /* CPX #$0F */
+        0xD0, 0xD1,                 /* BNE loop */
+        0x4C, 0x30, 0x10 };         /* JMP * */
+    static const uint8_t irq_code[] = {
+        0x8D, 0x0F, 0xD0,           /* STA $D00F */
+        0xEE, 0x01, 0x02,           /* INC $0201 */
+        0x40 };                     /* RTI */
+
+    machine_create(mu_fail, &m, &inst);
+    TEST_ASSERT(!mu_fail);
+    memcpy(m->mem + 0x1000, main_code, sizeof(main_code));
+    memcpy(m->mem + 0x2000, irq_code, sizeof(irq_code));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_create(&dma, inst, 0xD008, 4));
+
+    /* checkpoints are far apart, so each replay runs several transfers. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_history_create(&history, inst, 1000, 64));
+
+    /* save the state at a run of positions across several transfers. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_run(history, 300));
+    for (int i = 0; i < 40; ++i)
+    {
+        positions[i] = j65c02_history_position_get(history);
+        state_save(states + i, inst, m);
+        memcpy(page3[i], m->mem + 0x300, sizeof(page3[i]));
+        transfers[i] = j65c02_dma_transfer_count_get(dma);
+        while (positions[i] == j65c02_history_position_get(history))
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_history_run(history, 1));
+        }
+    }
+
+    TEST_ASSERT(transfers[0] < transfers[39]);
+
+    /* then run until every transfer is done. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_run(history, 3000));
+    TEST_ASSERT(15 == j65c02_dma_transfer_count_get(dma));
+    TEST_ASSERT(15 == m->mem[0x0201]);
+    uint64_t present = j65c02_history_present_get(history);
+    saved_state present_state;
+    uint8_t present_page3[256];
+    state_save(&present_state, inst, m);
+    memcpy(present_page3, m->mem + 0x300, sizeof(present_page3));
+    int device_reads = m->device_reads;
+
+    /* seek back to the last saved position, then step back through them. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_seek(history, positions[39]));
+    for (int i = 39; i >= 0; --i)
+    {
+        while (positions[i] < j65c02_history_position_get(history))
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_history_step_back(history));
+        }
+
+        TEST_ASSERT(positions[i] == j65c02_history_position_get(history));
+        TEST_EXPECT(state_matches(states + i, inst, m));
+        TEST_EXPECT(0 == memcmp(page3[i], m->mem + 0x300, sizeof(page3[i])));
+        TEST_EXPECT(transfers[i] == j65c02_dma_transfer_count_get(dma));
+    }
+
+    /* the transfers read the history, not the device. */
+    TEST_EXPECT(device_reads == m->device_reads);
+
+    /* return to the present. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_seek(history, present));
+    TEST_EXPECT(state_matches(&present_state, inst, m));
+    TEST_EXPECT(
+        0 == memcmp(present_page3, m->mem + 0x300, sizeof(present_page3)));
+    TEST_EXPECT(15 == j65c02_dma_transfer_count_get(dma));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_release(history));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_release(dma));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    free(m);
+}
+
+/**
+ * Verify that a full checkpoint ring drops the oldest history.
+ */
+TEST(ring_drops_oldest)
+{
+    machine* m = nullptr;
+    j65c02* inst = nullptr;
+    j65c02_history* history = nullptr;
+
+    machine_create(mu_fail, &m, &inst);
+    TEST_ASSERT(!mu_fail);
+
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_CHECKPOINTS
+            == j65c02_history_create(&history, inst, 0, 4));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_CHECKPOINTS
+            == j65c02_history_create(&history, inst, 100, 0));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_history_create(&history, inst, 50, 4));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_run(history, 1000));
+
+    /* only the last few checkpoint intervals are held. */
+    uint64_t oldest = j65c02_history_oldest_get(history);
+    TEST_ASSERT(0 < oldest);
+    TEST_EXPECT(
+        JEMU_ERROR_HISTORY_UNAVAILABLE
+            == j65c02_history_seek(history, oldest - 1));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_seek(history, oldest));
+    TEST_EXPECT(
+        JEMU_ERROR_HISTORY_UNAVAILABLE == j65c02_history_step_back(history));
+
+    /* the present is still reachable. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_history_seek(
+                    history, j65c02_history_present_get(history)));
+    TEST_EXPECT(STATUS_SUCCESS == j65c02_history_run(history, 100));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_history_release(history));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    free(m);
+}
@@ -0,0 +1,117 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/hle.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_hle;
+
+TEST_SUITE(j65c02_hle);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief A native multiply of A by X, leaving the low byte in A and the high
+ * byte at $31.
+ */
+static status native_multiply(void* vcount, j65c02* inst)
+{
+    unsigned product =
+        (unsigned)j65c02_reg_a_get(inst) * j65c02_reg_x_get(inst);
+
+    ++*(int*)vcount;
+    j65c02_reg_a_set(inst, product & 0xFF);
+
+    return j65c02_hle_write(inst, 0x31, product >> 8);
+}
+
+/**
+ * Verify that a native routine runs in place of the guest routine at its
+ * address, returns as an RTS would, and is charged its cycles.
+ */
+TEST(native_routine)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02* inst = nullptr;
+    int count = 0;
+    uint8_t val;
+
+    mem[0x1000] = 0xA9;             /* LDA #$40 */
+    mem[0x1001] = 0x40;
+    mem[0x1002] = 0xA2;             /* LDX #$07 */
+    mem[0x1003] = 0x07;
+    mem[0x1004] = 0x20;             /* JSR $2000 */
+    mem[0x1005] = 0x00;
+    mem[0x1006] = 0x20;
+    mem[0x1007] = 0x85;             /* STA $30 */
+    mem[0x1008] = 0x30;
+    mem[0x1009] = 0xDB;             /* STP */
+    mem[0x2000] = 0x02;             /* the guest routine never runs. */
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_EXPECT(
+        JEMU_ERROR_HLE_BAD_ROUTINE
+            == j65c02_hle_set(inst, 0x2000, NULL, &count, 50));
+    TEST_EXPECT(
+        JEMU_ERROR_HLE_BAD_ROUTINE
+            == j65c02_hle_set(inst, 0x2000, &native_multiply, &count, -1));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_hle_set(inst, 0x2000, &native_multiply, &count, 50));
+
+    /* a step at the routine runs it, and returns past the JSR. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_EXPECT(0x2000 == j65c02_reg_pc_get(inst));
+    uint64_t cycle_count = j65c02_cycle_count_get(inst);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_EXPECT(1 == count);
+    TEST_EXPECT(0x1007 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(cycle_count + 50 == j65c02_cycle_count_get(inst));
+    TEST_EXPECT(0xC0 == j65c02_reg_a_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_hle_read(inst, 0x31, &val));
+    TEST_EXPECT(0x01 == val);
+
+    /* a run without the budget for the routine leaves it for the next. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 20));
+    TEST_EXPECT(0x2000 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(1 == count);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(2 == count);
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0xC0 == mem[0x30]);
+
+    /* once cleared, the guest routine runs. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_hle_clear(inst, 0x2000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_hle_clear(inst, 0x2000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_EXPECT(JEMU_ERROR_INVALID_OPCODE == j65c02_run(inst, 100));
+    TEST_EXPECT(2 == count);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
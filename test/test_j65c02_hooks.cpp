@@ -0,0 +1,130 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/hooks.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_hooks;
+
+TEST_SUITE(j65c02_hooks);
+
+namespace {
+
+struct hook_log
+{
+    std::vector<uint16_t> pcs;
+    std::vector<uint8_t> opcodes;
+    std::vector<int> cycles;
+    size_t pre_count;
+    uint16_t fail_at;
+};
+
+}
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+static status pre_hook(
+    void* vlog, j65c02*, uint16_t pc, uint8_t, int cycles)
+{
+    hook_log* log = (hook_log*)vlog;
+
+    if (pc == log->fail_at || 0 != cycles)
+    {
+        return JEMU_ERROR_INVALID_PROCESSOR_STATE;
+    }
+
+    ++log->pre_count;
+
+    return STATUS_SUCCESS;
+}
+
+static status post_hook(
+    void* vlog, j65c02*, uint16_t pc, uint8_t opcode, int cycles)
+{
+    hook_log* log = (hook_log*)vlog;
+
+    log->pcs.push_back(pc);
+    log->opcodes.push_back(opcode);
+    log->cycles.push_back(cycles);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that hooks see each instruction, that a failing pre hook stops the
+ * instruction, and that clearing the hooks stops calling them.
+ */
+TEST(pre_post)
+{
+    std::vector<uint8_t> mem(65536);
+    hook_log log = { {}, {}, {}, 0, 0xFFFF };
+    j65c02* inst = nullptr;
+
+    mem[0x1000] = 0xA9;             /* LDA #$01 */
+    mem[0x1001] = 0x01;
+    mem[0x1002] = 0x85;             /* STA $20 */
+    mem[0x1003] = 0x20;
+    mem[0x1004] = 0xE8;             /* INX */
+    mem[0x1005] = 0xDB;             /* STP */
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_hooks_set(inst, &pre_hook, &post_hook, &log));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(4 == log.pre_count);
+    TEST_ASSERT(4 == log.pcs.size());
+    TEST_EXPECT(0x1000 == log.pcs[0]);
+    TEST_EXPECT(0xA9 == log.opcodes[0]);
+    TEST_EXPECT(2 == log.cycles[0]);
+    TEST_EXPECT(0x1002 == log.pcs[1]);
+    TEST_EXPECT(0x85 == log.opcodes[1]);
+    TEST_EXPECT(3 == log.cycles[1]);
+    TEST_EXPECT(0x1005 == log.pcs[3]);
+    TEST_EXPECT(0xDB == log.opcodes[3]);
+
+    /* a failing pre hook stops the instruction before it runs. */
+    log.fail_at = 0x1004;
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_PROCESSOR_STATE == j65c02_run(inst, 100));
+    TEST_EXPECT(0 == j65c02_reg_x_get(inst));
+    TEST_EXPECT(6 == log.pcs.size());
+
+    /* without hooks, nothing is called. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_hooks_set(inst, nullptr, nullptr, nullptr));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(1 == j65c02_reg_x_get(inst));
+    TEST_EXPECT(6 == log.pcs.size());
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
@@ -0,0 +1,167 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/idiom.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_idiom;
+
+TEST_SUITE(j65c02_idiom);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Load a program that copies and fills memory with each idiom.
+ */
+static void load_program(std::vector<uint8_t>& mem)
+{
+    static const uint8_t program[] = {
+        0xA0, 0x00,                 /* LDY #$00 */
+        0xA9, 0x00, 0x85, 0x10,     /* LDA #$00 / STA $10 */
+        0xA9, 0x20, 0x85, 0x11,     /* LDA #$20 / STA $11 */
+        0xA9, 0x00, 0x85, 0x12,     /* LDA #$00 / STA $12 */
+        0xA9, 0x40, 0x85, 0x13,     /* LDA #$40 / STA $13 */
+        0xB1, 0x10,                 /* LDA ($10),Y */
+        0x91, 0x12,                 /* STA ($12),Y */
+        0xC8,                       /* INY */
+        0xD0, 0xF9,                 /* BNE -7 */
+        0xA2, 0x80,                 /* LDX #$80 */
+        0x9E, 0xFF, 0x4F,           /* STZ $4FFF,X */
+        0xCA,                       /* DEX */
+        0xD0, 0xFA,                 /* BNE -6 */
+        0xA9, 0x5A,                 /* LDA #$5A */
+        0xA0, 0x40,                 /* LDY #$40 */
+        0x99, 0x00, 0x60,           /* STA $6000,Y */
+        0xC8,                       /* INY */
+        0xD0, 0xFA,                 /* BNE -6 */
+        0xA2, 0x01,                 /* LDX #$01 */
+        0xBD, 0x00, 0x70,           /* LDA $7000,X */
+        0x9D, 0x01, 0x70,           /* STA $7001,X */
+        0xE8,                       /* INX */
+        0xD0, 0xF7,                 /* BNE -9 */
+        0xDB };                     /* STP */
+
+    for (size_t i = 0; i < sizeof(program); ++i)
+    {
+        mem[0x1000 + i] = program[i];
+    }
+
+    for (int i = 0; i < 256; ++i)
+    {
+        mem[0x2000 + i] = (uint8_t)(i * 7 + 3);
+        mem[0x5000 + i] = 0xEE;
+        mem[0x7000 + i] = (uint8_t)(0xFF - i);
+    }
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+}
+
+/**
+ * Verify that loops run natively leave the same registers, memory, and cycle
+ * count as the guest loops, however the runs split them.
+ */
+TEST(matches_guest_loops)
+{
+    std::vector<uint8_t> fast_mem(65536), slow_mem(65536);
+    j65c02* fast = nullptr;
+    j65c02* slow = nullptr;
+
+    load_program(fast_mem);
+    load_program(slow_mem);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &fast, &mem_read, &mem_write, &fast_mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &slow, &mem_read, &mem_write, &slow_mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(fast, 0x0000, fast_mem.data(), 65536));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_idioms_enable(fast, true));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(fast));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(slow));
+
+    /* run both in uneven slices, comparing them after each. */
+    for (int i = 0; i < 1000 && !j65c02_stopped_flag_get(slow); ++i)
+    {
+        int cycles = 37 + (i * 53) % 400;
+
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_run(fast, cycles));
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_run(slow, cycles));
+        TEST_ASSERT(
+            j65c02_cycle_count_get(slow) == j65c02_cycle_count_get(fast));
+        TEST_ASSERT(j65c02_reg_pc_get(slow) == j65c02_reg_pc_get(fast));
+        TEST_ASSERT(j65c02_reg_a_get(slow) == j65c02_reg_a_get(fast));
+        TEST_ASSERT(j65c02_reg_x_get(slow) == j65c02_reg_x_get(fast));
+        TEST_ASSERT(j65c02_reg_y_get(slow) == j65c02_reg_y_get(fast));
+        TEST_ASSERT(
+            j65c02_reg_status_get(slow) == j65c02_reg_status_get(fast));
+        TEST_ASSERT(slow_mem == fast_mem);
+    }
+
+    TEST_EXPECT(j65c02_stopped_flag_get(fast));
+    TEST_EXPECT(0x03 == fast_mem[0x4000]);
+    TEST_EXPECT(0x00 == fast_mem[0x507F]);
+    TEST_EXPECT(0xEE == fast_mem[0x5080]);
+    TEST_EXPECT(0x5A == fast_mem[0x60FF]);
+    TEST_EXPECT(0xFE == fast_mem[0x7100]);
+    TEST_EXPECT(j65c02_idiom_count_get(fast) >= 4);
+    TEST_EXPECT(0 == j65c02_idiom_count_get(slow));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(fast));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(slow));
+}
+
+/**
+ * Verify that loops in memory outside the registered regions run as guest
+ * code.
+ */
+TEST(unregistered_memory)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02* inst = nullptr;
+
+    load_program(mem);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(inst, 0x0000, mem.data(), 0x4000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_idioms_enable(inst, true));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100000));
+
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0x03 == mem[0x4000]);
+    TEST_EXPECT(0 == j65c02_idiom_count_get(inst));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
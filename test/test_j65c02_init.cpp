@@ -0,0 +1,130 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/jemu65c02.h>
+#include <stdlib.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+
+TEST_SUITE(j65c02_init);
+
+static status dummy_read(void*, uint16_t, uint8_t*)
+{
+    return -1;
+}
+
+static status dummy_write(void*, uint16_t, uint8_t)
+{
+    return -1;
+}
+
+/**
+ * Verify that we can initialize an emulator instance in our own storage.
+ */
+TEST(init_basics)
+{
+    j65c02* inst = nullptr;
+    int dummy_context = 1234;
+    alignas(64) uint8_t storage[1024];
+
+    /* PRECONDITION: the storage is big enough. */
+    TEST_ASSERT(j65c02_sizeof() <= sizeof(storage));
+
+    /* dirty the storage. */
+    memset(storage, 0xA5, sizeof(storage));
+
+    /* we can initialize an instance. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_init(
+                    &inst, storage, sizeof(storage), &dummy_read,
+                    &dummy_write, &dummy_context, JEMU_65c02_PERSONALITY_MOS,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+
+    /* the instance lives in our storage. */
+    TEST_EXPECT((void*)inst == (void*)storage);
+
+    /* verify that the personality and emulation mode were set. */
+    TEST_EXPECT(JEMU_65c02_PERSONALITY_MOS == j65c02_personality_get(inst));
+    TEST_EXPECT(
+        JEMU_65c02_EMULATION_MODE_STRICT == j65c02_emulation_mode_get(inst));
+
+    /* verify that the registers are zeroed. */
+    TEST_EXPECT(0 == j65c02_reg_a_get(inst));
+    TEST_EXPECT(0 == j65c02_reg_x_get(inst));
+    TEST_EXPECT(0 == j65c02_reg_y_get(inst));
+    TEST_EXPECT(0 == j65c02_reg_sp_get(inst));
+    TEST_EXPECT(0 == j65c02_reg_status_get(inst));
+    TEST_EXPECT(0 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(0 == j65c02_cycle_delta_get(inst));
+
+    /* verify that the processor starts in crashed mode. */
+    TEST_EXPECT(j65c02_crash_flag_get(inst));
+
+    /* releasing the instance clears but does not free our storage. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    TEST_EXPECT(0 == storage[0]);
+}
+
+/**
+ * Verify that storage that is too small or misaligned is rejected.
+ */
+TEST(init_bad_storage)
+{
+    j65c02* inst = nullptr;
+    alignas(64) uint8_t storage[1024];
+
+    /* too small. */
+    TEST_EXPECT(
+        JEMU_ERROR_BAD_STORAGE
+            == j65c02_init(
+                    &inst, storage, j65c02_sizeof() - 1, &dummy_read,
+                    &dummy_write, nullptr, JEMU_65c02_PERSONALITY_MOS,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+
+    /* misaligned. */
+    TEST_EXPECT(
+        JEMU_ERROR_BAD_STORAGE
+            == j65c02_init(
+                    &inst, storage + 1, sizeof(storage) - 1, &dummy_read,
+                    &dummy_write, nullptr, JEMU_65c02_PERSONALITY_MOS,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+
+    /* NULL. */
+    TEST_EXPECT(
+        JEMU_ERROR_BAD_STORAGE
+            == j65c02_init(
+                    &inst, nullptr, sizeof(storage), &dummy_read,
+                    &dummy_write, nullptr, JEMU_65c02_PERSONALITY_MOS,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+}
+
+/**
+ * Verify that passing an invalid personality causes init to fail.
+ */
+TEST(init_bad_personality)
+{
+    j65c02* inst = nullptr;
+    alignas(64) uint8_t storage[1024];
+
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_PERSONALITY
+            == j65c02_init(
+                    &inst, storage, sizeof(storage), &dummy_read,
+                    &dummy_write, nullptr, 17,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+}
+
+/**
+ * Verify that passing an invalid emulation mode causes init to fail.
+ */
+TEST(init_bad_emulation_mode)
+{
+    j65c02* inst = nullptr;
+    alignas(64) uint8_t storage[1024];
+
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_EMULATION_MODE
+            == j65c02_init(
+                    &inst, storage, sizeof(storage), &dummy_read,
+                    &dummy_write, nullptr, JEMU_65c02_PERSONALITY_MOS, 41));
+}
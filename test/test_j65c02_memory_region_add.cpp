@@ -0,0 +1,77 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/jemu65c02.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+
+TEST_SUITE(j65c02_memory_region_add);
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that regions are checked against the guest address space and the
+ * region limit.
+ */
+TEST(memory_region_add_checks)
+{
+    j65c02* inst = nullptr;
+    uint8_t mem[65536];
+
+    memset(mem, 0, sizeof(mem));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+
+    /* empty, missing, and oversized regions are rejected. */
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_MEMORY_REGION
+            == j65c02_memory_region_add(inst, 0x0000, mem, 0));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_MEMORY_REGION
+            == j65c02_memory_region_add(inst, 0x0000, nullptr, 16));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_MEMORY_REGION
+            == j65c02_memory_region_add(inst, 0x0001, mem, 65536));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_MEMORY_REGION
+            == j65c02_memory_region_add(inst, 0xFFF0, mem, 17));
+
+    /* the whole address space is a valid region. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_memory_region_add(inst, 0x0000, mem, 65536));
+
+    /* a region that ends exactly at the top of memory is valid. */
+    for (int i = 1; i < JEMU_MAX_MEMORY_REGIONS; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == j65c02_memory_region_add(inst, 0xFFF0, mem + 0xFFF0, 16));
+    }
+
+    /* there is no room for another region. */
+    TEST_EXPECT(
+        JEMU_ERROR_MEMORY_REGION_LIMIT
+            == j65c02_memory_region_add(inst, 0x0000, mem, 16));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
@@ -0,0 +1,221 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/batch.h>
+#include <jemu65c02/hle.h>
+#include <jemu65c02/hooks.h>
+#include <jemu65c02/opcode.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_batch;
+JEMU_IMPORT_jemu65c02_hle;
+JEMU_IMPORT_jemu65c02_hooks;
+JEMU_IMPORT_jemu65c02_opcode;
+
+TEST_SUITE(j65c02_opcode);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief A coprocessor multiply of the two bytes at its operand, leaving the
+ * product in X:A.
+ */
+static status multiply(void* vcount, j65c02* inst, uint16_t operand)
+{
+    uint8_t lhs, rhs;
+    status retval;
+
+    ++*(int*)vcount;
+
+    retval = j65c02_hle_read(inst, operand, &lhs);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = j65c02_hle_read(inst, operand + 1, &rhs);
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        j65c02_reg_a_set(inst, (lhs * rhs) & 0xFF);
+        j65c02_reg_x_set(inst, (lhs * rhs) >> 8);
+    }
+
+    return retval;
+}
+
+static status post_hook(
+    void* vcycles, j65c02*, uint16_t, uint8_t opcode, int cycles)
+{
+    if (0x02 == opcode)
+    {
+        *(int*)vcycles = cycles;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that a custom opcode fetches its operand, calls its handler, and is
+ * charged its cycles, on its own instance only.
+ */
+TEST(custom_opcode)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02* inst = nullptr;
+    j65c02* other = nullptr;
+    int count = 0;
+    int hooked_cycles = 0;
+
+    mem[0x1000] = 0x02;             /* MUL $0300 */
+    mem[0x1001] = 0x00;
+    mem[0x1002] = 0x03;
+    mem[0x1003] = 0x85;             /* STA $30 */
+    mem[0x1004] = 0x30;
+    mem[0x1005] = 0x86;             /* STX $31 */
+    mem[0x1006] = 0x31;
+    mem[0x1007] = 0xDB;             /* STP */
+    mem[0x0300] = 200;
+    mem[0x0301] = 3;
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &other, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+
+    TEST_EXPECT(
+        JEMU_ERROR_OPCODE_IN_USE
+            == j65c02_opcode_set(inst, 0xA9, &multiply, &count, 1, 8));
+    TEST_EXPECT(
+        JEMU_ERROR_OPCODE_BAD_HANDLER
+            == j65c02_opcode_set(inst, 0x02, NULL, &count, 2, 8));
+    TEST_EXPECT(
+        JEMU_ERROR_OPCODE_BAD_HANDLER
+            == j65c02_opcode_set(inst, 0x02, &multiply, &count, 3, 8));
+    TEST_EXPECT(
+        JEMU_ERROR_OPCODE_BAD_HANDLER
+            == j65c02_opcode_set(inst, 0x02, &multiply, &count, 2, 0));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_opcode_set(inst, 0x02, &multiply, &count, 2, 8));
+
+    /* a step runs the opcode and charges its cycles. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    uint64_t cycle_count = j65c02_cycle_count_get(inst);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_EXPECT(1 == count);
+    TEST_EXPECT(0x1003 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(cycle_count + 8 == j65c02_cycle_count_get(inst));
+    TEST_EXPECT(0x58 == j65c02_reg_a_get(inst));
+    TEST_EXPECT(0x02 == j65c02_reg_x_get(inst));
+
+    /* hooks see the custom opcode, and the budget of a run covers it. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_hooks_set(inst, NULL, &post_hook, &hooked_cycles));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 8));
+    TEST_EXPECT(0x1000 == j65c02_reg_pc_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(2 == count);
+    TEST_EXPECT(8 == hooked_cycles);
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0x58 == mem[0x30]);
+    TEST_EXPECT(0x02 == mem[0x31]);
+
+    /* other instances, and a cleared opcode, see an invalid opcode. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(other));
+    TEST_EXPECT(JEMU_ERROR_INVALID_OPCODE == j65c02_run(other, 100));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_opcode_clear(inst, 0x02));
+    TEST_EXPECT(
+        JEMU_ERROR_OPCODE_IN_USE == j65c02_opcode_clear(inst, 0xA9));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_EXPECT(JEMU_ERROR_INVALID_OPCODE == j65c02_run(inst, 100));
+    TEST_EXPECT(2 == count);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(other));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a batch runs a lane with custom opcodes through its own
+ * dispatch table, alongside a plain lane.
+ */
+TEST(batch_lane)
+{
+    std::vector<uint8_t> mem(65536), plain_mem(65536);
+    j65c02* insts[2] = { nullptr, nullptr };
+    j65c02_batch* batch = nullptr;
+    status results[2];
+    int count = 0;
+
+    mem[0x1000] = 0x02;             /* MUL $0300 */
+    mem[0x1001] = 0x00;
+    mem[0x1002] = 0x03;
+    mem[0x1003] = 0x85;             /* STA $30 */
+    mem[0x1004] = 0x30;
+    mem[0x1005] = 0xDB;             /* STP */
+    mem[0x0300] = 7;
+    mem[0x0301] = 6;
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+    plain_mem[0x1000] = 0xDB;       /* STP */
+    plain_mem[0xFFFC] = 0x00;
+    plain_mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &insts[0], &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &insts[1], &mem_read, &mem_write, &plain_mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_opcode_set(insts[0], 0x02, &multiply, &count, 2, 8));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(insts[0]));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(insts[1]));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_batch_create(&batch, insts, 2));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_batch_run(batch, 100, results, nullptr));
+
+    TEST_EXPECT(STATUS_SUCCESS == results[0]);
+    TEST_EXPECT(STATUS_SUCCESS == results[1]);
+    TEST_EXPECT(1 == count);
+    TEST_EXPECT(42 == mem[0x30]);
+    TEST_EXPECT(j65c02_stopped_flag_get(insts[0]));
+    TEST_EXPECT(j65c02_stopped_flag_get(insts[1]));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_batch_release(batch));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[0]));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[1]));
+}
@@ -0,0 +1,216 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/flight_recorder.h>
+#include <jemu65c02/pool.h>
+#include <stdint.h>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_flight_recorder;
+JEMU_IMPORT_jemu65c02_pool;
+
+TEST_SUITE(j65c02_pool);
+
+static status dummy_read(void*, uint16_t, uint8_t*)
+{
+    return -1;
+}
+
+static status dummy_write(void*, uint16_t, uint8_t)
+{
+    return -1;
+}
+
+/**
+ * Verify that we can create and release a pool.
+ */
+TEST(create_release)
+{
+    j65c02_pool* pool = nullptr;
+
+    /* we can create a pool. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_create(&pool, 16));
+
+    /* every slot is available. */
+    TEST_EXPECT(16 == j65c02_pool_capacity_get(pool));
+    TEST_EXPECT(16 == j65c02_pool_available_get(pool));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_release(pool));
+}
+
+/**
+ * Verify that pool instances are cache-line-aligned and distinct, and that the
+ * pool is exhausted when every slot is in use.
+ */
+TEST(acquire_until_exhausted)
+{
+    j65c02_pool* pool = nullptr;
+    j65c02* inst[4];
+    j65c02* extra = nullptr;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_create(&pool, 4));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == j65c02_pool_acquire(
+                        pool, &inst[i], &dummy_read, &dummy_write, nullptr,
+                        JEMU_65c02_PERSONALITY_WDC,
+                        JEMU_65c02_EMULATION_MODE_STRICT));
+
+        /* each instance starts on a cache line. */
+        TEST_EXPECT(0 == ((uintptr_t)inst[i] % 64));
+
+        /* each instance starts crashed, like a created instance. */
+        TEST_EXPECT(j65c02_crash_flag_get(inst[i]));
+    }
+
+    /* instances do not overlap. */
+    for (int i = 1; i < 4; ++i)
+    {
+        TEST_EXPECT(
+            (uintptr_t)inst[i] - (uintptr_t)inst[i-1] >= j65c02_sizeof());
+    }
+
+    /* no slots are left. */
+    TEST_EXPECT(0 == j65c02_pool_available_get(pool));
+    TEST_EXPECT(
+        JEMU_ERROR_POOL_EXHAUSTED
+            == j65c02_pool_acquire(
+                    pool, &extra, &dummy_read, &dummy_write, nullptr,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+
+    /* releasing an instance returns its slot, which is handed out next. */
+    j65c02* released = inst[2];
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst[2]));
+    TEST_EXPECT(1 == j65c02_pool_available_get(pool));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_pool_acquire(
+                    pool, &inst[2], &dummy_read, &dummy_write, nullptr,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_EXPECT(released == inst[2]);
+
+    /* clean up. */
+    for (int i = 0; i < 4; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst[i]));
+    }
+    TEST_EXPECT(4 == j65c02_pool_available_get(pool));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_release(pool));
+}
+
+/**
+ * Verify that releasing a pool instance twice fails without freeing its slot
+ * again.
+ */
+TEST(double_release)
+{
+    j65c02_pool* pool = nullptr;
+    j65c02* inst = nullptr;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_create(&pool, 2));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_pool_acquire(
+                    pool, &inst, &dummy_read, &dummy_write, nullptr,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+
+    /* the first release returns the slot. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    TEST_EXPECT(2 == j65c02_pool_available_get(pool));
+
+    /* the second release fails, and the slot is not returned again. */
+    TEST_EXPECT(JEMU_ERROR_POOL_BAD_INSTANCE == j65c02_release(inst));
+    TEST_EXPECT(2 == j65c02_pool_available_get(pool));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_release(pool));
+}
+
+/**
+ * Verify that resetting a pool frees every slot.
+ */
+TEST(reset)
+{
+    j65c02_pool* pool = nullptr;
+    j65c02* inst = nullptr;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_create(&pool, 8));
+
+    for (int i = 0; i < 8; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == j65c02_pool_acquire(
+                        pool, &inst, &dummy_read, &dummy_write, nullptr,
+                        JEMU_65c02_PERSONALITY_MOS,
+                        JEMU_65c02_EMULATION_MODE_STRICT));
+    }
+
+    TEST_EXPECT(0 == j65c02_pool_available_get(pool));
+
+    /* reset the pool. */
+    j65c02_pool_reset(pool);
+    TEST_EXPECT(8 == j65c02_pool_available_get(pool));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_release(pool));
+}
+
+/**
+ * Verify that resetting or releasing a pool frees what the instances still in
+ * use own.
+ */
+TEST(reset_frees_owned)
+{
+    j65c02_pool* pool = nullptr;
+    j65c02* inst = nullptr;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_create(&pool, 2));
+
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == j65c02_pool_acquire(
+                        pool, &inst, &dummy_read, &dummy_write, nullptr,
+                        JEMU_65c02_PERSONALITY_WDC,
+                        JEMU_65c02_EMULATION_MODE_STRICT));
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_flight_recorder_enable(inst, 65536));
+
+        /* the first ring is freed by the reset, the second by the release. */
+        if (0 == i)
+        {
+            j65c02_pool_reset(pool);
+            TEST_EXPECT(2 == j65c02_pool_available_get(pool));
+        }
+    }
+
+    TEST_EXPECT(1 == j65c02_pool_available_get(pool));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_release(pool));
+}
+
+/**
+ * Verify that a bad personality does not consume a slot.
+ */
+TEST(acquire_bad_personality)
+{
+    j65c02_pool* pool = nullptr;
+    j65c02* inst = nullptr;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_create(&pool, 2));
+
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_PERSONALITY
+            == j65c02_pool_acquire(
+                    pool, &inst, &dummy_read, &dummy_write, nullptr, 17,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_EXPECT(2 == j65c02_pool_available_get(pool));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_pool_release(pool));
+}
@@ -0,0 +1,482 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/profile.h>
+#include <map>
+#include <string.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_profile;
+JEMU_IMPORT_jemu65c02_symbols;
+
+TEST_SUITE(j65c02_profile);
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that the profiler counts instructions and cycles per program counter
+ * and per opcode, and reports the busiest first.
+ */
+TEST(counters)
+{
+    j65c02* inst = nullptr;
+    std::vector<uint8_t> mem(65536);
+    std::vector<j65c02_profile_entry> entries(8);
+    uint64_t instructions, cycles, start, total = 0;
+    size_t count;
+
+    mem[0x1000] = 0xA2;             /* LDX #$05 */
+    mem[0x1001] = 0x05;
+    mem[0x1002] = 0xCA;             /* loop: DEX */
+    mem[0x1003] = 0xD0;             /* BNE loop */
+    mem[0x1004] = 0xFD;
+    mem[0x1005] = 0xDB;             /* STP */
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem.data(),
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+
+    /* nothing is counted until the profiler is enabled. */
+    TEST_EXPECT(
+        JEMU_ERROR_PROFILE_DISABLED
+            == j65c02_profile_pc_get(inst, 0x1000, &instructions, &cycles));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_profile_enable(inst, true));
+
+    start = j65c02_cycle_count_get(inst);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_ASSERT(j65c02_stopped_flag_get(inst));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_pc_get(inst, 0x1000, &instructions, &cycles));
+    TEST_EXPECT(1 == instructions);
+    TEST_EXPECT(2 == cycles);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_pc_get(inst, 0x1002, &instructions, &cycles));
+    TEST_EXPECT(5 == instructions);
+    TEST_EXPECT(10 == cycles);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_opcode_get(inst, 0xD0, &instructions, &cycles));
+    TEST_EXPECT(5 == instructions);
+
+    /* the report holds each address that ran, busiest first. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_report(
+                    inst, JEMU_PROFILE_REPORT_PC, entries.data(),
+                    entries.size(), &count));
+    TEST_ASSERT(4 == count);
+    TEST_EXPECT(0x1003 == entries[0].key);
+    TEST_EXPECT(0x1002 == entries[1].key);
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+        {
+            TEST_EXPECT(entries[i - 1].cycles >= entries[i].cycles);
+        }
+
+        total += entries[i].cycles;
+    }
+
+    TEST_EXPECT(j65c02_cycle_count_get(inst) - start == total);
+
+    /* a short array takes the busiest entries. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_report(
+                    inst, JEMU_PROFILE_REPORT_OPCODE, entries.data(), 1,
+                    &count));
+    TEST_ASSERT(1 == count);
+    TEST_EXPECT(0xD0 == entries[0].key);
+    TEST_EXPECT(5 == entries[0].instructions);
+
+    /* reset clears the counters. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_profile_reset(inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_report(
+                    inst, JEMU_PROFILE_REPORT_PC, entries.data(),
+                    entries.size(), &count));
+    TEST_EXPECT(0 == count);
+
+    /* disabling frees the counters. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_profile_enable(inst, false));
+    TEST_EXPECT(
+        JEMU_ERROR_PROFILE_DISABLED == j65c02_profile_reset(inst));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_profile_enable(inst, true));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+static status text_sink(void* vout, const char* data, size_t size)
+{
+    std::string* out = (std::string*)vout;
+
+    out->append(data, size);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that the profiler attributes cycles to call paths through calls,
+ * interrupts, and returns, and that an RTS through a pushed address does not
+ * count as a return.
+ */
+TEST(call_graph)
+{
+    j65c02* inst = nullptr;
+    j65c02_symbols* symbols = nullptr;
+    std::vector<uint8_t> mem(65536);
+    std::vector<j65c02_profile_path> paths(16);
+    std::map<std::string, uint64_t> folded;
+    std::string out, line;
+    uint64_t start, total = 0;
+    size_t count;
+    bool interrupted = false;
+
+    static const uint8_t main[] = {
+        0x58,                       /* 1000: CLI */
+        0x20, 0x00, 0x11,           /* 1001: JSR $1100 */
+        0x20, 0x00, 0x12,           /* 1004: JSR $1200 */
+        0xDB };                     /* 1007: STP */
+
+    static const uint8_t outer[] = {
+        0x20, 0x00, 0x12,           /* 1100: JSR $1200 */
+        0x60 };                     /* 1103: RTS */
+
+    static const uint8_t inner[] = {
+        0xA2, 0x03,                 /* 1200: LDX #$03 */
+        0xCA,                       /* 1202: DEX */
+        0xD0, 0xFD,                 /* 1203: BNE $1202 */
+        0xA9, 0x13,                 /* 1205: LDA #$13 */
+        0x48,                       /* 1207: PHA */
+        0xA9, 0x00,                 /* 1208: LDA #$00 */
+        0x48,                       /* 120A: PHA */
+        0x60 };                     /* 120B: RTS to $1300 */
+
+    memcpy(mem.data() + 0x1000, main, sizeof(main));
+    memcpy(mem.data() + 0x1100, outer, sizeof(outer));
+    memcpy(mem.data() + 0x1200, inner, sizeof(inner));
+    mem[0x1300] = 0x60;             /* RTS */
+
+    /* an RTS returns to the address its JSR pushed, as this core lays it out
+     * on the stack. */
+    mem[0x0310] = 0x4C;             /* from $1001: JMP $1004 */
+    mem[0x0311] = 0x04;
+    mem[0x0312] = 0x10;
+    mem[0x0211] = 0x60;             /* from $1100: RTS */
+    mem[0x0610] = 0xDB;             /* from $1004: STP */
+    mem[0x1400] = 0xE6;             /* INC $10 */
+    mem[0x1401] = 0x10;
+    mem[0x1402] = 0x40;             /* RTI */
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+    mem[0xFFFE] = 0x00;
+    mem[0xFFFF] = 0x14;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem.data(),
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_profile_enable(inst, true));
+
+    /* interrupt the first call of $1200, inside its loop. */
+    start = j65c02_cycle_count_get(inst);
+    while (!j65c02_stopped_flag_get(inst))
+    {
+        if (!interrupted && 0x1202 == j65c02_reg_pc_get(inst))
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_interrupt(inst));
+            interrupted = true;
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_folded_write(
+                    inst, nullptr, &text_sink, &out));
+
+    std::istringstream lines(out);
+    while (std::getline(lines, line))
+    {
+        size_t space = line.rfind(' ');
+        TEST_ASSERT(std::string::npos != space);
+        folded[line.substr(0, space)] = std::stoull(line.substr(space + 1));
+        total += std::stoull(line.substr(space + 1));
+    }
+
+    /* each call path is a line, and every cycle is counted once. */
+    TEST_ASSERT(5 == folded.size());
+    TEST_EXPECT(1 == folded.count("root"));
+    TEST_EXPECT(1 == folded.count("root;$1100"));
+    TEST_EXPECT(1 == folded.count("root;$1200"));
+    TEST_EXPECT(1 == folded.count("root;$1100;$1200"));
+    TEST_EXPECT(11 == folded["root;$1100;$1200;irq:$1400"]);
+    TEST_EXPECT(j65c02_cycle_count_get(inst) - start == total);
+
+    /* the RTI counts in the handler, so the two calls of $1200 match, and
+     * $1100 holds its JSR and the RTS at $1300 that returns from $1200. */
+    TEST_EXPECT(folded["root;$1100;$1200"] == folded["root;$1200"]);
+    TEST_EXPECT(12 == folded["root;$1100"]);
+
+    /* the root path includes every cycle. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_paths_get(
+                    inst, paths.data(), paths.size(), &count));
+    TEST_ASSERT(5 == count);
+    TEST_EXPECT(JEMU_PROFILE_CALL_ROOT == paths[0].kind);
+    TEST_EXPECT(total == paths[0].inclusive_cycles);
+    for (size_t i = 1; i < count; ++i)
+    {
+        TEST_EXPECT(paths[i].parent < i);
+        TEST_EXPECT(1 == paths[i].calls);
+        TEST_EXPECT(paths[i].inclusive_cycles >= paths[i].exclusive_cycles);
+    }
+
+    /* with a symbol table, calls are named by their labels. */
+    static const char labels[] =
+        "al C:1100 .outer\n"
+        "al C:1200 .inner\n"
+        "al C:1400 .irq_handler\n";
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_symbols_create(&symbols));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_symbols_load_vice(
+                    symbols, 0, labels, sizeof(labels) - 1));
+
+    out.clear();
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_folded_write(inst, symbols, &text_sink, &out));
+    TEST_EXPECT(
+        std::string::npos
+            != out.find("root;outer;inner;irq:irq_handler 11\n"));
+    TEST_EXPECT(std::string::npos != out.find("\nroot;inner "));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_symbols_release(symbols));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that calls made with the stack pointer wrapping around its page
+ * unwind in order, and that each instruction counts in the routine it runs in.
+ */
+TEST(stack_wrap)
+{
+    j65c02* inst = nullptr;
+    std::vector<uint8_t> mem(65536);
+    std::map<std::string, uint64_t> folded;
+    std::string out, line;
+
+    static const uint8_t main[] = {
+        0xA2, 0x01,                 /* 1000: LDX #$01 */
+        0x9A,                       /* 1002: TXS */
+        0x20, 0x00, 0x11,           /* 1003: JSR $1100 */
+        0xDB };                     /* 1006: STP */
+
+    static const uint8_t outer[] = {
+        0x20, 0x00, 0x12,           /* 1100: JSR $1200 */
+        0xEA,                       /* 1103: NOP */
+        0xEA,                       /* 1104: NOP */
+        0x60 };                     /* 1105: RTS */
+
+    memcpy(mem.data() + 0x1000, main, sizeof(main));
+    memcpy(mem.data() + 0x1100, outer, sizeof(outer));
+    mem[0x1200] = 0x60;             /* RTS */
+
+    /* an RTS returns to the address its JSR pushed, as this core lays it out
+     * on the stack. */
+    mem[0x0510] = 0x4C;             /* from $1003: JMP $1006 */
+    mem[0x0511] = 0x06;
+    mem[0x0512] = 0x10;
+    mem[0x0211] = 0x4C;             /* from $1100: JMP $1103 */
+    mem[0x0212] = 0x03;
+    mem[0x0213] = 0x11;
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem.data(),
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_profile_enable(inst, true));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 1000));
+    TEST_ASSERT(j65c02_stopped_flag_get(inst));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_folded_write(
+                    inst, nullptr, &text_sink, &out));
+
+    std::istringstream lines(out);
+    while (std::getline(lines, line))
+    {
+        size_t space = line.rfind(' ');
+        TEST_ASSERT(std::string::npos != space);
+        folded[line.substr(0, space)] = std::stoull(line.substr(space + 1));
+    }
+
+    /* the code after the inner return still counts in $1100. */
+    TEST_ASSERT(3 == folded.size());
+    TEST_EXPECT(16 == folded["root"]);
+    TEST_EXPECT(19 == folded["root;$1100"]);
+    TEST_EXPECT(6 == folded["root;$1100;$1200"]);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that the profiler counts interrupts per source, and times their
+ * handlers through nesting and wakes from WAI.
+ */
+TEST(interrupts)
+{
+    j65c02* inst = nullptr;
+    std::vector<uint8_t> mem(65536);
+    j65c02_profile_interrupts irq, nmi, wake;
+
+    static const uint8_t main[] = {
+        0x58,                       /* 1000: CLI */
+        0xCB,                       /* 1001: WAI */
+        0x78,                       /* 1002: SEI */
+        0x58,                       /* 1003: CLI */
+        0xDB };                     /* 1004: STP */
+
+    memcpy(mem.data() + 0x1000, main, sizeof(main));
+    mem[0x1400] = 0xE6;             /* INC $10 */
+    mem[0x1401] = 0x10;
+    mem[0x1402] = 0x40;             /* RTI */
+    mem[0x1500] = 0x40;             /* RTI */
+    mem[0xFFFA] = 0x00;
+    mem[0xFFFB] = 0x15;
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+    mem[0xFFFE] = 0x00;
+    mem[0xFFFF] = 0x14;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem.data(),
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_profile_enable(inst, true));
+
+    /* an IRQ that ends a WAI is a wake. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_interrupt(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+
+    /* an IRQ raised with interrupts disabled is masked. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_interrupt(inst));
+
+    /* an NMI nested in an IRQ handler is timed in both. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_interrupt(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_nmi(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    TEST_ASSERT(0x1004 == j65c02_reg_pc_get(inst));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_interrupts_get(
+                    inst, JEMU_PROFILE_INTERRUPT_WAKE, &wake));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_interrupts_get(
+                    inst, JEMU_PROFILE_INTERRUPT_IRQ, &irq));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_interrupts_get(
+                    inst, JEMU_PROFILE_INTERRUPT_NMI, &nmi));
+    TEST_EXPECT(
+        JEMU_ERROR_PROFILE_BAD_SOURCE
+            == j65c02_profile_interrupts_get(
+                    inst, JEMU_PROFILE_INTERRUPT_SOURCES, &nmi));
+
+    /* the wake handler ran an INC and an RTI. */
+    TEST_EXPECT(1 == wake.raised);
+    TEST_EXPECT(0 == wake.masked);
+    TEST_EXPECT(1 == wake.handled);
+    TEST_EXPECT(11 == wake.min_cycles);
+    TEST_EXPECT(11 == wake.max_cycles);
+    TEST_EXPECT(1 == wake.buckets[4]);
+    TEST_EXPECT(wake.last_raised == wake.last_entered);
+    TEST_EXPECT(wake.last_returned - wake.last_entered == 11);
+
+    /* the IRQ handler includes the NMI handler it was interrupted by. */
+    TEST_EXPECT(2 == irq.raised);
+    TEST_EXPECT(1 == irq.masked);
+    TEST_EXPECT(1 == irq.handled);
+    TEST_EXPECT(17 == irq.total_cycles);
+    TEST_EXPECT(1 == nmi.raised);
+    TEST_EXPECT(1 == nmi.handled);
+    TEST_EXPECT(6 == nmi.total_cycles);
+    TEST_EXPECT(irq.last_returned == j65c02_cycle_count_get(inst));
+    TEST_EXPECT(17 == j65c02_profile_interrupts_percentile(&irq, 50));
+
+    /* percentiles are read from the histogram, within the range seen. */
+    j65c02_profile_interrupts hist;
+    memset(&hist, 0, sizeof(hist));
+    hist.handled = 4;
+    hist.min_cycles = 2;
+    hist.max_cycles = 20;
+    hist.buckets[2] = 3;
+    hist.buckets[5] = 1;
+    TEST_EXPECT(2 == j65c02_profile_interrupts_percentile(&hist, 0));
+    TEST_EXPECT(3 == j65c02_profile_interrupts_percentile(&hist, 75));
+    TEST_EXPECT(20 == j65c02_profile_interrupts_percentile(&hist, 99));
+
+    /* reset clears the counters. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_profile_reset(inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_profile_interrupts_get(
+                    inst, JEMU_PROFILE_INTERRUPT_IRQ, &irq));
+    TEST_EXPECT(0 == irq.raised);
+    TEST_EXPECT(0 == irq.handled);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
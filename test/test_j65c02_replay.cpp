@@ -0,0 +1,432 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/replay.h>
+#include <stdlib.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_replay;
+
+TEST_SUITE(j65c02_replay);
+
+/* A machine with RAM everywhere but page $D0, where a read of $D000 returns
+ * the next value from a pseudo random generator and writes are counted. */
+struct machine
+{
+    uint8_t mem[65536];
+    uint32_t seed;
+    int device_reads;
+    int device_writes;
+};
+
+static status machine_read(void* vm, uint16_t addr, uint8_t* val)
+{
+    machine* m = (machine*)vm;
+
+    if (0xD0 == addr >> 8)
+    {
+        m->seed = m->seed * 1103515245 + 12345;
+        *val = (uint8_t)(m->seed >> 16);
+        ++m->device_reads;
+    }
+    else
+    {
+        *val = m->mem[addr];
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static status machine_write(void* vm, uint16_t addr, uint8_t val)
+{
+    machine* m = (machine*)vm;
+
+    if (0xD0 == addr >> 8)
+    {
+        ++m->device_writes;
+    }
+    else
+    {
+        m->mem[addr] = val;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Load a program that sums device reads, with interrupt handlers that
+ * also read the device.
+ */
+static void machine_init(machine* m, uint32_t seed)
+{
+    static const uint8_t main_code[] = {
+        0x58,                       /* CLI */
+        0xAD, 0x00, 0xD0,           /* loop: LDA $D000 */
+        0x18,                       /* CLC */
+        0x6D, 0x00, 0x03,           /* ADC $0300 */
+        0x8D, 0x00, 0x03,           /* STA $0300 */
+        0x8D, 0x01, 0xD0,           /* STA $D001 */
+        0x4C, 0x01, 0x10 };         /* JMP loop */
+    static const uint8_t irq_code[] = {
+        0xEE, 0x01, 0x03,           /* INC $0301 */
+        0xAD, 0x00, 0xD0,           /* LDA $D000 */
+        0x8D, 0x02, 0x03,           /* STA $0302 */
+        0x40 };                     /* RTI */
+    static const uint8_t nmi_code[] = {
+        0xEE, 0x03, 0x03,           /* INC $0303 */
+        0x40 };                     /* RTI */
+
+    memset(m, 0, sizeof(*m));
+    m->seed = seed;
+    memcpy(m->mem + 0x1000, main_code, sizeof(main_code));
+    memcpy(m->mem + 0x2000, irq_code, sizeof(irq_code));
+    memcpy(m->mem + 0x2100, nmi_code, sizeof(nmi_code));
+    m->mem[0xFFFA] = 0x00;
+    m->mem[0xFFFB] = 0x21;
+    m->mem[0xFFFC] = 0x00;
+    m->mem[0xFFFD] = 0x10;
+    m->mem[0xFFFE] = 0x00;
+    m->mem[0xFFFF] = 0x20;
+}
+
+/**
+ * \brief Create a reset instance for a machine, with every page but $D0
+ * registered as memory.
+ */
+static void machine_inst_create(bool& mu_fail, j65c02** inst, machine* m)
+{
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    inst, &machine_read, &machine_write, m,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(*inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(*inst, 0x0000, m->mem, 0xD000));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(
+                    *inst, 0xD100, m->mem + 0xD100, 0x10000 - 0xD100));
+}
+
+/**
+ * \brief Record a run with interrupts and NMIs, returning a copy of the
+ * stream.
+ */
+static void record(
+    bool& mu_fail, machine* m, j65c02** inst, uint8_t** data, size_t* size)
+{
+    j65c02_recorder* recorder = nullptr;
+    const uint8_t* stream;
+
+    machine_inst_create(mu_fail, inst, m);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_recorder_create(&recorder, *inst));
+
+    for (int i = 0; i < 60; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_run(*inst, 37 + i % 5));
+
+        if (0 == i % 7)
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_recorder_interrupt(recorder));
+        }
+
+        if (0 == i % 11)
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_recorder_nmi(recorder));
+        }
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(*inst, 100));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_recorder_data_get(recorder, &stream, size));
+    *data = (uint8_t*)malloc(*size);
+    TEST_ASSERT(nullptr != *data);
+    memcpy(*data, stream, *size);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_recorder_release(recorder));
+}
+
+/**
+ * Verify that a replay reproduces the recorded run without touching the
+ * device.
+ */
+TEST(replay_matches_recording)
+{
+    machine* recorded = (machine*)malloc(sizeof(machine));
+    machine* replayed = (machine*)malloc(sizeof(machine));
+    j65c02* rec_inst = nullptr;
+    j65c02* rep_inst = nullptr;
+    j65c02_replayer* replayer = nullptr;
+    uint8_t* data = nullptr;
+    size_t size = 0;
+
+    TEST_ASSERT(nullptr != recorded && nullptr != replayed);
+
+    machine_init(recorded, 1);
+    record(mu_fail, recorded, &rec_inst, &data, &size);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(recorded->device_reads > 100);
+    TEST_ASSERT(0 != recorded->mem[0x0301]);
+    TEST_ASSERT(0 != recorded->mem[0x0303]);
+
+    /* the replayed device would produce different values if it were used. */
+    machine_init(replayed, 2);
+    machine_inst_create(mu_fail, &rep_inst, replayed);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_replayer_create(&replayer, rep_inst, data, size));
+
+    /* replay in different slices than were recorded. */
+    uint64_t total =
+        j65c02_cycle_count_get(rec_inst) - j65c02_cycle_count_get(rep_inst);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_run(replayer, 1000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_run(replayer, 3));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_replayer_run(replayer, (int)(total - 1003)));
+
+    TEST_EXPECT(
+        j65c02_cycle_count_get(rec_inst) == j65c02_cycle_count_get(rep_inst));
+    TEST_EXPECT(j65c02_reg_pc_get(rec_inst) == j65c02_reg_pc_get(rep_inst));
+    TEST_EXPECT(j65c02_reg_a_get(rec_inst) == j65c02_reg_a_get(rep_inst));
+    TEST_EXPECT(j65c02_reg_sp_get(rec_inst) == j65c02_reg_sp_get(rep_inst));
+    TEST_EXPECT(
+        j65c02_reg_status_get(rec_inst) == j65c02_reg_status_get(rep_inst));
+    TEST_EXPECT(0 == memcmp(recorded->mem, replayed->mem, sizeof(replayed->mem)));
+    TEST_EXPECT(0 == replayed->device_reads);
+    TEST_EXPECT(0 == replayed->device_writes);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_release(replayer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(rep_inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(rec_inst));
+    free(data);
+    free(replayed);
+    free(recorded);
+}
+
+/**
+ * Verify that code outside the registered regions replays in slices that
+ * differ from those in which it was recorded.
+ */
+TEST(unregistered_code)
+{
+    static const uint8_t rom_code[] = {
+        0xAD, 0x00, 0xD0,           /* loop: LDA $D000 */
+        0x6D, 0x00, 0x03,           /* ADC $0300 */
+        0x8D, 0x00, 0x03,           /* STA $0300 */
+        0xE6, 0x00,                 /* INC $00 */
+        0x4C, 0x00, 0x80 };         /* JMP loop */
+    machine* recorded = (machine*)malloc(sizeof(machine));
+    machine* replayed = (machine*)malloc(sizeof(machine));
+    machine* machines[2] = { recorded, replayed };
+    j65c02* insts[2] = { nullptr, nullptr };
+    j65c02_recorder* recorder = nullptr;
+    j65c02_replayer* replayer = nullptr;
+    const uint8_t* stream;
+    uint8_t* data;
+    size_t size;
+
+    TEST_ASSERT(nullptr != recorded && nullptr != replayed);
+
+    /* only RAM below the code is registered. */
+    for (int i = 0; i < 2; ++i)
+    {
+        machine_init(machines[i], 1 + i);
+        memcpy(machines[i]->mem + 0x8000, rom_code, sizeof(rom_code));
+        machines[i]->mem[0xFFFC] = 0x00;
+        machines[i]->mem[0xFFFD] = 0x80;
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == j65c02_create(
+                        &insts[i], &machine_read, &machine_write, machines[i],
+                        JEMU_65c02_PERSONALITY_WDC,
+                        JEMU_65c02_EMULATION_MODE_STRICT));
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(insts[i]));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == j65c02_memory_region_add(
+                        insts[i], 0x0000, machines[i]->mem, 0x8000));
+    }
+
+    /* record in slices too short for most instructions. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_recorder_create(&recorder, insts[0]));
+    for (int i = 0; i < 200; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_run(insts[0], 3 + i % 5));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_recorder_data_get(recorder, &stream, &size));
+    data = (uint8_t*)malloc(size);
+    TEST_ASSERT(nullptr != data);
+    memcpy(data, stream, size);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_recorder_release(recorder));
+
+    /* replay in long slices. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_replayer_create(&replayer, insts[1], data, size));
+    uint64_t total =
+        j65c02_cycle_count_get(insts[0]) - j65c02_cycle_count_get(insts[1]);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_run(replayer, 136));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_run(replayer, 11));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_replayer_run(replayer, (int)(total - 147)));
+
+    TEST_EXPECT(
+        j65c02_cycle_count_get(insts[0]) == j65c02_cycle_count_get(insts[1]));
+    TEST_EXPECT(j65c02_reg_pc_get(insts[0]) == j65c02_reg_pc_get(insts[1]));
+    TEST_EXPECT(j65c02_reg_a_get(insts[0]) == j65c02_reg_a_get(insts[1]));
+    TEST_EXPECT(recorded->mem[0x0000] > 20);
+    TEST_EXPECT(recorded->mem[0x0000] == replayed->mem[0x0000]);
+    TEST_EXPECT(recorded->mem[0x0300] == replayed->mem[0x0300]);
+    TEST_EXPECT(0 == replayed->device_reads);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_release(replayer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[0]));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(insts[1]));
+    free(data);
+    free(replayed);
+    free(recorded);
+}
+
+/**
+ * Verify that a replay that stops following the recording is detected.
+ */
+TEST(diverged)
+{
+    machine* recorded = (machine*)malloc(sizeof(machine));
+    machine* replayed = (machine*)malloc(sizeof(machine));
+    j65c02* rec_inst = nullptr;
+    j65c02* rep_inst = nullptr;
+    j65c02_replayer* replayer = nullptr;
+    uint8_t* data = nullptr;
+    size_t size = 0;
+
+    TEST_ASSERT(nullptr != recorded && nullptr != replayed);
+
+    machine_init(recorded, 1);
+    record(mu_fail, recorded, &rec_inst, &data, &size);
+    TEST_ASSERT(!mu_fail);
+
+    /* the replayed program reads RAM instead of the device. */
+    machine_init(replayed, 1);
+    replayed->mem[0x1003] = 0x03;
+    machine_inst_create(mu_fail, &rep_inst, replayed);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_replayer_create(&replayer, rep_inst, data, size));
+
+    TEST_EXPECT(
+        JEMU_ERROR_REPLAY_DIVERGED == j65c02_replayer_run(replayer, 100000));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_release(replayer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(rep_inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(rec_inst));
+    free(data);
+    free(replayed);
+    free(recorded);
+}
+
+/**
+ * Verify that running past the end of a recording is detected.
+ */
+TEST(exhausted)
+{
+    machine* m = (machine*)malloc(sizeof(machine));
+    j65c02* inst = nullptr;
+    j65c02_recorder* recorder = nullptr;
+    j65c02_replayer* replayer = nullptr;
+    const uint8_t* stream;
+    uint8_t* data;
+    size_t size;
+
+    TEST_ASSERT(nullptr != m);
+
+    /* record a short run. */
+    machine_init(m, 1);
+    machine_inst_create(mu_fail, &inst, m);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_recorder_create(&recorder, inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 200));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_recorder_data_get(recorder, &stream, &size));
+    data = (uint8_t*)malloc(size);
+    TEST_ASSERT(nullptr != data);
+    memcpy(data, stream, size);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_recorder_release(recorder));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+
+    /* replay a longer one. */
+    machine_init(m, 1);
+    machine_inst_create(mu_fail, &inst, m);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_replayer_create(&replayer, inst, data, size));
+    TEST_EXPECT(
+        JEMU_ERROR_REPLAY_EXHAUSTED == j65c02_replayer_run(replayer, 400));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_release(replayer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    free(data);
+    free(m);
+}
+
+/**
+ * Verify that malformed streams are rejected.
+ */
+TEST(bad_stream)
+{
+    machine* m = (machine*)malloc(sizeof(machine));
+    j65c02* inst = nullptr;
+    j65c02_replayer* replayer = nullptr;
+    const uint8_t bad_magic[] = { 'J', '6', '5', 'X', 1 };
+    const uint8_t bad_version[] = { 'J', '6', '5', 'R', 2 };
+    const uint8_t short_reads[] = { 'J', '6', '5', 'R', 1, 0x01, 0x03, 0xAA };
+    const uint8_t short_event[] = { 'J', '6', '5', 'R', 1, 0x04, 0x80 };
+    const uint8_t bad_tag[] = { 'J', '6', '5', 'R', 1, 0x7F };
+    const uint8_t good[] = { 'J', '6', '5', 'R', 1, 0x01, 0x01, 0xAA, 0x04, 7 };
+
+    TEST_ASSERT(nullptr != m);
+    machine_init(m, 1);
+    machine_inst_create(mu_fail, &inst, m);
+    TEST_ASSERT(!mu_fail);
+
+    TEST_EXPECT(
+        JEMU_ERROR_REPLAY_BAD_STREAM
+            == j65c02_replayer_create(
+                    &replayer, inst, bad_magic, sizeof(bad_magic)));
+    TEST_EXPECT(
+        JEMU_ERROR_REPLAY_BAD_STREAM
+            == j65c02_replayer_create(
+                    &replayer, inst, bad_version, sizeof(bad_version)));
+    TEST_EXPECT(
+        JEMU_ERROR_REPLAY_BAD_STREAM
+            == j65c02_replayer_create(
+                    &replayer, inst, short_reads, sizeof(short_reads)));
+    TEST_EXPECT(
+        JEMU_ERROR_REPLAY_BAD_STREAM
+            == j65c02_replayer_create(
+                    &replayer, inst, short_event, sizeof(short_event)));
+    TEST_EXPECT(
+        JEMU_ERROR_REPLAY_BAD_STREAM
+            == j65c02_replayer_create(
+                    &replayer, inst, bad_tag, sizeof(bad_tag)));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_replayer_create(&replayer, inst, good, sizeof(good)));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_replayer_release(replayer));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    free(m);
+}
@@ -0,0 +1,216 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/runahead.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_runahead;
+
+TEST_SUITE(j65c02_runahead);
+
+namespace {
+
+struct board
+{
+    uint8_t mem[65536];
+};
+
+/**
+ * The state seen by the output callback.
+ */
+struct capture
+{
+    int calls;
+    uint8_t a;
+    uint16_t pc;
+    uint8_t total;
+    board* b;
+};
+
+}
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+static status capture_output(void* context, j65c02* inst)
+{
+    capture* cap = (capture*)context;
+
+    ++cap->calls;
+    cap->a = j65c02_reg_a_get(inst);
+    cap->pc = j65c02_reg_pc_get(inst);
+    cap->total = cap->b->mem[0x0301];
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Create a board that keeps adding the input at $0300 to a total at $0301.
+ */
+static status board_create(j65c02** inst, board* b)
+{
+    static const uint8_t program[] = {
+        0xAD, 0x00, 0x03,       /* 1000: LDA $0300   */
+        0x18,                   /* 1003: CLC         */
+        0x6D, 0x01, 0x03,       /* 1004: ADC $0301   */
+        0x8D, 0x01, 0x03,       /* 1007: STA $0301   */
+        0x4C, 0x00, 0x10,       /* 100A: JMP $1000   */
+    };
+    status retval;
+
+    memset(b->mem, 0, sizeof(b->mem));
+    memcpy(b->mem + 0x1000, program, sizeof(program));
+    b->mem[0xFFFC] = 0x00;
+    b->mem[0xFFFD] = 0x10;
+
+    retval =
+        j65c02_create(
+            inst, &mem_read, &mem_write, b->mem, JEMU_65c02_PERSONALITY_WDC,
+            JEMU_65c02_EMULATION_MODE_STRICT);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return j65c02_reset(*inst);
+}
+
+/**
+ * Copy the state of one board and instance to another.
+ */
+static void board_copy(j65c02* dst, board* dst_b, j65c02* src, board* src_b)
+{
+    memcpy(dst_b->mem, src_b->mem, sizeof(dst_b->mem));
+    j65c02_reg_a_set(dst, j65c02_reg_a_get(src));
+    j65c02_reg_x_set(dst, j65c02_reg_x_get(src));
+    j65c02_reg_y_set(dst, j65c02_reg_y_get(src));
+    j65c02_reg_sp_set(dst, j65c02_reg_sp_get(src));
+    j65c02_reg_status_set(dst, j65c02_reg_status_get(src));
+    j65c02_reg_pc_set(dst, j65c02_reg_pc_get(src));
+    j65c02_cycle_delta_set(dst, j65c02_cycle_delta_get(src));
+}
+
+/**
+ * Verify that each frame leaves the instance at the end of the real frame,
+ * and that the outputs come from the end of the speculative frames.
+ */
+static void run_ahead(bool& mu_fail, size_t frames)
+{
+    const int FRAME = 100;
+    j65c02_runahead* runahead = nullptr;
+    j65c02 *inst, *ref, *spec;
+    board b, ref_b, spec_b;
+    capture cap = { 0, 0, 0, 0, &b };
+
+    TEST_ASSERT(STATUS_SUCCESS == board_create(&inst, &b));
+    TEST_ASSERT(STATUS_SUCCESS == board_create(&ref, &ref_b));
+    TEST_ASSERT(STATUS_SUCCESS == board_create(&spec, &spec_b));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_memory_region_add(inst, 0x0000, b.mem, 65536));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_runahead_create(
+                    &runahead, inst, FRAME, frames, &capture_output, &cap));
+
+    for (int i = 1; i <= 20; ++i)
+    {
+        /* the host applies a new input each frame. */
+        b.mem[0x0300] = (uint8_t)i;
+        ref_b.mem[0x0300] = (uint8_t)i;
+
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_runahead_frame(runahead));
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_run(ref, FRAME));
+
+        /* the instance is left at the end of the real frame. */
+        TEST_EXPECT(j65c02_reg_a_get(ref) == j65c02_reg_a_get(inst));
+        TEST_EXPECT(j65c02_reg_pc_get(ref) == j65c02_reg_pc_get(inst));
+        TEST_EXPECT(
+            j65c02_cycle_count_get(ref) == j65c02_cycle_count_get(inst));
+        TEST_EXPECT(
+            j65c02_cycle_delta_get(ref) == j65c02_cycle_delta_get(inst));
+        TEST_EXPECT(0 == memcmp(ref_b.mem, b.mem, sizeof(b.mem)));
+
+        /* the outputs match running ahead from the real frame. */
+        board_copy(spec, &spec_b, ref, &ref_b);
+        for (size_t f = 0; f < frames; ++f)
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_run(spec, FRAME));
+        }
+
+        TEST_EXPECT(i == cap.calls);
+        TEST_EXPECT(j65c02_reg_a_get(spec) == cap.a);
+        TEST_EXPECT(j65c02_reg_pc_get(spec) == cap.pc);
+        TEST_EXPECT(spec_b.mem[0x0301] == cap.total);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_runahead_release(runahead));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(ref));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(spec));
+}
+
+TEST(run_ahead_disabled)
+{
+    run_ahead(mu_fail, 0);
+}
+
+TEST(run_ahead_one_frame)
+{
+    run_ahead(mu_fail, 1);
+}
+
+TEST(run_ahead_several_frames)
+{
+    run_ahead(mu_fail, 4);
+}
+
+/**
+ * Verify that a speculative failure is reported and still rolled back.
+ */
+TEST(speculative_error_rolls_back)
+{
+    j65c02_runahead* runahead = nullptr;
+    j65c02* inst;
+    board b;
+    capture cap = { 0, 0, 0, 0, &b };
+
+    TEST_ASSERT(STATUS_SUCCESS == board_create(&inst, &b));
+
+    /* ten NOPs, then an invalid opcode. */
+    memset(b.mem + 0x1000, 0xEA, 10);
+    b.mem[0x100A] = 0x02;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_memory_region_add(inst, 0x0000, b.mem, 65536));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_runahead_create(
+                    &runahead, inst, 20, 1, &capture_output, &cap));
+
+    /* the real frame runs nine NOPs; the speculative frame hits the invalid
+     * opcode. */
+    TEST_EXPECT(JEMU_ERROR_INVALID_OPCODE == j65c02_runahead_frame(runahead));
+    TEST_EXPECT(0 == cap.calls);
+
+    /* the instance was rolled back to the end of the real frame. */
+    TEST_EXPECT(0x1009 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(18 == j65c02_cycle_count_get(inst));
+    TEST_EXPECT(!j65c02_crash_flag_get(inst));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_runahead_release(runahead));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
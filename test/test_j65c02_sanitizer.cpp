@@ -0,0 +1,238 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/hooks.h>
+#include <jemu65c02/sanitizer.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_hooks;
+JEMU_IMPORT_jemu65c02_sanitizer;
+
+TEST_SUITE(j65c02_sanitizer);
+
+static status mem_read(void* vmem, uint16_t addr, uint8_t* val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    *val = (*mem)[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmem, uint16_t addr, uint8_t val)
+{
+    std::vector<uint8_t>* mem = (std::vector<uint8_t>*)vmem;
+
+    (*mem)[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+static status count_hook(void* vcount, j65c02*, uint16_t, uint8_t, int)
+{
+    ++*(int*)vcount;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Create an instance running from a ROM at $1000, with RAM below it
+ * and the stack page initialized.
+ */
+static j65c02* sanitized_create(std::vector<uint8_t>& mem)
+{
+    j65c02* inst = nullptr;
+
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    if (STATUS_SUCCESS
+            != j65c02_create(
+                    &inst, &mem_read, &mem_write, &mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT)
+     || STATUS_SUCCESS != j65c02_reset(inst)
+     || STATUS_SUCCESS != j65c02_sanitizer_enable(inst, true)
+     || STATUS_SUCCESS
+            != j65c02_sanitizer_permissions_set(
+                    inst, 0x0000, 0x1000,
+                    JEMU_SANITIZER_READ | JEMU_SANITIZER_WRITE)
+     || STATUS_SUCCESS
+            != j65c02_sanitizer_permissions_set(
+                    inst, 0x0100, 0x0100,
+                    JEMU_SANITIZER_READ | JEMU_SANITIZER_WRITE
+                  | JEMU_SANITIZER_INIT)
+     || STATUS_SUCCESS
+            != j65c02_sanitizer_permissions_set(
+                    inst, 0x1000, 0x1000,
+                    JEMU_SANITIZER_READ | JEMU_SANITIZER_EXEC
+                  | JEMU_SANITIZER_INIT))
+    {
+        return nullptr;
+    }
+
+    return inst;
+}
+
+/**
+ * Verify that a write to ROM is reported and does not reach the bus, and that
+ * the state of the sanitizer is checked.
+ */
+TEST(rom_write)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02_sanitizer_report report;
+
+    mem[0x1000] = 0xA9;             /* LDA #$5A */
+    mem[0x1001] = 0x5A;
+    mem[0x1002] = 0x8D;             /* STA $1800 */
+    mem[0x1003] = 0x00;
+    mem[0x1004] = 0x18;
+    mem[0x1005] = 0xDB;             /* STP */
+
+    j65c02* inst = sanitized_create(mem);
+    TEST_ASSERT(nullptr != inst);
+    TEST_EXPECT(
+        JEMU_ERROR_SANITIZER_NO_REPORT
+            == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(
+        JEMU_ERROR_SANITIZER_BAD_RANGE
+            == j65c02_sanitizer_permissions_set(inst, 0xFFFF, 2, 0));
+
+    TEST_EXPECT(JEMU_ERROR_SANITIZER_VIOLATION == j65c02_run(inst, 100));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(JEMU_SANITIZER_VIOLATION_WRITE == report.kind);
+    TEST_EXPECT(0x1800 == report.addr);
+    TEST_EXPECT(0x1002 == report.pc);
+    TEST_EXPECT(0x5A == report.value);
+    TEST_EXPECT(2 == report.cycle_count);
+    TEST_EXPECT(0x00 == mem[0x1800]);
+
+    /* without the sanitizer, the write goes through. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_sanitizer_enable(inst, false));
+    TEST_EXPECT(
+        JEMU_ERROR_SANITIZER_DISABLED
+            == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(
+        JEMU_ERROR_SANITIZER_DISABLED
+            == j65c02_sanitizer_permissions_set(inst, 0, 1, 0));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0x5A == mem[0x1800]);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a read of RAM that was never written is reported, and that a
+ * write initializes it.
+ */
+TEST(uninitialized)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02_sanitizer_report report;
+
+    mem[0x1000] = 0x8D;             /* STA $0300 */
+    mem[0x1001] = 0x00;
+    mem[0x1002] = 0x03;
+    mem[0x1003] = 0xAD;             /* LDA $0300 */
+    mem[0x1004] = 0x00;
+    mem[0x1005] = 0x03;
+    mem[0x1006] = 0xAD;             /* LDA $0301 */
+    mem[0x1007] = 0x01;
+    mem[0x1008] = 0x03;
+    mem[0x1009] = 0xDB;             /* STP */
+
+    j65c02* inst = sanitized_create(mem);
+    TEST_ASSERT(nullptr != inst);
+
+    TEST_EXPECT(JEMU_ERROR_SANITIZER_VIOLATION == j65c02_run(inst, 100));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(JEMU_SANITIZER_VIOLATION_UNINITIALIZED == report.kind);
+    TEST_EXPECT(0x0301 == report.addr);
+    TEST_EXPECT(0x1006 == report.pc);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that an opcode fetched from memory that is not executable is
+ * reported before it runs, with the program counter left on it.
+ */
+TEST(exec)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02_sanitizer_report report;
+    int count = 0;
+
+    mem[0x1000] = 0xA9;             /* LDA #$E8 */
+    mem[0x1001] = 0xE8;
+    mem[0x1002] = 0x8D;             /* STA $0400 */
+    mem[0x1003] = 0x00;
+    mem[0x1004] = 0x04;
+    mem[0x1005] = 0x4C;             /* JMP $0400 */
+    mem[0x1006] = 0x00;
+    mem[0x1007] = 0x04;
+
+    j65c02* inst = sanitized_create(mem);
+    TEST_ASSERT(nullptr != inst);
+
+    /* the sanitizer stays outermost, and still calls the hooks. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_hooks_set(inst, &count_hook, NULL, &count));
+
+    TEST_EXPECT(JEMU_ERROR_SANITIZER_VIOLATION == j65c02_run(inst, 100));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(JEMU_SANITIZER_VIOLATION_EXEC == report.kind);
+    TEST_EXPECT(0x0400 == report.addr);
+    TEST_EXPECT(0x0400 == report.pc);
+    TEST_EXPECT(0x0400 == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(0 == j65c02_reg_x_get(inst));
+    TEST_EXPECT(3 == count);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that pushes and pulls that wrap the stack pointer are reported.
+ */
+TEST(stack)
+{
+    std::vector<uint8_t> mem(65536);
+    j65c02_sanitizer_report report;
+
+    mem[0x1000] = 0xA2;             /* LDX #$01 */
+    mem[0x1001] = 0x01;
+    mem[0x1002] = 0x9A;             /* TXS */
+    mem[0x1003] = 0x48;             /* PHA */
+    mem[0x1004] = 0x48;             /* PHA */
+    mem[0x1005] = 0x48;             /* PHA */
+    mem[0x1010] = 0xA2;             /* LDX #$FE */
+    mem[0x1011] = 0xFE;
+    mem[0x1012] = 0x9A;             /* TXS */
+    mem[0x1013] = 0x68;             /* PLA */
+    mem[0x1014] = 0x68;             /* PLA */
+
+    j65c02* inst = sanitized_create(mem);
+    TEST_ASSERT(nullptr != inst);
+
+    TEST_EXPECT(JEMU_ERROR_SANITIZER_VIOLATION == j65c02_run(inst, 100));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(JEMU_SANITIZER_VIOLATION_STACK_OVERFLOW == report.kind);
+    TEST_EXPECT(0x01FF == report.addr);
+    TEST_EXPECT(0x1004 == report.pc);
+
+    j65c02_reg_pc_set(inst, 0x1010);
+    TEST_EXPECT(JEMU_ERROR_SANITIZER_VIOLATION == j65c02_run(inst, 100));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_sanitizer_report_get(inst, &report));
+    TEST_EXPECT(JEMU_SANITIZER_VIOLATION_STACK_UNDERFLOW == report.kind);
+    TEST_EXPECT(0x0100 == report.addr);
+    TEST_EXPECT(0x1014 == report.pc);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
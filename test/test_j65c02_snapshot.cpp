@@ -0,0 +1,130 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/snapshot.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_snapshot;
+
+TEST_SUITE(j65c02_snapshot);
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that restoring a snapshot rolls back the processor and every
+ * registered memory region.
+ */
+TEST(save_and_restore)
+{
+    j65c02* inst = nullptr;
+    j65c02_snapshot* snapshot = nullptr;
+    uint8_t mem[65536], saved_mem[65536];
+
+    memset(mem, 0, sizeof(mem));
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    /* at 0x1000, INX; STX $0200; JMP $1000. */
+    mem[0x1000] = 0xE8;
+    mem[0x1001] = 0x8E;
+    mem[0x1002] = 0x00;
+    mem[0x1003] = 0x02;
+    mem[0x1004] = 0x4C;
+    mem[0x1005] = 0x00;
+    mem[0x1006] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(inst));
+
+    /* zero page and stack in one region, the rest in another. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_memory_region_add(inst, 0x0000, mem, 0x200));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(
+                    inst, 0x0200, mem + 0x200, 65536 - 0x200));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_create(&snapshot, inst));
+
+    /* run a while, then save. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 123));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_save(snapshot, inst));
+
+    uint8_t x = j65c02_reg_x_get(inst);
+    uint16_t pc = j65c02_reg_pc_get(inst);
+    uint64_t count = j65c02_cycle_count_get(inst);
+    int delta = j65c02_cycle_delta_get(inst);
+    memcpy(saved_mem, mem, sizeof(mem));
+
+    /* run some more, so that everything changes. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 1001));
+    TEST_ASSERT(x != j65c02_reg_x_get(inst));
+    TEST_ASSERT(0 != memcmp(saved_mem, mem, sizeof(mem)));
+
+    /* restore. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_restore(snapshot, inst));
+    TEST_EXPECT(x == j65c02_reg_x_get(inst));
+    TEST_EXPECT(pc == j65c02_reg_pc_get(inst));
+    TEST_EXPECT(count == j65c02_cycle_count_get(inst));
+    TEST_EXPECT(delta == j65c02_cycle_delta_get(inst));
+    TEST_EXPECT(0 == memcmp(saved_mem, mem, sizeof(mem)));
+
+    /* a snapshot can be restored more than once. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 50));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_restore(snapshot, inst));
+    TEST_EXPECT(x == j65c02_reg_x_get(inst));
+    TEST_EXPECT(0 == memcmp(saved_mem, mem, sizeof(mem)));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_release(snapshot));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a snapshot can't be used with a different memory layout.
+ */
+TEST(layout_mismatch)
+{
+    j65c02* inst = nullptr;
+    j65c02_snapshot* snapshot = nullptr;
+    uint8_t mem[65536];
+
+    memset(mem, 0, sizeof(mem));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &mem_read, &mem_write, mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_create(&snapshot, inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_memory_region_add(inst, 0x0000, mem, 0x100));
+
+    TEST_EXPECT(
+        JEMU_ERROR_SNAPSHOT_MISMATCH == j65c02_snapshot_save(snapshot, inst));
+    TEST_EXPECT(
+        JEMU_ERROR_SNAPSHOT_MISMATCH
+            == j65c02_snapshot_restore(snapshot, inst));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_snapshot_release(snapshot));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
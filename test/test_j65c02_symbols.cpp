@@ -0,0 +1,155 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/symbols.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_symbols;
+
+TEST_SUITE(j65c02_symbols);
+
+/**
+ * Verify that labels can be loaded from a VICE label list and found at and
+ * after their addresses, in their own bank only.
+ */
+TEST(vice)
+{
+    j65c02_symbols* symbols = nullptr;
+    const char* name;
+    uint16_t offset;
+    char text[16];
+
+    static const char labels[] =
+        "; kernal labels\n"
+        "al C:e000 .reset\n"
+        "al C:e050 .irq_handler\n"
+        "al D:e000 .drive_reset\n"
+        "\n"
+        "$E020 main_loop\n"
+        "al C:E000 .duplicate\n";
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_symbols_create(&symbols));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_symbols_load_vice(
+                    symbols, 1, labels, sizeof(labels) - 1));
+
+    /* a label is found at its address, and the first one loaded wins. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_symbols_lookup(symbols, 1, 0xE000, &name, &offset));
+    TEST_EXPECT(!strcmp("reset", name));
+    TEST_EXPECT(0 == offset);
+
+    /* an address past a label is found by its offset. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_symbols_lookup(symbols, 1, 0xE04F, &name, &offset));
+    TEST_EXPECT(!strcmp("main_loop", name));
+    TEST_EXPECT(0x2F == offset);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_symbols_lookup(symbols, 1, 0xFFFF, &name, &offset));
+    TEST_EXPECT(!strcmp("irq_handler", name));
+
+    /* there is nothing before the first label, or in another bank. */
+    TEST_EXPECT(
+        JEMU_ERROR_SYMBOLS_NOT_FOUND
+            == j65c02_symbols_lookup(symbols, 1, 0xDFFF, &name, &offset));
+    TEST_EXPECT(
+        JEMU_ERROR_SYMBOLS_NOT_FOUND
+            == j65c02_symbols_lookup(symbols, 0, 0xE000, &name, &offset));
+    TEST_EXPECT(
+        JEMU_ERROR_SYMBOLS_NOT_FOUND
+            == j65c02_symbols_lookup(symbols, 2, 0xE000, &name, &offset));
+
+    /* addresses are formatted by label, offset, or value. */
+    TEST_EXPECT(9 == j65c02_symbols_format(symbols, 1, 0xE020, text, 16));
+    TEST_EXPECT(!strcmp("main_loop", text));
+    TEST_EXPECT(13 == j65c02_symbols_format(symbols, 1, 0xE053, text, 16));
+    TEST_EXPECT(!strcmp("irq_handler+3", text));
+    TEST_EXPECT(5 == j65c02_symbols_format(symbols, 0, 0xE053, text, 16));
+    TEST_EXPECT(!strcmp("$E053", text));
+    TEST_EXPECT(5 == j65c02_symbols_format(nullptr, 1, 0xE053, text, 16));
+    TEST_EXPECT(!strcmp("$E053", text));
+
+    /* text that does not fit is cut short. */
+    TEST_EXPECT(7 == j65c02_symbols_format(symbols, 1, 0xE053, text, 8));
+    TEST_EXPECT(!strcmp("irq_han", text));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_symbols_release(symbols));
+}
+
+/**
+ * Verify that the labels of an ld65 debug info file are loaded, and that
+ * other symbols are skipped.
+ */
+TEST(dbg)
+{
+    j65c02_symbols* symbols = nullptr;
+    const char* name;
+    uint16_t offset;
+
+    static const char info[] =
+        "version\tmajor=2,minor=0\n"
+        "info\tcsym=0,file=1,lib=0,line=4,mod=1,scope=1,seg=2,span=2,sym=4\n"
+        "file\tid=0,name=\"main.s\",size=120,mtime=0x5F000000,mod=0\n"
+        "seg\tid=0,name=\"CODE\",start=0x008000,size=0x0040,addrsize=abs\n"
+        "sym\tid=0,name=\"start\",addrsize=absolute,scope=0,def=0,"
+            "val=0x8000,seg=0,type=lab\n"
+        "sym\tid=1,name=\"@loop\",addrsize=absolute,scope=0,parent=0,def=1,"
+            "val=0x8004,seg=0,type=lab\n"
+        "sym\tid=2,name=\"SCREEN\",addrsize=absolute,scope=0,def=2,"
+            "val=0x0400,type=equ\n"
+        "sym\tid=3,name=\"vector\",addrsize=absolute,scope=0,ref=3,"
+            "type=imp\n";
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_symbols_create(&symbols));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_symbols_load_dbg(symbols, 0, info, sizeof(info) - 1));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_symbols_lookup(symbols, 0, 0x8002, &name, &offset));
+    TEST_EXPECT(!strcmp("start", name));
+    TEST_EXPECT(2 == offset);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_symbols_lookup(symbols, 0, 0x8004, &name, &offset));
+    TEST_EXPECT(!strcmp("@loop", name));
+
+    /* equates are not labels. */
+    TEST_EXPECT(
+        JEMU_ERROR_SYMBOLS_NOT_FOUND
+            == j65c02_symbols_lookup(symbols, 0, 0x0400, &name, &offset));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_symbols_release(symbols));
+}
+
+/**
+ * Verify that malformed lines are rejected.
+ */
+TEST(bad_format)
+{
+    j65c02_symbols* symbols = nullptr;
+
+    static const char vice[] = "al C:12345 .too_wide\n";
+    static const char unnamed[] = "$1234\n";
+    static const char dbg[] =
+        "sym\tid=0,name=\"far\",val=0x10000,type=lab\n";
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_symbols_create(&symbols));
+    TEST_EXPECT(
+        JEMU_ERROR_SYMBOLS_BAD_FORMAT
+            == j65c02_symbols_load_vice(symbols, 0, vice, sizeof(vice) - 1));
+    TEST_EXPECT(
+        JEMU_ERROR_SYMBOLS_BAD_FORMAT
+            == j65c02_symbols_load_vice(
+                    symbols, 0, unnamed, sizeof(unnamed) - 1));
+    TEST_EXPECT(
+        JEMU_ERROR_SYMBOLS_BAD_FORMAT
+            == j65c02_symbols_load_dbg(symbols, 0, dbg, sizeof(dbg) - 1));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_symbols_release(symbols));
+}
@@ -0,0 +1,379 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/system.h>
+#include <string.h>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_system;
+
+TEST_SUITE(j65c02_system);
+
+namespace {
+
+/**
+ * A CPU board with private memory, a shared window at $8000-$8FFF, and a pair
+ * of mailbox registers.
+ *
+ *  - $D000 reads receive from the inbox (0 if empty); writes send to the
+ *    outbox.
+ *  - $D001 reads the number of messages waiting in the inbox.
+ *  - $D002 reads the number of messages waiting in the outbox.
+ */
+struct board
+{
+    uint8_t mem[65536];
+    uint8_t* shared;
+    j65c02_mailbox* inbox;
+    j65c02_mailbox* outbox;
+};
+
+}
+
+static status board_read(void* ctx, uint16_t addr, uint8_t* val)
+{
+    board* b = (board*)ctx;
+
+    if (addr >= 0x8000 && addr < 0x9000)
+    {
+        *val = b->shared[addr - 0x8000];
+    }
+    else if (0xD000 == addr)
+    {
+        if (STATUS_SUCCESS != j65c02_mailbox_receive(b->inbox, val))
+        {
+            *val = 0;
+        }
+    }
+    else if (0xD001 == addr)
+    {
+        *val = (uint8_t)j65c02_mailbox_count_get(b->inbox);
+    }
+    else if (0xD002 == addr)
+    {
+        *val = (uint8_t)j65c02_mailbox_count_get(b->outbox);
+    }
+    else
+    {
+        *val = b->mem[addr];
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static status board_write(void* ctx, uint16_t addr, uint8_t val)
+{
+    board* b = (board*)ctx;
+
+    if (addr >= 0x8000 && addr < 0x9000)
+    {
+        b->shared[addr - 0x8000] = val;
+    }
+    else if (0xD000 == addr)
+    {
+        return j65c02_mailbox_send(b->outbox, val);
+    }
+    else
+    {
+        b->mem[addr] = val;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/* sends 1 through 200 to the outbox, waiting while it is full, then stops. */
+static const uint8_t producer[] = {
+    0xA2, 0x01,             /* 1000: LDX #$01    */
+    0xAD, 0x02, 0xD0,       /* 1002: LDA $D002   */
+    0xC9, 0x10,             /* 1005: CMP #$10    */
+    0xB0, 0xF9,             /* 1007: BCS $1002   */
+    0x8E, 0x00, 0xD0,       /* 1009: STX $D000   */
+    0xE8,                   /* 100C: INX         */
+    0xE0, 0xC9,             /* 100D: CPX #$C9    */
+    0xD0, 0xF1,             /* 100F: BNE $1002   */
+    0xDB,                   /* 1011: STP         */
+};
+
+/* sums 200 messages from the inbox into shared $8000-$8001, then stops. */
+static const uint8_t consumer[] = {
+    0xA0, 0x00,             /* 1000: LDY #$00    */
+    0xAD, 0x01, 0xD0,       /* 1002: LDA $D001   */
+    0xF0, 0xFB,             /* 1005: BEQ $1002   */
+    0xAD, 0x00, 0xD0,       /* 1007: LDA $D000   */
+    0x18,                   /* 100A: CLC         */
+    0x6D, 0x00, 0x80,       /* 100B: ADC $8000   */
+    0x8D, 0x00, 0x80,       /* 100E: STA $8000   */
+    0x90, 0x03,             /* 1011: BCC $1016   */
+    0xEE, 0x01, 0x80,       /* 1013: INC $8001   */
+    0xC8,                   /* 1016: INY         */
+    0xC0, 0xC8,             /* 1017: CPY #$C8    */
+    0xD0, 0xE7,             /* 1019: BNE $1002   */
+    0xDB,                   /* 101B: STP         */
+};
+
+/**
+ * Build a producer / consumer system with a 16 message mailbox.
+ */
+static status system_build(
+    j65c02_system** system, board* boards, int quantum, int flags)
+{
+    const uint8_t* programs[2] = { producer, consumer };
+    const size_t sizes[2] = { sizeof(producer), sizeof(consumer) };
+    j65c02_mailbox* mailbox;
+    uint8_t* shared;
+    status retval;
+
+    retval = j65c02_system_create(system, 2, quantum, flags);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = j65c02_system_shared_create(*system, 4096, &shared);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = j65c02_system_mailbox_create(*system, 16, &mailbox);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        j65c02* inst;
+
+        memset(boards[i].mem, 0, sizeof(boards[i].mem));
+        memcpy(boards[i].mem + 0x1000, programs[i], sizes[i]);
+        boards[i].mem[0xFFFC] = 0x00;
+        boards[i].mem[0xFFFD] = 0x10;
+        boards[i].shared = shared;
+        boards[i].inbox = mailbox;
+        boards[i].outbox = mailbox;
+
+        retval =
+            j65c02_create(
+                &inst, &board_read, &board_write, boards + i,
+                JEMU_65c02_PERSONALITY_WDC, JEMU_65c02_EMULATION_MODE_STRICT);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = j65c02_system_cpu_attach(*system, i, inst);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = j65c02_reset(inst);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Verify that messages pass between CPUs running on their own threads.
+ */
+TEST(run_threaded)
+{
+    j65c02_system* system = nullptr;
+    board boards[2];
+    status results[2];
+
+    TEST_ASSERT(STATUS_SUCCESS == system_build(&system, boards, 100, 0));
+
+    while (!j65c02_stopped_flag_get(j65c02_system_cpu_get(system, 1)))
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_system_run(system, 10000, results));
+        TEST_ASSERT(STATUS_SUCCESS == results[0]);
+        TEST_ASSERT(STATUS_SUCCESS == results[1]);
+    }
+
+    /* the consumer saw 1 + 2 + ... + 200 == 20100. */
+    TEST_EXPECT(0x84 == boards[1].shared[0]);
+    TEST_EXPECT(0x4E == boards[1].shared[1]);
+    TEST_EXPECT(j65c02_stopped_flag_get(j65c02_system_cpu_get(system, 0)));
+
+    /* CPUs stay within a quantum of each other, so the run times match. */
+    TEST_EXPECT(
+        j65c02_cycle_count_get(j65c02_system_cpu_get(system, 0))
+            <= j65c02_cycle_count_get(j65c02_system_cpu_get(system, 1)));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_release(system));
+}
+
+/**
+ * Verify that a deterministic run matches interleaving j65c02_run by hand.
+ */
+TEST(run_deterministic)
+{
+    const int QUANTUM = 37;
+    const int CYCLES = 1000;
+    j65c02_system* system = nullptr;
+    j65c02_system* manual = nullptr;
+    board boards[2], manual_boards[2];
+    status results[2];
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == system_build(
+                    &system, boards, QUANTUM,
+                    JEMU_SYSTEM_FLAG_DETERMINISTIC));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == system_build(
+                    &manual, manual_boards, QUANTUM,
+                    JEMU_SYSTEM_FLAG_DETERMINISTIC));
+
+    for (int run = 0; run < 20; ++run)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_system_run(system, CYCLES, results));
+
+        /* interleave the same quanta by hand, including the short one. */
+        for (int remaining = CYCLES; remaining > 0; remaining -= QUANTUM)
+        {
+            int quantum = remaining < QUANTUM ? remaining : QUANTUM;
+
+            for (size_t i = 0; i < 2; ++i)
+            {
+                TEST_ASSERT(
+                    STATUS_SUCCESS
+                        == j65c02_run(
+                                j65c02_system_cpu_get(manual, i), quantum));
+            }
+        }
+
+        for (size_t i = 0; i < 2; ++i)
+        {
+            j65c02* a = j65c02_system_cpu_get(system, i);
+            j65c02* b = j65c02_system_cpu_get(manual, i);
+
+            TEST_EXPECT(STATUS_SUCCESS == results[i]);
+            TEST_EXPECT(j65c02_reg_a_get(a) == j65c02_reg_a_get(b));
+            TEST_EXPECT(j65c02_reg_x_get(a) == j65c02_reg_x_get(b));
+            TEST_EXPECT(j65c02_reg_y_get(a) == j65c02_reg_y_get(b));
+            TEST_EXPECT(j65c02_reg_pc_get(a) == j65c02_reg_pc_get(b));
+            TEST_EXPECT(j65c02_cycle_count_get(a) == j65c02_cycle_count_get(b));
+        }
+
+        TEST_EXPECT(0 == memcmp(boards[0].shared, manual_boards[0].shared, 2));
+    }
+
+    /* by now, every message has been sent and summed. */
+    TEST_EXPECT(0x84 == boards[1].shared[0]);
+    TEST_EXPECT(0x4E == boards[1].shared[1]);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_release(system));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_release(manual));
+}
+
+/**
+ * Verify that a failing CPU is reported without stopping the others.
+ */
+TEST(run_reports_errors)
+{
+    j65c02_system* system = nullptr;
+    board boards[2];
+    status results[2];
+
+    TEST_ASSERT(STATUS_SUCCESS == system_build(&system, boards, 50, 0));
+
+    /* the consumer executes an invalid opcode. */
+    boards[1].mem[0x1000] = 0x02;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_run(system, 1000, results));
+    TEST_EXPECT(STATUS_SUCCESS == results[0]);
+    TEST_EXPECT(JEMU_ERROR_INVALID_OPCODE == results[1]);
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_release(system));
+}
+
+/**
+ * Verify that a mailbox delivers messages in order and reports full and empty.
+ */
+TEST(mailbox_ring)
+{
+    j65c02_system* system = nullptr;
+    j65c02_mailbox* mailbox = nullptr;
+    uint8_t val;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_create(&system, 1, 10, 0));
+
+    /* a capacity of 3 is rounded up to 4. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_system_mailbox_create(system, 3, &mailbox));
+    TEST_EXPECT(JEMU_ERROR_MAILBOX_EMPTY == j65c02_mailbox_receive(mailbox, &val));
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (uint8_t i = 0; i < 4; ++i)
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_mailbox_send(mailbox, i));
+        }
+
+        TEST_EXPECT(4 == j65c02_mailbox_count_get(mailbox));
+        TEST_EXPECT(JEMU_ERROR_MAILBOX_FULL == j65c02_mailbox_send(mailbox, 9));
+
+        for (uint8_t i = 0; i < 4; ++i)
+        {
+            TEST_ASSERT(
+                STATUS_SUCCESS == j65c02_mailbox_receive(mailbox, &val));
+            TEST_EXPECT(i == val);
+        }
+
+        TEST_EXPECT(0 == j65c02_mailbox_count_get(mailbox));
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_release(system));
+}
+
+/**
+ * Verify the system argument checks.
+ */
+TEST(create_and_attach_checks)
+{
+    j65c02_system* system = nullptr;
+    board b;
+    j65c02* inst;
+    status results[2];
+
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_CPU_COUNT
+            == j65c02_system_create(&system, 0, 10, 0));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_QUANTUM == j65c02_system_create(&system, 2, 0, 0));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_create(&system, 2, 10, 0));
+
+    /* a system with a missing CPU can't run. */
+    TEST_EXPECT(
+        JEMU_ERROR_SYSTEM_INCOMPLETE
+            == j65c02_system_run(system, 100, results));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &inst, &board_read, &board_write, &b,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_CPU_INDEX
+            == j65c02_system_cpu_attach(system, 2, inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_cpu_attach(system, 0, inst));
+    TEST_EXPECT(
+        JEMU_ERROR_INVALID_CPU_INDEX
+            == j65c02_system_cpu_attach(system, 0, inst));
+    TEST_EXPECT(inst == j65c02_system_cpu_get(system, 0));
+    TEST_EXPECT(nullptr == j65c02_system_cpu_get(system, 1));
+    TEST_EXPECT(nullptr == j65c02_system_cpu_get(system, 2));
+
+    /* releasing the system releases the attached CPU. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_system_release(system));
+}
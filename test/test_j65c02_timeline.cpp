@@ -0,0 +1,214 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/timeline.h>
+#include <string>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_timeline;
+
+TEST_SUITE(j65c02_timeline);
+
+namespace {
+
+struct machine
+{
+    std::vector<uint8_t> mem;
+    j65c02* inst;
+    j65c02_timeline* timeline;
+};
+
+}
+
+static status mem_read(void* vmachine, uint16_t addr, uint8_t* val)
+{
+    machine* m = (machine*)vmachine;
+
+    *val = m->mem[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* vmachine, uint16_t addr, uint8_t val)
+{
+    machine* m = (machine*)vmachine;
+
+    /* the device at $D000 records its own span. */
+    if (0xD000 == addr)
+    {
+        uint64_t cycles = j65c02_cycle_count_get(m->inst);
+
+        if (STATUS_SUCCESS
+                != j65c02_timeline_begin(
+                        m->timeline, 0, JEMU_TIMELINE_LANE_DEVICE, "uart",
+                        cycles)
+         || STATUS_SUCCESS
+                != j65c02_timeline_end(
+                        m->timeline, 0, JEMU_TIMELINE_LANE_DEVICE, cycles))
+        {
+            return JEMU_ERROR_TIMELINE_BAD_TRACK;
+        }
+    }
+
+    m->mem[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+static status text_sink(void* vout, const char* data, size_t size)
+{
+    std::string* out = (std::string*)vout;
+
+    out->append(data, size);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * Count the events of a phase in a timeline.
+ */
+static size_t phase_count(const std::string& json, char phase)
+{
+    std::string key = std::string("\"ph\":\"") + phase + "\"";
+    size_t count = 0;
+
+    for (size_t pos = json.find(key); std::string::npos != pos;
+         pos = json.find(key, pos + 1))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+/**
+ * Verify that an attached instance records its run slices, waits, and
+ * interrupt handlers, and that devices can record their own spans.
+ */
+TEST(spans)
+{
+    machine m;
+    std::string json;
+
+    m.mem.resize(65536);
+    m.mem[0x1000] = 0x58;           /* CLI */
+    m.mem[0x1001] = 0xCB;           /* WAI */
+    m.mem[0x1002] = 0xDB;           /* STP */
+    m.mem[0x1400] = 0x8D;           /* STA $D000 */
+    m.mem[0x1401] = 0x00;
+    m.mem[0x1402] = 0xD0;
+    m.mem[0x1403] = 0x40;           /* RTI */
+    m.mem[0xFFFC] = 0x00;
+    m.mem[0xFFFD] = 0x10;
+    m.mem[0xFFFE] = 0x00;
+    m.mem[0xFFFF] = 0x14;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_timeline_create(&m.timeline, 1, 64));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    &m.inst, &mem_read, &mem_write, &m,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(m.inst));
+    TEST_EXPECT(
+        JEMU_ERROR_TIMELINE_BAD_TRACK
+            == j65c02_timeline_attach(m.inst, m.timeline, 1));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_timeline_attach(m.inst, m.timeline, 0));
+
+    /* run into the WAI, wake it, and run the handler through to STP. */
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(m.inst, 100));
+    TEST_ASSERT(j65c02_wait_flag_get(m.inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_interrupt(m.inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(m.inst, 100));
+    TEST_ASSERT(j65c02_stopped_flag_get(m.inst));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_timeline_write(
+                    m.timeline, JEMU_TIMELINE_CLOCK_CYCLES, &text_sink,
+                    &json));
+
+    /* the events nest, and are named. */
+    TEST_EXPECT(0 == json.find("{\"traceEvents\":["));
+    TEST_EXPECT(5 == phase_count(json, 'B'));
+    TEST_EXPECT(5 == phase_count(json, 'E'));
+    TEST_EXPECT(4 == phase_count(json, 'M'));
+    TEST_EXPECT(std::string::npos != json.find("\"name\":\"wai\""));
+    TEST_EXPECT(std::string::npos != json.find("\"name\":\"irq\""));
+    TEST_EXPECT(std::string::npos != json.find("\"name\":\"uart\""));
+    TEST_EXPECT(
+        std::string::npos
+            != json.find(
+                    "{\"ph\":\"B\",\"pid\":0,\"tid\":1,\"ts\":5,"
+                    "\"name\":\"wai\"}"));
+    TEST_EXPECT(0 == j65c02_timeline_dropped_get(m.timeline));
+
+    /* the host clock is written in microseconds, to the nanosecond. */
+    json.clear();
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_timeline_write(
+                    m.timeline, JEMU_TIMELINE_CLOCK_HOST, &text_sink, &json));
+    TEST_EXPECT(std::string::npos != json.find("\"ts\":"));
+    TEST_EXPECT(std::string::npos == json.find("\"ts\":5,"));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(m.inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_timeline_release(m.timeline));
+}
+
+/**
+ * Verify that a full track drops events without leaving spans open, and that
+ * names are escaped.
+ */
+TEST(full_track)
+{
+    j65c02_timeline* timeline = nullptr;
+    std::string json;
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_timeline_create(&timeline, 2, 3));
+
+    /* only the outer span fits, with one instant. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_timeline_begin(
+                    timeline, 1, JEMU_TIMELINE_LANE_DEVICE, "outer", 1));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_timeline_instant(
+                    timeline, 1, JEMU_TIMELINE_LANE_DEVICE, "say \"hi\"", 2));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_timeline_begin(
+                    timeline, 1, JEMU_TIMELINE_LANE_DEVICE, "inner", 3));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_timeline_end(
+                    timeline, 1, JEMU_TIMELINE_LANE_DEVICE, 4));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_timeline_end(
+                    timeline, 1, JEMU_TIMELINE_LANE_DEVICE, 5));
+    TEST_EXPECT(
+        JEMU_ERROR_TIMELINE_BAD_TRACK
+            == j65c02_timeline_end(timeline, 2, JEMU_TIMELINE_LANE_HOST, 6));
+    TEST_EXPECT(
+        JEMU_ERROR_TIMELINE_BAD_TRACK
+            == j65c02_timeline_end(timeline, 0, JEMU_TIMELINE_LANES, 6));
+    TEST_EXPECT(2 == j65c02_timeline_dropped_get(timeline));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_timeline_write(
+                    timeline, JEMU_TIMELINE_CLOCK_CYCLES, &text_sink, &json));
+    TEST_EXPECT(1 == phase_count(json, 'B'));
+    TEST_EXPECT(1 == phase_count(json, 'i'));
+    TEST_EXPECT(1 == phase_count(json, 'E'));
+    TEST_EXPECT(std::string::npos == json.find("inner"));
+    TEST_EXPECT(
+        std::string::npos != json.find("\"ts\":5}"));
+    TEST_EXPECT(
+        std::string::npos != json.find("\"name\":\"say \\\"hi\\\"\""));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_timeline_release(timeline));
+}
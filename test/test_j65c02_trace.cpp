@@ -0,0 +1,757 @@
+#include <minunit/minunit.h>
+#include <jemu65c02/dma.h>
+#include <jemu65c02/flight_recorder.h>
+#include <jemu65c02/trace.h>
+#include <string.h>
+#include <vector>
+
+JEMU_IMPORT_jemu65c02;
+JEMU_IMPORT_jemu65c02_dma;
+JEMU_IMPORT_jemu65c02_flight_recorder;
+JEMU_IMPORT_jemu65c02_trace;
+
+TEST_SUITE(j65c02_trace);
+
+static status mem_read(void* varr, uint16_t addr, uint8_t* val)
+{
+    const uint8_t* arr = (const uint8_t*)varr;
+
+    *val = arr[addr];
+
+    return STATUS_SUCCESS;
+}
+
+static status mem_write(void* varr, uint16_t addr, uint8_t val)
+{
+    uint8_t* arr = (uint8_t*)varr;
+
+    arr[addr] = val;
+
+    return STATUS_SUCCESS;
+}
+
+static status sink(void* vout, const uint8_t* data, size_t size)
+{
+    std::vector<uint8_t>* out = (std::vector<uint8_t>*)vout;
+
+    out->insert(out->end(), data, data + size);
+
+    return STATUS_SUCCESS;
+}
+
+struct source_context
+{
+    const std::vector<uint8_t>* in;
+    size_t pos;
+};
+
+/* hand the trace back a few bytes at a time. */
+static size_t source(void* vctx, uint8_t* data, size_t size)
+{
+    source_context* ctx = (source_context*)vctx;
+    size_t left = ctx->in->size() - ctx->pos;
+
+    if (size > left)
+    {
+        size = left;
+    }
+
+    if (size > 1000)
+    {
+        size = 1000;
+    }
+
+    memcpy(data, ctx->in->data() + ctx->pos, size);
+    ctx->pos += size;
+
+    return size;
+}
+
+/**
+ * \brief Create an instance over a flat memory image and reset it.
+ */
+static void instance_create(bool& mu_fail, j65c02** inst, uint8_t* mem)
+{
+    mem[0xFFFC] = 0x00;
+    mem[0xFFFD] = 0x10;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    inst, &mem_read, &mem_write, mem,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(*inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(*inst, 0x0000, mem, 65536));
+}
+
+/**
+ * Verify that a long trace reads back the same instructions that the flight
+ * recorder saw, in a few bytes per instruction.
+ */
+TEST(round_trip)
+{
+    j65c02* inst = nullptr;
+    j65c02_trace_writer* writer = nullptr;
+    j65c02_trace* trace = nullptr;
+    j65c02_trace_reader* reader = nullptr;
+    j65c02_trace_record record;
+    std::vector<uint8_t> mem(65536);
+    std::vector<uint8_t> out;
+    std::vector<j65c02_flight_entry> entries(1 << 18);
+    source_context ctx = { &out, 0 };
+    size_t count, index = 0;
+    status retval;
+
+    static const uint8_t code[] = {
+        0xA0, 0x00,                 /* LDY #$00 */
+        0xA2, 0x00,                 /* outer: LDX #$00 */
+        0xE8,                       /* inner: INX */
+        0xD0, 0xFD,                 /* BNE inner */
+        0xC8,                       /* INY */
+        0xD0, 0xF8,                 /* BNE outer */
+        0xDB };                     /* STP */
+
+    memcpy(mem.data() + 0x1000, code, sizeof(code));
+    instance_create(mu_fail, &inst, mem.data());
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_flight_recorder_enable(inst, entries.size()));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_writer_create(&writer, &sink, &out));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_create(&trace, writer, inst, 0));
+
+    /* an instance is traced only once. */
+    j65c02_trace* again = nullptr;
+    TEST_EXPECT(
+        JEMU_ERROR_TRACE_ATTACHED
+            == j65c02_trace_create(&again, writer, inst, 0));
+
+    for (int runs = 0; runs < 1000 && !j65c02_stopped_flag_get(inst); ++runs)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 10000));
+    }
+
+    TEST_ASSERT(j65c02_stopped_flag_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_release(trace));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+
+    count =
+        j65c02_flight_recorder_dump(inst, entries.data(), entries.size());
+    TEST_ASSERT(count > 100000);
+    TEST_ASSERT(count < entries.size());
+
+    /* the inner loop compresses to a few bytes per instruction. */
+    TEST_EXPECT(out.size() < 3 * count);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_reader_create(&reader, &source, &ctx));
+
+    while (STATUS_SUCCESS
+                == (retval = j65c02_trace_reader_next(reader, &record))
+        && JEMU_TRACE_RECORD_END != record.type)
+    {
+        TEST_ASSERT(index < count);
+        const j65c02_flight_entry& entry = entries[index++];
+
+        TEST_ASSERT(JEMU_TRACE_RECORD_INSTRUCTION == record.type);
+        TEST_ASSERT(0 == record.stream);
+        TEST_ASSERT(index - 1 == record.position);
+        TEST_ASSERT(entry.cycle_count == record.cycle_count);
+        TEST_ASSERT(entry.reg_pc == record.reg_pc);
+        TEST_ASSERT(entry.opcode == record.opcode);
+        TEST_ASSERT(entry.operand_count == record.operand_count);
+        for (uint8_t i = 0; i < entry.operand_count; ++i)
+        {
+            TEST_ASSERT(entry.operands[i] == record.operands[i]);
+        }
+        TEST_ASSERT(entry.reg_a == record.reg_a);
+        TEST_ASSERT(entry.reg_x == record.reg_x);
+        TEST_ASSERT(entry.reg_y == record.reg_y);
+        TEST_ASSERT(entry.reg_sp == record.reg_sp);
+        TEST_ASSERT(entry.reg_status == record.reg_status);
+    }
+
+    /* the trace ends with an end record. */
+    TEST_ASSERT(STATUS_SUCCESS == retval);
+    TEST_EXPECT(count == record.position);
+    TEST_EXPECT(count == index);
+    TEST_EXPECT(
+        JEMU_ERROR_TRACE_END == j65c02_trace_reader_next(reader, &record));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a bus trace records every access, in order.
+ */
+TEST(bus_records)
+{
+    j65c02* inst = nullptr;
+    j65c02_trace_writer* writer = nullptr;
+    j65c02_trace* trace = nullptr;
+    j65c02_trace_reader* reader = nullptr;
+    j65c02_trace_record record;
+    std::vector<uint8_t> mem(65536);
+    std::vector<uint8_t> out;
+    source_context ctx = { &out, 0 };
+
+    static const uint8_t code[] = {
+        0xA9, 0x42,                 /* LDA #$42 */
+        0x8D, 0x00, 0x02,           /* STA $0200 */
+        0xAD, 0x00, 0x02,           /* LDA $0200 */
+        0xDB };                     /* STP */
+
+    static const struct
+    {
+        int type;
+        uint16_t addr;
+        uint8_t value;
+    } expected[] = {
+        { JEMU_TRACE_RECORD_READ,           0x1000, 0xA9 },
+        { JEMU_TRACE_RECORD_INSTRUCTION,    0x1000, 0xA9 },
+        { JEMU_TRACE_RECORD_READ,           0x1001, 0x42 },
+        { JEMU_TRACE_RECORD_READ,           0x1002, 0x8D },
+        { JEMU_TRACE_RECORD_INSTRUCTION,    0x1002, 0x8D },
+        { JEMU_TRACE_RECORD_READ,           0x1003, 0x00 },
+        { JEMU_TRACE_RECORD_READ,           0x1004, 0x02 },
+        { JEMU_TRACE_RECORD_WRITE,          0x0200, 0x42 },
+        { JEMU_TRACE_RECORD_READ,           0x1005, 0xAD },
+        { JEMU_TRACE_RECORD_INSTRUCTION,    0x1005, 0xAD },
+        { JEMU_TRACE_RECORD_READ,           0x1006, 0x00 },
+        { JEMU_TRACE_RECORD_READ,           0x1007, 0x02 },
+        { JEMU_TRACE_RECORD_READ,           0x0200, 0x42 },
+        { JEMU_TRACE_RECORD_READ,           0x1008, 0xDB },
+        { JEMU_TRACE_RECORD_INSTRUCTION,    0x1008, 0xDB },
+        { JEMU_TRACE_RECORD_END,            0x0000, 0x00 } };
+
+    memcpy(mem.data() + 0x1000, code, sizeof(code));
+    instance_create(mu_fail, &inst, mem.data());
+    TEST_ASSERT(!mu_fail);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_writer_create(&writer, &sink, &out));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_create(
+                    &trace, writer, inst, JEMU_TRACE_FLAG_BUS));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 100));
+    TEST_ASSERT(j65c02_stopped_flag_get(inst));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_release(trace));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+
+    /* the bus was restored. */
+    TEST_EXPECT(STATUS_SUCCESS == j65c02_reset(inst));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_reader_create(&reader, &source, &ctx));
+
+    for (const auto& e : expected)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_trace_reader_next(reader, &record));
+        TEST_EXPECT(e.type == record.type);
+        if (JEMU_TRACE_RECORD_END == e.type)
+        {
+            TEST_EXPECT(4 == record.position);
+        }
+        else if (JEMU_TRACE_RECORD_INSTRUCTION == e.type)
+        {
+            TEST_EXPECT(e.addr == record.reg_pc);
+            TEST_EXPECT(e.value == record.opcode);
+        }
+        else
+        {
+            TEST_EXPECT(e.addr == record.addr);
+            TEST_EXPECT(e.value == record.value);
+        }
+    }
+
+    TEST_EXPECT(
+        JEMU_ERROR_TRACE_END == j65c02_trace_reader_next(reader, &record));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * \brief A machine with RAM below $D000, a device at $D000, and ROM above.
+ */
+struct machine
+{
+    std::vector<uint8_t> mem;
+    uint8_t seed;
+};
+
+static status machine_read(void* vm, uint16_t addr, uint8_t* val)
+{
+    machine* m = (machine*)vm;
+
+    /* the device hands out a new value on each read of $D000. */
+    if (0xD000 == (addr & 0xF000))
+    {
+        m->seed = (uint8_t)(m->seed * 13 + 7);
+        *val = (0xD000 == addr) ? m->seed : 0;
+    }
+    else
+    {
+        *val = m->mem[addr];
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static status machine_write(void* vm, uint16_t addr, uint8_t val)
+{
+    machine* m = (machine*)vm;
+
+    if (0xD000 != (addr & 0xF000))
+    {
+        m->mem[addr] = val;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Create a machine running a program that dispatches on device reads.
+ */
+static void machine_create(bool& mu_fail, j65c02** inst, machine* m)
+{
+    static const uint8_t code[] = {
+        0x58,                       /* E000: CLI */
+        0xA0, 0x00,                 /* E001: LDY #$00 */
+        0xAD, 0x00, 0xD0,           /* E003: loop: LDA $D000 */
+        0x99, 0x00, 0x03,           /* E006: STA $0300,Y */
+        0x29, 0x03,                 /* E009: AND #$03 */
+        0x0A,                       /* E00B: ASL A */
+        0xAA,                       /* E00C: TAX */
+        0x7C, 0x40, 0xE0,           /* E00D: JMP ($E040,X) */
+        0xC8,                       /* E010: next: INY */
+        0xD0, 0xF0,                 /* E011: BNE loop */
+        0xDB };                     /* E013: STP */
+
+    static const uint8_t cases[] = {
+        0xE6, 0x10,                 /* E020: INC $10 */
+        0x80, 0xEC,                 /* E022: BRA next */
+        0xE6, 0x11,                 /* E024: INC $11 */
+        0x80, 0xE8,                 /* E026: BRA next */
+        0x8D, 0x01, 0xD0,           /* E028: STA $D001 */
+        0x80, 0xE3,                 /* E02B: BRA next */
+        0xCB,                       /* E02D: WAI */
+        0x80, 0xE0 };               /* E02E: BRA next */
+
+    static const uint8_t table[] = { 0x20, 0xE0, 0x24, 0xE0, 0x28, 0xE0, 0x2D,
+        0xE0 };
+
+    static const uint8_t handler[] = {
+        0xE6, 0x12,                 /* E050: INC $12 */
+        0xAD, 0x02, 0xD0,           /* E052: LDA $D002 */
+        0x40 };                     /* E055: RTI */
+
+    m->mem.assign(65536, 0);
+    m->seed = 1;
+    memcpy(m->mem.data() + 0xE000, code, sizeof(code));
+    memcpy(m->mem.data() + 0xE020, cases, sizeof(cases));
+    memcpy(m->mem.data() + 0xE040, table, sizeof(table));
+    memcpy(m->mem.data() + 0xE050, handler, sizeof(handler));
+    m->mem[0xFFFC] = 0x00;
+    m->mem[0xFFFD] = 0xE0;
+    m->mem[0xFFFE] = 0x50;
+    m->mem[0xFFFF] = 0xE0;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_create(
+                    inst, &machine_read, &machine_write, m,
+                    JEMU_65c02_PERSONALITY_WDC,
+                    JEMU_65c02_EMULATION_MODE_STRICT));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_reset(*inst));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(*inst, 0x0000, m->mem.data(), 0xD000));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_memory_region_add(
+                    *inst, 0xE000, m->mem.data() + 0xE000, 0x2000));
+}
+
+/**
+ * \brief Run a machine to its STP, with a timer interrupt.
+ */
+static void machine_run(bool& mu_fail, j65c02* inst)
+{
+    for (int i = 0; i < 100000 && !j65c02_stopped_flag_get(inst); ++i)
+    {
+        if (j65c02_wait_flag_get(inst) || 0 == i % 37)
+        {
+            TEST_ASSERT(STATUS_SUCCESS == j65c02_interrupt(inst));
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == j65c02_step(inst));
+    }
+
+    TEST_ASSERT(j65c02_stopped_flag_get(inst));
+}
+
+/**
+ * \brief Trace a machine run into the given output.
+ */
+static void machine_trace(
+    bool& mu_fail, std::vector<uint8_t>* out, int flags)
+{
+    j65c02* inst = nullptr;
+    j65c02_trace_writer* writer = nullptr;
+    j65c02_trace* trace = nullptr;
+    machine m;
+
+    machine_create(mu_fail, &inst, &m);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_writer_create(&writer, &sink, out));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_create(&trace, writer, inst, flags));
+    machine_run(mu_fail, inst);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_release(trace));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * Verify that a control flow trace rebuilds the same full trace that was
+ * recorded live, and that a changed program is caught.
+ */
+TEST(rebuild)
+{
+    j65c02* inst = nullptr;
+    j65c02_trace_writer* writer = nullptr;
+    j65c02_trace_reader* live_reader = nullptr;
+    j65c02_trace_reader* reader = nullptr;
+    j65c02_trace_record live, record;
+    std::vector<uint8_t> control, full, rebuilt;
+    source_context control_ctx = { &control, 0 };
+    source_context full_ctx = { &full, 0 };
+    source_context rebuilt_ctx = { &rebuilt, 0 };
+    machine m;
+    size_t count = 0;
+    status retval;
+
+    machine_trace(
+        mu_fail, &control,
+        JEMU_TRACE_FLAG_CONTROL_FLOW | JEMU_TRACE_FLAG_BUS);
+    TEST_ASSERT(!mu_fail);
+    machine_trace(mu_fail, &full, JEMU_TRACE_FLAG_BUS);
+    TEST_ASSERT(!mu_fail);
+
+    /* the control flow trace is much smaller. */
+    TEST_EXPECT(4 * control.size() < full.size());
+
+    /* rebuild onto a fresh machine whose device is never read. */
+    machine_create(mu_fail, &inst, &m);
+    TEST_ASSERT(!mu_fail);
+    m.seed = 0;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_reader_create(&reader, &source, &control_ctx));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_writer_create(&writer, &sink, &rebuilt));
+    TEST_EXPECT(
+        STATUS_SUCCESS
+            == j65c02_trace_rebuild(
+                    reader, 0, inst, writer, JEMU_TRACE_FLAG_BUS));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0 == m.seed);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+
+    /* the rebuilt trace matches the live one, record for record. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_reader_create(&live_reader, &source, &full_ctx));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_reader_create(&reader, &source, &rebuilt_ctx));
+
+    while (STATUS_SUCCESS
+                == (retval = j65c02_trace_reader_next(live_reader, &live)))
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_trace_reader_next(reader, &record));
+        TEST_ASSERT(live.type == record.type);
+        TEST_ASSERT(live.position == record.position);
+        TEST_ASSERT(live.cycle_count == record.cycle_count);
+
+        if (JEMU_TRACE_RECORD_INSTRUCTION == live.type)
+        {
+            TEST_ASSERT(live.reg_pc == record.reg_pc);
+            TEST_ASSERT(live.opcode == record.opcode);
+            TEST_ASSERT(live.reg_a == record.reg_a);
+            TEST_ASSERT(live.reg_x == record.reg_x);
+            TEST_ASSERT(live.reg_y == record.reg_y);
+            TEST_ASSERT(live.reg_sp == record.reg_sp);
+            TEST_ASSERT(live.reg_status == record.reg_status);
+        }
+        else if (
+            JEMU_TRACE_RECORD_READ == live.type
+         || JEMU_TRACE_RECORD_WRITE == live.type)
+        {
+            TEST_ASSERT(live.addr == record.addr);
+            TEST_ASSERT(live.value == record.value);
+        }
+
+        ++count;
+    }
+
+    TEST_EXPECT(JEMU_ERROR_TRACE_END == retval);
+    TEST_EXPECT(
+        JEMU_ERROR_TRACE_END == j65c02_trace_reader_next(reader, &record));
+    TEST_EXPECT(count > 2000);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(live_reader));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+
+    /* a machine running a changed program diverges. */
+    machine_create(mu_fail, &inst, &m);
+    TEST_ASSERT(!mu_fail);
+    m.mem[0xE00A] = 0x01;           /* AND #$01 */
+    control_ctx = { &control, 0 };
+    rebuilt.clear();
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_reader_create(&reader, &source, &control_ctx));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_writer_create(&writer, &sink, &rebuilt));
+    TEST_EXPECT(
+        JEMU_ERROR_REPLAY_DIVERGED
+            == j65c02_trace_rebuild(reader, 0, inst, writer, 0));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+
+    /* a full trace can't be rebuilt. */
+    machine_create(mu_fail, &inst, &m);
+    TEST_ASSERT(!mu_fail);
+    full_ctx = { &full, 0 };
+    rebuilt.clear();
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_reader_create(&reader, &source, &full_ctx));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_writer_create(&writer, &sink, &rebuilt));
+    TEST_EXPECT(
+        JEMU_ERROR_TRACE_BAD_STREAM
+            == j65c02_trace_rebuild(reader, 0, inst, writer, 0));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}
+
+/**
+ * \brief Load a program that copies device bytes to RAM with a DMA controller
+ * at $D008, taking an IRQ after each transfer.
+ */
+static void dma_machine_create(
+    bool& mu_fail, j65c02** inst, j65c02_dma** dma, machine* m)
+{
+    static const uint8_t code[] = {
+        0x58,                       /* E000: CLI */
+        0xA0, 0x00,                 /* E001: LDY #$00 */
+        0x98,                       /* E003: loop: TYA */
+        0x0A, 0x0A, 0x0A, 0x0A,     /* E004: ASL ASL ASL ASL */
+        0x8D, 0x0A, 0xD0,           /* E008: STA $D00A */
+        0xA9, 0x00,                 /* E00B: LDA #$00 */
+        0x8D, 0x08, 0xD0,           /* E00D: STA $D008 */
+        0xA9, 0xD0,                 /* E010: LDA #$D0 */
+        0x8D, 0x09, 0xD0,           /* E012: STA $D009 */
+        0xA9, 0x03,                 /* E015: LDA #$03 */
+        0x8D, 0x0B, 0xD0,           /* E017: STA $D00B */
+        0xA9, 0x10,                 /* E01A: LDA #$10 */
+        0x8D, 0x0C, 0xD0,           /* E01C: STA $D00C */
+        0x9C, 0x0D, 0xD0,           /* E01F: STZ $D00D */
+        0xA9, 0x03,                 /* E022: LDA #$03 */
+        0x8D, 0x0E, 0xD0,           /* E024: STA $D00E */
+        0xC8,                       /* E027: INY */
+        0xC0, 0x08,                 /* E028: CPY #$08 */
+        0xD0, 0xD7,                 /* E02A: BNE loop */
+        0xDB };                     /* E02C: STP */
+
+    static const uint8_t handler[] = {
+        0x8D, 0x0F, 0xD0,           /* E050: STA $D00F */
+        0xE6, 0x12,                 /* E053: INC $12 */
+        0x40 };                     /* E055: RTI */
+
+    machine_create(mu_fail, inst, m);
+    TEST_ASSERT(!mu_fail);
+    memset(m->mem.data() + 0xE000, 0, 0x60);
+    memcpy(m->mem.data() + 0xE000, code, sizeof(code));
+    memcpy(m->mem.data() + 0xE050, handler, sizeof(handler));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_create(dma, *inst, 0xD008, 2));
+}
+
+/**
+ * Verify that a rebuild runs the DMA transfers of the traced run again, with
+ * their device reads from the trace, and takes each DMA IRQ once.
+ */
+TEST(rebuild_dma)
+{
+    j65c02* inst = nullptr;
+    j65c02_dma* dma = nullptr;
+    j65c02_trace_writer* writer = nullptr;
+    j65c02_trace* trace = nullptr;
+    j65c02_trace_reader* live_reader = nullptr;
+    j65c02_trace_reader* reader = nullptr;
+    j65c02_trace_record live, record;
+    std::vector<uint8_t> control, rebuilt;
+    source_context control_ctx = { &control, 0 };
+    source_context rebuilt_ctx = { &rebuilt, 0 };
+    const int flags = JEMU_TRACE_FLAG_CONTROL_FLOW | JEMU_TRACE_FLAG_BUS;
+    machine m;
+    uint8_t page3[128];
+    uint8_t irqs;
+    size_t count = 0;
+    status retval;
+
+    /* trace a run, with timer interrupts between the DMA IRQs. */
+    dma_machine_create(mu_fail, &inst, &dma, &m);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_writer_create(&writer, &sink, &control));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_create(&trace, writer, inst, flags));
+    machine_run(mu_fail, inst);
+    TEST_ASSERT(!mu_fail);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_release(trace));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+    TEST_ASSERT(8 == j65c02_dma_transfer_count_get(dma));
+    memcpy(page3, m.mem.data() + 0x300, sizeof(page3));
+    irqs = m.mem[0x12];
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_release(dma));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+
+    /* rebuild onto a fresh machine whose device is never read. */
+    dma_machine_create(mu_fail, &inst, &dma, &m);
+    TEST_ASSERT(!mu_fail);
+    m.seed = 0;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_reader_create(&reader, &source, &control_ctx));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_writer_create(&writer, &sink, &rebuilt));
+    TEST_EXPECT(
+        STATUS_SUCCESS
+            == j65c02_trace_rebuild(reader, 0, inst, writer, flags));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+    TEST_EXPECT(j65c02_stopped_flag_get(inst));
+    TEST_EXPECT(0 == m.seed);
+    TEST_EXPECT(8 == j65c02_dma_transfer_count_get(dma));
+    TEST_EXPECT(0 == memcmp(page3, m.mem.data() + 0x300, sizeof(page3)));
+    TEST_EXPECT(irqs == m.mem[0x12]);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_dma_release(dma));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+
+    /* the rebuilt control flow trace matches the live one. */
+    control_ctx = { &control, 0 };
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_reader_create(
+                    &live_reader, &source, &control_ctx));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == j65c02_trace_reader_create(&reader, &source, &rebuilt_ctx));
+
+    while (STATUS_SUCCESS
+                == (retval = j65c02_trace_reader_next(live_reader, &live)))
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS == j65c02_trace_reader_next(reader, &record));
+        TEST_ASSERT(live.type == record.type);
+        TEST_ASSERT(live.position == record.position);
+        TEST_ASSERT(live.cycle_count == record.cycle_count);
+
+        if (JEMU_TRACE_RECORD_READ == live.type)
+        {
+            TEST_ASSERT(live.addr == record.addr);
+            TEST_ASSERT(live.value == record.value);
+        }
+
+        ++count;
+    }
+
+    TEST_EXPECT(JEMU_ERROR_TRACE_END == retval);
+    TEST_EXPECT(
+        JEMU_ERROR_TRACE_END == j65c02_trace_reader_next(reader, &record));
+    TEST_EXPECT(count > 8 * 16);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(live_reader));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+}
+
+/**
+ * Verify that malformed traces are rejected.
+ */
+TEST(bad_stream)
+{
+    j65c02* inst = nullptr;
+    j65c02_trace_writer* writer = nullptr;
+    j65c02_trace* trace = nullptr;
+    j65c02_trace_reader* reader = nullptr;
+    j65c02_trace_record record;
+    std::vector<uint8_t> mem(65536);
+    std::vector<uint8_t> out;
+    std::vector<uint8_t> garbage = { 'J', '6', '5', 'R', 1 };
+    source_context ctx = { &garbage, 0 };
+    status retval;
+
+    /* a trace must start with a trace header. */
+    TEST_EXPECT(
+        JEMU_ERROR_TRACE_BAD_STREAM
+            == j65c02_trace_reader_create(&reader, &source, &ctx));
+
+    /* a trace with no blocks is empty. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_writer_create(&writer, &sink, &out));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+    ctx = { &out, 0 };
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_reader_create(&reader, &source, &ctx));
+    TEST_EXPECT(
+        JEMU_ERROR_TRACE_END == j65c02_trace_reader_next(reader, &record));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+
+    /* a trace cut short within a block is malformed. */
+    mem[0x1000] = 0x80;             /* BRA * */
+    mem[0x1001] = 0xFE;
+    instance_create(mu_fail, &inst, mem.data());
+    TEST_ASSERT(!mu_fail);
+    out.clear();
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_writer_create(&writer, &sink, &out));
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_create(&trace, writer, inst, 0));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_run(inst, 1000));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_release(trace));
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_writer_release(writer));
+
+    out.resize(out.size() - 1);
+    ctx = { &out, 0 };
+    TEST_ASSERT(
+        STATUS_SUCCESS == j65c02_trace_reader_create(&reader, &source, &ctx));
+    while (STATUS_SUCCESS
+                == (retval = j65c02_trace_reader_next(reader, &record)))
+        ;
+    TEST_EXPECT(JEMU_ERROR_TRACE_BAD_STREAM == retval);
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_trace_reader_release(reader));
+
+    TEST_ASSERT(STATUS_SUCCESS == j65c02_release(inst));
+}